@@ -0,0 +1,36 @@
+#!/bin/bash -e
+#This script is invoked to tune SGEMM kernel selection
+#Extra arguments are passed to hcblas-tune, e.g. --cpu to tune the host path
+
+#CURRENT_WORK_DIRECTORY
+CURRENTDIR=$PWD
+export HCBLAS_PATH=$CURRENTDIR/../../
+
+set +e
+mkdir -p $CURRENTDIR/../../build/bench/
+set -e
+cd $CURRENTDIR/../../build/bench/ && cmake -DCMAKE_CXX_FLAGS=-fPIC $HCBLAS_PATH/test/src/
+make hcblas-tune
+cd $CURRENTDIR
+
+#Path to tuner executable
+path2exe="$CURRENTDIR/../../build/bench/bin/hcblas-tune"
+workingdir="$CURRENTDIR"
+
+if [ ! -x $path2exe ]; then
+  echo $path2exe "doesnot exist"
+  exit
+fi
+
+#Tune over every dimension file listed in Input.txt plus the NN/NT/TN sets
+inputs=""
+while read line; do
+  if [ -f "$workingdir/$line" ]; then
+    inputs="$inputs $workingdir/$line"
+  fi
+done < $workingdir/Input.txt
+inputs="$inputs $(ls $workingdir/NN_*.txt $workingdir/NT_*.txt $workingdir/TN_*.txt)"
+
+$path2exe "$@" -o $workingdir/hcblas_gemm_table.txt $inputs
+echo "Selection table written to $workingdir/hcblas_gemm_table.txt"
+echo "Use it with: export HCBLAS_GEMM_TABLE=$workingdir/hcblas_gemm_table.txt"
@@ -96,6 +96,47 @@ typedef hcFloatComplex hcComplex;
 typedef double_2_ hcDoubleComplex;
 typedef hcDoubleComplex hcDoubleComplex;
 
+// 2.2.5. hcblasSideMode_t
+
+// The type indicates whether the triangular or symmetric matrix of a Level-3
+// routine is on the left or right side of the other matrix.
+
+enum hcblasSideMode_t : unsigned short {
+  HCBLAS_SIDE_LEFT,  // The matrix is on the left side in the equation
+  HCBLAS_SIDE_RIGHT  // The matrix is on the right side in the equation
+};
+
+// 2.2.6. hcblasFillMode_t
+
+// The type indicates which part (lower or upper) of a triangular or
+// symmetric matrix is referenced by the function.
+
+enum hcblasFillMode_t : unsigned short {
+  HCBLAS_FILL_MODE_LOWER,  // The lower part of the matrix is filled
+  HCBLAS_FILL_MODE_UPPER   // The upper part of the matrix is filled
+};
+
+// 2.2.7. hcblasDiagType_t
+
+// The type indicates whether the main diagonal of a triangular matrix is
+// unity and consequently should not be touched or modified by the function.
+
+enum hcblasDiagType_t : unsigned short {
+  HCBLAS_DIAG_NON_UNIT,  // The matrix diagonal has non-unit elements
+  HCBLAS_DIAG_UNIT       // The matrix diagonal has unit elements
+};
+
+// 2.2.8. hcblasPointerMode_t
+
+// The type indicates whether the scalars passed by reference (alpha, and
+// the results of the reductions) live in host or in device memory. It is
+// set for a handle with hcblasSetPointerMode().
+
+enum hcblasPointerMode_t : unsigned short {
+  HCBLAS_POINTER_MODE_HOST,   // Scalars are in host memory
+  HCBLAS_POINTER_MODE_DEVICE  // Scalars are in device memory
+};
+
 // hcblas Helper functions
 
 // 1. hcblasCreate()
@@ -232,6 +273,150 @@ hcblasStatus_t hcblasGetMatrix(hcblasHandle_t handle, int rows, int cols,
                                int elemSize, const void *A, int lda, void *B,
                                int ldb);
 
+// 7. hcblasSetGemmAutotune()
+
+// This function turns online tuning of SGEMM on for the handle when budget is
+// positive and off when it is 0. The first calls with each new (transpose, M,
+// N, K, leading dimension) combination then run and time the kernel variants
+// that can handle the shape, after which the fastest one is used for that
+// combination. budget bounds the number of timed calls over the handle's
+// life; combinations met after it is spent keep the default kernel choice.
+// Timed calls wait for their kernel to finish. Turning tuning off or on again
+// discards earlier results.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the tuning mode was set
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      budget < 0
+
+hcblasStatus_t hcblasSetGemmAutotune(hcblasHandle_t handle, int budget);
+
+// 8. hcblasSetTrace()
+
+// This function turns the dispatch trace on (enable != 0) or off for the
+// handle. While it is on, every GEMM call records its shape, the kernel
+// variant that ran, why it was chosen, the launch geometry, the ratio of
+// padded to useful work and the elapsed time in a ring shared by the
+// process. Traced device calls wait for their kernel to finish. Setting
+// HCBLAS_TRACE=<file> turns the trace on for every handle and writes it to
+// <file> at exit.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the trace mode was set
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+
+hcblasStatus_t hcblasSetTrace(hcblasHandle_t handle, int enable);
+
+// 9. hcblasDumpTrace()
+
+// This function writes the events held in the trace ring to path, as JSON
+// when path ends in ".json" and as CSV otherwise. The ring keeps the most
+// recent 65536 calls.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the trace was written
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      path is NULL
+// HCBLAS_STATUS_INTERNAL_ERROR     path could not be written
+
+hcblasStatus_t hcblasDumpTrace(hcblasHandle_t handle, const char *path);
+
+// 10. hcblasGetScratchHighWater()
+
+// This function reports the most scratch memory the handle's routines have
+// held at once, in bytes, on the device (deviceBytes) and on the host
+// (hostBytes). Reductions such as hcblas<t>dot(), hcblas<t>asum() and
+// transposed hcblas<t>gemv() keep their temporary buffers in a pool owned by
+// the handle: buffers are rounded up to a power of two, reused by later
+// calls and released by hcblasDestroy(). Either pointer may be NULL.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the high-water marks were returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+
+hcblasStatus_t hcblasGetScratchHighWater(hcblasHandle_t handle,
+                                         size_t *deviceBytes,
+                                         size_t *hostBytes);
+
+// 11. hcblasSetWorkspace()
+
+// This function hands the handle a device region of bytes bytes at
+// workspace, allocated by the caller on the handle's accelerator. Routines
+// that need temporary device memory (the partial sums and arrival counters
+// of the reductions of hcblas<t>dot(), hcblas<t>asum() and transposed
+// hcblas<t>gemv(), the partial tiles of split-K and stream-K
+// hcblas<t>gemm(), the conjugated and packed copies of the triangular
+// level-3 routines) then carve it from this region instead of allocating it.
+// A call whose temporaries do not fit still runs: it allocates them for that
+// call only, which is slower. The region must stay valid until
+// hcblasSetWorkspace() is called again or the handle is destroyed; passing
+// NULL returns the handle to its own pool. The memory the pool had cached is
+// freed, and any work queued through the handle is waited for before the
+// region changes. Use hcblas<t>gemm_workspaceSize() and
+// hcblas<t>dot_workspaceSize() to size the region.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the workspace was set
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      workspace is not NULL and bytes is 0
+
+hcblasStatus_t hcblasSetWorkspace(hcblasHandle_t handle, void *workspace,
+                                  size_t bytes);
+
+// 12. hcblas<t>gemm_workspaceSize() and hcblas<t>dot_workspaceSize()
+
+// These functions return in bytes the workspace a call of hcblas<t>gemm()
+// with dimensions m, n and k, or of hcblas<t>dot() over n elements, carves
+// on the handle's current stream. The size does not depend on the layout or
+// on the transposes. It is 0 when the call needs no temporaries, and always
+// 0 for handles bound to the CPU. Calls issued one after another can share a
+// region sized for the largest of them; calls made concurrently from several
+// threads need the sum.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the size was returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      a dimension is negative or bytes is NULL
+
+hcblasStatus_t hcblasSgemm_workspaceSize(hcblasHandle_t handle, int m, int n,
+                                         int k, size_t *bytes);
+hcblasStatus_t hcblasDgemm_workspaceSize(hcblasHandle_t handle, int m, int n,
+                                         int k, size_t *bytes);
+hcblasStatus_t hcblasSdot_workspaceSize(hcblasHandle_t handle, int n,
+                                        size_t *bytes);
+hcblasStatus_t hcblasDdot_workspaceSize(hcblasHandle_t handle, int n,
+                                        size_t *bytes);
+
+// 13. hcblasSetPointerMode() and hcblasGetPointerMode()
+
+// This function sets the pointer mode of the handle, HCBLAS_POINTER_MODE_HOST
+// by default. In HCBLAS_POINTER_MODE_DEVICE the result of hcblas<t>dot() and
+// hcblas<t>asum() is written to device memory and the alpha of
+// hcblas<t>scal() and hcblas<t>axpy() is read from device memory, for the
+// real types and their batched forms. These calls then return as soon as
+// their work is queued: the reductions, which always finish on the device,
+// leave their sum there instead of copying it back, so a sequence such as
+// dot, scal, axpy runs without a host round trip. The other routines read
+// their alpha and beta from device memory too, copying them to the host
+// first, so their calls wait for the work queued before them.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the pointer mode was set or returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      mode is NULL (hcblasGetPointerMode())
+
+hcblasStatus_t hcblasSetPointerMode(hcblasHandle_t handle,
+                                    hcblasPointerMode_t mode);
+hcblasStatus_t hcblasGetPointerMode(hcblasHandle_t handle,
+                                    hcblasPointerMode_t *mode);
+
 // HCBLAS Level-1 function reference
 
 // Level-1 Basic Linear Algebra Subprograms (BLAS1) functions perform scalar and
@@ -265,6 +450,10 @@ hcblasStatus_t hcblasGetMatrix(hcblasHandle_t handle, int rows, int cols,
 //                                              elements of x.
 // result       host or device   output         the resulting index, which is
 //                                              0.0 if n,incx<=0.
+//                                              Batched: batchCount values,
+//                                              result[i] for vector i, which
+//                                              starts n * incx elements after
+//                                              vector i - 1.
 // batchCount   host             input          number of pointers contained in
 //                                              input and output arrays.
 
@@ -372,6 +561,10 @@ hcblasStatus_t hcblasDcopyBatched(hcblasHandle_t handle, int n, const double *x,
 //                                              elements of y.
 // result       host or device   output         the resulting dot product, which
 //                                              is 0.0 if n<=0.
+//                                              Batched: batchCount values,
+//                                              result[i] for vectors i, which
+//                                              start n * incx and n * incy
+//                                              elements after vectors i - 1.
 // batchCount   host             input          number of pointers contained in
 //                                              input and output arrays.
 
@@ -789,4 +982,1236 @@ hcblasStatus_t hcblasZgemmBatched(
     const hcDoubleComplex *beta, hcDoubleComplex *Carray[], int ldc,
     int batchCount);
 
+// 3. hcblas<t>trsm()
+
+// This function solves the triangular linear system with multiple right-hand
+// sides
+// op ( A ) X = α B   if  side == HCBLAS_SIDE_LEFT
+// X op ( A ) = α B   if  side == HCBLAS_SIDE_RIGHT
+// where A is a triangular matrix stored in lower or upper mode with or
+// without the main diagonal, X and B are m × n matrices, and α is a scalar.
+// Also, for matrix A
+// op ( A ) = A   if  transa == HCBLAS_OP_N
+//            A^T if  transa == HCBLAS_OP_T
+//            A^H if  transa == HCBLAS_OP_C
+// The solution X overwrites B on exit. Diagonal blocks of A are solved
+// directly and the remaining updates of B run through hcblas<t>gemm().
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// side         host             input          indicates if matrix A is on the
+//                                              left or right of X.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A) that is non- or
+//                                              (conj.) transpose.
+// diag         host             input          indicates if the elements on the
+//                                              main diagonal of matrix A are
+//                                              unity and should not be
+//                                              accessed.
+// m            host             input          number of rows of matrix B, with
+//                                              matrix A sized accordingly.
+// n            host             input          number of columns of matrix B,
+//                                              with matrix A sized
+//                                              accordingly.
+// alpha        host             input          <type> scalar used for
+//                                              multiplication. If alpha==0, A
+//                                              is not referenced and B does
+//                                              not have to be a valid input.
+// A            device           input          <type> array of dimension lda x
+//                                              m with lda>=max(1,m) if
+//                                              side == HCBLAS_SIDE_LEFT and
+//                                              lda x n with lda>=max(1,n)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           in/out         <type> array of dimension ldb x
+//                                              n with ldb>=max(1,m). It is
+//                                              overwritten with X.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrsm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const float *alpha, float *A, int lda, float *B,
+                           int ldb);
+
+hcblasStatus_t hcblasDtrsm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const double *alpha, double *A, int lda, double *B,
+                           int ldb);
+
+hcblasStatus_t hcblasCtrsm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           hcComplex *B, int ldb);
+
+hcblasStatus_t hcblasZtrsm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, hcDoubleComplex *B, int ldb);
+
+// 4. hcblas<t>trsmBatched()
+
+// This function solves an array of triangular linear systems with multiple
+// right-hand sides
+// op ( A [ i ] ) X [ i ] = α B [ i ]   if  side == HCBLAS_SIDE_LEFT
+// X [ i ] op ( A [ i ] ) = α B [ i ]   if  side == HCBLAS_SIDE_RIGHT
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>trsm()
+// applying to every entry. Aarray and Barray are arrays of pointers to
+// matrices stored in column-major format; X [ i ] overwrites B [ i ].
+
+// This function is intended for many small systems: when A [ i ] has at most
+// 64 rows (32 for double complex), every system is solved by a single launch.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x m if side ==
+//                                              HCBLAS_SIDE_LEFT and lda x n
+//                                              otherwise.
+// Barray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n with ldb>=max(1,m).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray and Barray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrsmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const float *alpha, float *Aarray[], int lda,
+                                  float *Barray[], int ldb, int batchCount);
+
+hcblasStatus_t hcblasDtrsmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const double *alpha, double *Aarray[],
+                                  int lda, double *Barray[], int ldb,
+                                  int batchCount);
+
+hcblasStatus_t hcblasCtrsmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, hcComplex *Barray[], int ldb,
+                                  int batchCount);
+
+hcblasStatus_t hcblasZtrsmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  hcDoubleComplex *Barray[], int ldb,
+                                  int batchCount);
+
+// 5. hcblas<t>syrk()
+
+// This function performs the symmetric rank-k update
+// C = α op ( A ) op ( A )^T + β C
+// where α and β are scalars, C is a symmetric matrix stored in lower or upper
+// mode, and A is a matrix with dimensions op(A) n × k. Also, for matrix A
+// op ( A ) = A   if  trans == HCBLAS_OP_N
+//            A^T if  trans == HCBLAS_OP_T
+// Only the uplo triangle of C is computed and written: off-diagonal blocks
+// run through hcblas<t>gemm() and the diagonal blocks through a kernel that
+// skips the other triangle, about half the work of the full product.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix C lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A) that is non- or
+//                                              transpose (HCBLAS_OP_C is
+//                                              taken as HCBLAS_OP_T for the
+//                                              real types and rejected for the
+//                                              complex ones).
+// n            host             input          number of rows of matrix op(A)
+//                                              and C.
+// k            host             input          number of columns of matrix
+//                                              op(A).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or trans is
+//                                 HCBLAS_OP_C for the complex types
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyrk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const float *alpha, float *A, int lda,
+                           const float *beta, float *C, int ldc);
+
+hcblasStatus_t hcblasDsyrk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const double *alpha, double *A, int lda,
+                           const double *beta, double *C, int ldc);
+
+hcblasStatus_t hcblasCsyrk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           const hcComplex *beta, hcComplex *C, int ldc);
+
+hcblasStatus_t hcblasZsyrk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, const hcDoubleComplex *beta,
+                           hcDoubleComplex *C, int ldc);
+
+// 6. hcblas<t>syrkBatched()
+
+// This function performs the symmetric rank-k update for an array of matrices
+// C [ i ] = α op ( A [ i ] ) op ( A [ i ] )^T + β C [ i ]
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>syrk()
+// applying to every entry. Aarray and Carray are arrays of pointers to
+// matrices stored in column-major format. The diagonal blocks of every entry
+// share one launch and each off-diagonal block is one batched GEMM.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if trans ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0 or trans is
+//                                 HCBLAS_OP_C for the complex types
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyrkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const float *alpha, float *Aarray[], int lda,
+                                  const float *beta, float *Carray[], int ldc,
+                                  int batchCount);
+
+hcblasStatus_t hcblasDsyrkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const double *alpha, double *Aarray[],
+                                  int lda, const double *beta, double *Carray[],
+                                  int ldc, int batchCount);
+
+hcblasStatus_t hcblasCsyrkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, const hcComplex *beta,
+                                  hcComplex *Carray[], int ldc, int batchCount);
+
+hcblasStatus_t hcblasZsyrkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  const hcDoubleComplex *beta,
+                                  hcDoubleComplex *Carray[], int ldc,
+                                  int batchCount);
+
+// 7. hcblas<t>herk()
+
+// This function performs the Hermitian rank-k update
+// C = α op ( A ) op ( A )^H + β C
+// where α and β are real scalars, C is a Hermitian matrix stored in lower or
+// upper mode, and A is a matrix with dimensions op(A) n × k. Also, for
+// matrix A
+// op ( A ) = A   if  trans == HCBLAS_OP_N
+//            A^H if  trans == HCBLAS_OP_C
+// Only the uplo triangle of C is computed and written, as in
+// hcblas<t>syrk(); the imaginary parts of the diagonal are set to zero.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix C lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A) that is non- or
+//                                              conj. transpose.
+// n            host             input          number of rows of matrix op(A)
+//                                              and C.
+// k            host             input          number of columns of matrix
+//                                              op(A).
+// alpha        host             input          real scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// beta         host             input          real scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or trans is HCBLAS_OP_T
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasCherk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const float *alpha, hcComplex *A, int lda,
+                           const float *beta, hcComplex *C, int ldc);
+
+hcblasStatus_t hcblasZherk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const double *alpha, hcDoubleComplex *A, int lda,
+                           const double *beta, hcDoubleComplex *C, int ldc);
+
+// 8. hcblas<t>herkBatched()
+
+// This function performs the Hermitian rank-k update for an array of matrices
+// C [ i ] = α op ( A [ i ] ) op ( A [ i ] )^H + β C [ i ]
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>herk()
+// applying to every entry. Aarray and Carray are arrays of pointers to
+// matrices stored in column-major format. The diagonal blocks of every entry
+// share one launch and each off-diagonal block is one batched GEMM.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if trans ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0 or trans is
+//                                 HCBLAS_OP_T
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasCherkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const float *alpha, hcComplex *Aarray[],
+                                  int lda, const float *beta,
+                                  hcComplex *Carray[], int ldc, int batchCount);
+
+hcblasStatus_t hcblasZherkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const double *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  const double *beta, hcDoubleComplex *Carray[],
+                                  int ldc, int batchCount);
+
+// 9. hcblas<t>syr2k()
+
+// This function performs the symmetric rank-2k update
+// C = α ( op ( A ) op ( B )^T + op ( B ) op ( A )^T ) + β C
+// where α and β are scalars, C is a symmetric matrix stored in lower or upper
+// mode, and A and B are matrices with dimensions op(A) and op(B) n × k.
+// Also, for matrices A and B
+// op ( A ) and op ( B ) = A and B     if  trans == HCBLAS_OP_N
+//                         A^T and B^T if  trans == HCBLAS_OP_T
+// Both products are accumulated in one pass over the uplo triangle of C,
+// which is read and written once instead of once per hcblas<t>gemm() call.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix C lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A), op(B) that is
+//                                              non- or transpose (HCBLAS_OP_C
+//                                              is taken as HCBLAS_OP_T for the
+//                                              real types and rejected for the
+//                                              complex ones).
+// n            host             input          number of rows of matrix op(A),
+//                                              op(B) and C.
+// k            host             input          number of columns of matrix
+//                                              op(A) and op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              k with ldb>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and ldb x
+//                                              n with ldb>=max(1,k) otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or trans is
+//                                 HCBLAS_OP_C for the complex types
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyr2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const float *alpha, float *A, int lda, float *B,
+                            int ldb, const float *beta, float *C, int ldc);
+
+hcblasStatus_t hcblasDsyr2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const double *alpha, double *A, int lda, double *B,
+                            int ldb, const double *beta, double *C, int ldc);
+
+hcblasStatus_t hcblasCsyr2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const hcComplex *alpha, hcComplex *A, int lda,
+                            hcComplex *B, int ldb, const hcComplex *beta,
+                            hcComplex *C, int ldc);
+
+hcblasStatus_t hcblasZsyr2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                            int lda, hcDoubleComplex *B, int ldb,
+                            const hcDoubleComplex *beta, hcDoubleComplex *C,
+                            int ldc);
+
+// 10. hcblas<t>syr2kBatched()
+
+// This function performs the symmetric rank-2k update for an array of matrices
+// C [ i ] = α ( op ( A [ i ] ) op ( B [ i ] )^T
+//            + op ( B [ i ] ) op ( A [ i ] )^T ) + β C [ i ]
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>syr2k()
+// applying to every entry. Aarray, Barray and Carray are arrays of pointers
+// to matrices stored in column-major format.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if trans ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x k if trans ==
+//                                              HCBLAS_OP_N and ldb x n
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0 or trans is
+//                                 HCBLAS_OP_C for the complex types
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyr2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const float *alpha, float *Aarray[], int lda,
+                                   float *Barray[], int ldb, const float *beta,
+                                   float *Carray[], int ldc, int batchCount);
+
+hcblasStatus_t hcblasDsyr2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const double *alpha, double *Aarray[],
+                                   int lda, double *Barray[], int ldb,
+                                   const double *beta, double *Carray[],
+                                   int ldc, int batchCount);
+
+hcblasStatus_t hcblasCsyr2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const hcComplex *alpha, hcComplex *Aarray[],
+                                   int lda, hcComplex *Barray[], int ldb,
+                                   const hcComplex *beta, hcComplex *Carray[],
+                                   int ldc, int batchCount);
+
+hcblasStatus_t hcblasZsyr2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const hcDoubleComplex *alpha,
+                                   hcDoubleComplex *Aarray[], int lda,
+                                   hcDoubleComplex *Barray[], int ldb,
+                                   const hcDoubleComplex *beta,
+                                   hcDoubleComplex *Carray[], int ldc,
+                                   int batchCount);
+
+// 11. hcblas<t>her2k()
+
+// This function performs the Hermitian rank-2k update
+// C = α op ( A ) op ( B )^H + conj ( α ) op ( B ) op ( A )^H + β C
+// where α is a complex and β a real scalar, C is a Hermitian matrix stored in
+// lower or upper mode, and A and B are matrices with dimensions op(A) and
+// op(B) n × k. Also, for matrices A and B
+// op ( A ) and op ( B ) = A and B     if  trans == HCBLAS_OP_N
+//                         A^H and B^H if  trans == HCBLAS_OP_C
+// As in hcblas<t>syr2k() only the uplo triangle of C is read and written,
+// once; the imaginary parts of the diagonal are set to zero.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix C lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A), op(B) that is
+//                                              non- or conj. transpose.
+// n            host             input          number of rows of matrix op(A),
+//                                              op(B) and C.
+// k            host             input          number of columns of matrix
+//                                              op(A) and op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              k with ldb>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and ldb x
+//                                              n with ldb>=max(1,k) otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          real scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or trans is HCBLAS_OP_T
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasCher2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const hcComplex *alpha, hcComplex *A, int lda,
+                            hcComplex *B, int ldb, const float *beta,
+                            hcComplex *C, int ldc);
+
+hcblasStatus_t hcblasZher2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                            int lda, hcDoubleComplex *B, int ldb,
+                            const double *beta, hcDoubleComplex *C, int ldc);
+
+// 12. hcblas<t>her2kBatched()
+
+// This function performs the Hermitian rank-2k update for an array of matrices
+// C [ i ] = α op ( A [ i ] ) op ( B [ i ] )^H
+//          + conj ( α ) op ( B [ i ] ) op ( A [ i ] )^H + β C [ i ]
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>her2k()
+// applying to every entry. Aarray, Barray and Carray are arrays of pointers
+// to matrices stored in column-major format.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if trans ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x k if trans ==
+//                                              HCBLAS_OP_N and ldb x n
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0 or trans is
+//                                 HCBLAS_OP_T
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasCher2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const hcComplex *alpha, hcComplex *Aarray[],
+                                   int lda, hcComplex *Barray[], int ldb,
+                                   const float *beta, hcComplex *Carray[],
+                                   int ldc, int batchCount);
+
+hcblasStatus_t hcblasZher2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const hcDoubleComplex *alpha,
+                                   hcDoubleComplex *Aarray[], int lda,
+                                   hcDoubleComplex *Barray[], int ldb,
+                                   const double *beta,
+                                   hcDoubleComplex *Carray[], int ldc,
+                                   int batchCount);
+
+// 13. hcblas<t>symm()
+
+// This function performs the symmetric matrix-matrix multiplication
+// C = α A B + β C   if  side == HCBLAS_SIDE_LEFT
+// C = α B A + β C   if  side == HCBLAS_SIDE_RIGHT
+// where A is a symmetric matrix stored in lower or upper mode, B and C are
+// m × n matrices, and α and β are scalars. Only the uplo triangle of A is
+// read: tiles of the other one are mirrored from it as they are loaded, so
+// the full matrix is never formed.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// side         host             input          indicates if matrix A is on the
+//                                              left or right of B.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// m            host             input          number of rows of matrix C and
+//                                              B, with matrix A sized
+//                                              accordingly.
+// n            host             input          number of columns of matrix C
+//                                              and B, with matrix A sized
+//                                              accordingly.
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              m with lda>=max(1,m) if
+//                                              side == HCBLAS_SIDE_LEFT and
+//                                              lda x n with lda>=max(1,n)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              n with ldb>=max(1,m).
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsymm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const float *alpha, float *A, int lda, float *B,
+                           int ldb, const float *beta, float *C, int ldc);
+
+hcblasStatus_t hcblasDsymm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const double *alpha, double *A, int lda, double *B,
+                           int ldb, const double *beta, double *C, int ldc);
+
+hcblasStatus_t hcblasCsymm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           hcComplex *B, int ldb, const hcComplex *beta,
+                           hcComplex *C, int ldc);
+
+hcblasStatus_t hcblasZsymm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, hcDoubleComplex *B, int ldb,
+                           const hcDoubleComplex *beta, hcDoubleComplex *C,
+                           int ldc);
+
+// 14. hcblas<t>symmBatched()
+
+// This function performs the symmetric matrix-matrix multiplication for an
+// array of matrices
+// C [ i ] = α A [ i ] B [ i ] + β C [ i ]   if  side == HCBLAS_SIDE_LEFT
+// C [ i ] = α B [ i ] A [ i ] + β C [ i ]   if  side == HCBLAS_SIDE_RIGHT
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>symm()
+// applying to every entry. Aarray, Barray and Carray are arrays of pointers
+// to matrices stored in column-major format. The tiles of every entry share
+// one launch.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x m if side ==
+//                                              HCBLAS_SIDE_LEFT and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n with ldb>=max(1,m).
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,m).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsymmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const float *alpha, float *Aarray[], int lda,
+                                  float *Barray[], int ldb, const float *beta,
+                                  float *Carray[], int ldc, int batchCount);
+
+hcblasStatus_t hcblasDsymmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const double *alpha, double *Aarray[],
+                                  int lda, double *Barray[], int ldb,
+                                  const double *beta, double *Carray[], int ldc,
+                                  int batchCount);
+
+hcblasStatus_t hcblasCsymmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, hcComplex *Barray[], int ldb,
+                                  const hcComplex *beta, hcComplex *Carray[],
+                                  int ldc, int batchCount);
+
+hcblasStatus_t hcblasZsymmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  hcDoubleComplex *Barray[], int ldb,
+                                  const hcDoubleComplex *beta,
+                                  hcDoubleComplex *Carray[], int ldc,
+                                  int batchCount);
+
+// 15. hcblas<t>hemm()
+
+// This function performs the Hermitian matrix-matrix multiplication
+// C = α A B + β C   if  side == HCBLAS_SIDE_LEFT
+// C = α B A + β C   if  side == HCBLAS_SIDE_RIGHT
+// where A is a Hermitian matrix stored in lower or upper mode, B and C are
+// m × n matrices, and α and β are scalars. Only the uplo triangle of A is
+// read: tiles of the other one are mirrored from it as they are loaded, so
+// the full matrix is never formed.
+// The imaginary parts of the diagonal of A are assumed to be zero.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// side         host             input          indicates if matrix A is on the
+//                                              left or right of B.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// m            host             input          number of rows of matrix C and
+//                                              B, with matrix A sized
+//                                              accordingly.
+// n            host             input          number of columns of matrix C
+//                                              and B, with matrix A sized
+//                                              accordingly.
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              m with lda>=max(1,m) if
+//                                              side == HCBLAS_SIDE_LEFT and
+//                                              lda x n with lda>=max(1,n)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              n with ldb>=max(1,m).
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasChemm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           hcComplex *B, int ldb, const hcComplex *beta,
+                           hcComplex *C, int ldc);
+
+hcblasStatus_t hcblasZhemm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, hcDoubleComplex *B, int ldb,
+                           const hcDoubleComplex *beta, hcDoubleComplex *C,
+                           int ldc);
+
+// 16. hcblas<t>hemmBatched()
+
+// This function performs the Hermitian matrix-matrix multiplication for an
+// array of matrices
+// C [ i ] = α A [ i ] B [ i ] + β C [ i ]   if  side == HCBLAS_SIDE_LEFT
+// C [ i ] = α B [ i ] A [ i ] + β C [ i ]   if  side == HCBLAS_SIDE_RIGHT
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>hemm()
+// applying to every entry. Aarray, Barray and Carray are arrays of pointers
+// to matrices stored in column-major format. The tiles of every entry share
+// one launch.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x m if side ==
+//                                              HCBLAS_SIDE_LEFT and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n with ldb>=max(1,m).
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,m).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasChemmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, hcComplex *Barray[], int ldb,
+                                  const hcComplex *beta, hcComplex *Carray[],
+                                  int ldc, int batchCount);
+
+hcblasStatus_t hcblasZhemmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  hcDoubleComplex *Barray[], int ldb,
+                                  const hcDoubleComplex *beta,
+                                  hcDoubleComplex *Carray[], int ldc,
+                                  int batchCount);
+
+// 17. hcblas<t>trmm()
+
+// This function performs the triangular matrix-matrix multiplication
+// B = α op ( A ) B   if  side == HCBLAS_SIDE_LEFT
+// B = α B op ( A )   if  side == HCBLAS_SIDE_RIGHT
+// where A is a triangular matrix stored in lower or upper mode with or
+// without the main diagonal, B is an m × n matrix, and α is a scalar.
+// Also, for matrix A
+// op ( A ) = A   if  transa == HCBLAS_OP_N
+//            A^T if  transa == HCBLAS_OP_T
+//            A^H if  transa == HCBLAS_OP_C
+// The product overwrites B on exit, without a second buffer: blocks of B are
+// multiplied by their diagonal blocks of A directly, in an order that leaves
+// the blocks still to be read unchanged, and the rest of each block row of
+// op ( A ) runs through hcblas<t>gemm(). Blocks of A in the other triangle
+// are never read.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// side         host             input          indicates if matrix A is on the
+//                                              left or right of B.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A) that is non- or
+//                                              (conj.) transpose.
+// diag         host             input          indicates if the elements on the
+//                                              main diagonal of matrix A are
+//                                              unity and should not be
+//                                              accessed.
+// m            host             input          number of rows of matrix B, with
+//                                              matrix A sized accordingly.
+// n            host             input          number of columns of matrix B,
+//                                              with matrix A sized
+//                                              accordingly.
+// alpha        host             input          <type> scalar used for
+//                                              multiplication. If alpha==0, A
+//                                              is not referenced and B does
+//                                              not have to be a valid input.
+// A            device           input          <type> array of dimension lda x
+//                                              m with lda>=max(1,m) if
+//                                              side == HCBLAS_SIDE_LEFT and
+//                                              lda x n with lda>=max(1,n)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           in/out         <type> array of dimension ldb x
+//                                              n with ldb>=max(1,m). It is
+//                                              overwritten with the product.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrmm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const float *alpha, float *A, int lda, float *B,
+                           int ldb);
+
+hcblasStatus_t hcblasDtrmm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const double *alpha, double *A, int lda, double *B,
+                           int ldb);
+
+hcblasStatus_t hcblasCtrmm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           hcComplex *B, int ldb);
+
+hcblasStatus_t hcblasZtrmm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, hcDoubleComplex *B, int ldb);
+
+// 18. hcblas<t>trmmBatched()
+
+// This function performs the triangular matrix-matrix multiplication for an
+// array of matrices
+// B [ i ] = α op ( A [ i ] ) B [ i ]   if  side == HCBLAS_SIDE_LEFT
+// B [ i ] = α B [ i ] op ( A [ i ] )   if  side == HCBLAS_SIDE_RIGHT
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>trmm()
+// applying to every entry. Aarray and Barray are arrays of pointers to
+// matrices stored in column-major format; each product overwrites B [ i ].
+
+// This function is intended for many small products: when A [ i ] has at
+// most 64 rows (32 for double complex), every product takes a single launch.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x m if side ==
+//                                              HCBLAS_SIDE_LEFT and lda x n
+//                                              otherwise.
+// Barray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n with ldb>=max(1,m).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray and Barray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrmmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const float *alpha, float *Aarray[], int lda,
+                                  float *Barray[], int ldb, int batchCount);
+
+hcblasStatus_t hcblasDtrmmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const double *alpha, double *Aarray[],
+                                  int lda, double *Barray[], int ldb,
+                                  int batchCount);
+
+hcblasStatus_t hcblasCtrmmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, hcComplex *Barray[], int ldb,
+                                  int batchCount);
+
+hcblasStatus_t hcblasZtrmmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  hcDoubleComplex *Barray[], int ldb,
+                                  int batchCount);
+
+// 19. hcblas<t>gemmt()
+
+// This function performs the matrix-matrix multiplication
+// C = α op ( A ) op ( B ) + β C
+// on the lower or upper triangle of C only, where α and β are scalars, A and
+// B are general matrices with dimensions op(A) n × k and op(B) k × n, and C
+// is an n × n matrix whose other triangle is not referenced. Also, for
+// matrix A
+// op ( A ) = A   if  transa == HCBLAS_OP_N
+//            A^T if  transa == HCBLAS_OP_T
+//            A^H if  transa == HCBLAS_OP_C
+// and op ( B ) is defined similarly for matrix B. Blocks of C outside the
+// uplo triangle are never computed: off-diagonal blocks run through
+// hcblas<t>gemm() and the diagonal blocks through a kernel that skips the
+// other triangle, about half the work of the full product.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if the lower or upper
+//                                              part of matrix C is computed,
+//                                              the other part is not
+//                                              referenced.
+// transa       host             input          operation op(A) that is non- or
+//                                              (conj.) transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              (conj.) transpose.
+// n            host             input          number of rows of matrix op(A),
+//                                              columns of matrix op(B) and
+//                                              rows and columns of C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              transa == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              n with ldb>=max(1,k) if
+//                                              transb == HCBLAS_OP_N and ldb x
+//                                              k with ldb>=max(1,n) otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgemmt(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t transa, hcblasOperation_t transb,
+                            int n, int k, const float *alpha, float *A, int lda,
+                            float *B, int ldb, const float *beta, float *C,
+                            int ldc);
+
+hcblasStatus_t hcblasDgemmt(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t transa, hcblasOperation_t transb,
+                            int n, int k, const double *alpha, double *A,
+                            int lda, double *B, int ldb, const double *beta,
+                            double *C, int ldc);
+
+hcblasStatus_t hcblasCgemmt(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t transa, hcblasOperation_t transb,
+                            int n, int k, const hcComplex *alpha, hcComplex *A,
+                            int lda, hcComplex *B, int ldb,
+                            const hcComplex *beta, hcComplex *C, int ldc);
+
+hcblasStatus_t hcblasZgemmt(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t transa, hcblasOperation_t transb,
+                            int n, int k, const hcDoubleComplex *alpha,
+                            hcDoubleComplex *A, int lda, hcDoubleComplex *B,
+                            int ldb, const hcDoubleComplex *beta,
+                            hcDoubleComplex *C, int ldc);
+
+// 20. hcblas<t>gemmtBatched()
+
+// This function performs the triangular matrix-matrix multiplication for an
+// array of matrices
+// C [ i ] = α op ( A [ i ] ) op ( B [ i ] ) + β C [ i ]
+// on the uplo triangle of each C [ i ], for i  ∈ [ 0 , batchCount − 1 ],
+// with the parameters of hcblas<t>gemmt() applying to every entry. Aarray,
+// Barray and Carray are arrays of pointers to matrices stored in
+// column-major format. The diagonal blocks of every entry share one launch
+// and each off-diagonal block is one batched GEMM.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if transa ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n if transb ==
+//                                              HCBLAS_OP_N and ldb x k
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgemmtBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int n, int k,
+                                   const float *alpha, float *Aarray[], int lda,
+                                   float *Barray[], int ldb, const float *beta,
+                                   float *Carray[], int ldc, int batchCount);
+
+hcblasStatus_t hcblasDgemmtBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int n, int k,
+                                   const double *alpha, double *Aarray[],
+                                   int lda, double *Barray[], int ldb,
+                                   const double *beta, double *Carray[],
+                                   int ldc, int batchCount);
+
+hcblasStatus_t hcblasCgemmtBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int n, int k,
+                                   const hcComplex *alpha, hcComplex *Aarray[],
+                                   int lda, hcComplex *Barray[], int ldb,
+                                   const hcComplex *beta, hcComplex *Carray[],
+                                   int ldc, int batchCount);
+
+hcblasStatus_t hcblasZgemmtBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int n, int k,
+                                   const hcDoubleComplex *alpha,
+                                   hcDoubleComplex *Aarray[], int lda,
+                                   hcDoubleComplex *Barray[], int ldb,
+                                   const hcDoubleComplex *beta,
+                                   hcDoubleComplex *Carray[], int ldc,
+                                   int batchCount);
+
 #endif  // LIB_INCLUDE_HCBLAS_H_
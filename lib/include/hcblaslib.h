@@ -47,8 +47,25 @@ enum hcblasStatus { HCBLAS_SUCCEEDS = 0, HCBLAS_INVALID = -1 };
 enum hcblasOrder : unsigned short { RowMajor, ColMajor };
 
 /* enumerator to define the type of operation to be performed on the input
- matrix ( NO_TRANSPOSE, TRANSPOSE, CONJUGATE) */
-enum hcblasTranspose { NoTrans = 'n', Trans = 't' };
+ matrix ( NO_TRANSPOSE, TRANSPOSE, CONJUGATE). The GEMM routines treat
+ ConjTrans as Trans */
+enum hcblasTranspose { NoTrans = 'n', Trans = 't', ConjTrans = 'c' };
+
+/* enumerator to define on which side a triangular or symmetric matrix
+ multiplies in a Level-3 operation */
+enum hcblasSide { Left = 'l', Right = 'r' };
+
+/* enumerator to define which triangle of a triangular or symmetric matrix is
+ referenced */
+enum hcblasUplo { Upper = 'u', Lower = 'l' };
+
+/* enumerator to define whether a triangular matrix has an implicit unit
+ diagonal */
+enum hcblasDiag { NonUnit = 'n', Unit = 'u' };
+
+/* enumerator to define where scalar arguments and scalar results passed by
+ pointer live */
+enum hcblasPointerMode : unsigned short { HostPointer, DevicePointer };
 
 union SP_FP32 {
   unsigned int u;
@@ -58,6 +75,31 @@ union SP_FP32 {
 bool hisnan(hc::half raw) __HC_FP16_DECL_SUFFIX__;
 int hisinf(hc::half raw) __HC_FP16_DECL_SUFFIX__;
 
+// Loads the GEMM kernel selection table named by HCBLAS_GEMM_TABLE, once per
+// process (src/blas/gemmselect)
+void gemm_selection_init();
+
+// Online GEMM tuner owned by a handle (src/blas/gemmselect/gemm_autotune.h)
+class GemmAutotuner;
+void gemm_autotuner_release(GemmAutotuner *tuner);
+
+// Tuning database of an accelerator, NULL unless HCBLAS_TUNING_DB names a
+// directory (src/blas/tunedb/tuning_db.h). Shared by all handles on it.
+class TuningDb;
+TuningDb *tuning_db_for_accelerator(const hc::accelerator &accl);
+void tuning_db_flush(TuningDb *db);
+
+// Process-wide dispatch trace (src/blas/trace/dispatch_trace.h); returns it
+// when HCBLAS_TRACE is set, NULL otherwise
+class DispatchTrace;
+DispatchTrace *dispatch_trace_from_env();
+
+// Size-class pool of device and host scratch owned by a handle
+// (src/blas/scratch/scratch_pool.h)
+class ScratchPool;
+ScratchPool *scratch_pool_create();
+void scratch_pool_release(ScratchPool *pool);
+
 struct hc_Complex {
   float real;
   float img;
@@ -80,11 +122,29 @@ struct Hcblaslibrary {
     // TODO(Neelakandan): Add another constructor to accommodate row
     // major setting
     this->Order = ColMajor;
+    this->hostExecution = isHostAccelerator(this->currentAccl);
+    this->tuningDb = tuning_db_for_accelerator(this->currentAccl);
+    this->trace = dispatch_trace_from_env();
+    this->scratch = scratch_pool_create();
+    gemm_selection_init();
+  }
+
+  // The handle owns its scratch pool and autotuner, so it is not copied
+  Hcblaslibrary(const Hcblaslibrary &) = delete;
+  Hcblaslibrary &operator=(const Hcblaslibrary &) = delete;
+
+  // True for the CPU accelerator, whose work is routed to the host engines
+  static bool isHostAccelerator(const hc::accelerator &accl) {
+    return accl.get_device_path() == L"cpu";
   }
 
   ~Hcblaslibrary() {
     // Deinitialize the library
     this->initialized = false;
+    gemm_autotuner_release(this->gemmAutotuner);
+    scratch_pool_release(this->scratch);
+    // Choices the autotuner queued go to disk with the handle
+    tuning_db_flush(this->tuningDb);
   }
 
   // Add current Accerator field
@@ -100,6 +160,31 @@ struct Hcblaslibrary {
 
   hcblasOrder Order;
 
+  // Set when the bound accelerator is the CPU. Routines with a host
+  // implementation then run it directly on the (host accessible) pointers
+  bool hostExecution = false;
+
+  // Set by hcblasSetGemmAutotune; SGEMM then tunes its kernel choice per
+  // shape on the first calls instead of only following the rule table
+  GemmAutotuner *gemmAutotuner = NULL;
+
+  // Persistent tuning results of currentAccl: GEMM kernel choices and
+  // routine thresholds. Not owned; lives for the whole process
+  TuningDb *tuningDb = NULL;
+
+  // Set by HCBLAS_TRACE or hcblasSetTrace; GEMM calls are then recorded.
+  // Not owned
+  DispatchTrace *trace = NULL;
+
+  // Temporary buffers of the reductions (partial sums), reused across
+  // calls instead of being allocated by each one
+  ScratchPool *scratch = NULL;
+
+  // Set by hcblasSetPointerMode. With DevicePointer the overloads taking
+  // alpha or the result by pointer read and write device memory, so the
+  // call queues without waiting for the device
+  hcblasPointerMode pointerMode = HostPointer;
+
   /* SAXPY - Y = alpha * X + Y                                    */
   /* SAXPY - Overloaded function with arguments of type hc::array */
 
@@ -117,6 +202,19 @@ struct Hcblaslibrary {
                             const __int64_t xOffset, const __int64_t yOffset,
                             const int batchSize);
 
+  /* SAXPY - Overloaded functions with alpha in memory of pointerMode */
+  hcblasStatus hcblas_saxpy(hc::accelerator_view accl_view, const int N,
+                            const float *alpha, const float *X, const int incX,
+                            float *Y, const int incY, const __int64_t xOffset,
+                            const __int64_t yOffset);
+
+  hcblasStatus hcblas_saxpy(hc::accelerator_view accl_view, const int N,
+                            const float *alpha, const float *X, const int incX,
+                            const __int64_t X_batchOffset, float *Y,
+                            const int incY, const __int64_t Y_batchOffset,
+                            const __int64_t xOffset, const __int64_t yOffset,
+                            const int batchSize);
+
   /* DAXPY - Y = alpha * X + Y                                    */
   /* DAXPY - Overloaded function with arguments of type hc::array */
 
@@ -135,6 +233,20 @@ struct Hcblaslibrary {
                             const __int64_t xOffset, const __int64_t yOffset,
                             const int batchSize);
 
+  /* DAXPY - Overloaded functions with alpha in memory of pointerMode */
+  hcblasStatus hcblas_daxpy(hc::accelerator_view accl_view, const int N,
+                            const double *alpha, const double *X,
+                            const int incX, double *Y, const int incY,
+                            const __int64_t xOffset, const __int64_t yOffset);
+
+  hcblasStatus hcblas_daxpy(hc::accelerator_view accl_view, const int N,
+                            const double *alpha, const double *X,
+                            const int incX, const __int64_t X_batchOffset,
+                            double *Y, const int incY,
+                            const __int64_t Y_batchOffset,
+                            const __int64_t xOffset, const __int64_t yOffset,
+                            const int batchSize);
+
   /* SGER - A = alpha * X * Y' + A                               */
   /* SGER - Overloaded function with arguments of type hc::array */
   hcblasStatus hcblas_sger(hc::accelerator_view accl_view, hcblasOrder order,
@@ -264,6 +376,14 @@ struct Hcblaslibrary {
                             const __int64_t C_batchOffset,
                             const __int64_t aOffset, const __int64_t bOffset,
                             const __int64_t cOffset, const int batchSize);
+
+  /* SGEMM/DGEMM - Device workspace bytes a non-batched call of this shape
+     carves (split-K and stream-K partial tiles); 0 when it needs none */
+  size_t hcblas_sgemm_workspaceSize(hc::accelerator_view accl_view,
+                                    const int M, const int N, const int K);
+  size_t hcblas_dgemm_workspaceSize(hc::accelerator_view accl_view,
+                                    const int M, const int N, const int K);
+
   /* CGEMM - C = alpha * op(A) * op(B) + beta * C                   */
   /* CGEMM - Overloaded function with arguments of type hc::array   */
   hcblasStatus hcblas_cgemm(hc::accelerator_view accl_view, hcblasOrder order,
@@ -314,6 +434,747 @@ struct Hcblaslibrary {
       hc::short_vector::double_2 *C[], const __int64_t cOffset,
       const __int64_t C_batchOffset, const __int64_t ldc, const int batchSize);
 
+  /* STRSM - op(A) * X = alpha * B or X * op(A) = alpha * B, X
+     overwriting B */
+  hcblasStatus hcblas_strsm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const float &alpha, float *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            float *B, const __int64_t bOffset,
+                            const __int64_t ldb);
+
+  /* STRSM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_strsm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const float &alpha, float *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            float *B[], const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const int batchSize);
+
+  /* DTRSM - op(A) * X = alpha * B or X * op(A) = alpha * B, X
+     overwriting B */
+  hcblasStatus hcblas_dtrsm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const double &alpha, double *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            double *B, const __int64_t bOffset,
+                            const __int64_t ldb);
+
+  /* DTRSM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_dtrsm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const double &alpha, double *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            double *B[], const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const int batchSize);
+
+  /* CTRSM - op(A) * X = alpha * B or X * op(A) = alpha * B, X
+     overwriting B */
+  hcblasStatus hcblas_ctrsm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            hc::short_vector::float_2 *B,
+                            const __int64_t bOffset, const __int64_t ldb);
+
+  /* CTRSM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_ctrsm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            hc::short_vector::float_2 *B[],
+                            const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const int batchSize);
+
+  /* ZTRSM - op(A) * X = alpha * B or X * op(A) = alpha * B, X
+     overwriting B */
+  hcblasStatus hcblas_ztrsm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            hc::short_vector::double_2 *B,
+                            const __int64_t bOffset, const __int64_t ldb);
+
+  /* ZTRSM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_ztrsm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            hc::short_vector::double_2 *B[],
+                            const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const int batchSize);
+
+  /* SSYRK - C = alpha * op(A) * op(A)^T + beta * C on one triangle */
+  hcblasStatus hcblas_ssyrk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const float &alpha, float *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            const float &beta, float *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* SSYRK - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_ssyrk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const float &alpha, float *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            const float &beta, float *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* DSYRK - C = alpha * op(A) * op(A)^T + beta * C on one triangle */
+  hcblasStatus hcblas_dsyrk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const double &alpha, double *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            const double &beta, double *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* DSYRK - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_dsyrk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const double &alpha, double *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            const double &beta, double *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* CSYRK - C = alpha * op(A) * op(A)^T + beta * C on one triangle */
+  hcblasStatus hcblas_csyrk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            const hc::short_vector::float_2 &beta,
+                            hc::short_vector::float_2 *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* CSYRK - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_csyrk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            const hc::short_vector::float_2 &beta,
+                            hc::short_vector::float_2 *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* ZSYRK - C = alpha * op(A) * op(A)^T + beta * C on one triangle */
+  hcblasStatus hcblas_zsyrk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            const hc::short_vector::double_2 &beta,
+                            hc::short_vector::double_2 *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* ZSYRK - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_zsyrk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            const hc::short_vector::double_2 &beta,
+                            hc::short_vector::double_2 *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* CHERK - C = alpha * op(A) * op(A)^H + beta * C on one triangle */
+  hcblasStatus hcblas_cherk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const float &alpha,
+                            hc::short_vector::float_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            const float &beta, hc::short_vector::float_2 *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* CHERK - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_cherk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const float &alpha,
+                            hc::short_vector::float_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            const float &beta, hc::short_vector::float_2 *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* ZHERK - C = alpha * op(A) * op(A)^H + beta * C on one triangle */
+  hcblasStatus hcblas_zherk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const double &alpha,
+                            hc::short_vector::double_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            const double &beta, hc::short_vector::double_2 *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* ZHERK - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_zherk(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasUplo uplo, hcblasTranspose typeA, const int N,
+                            const int K, const double &alpha,
+                            hc::short_vector::double_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            const double &beta, hc::short_vector::double_2 *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* SSYR2K - C = alpha * (op(A) * op(B)^T + op(B) * op(A)^T) + beta * C */
+  hcblasStatus hcblas_ssyr2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K, const float &alpha,
+                             float *A, const __int64_t aOffset,
+                             const __int64_t lda, float *B,
+                             const __int64_t bOffset, const __int64_t ldb,
+                             const float &beta, float *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* SSYR2K - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_ssyr2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K, const float &alpha,
+                             float *A[], const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             float *B[], const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const float &beta, float *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
+  /* DSYR2K - C = alpha * (op(A) * op(B)^T + op(B) * op(A)^T) + beta * C */
+  hcblasStatus hcblas_dsyr2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K, const double &alpha,
+                             double *A, const __int64_t aOffset,
+                             const __int64_t lda, double *B,
+                             const __int64_t bOffset, const __int64_t ldb,
+                             const double &beta, double *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* DSYR2K - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_dsyr2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K, const double &alpha,
+                             double *A[], const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             double *B[], const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const double &beta, double *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
+  /* CSYR2K - C = alpha * (op(A) * op(B)^T + op(B) * op(A)^T) + beta * C */
+  hcblasStatus hcblas_csyr2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K,
+                             const hc::short_vector::float_2 &alpha,
+                             hc::short_vector::float_2 *A,
+                             const __int64_t aOffset, const __int64_t lda,
+                             hc::short_vector::float_2 *B,
+                             const __int64_t bOffset, const __int64_t ldb,
+                             const hc::short_vector::float_2 &beta,
+                             hc::short_vector::float_2 *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* CSYR2K - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_csyr2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K,
+                             const hc::short_vector::float_2 &alpha,
+                             hc::short_vector::float_2 *A[],
+                             const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             hc::short_vector::float_2 *B[],
+                             const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const hc::short_vector::float_2 &beta,
+                             hc::short_vector::float_2 *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
+  /* ZSYR2K - C = alpha * (op(A) * op(B)^T + op(B) * op(A)^T) + beta * C */
+  hcblasStatus hcblas_zsyr2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K,
+                             const hc::short_vector::double_2 &alpha,
+                             hc::short_vector::double_2 *A,
+                             const __int64_t aOffset, const __int64_t lda,
+                             hc::short_vector::double_2 *B,
+                             const __int64_t bOffset, const __int64_t ldb,
+                             const hc::short_vector::double_2 &beta,
+                             hc::short_vector::double_2 *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* ZSYR2K - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_zsyr2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K,
+                             const hc::short_vector::double_2 &alpha,
+                             hc::short_vector::double_2 *A[],
+                             const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             hc::short_vector::double_2 *B[],
+                             const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const hc::short_vector::double_2 &beta,
+                             hc::short_vector::double_2 *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
+  /* CHER2K - C = alpha * op(A) * op(B)^H + conj(alpha) * op(B) * op(A)^H +
+     beta * C on one triangle */
+  hcblasStatus hcblas_cher2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K,
+                             const hc::short_vector::float_2 &alpha,
+                             hc::short_vector::float_2 *A,
+                             const __int64_t aOffset, const __int64_t lda,
+                             hc::short_vector::float_2 *B,
+                             const __int64_t bOffset, const __int64_t ldb,
+                             const float &beta, hc::short_vector::float_2 *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* CHER2K - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_cher2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K,
+                             const hc::short_vector::float_2 &alpha,
+                             hc::short_vector::float_2 *A[],
+                             const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             hc::short_vector::float_2 *B[],
+                             const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const float &beta, hc::short_vector::float_2 *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
+  /* ZHER2K - C = alpha * op(A) * op(B)^H + conj(alpha) * op(B) * op(A)^H +
+     beta * C on one triangle */
+  hcblasStatus hcblas_zher2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K,
+                             const hc::short_vector::double_2 &alpha,
+                             hc::short_vector::double_2 *A,
+                             const __int64_t aOffset, const __int64_t lda,
+                             hc::short_vector::double_2 *B,
+                             const __int64_t bOffset, const __int64_t ldb,
+                             const double &beta, hc::short_vector::double_2 *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* ZHER2K - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_zher2k(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             const int N, const int K,
+                             const hc::short_vector::double_2 &alpha,
+                             hc::short_vector::double_2 *A[],
+                             const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             hc::short_vector::double_2 *B[],
+                             const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const double &beta,
+                             hc::short_vector::double_2 *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
+  /* SSYMM - C = alpha * A * B + beta * C, symmetric A on either side */
+  hcblasStatus hcblas_ssymm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N, const float &alpha, float *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            float *B, const __int64_t bOffset,
+                            const __int64_t ldb, const float &beta, float *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* SSYMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_ssymm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N, const float &alpha, float *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            float *B[], const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const float &beta, float *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* DSYMM - C = alpha * A * B + beta * C, symmetric A on either side */
+  hcblasStatus hcblas_dsymm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N, const double &alpha, double *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            double *B, const __int64_t bOffset,
+                            const __int64_t ldb, const double &beta, double *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* DSYMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_dsymm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N, const double &alpha, double *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            double *B[], const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const double &beta, double *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* CSYMM - C = alpha * A * B + beta * C, symmetric A on either side */
+  hcblasStatus hcblas_csymm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            hc::short_vector::float_2 *B,
+                            const __int64_t bOffset, const __int64_t ldb,
+                            const hc::short_vector::float_2 &beta,
+                            hc::short_vector::float_2 *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* CSYMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_csymm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            hc::short_vector::float_2 *B[],
+                            const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const hc::short_vector::float_2 &beta,
+                            hc::short_vector::float_2 *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* ZSYMM - C = alpha * A * B + beta * C, symmetric A on either side */
+  hcblasStatus hcblas_zsymm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            hc::short_vector::double_2 *B,
+                            const __int64_t bOffset, const __int64_t ldb,
+                            const hc::short_vector::double_2 &beta,
+                            hc::short_vector::double_2 *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* ZSYMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_zsymm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            hc::short_vector::double_2 *B[],
+                            const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const hc::short_vector::double_2 &beta,
+                            hc::short_vector::double_2 *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* CHEMM - C = alpha * A * B + beta * C, Hermitian A on either side */
+  hcblasStatus hcblas_chemm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            hc::short_vector::float_2 *B,
+                            const __int64_t bOffset, const __int64_t ldb,
+                            const hc::short_vector::float_2 &beta,
+                            hc::short_vector::float_2 *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* CHEMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_chemm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            hc::short_vector::float_2 *B[],
+                            const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const hc::short_vector::float_2 &beta,
+                            hc::short_vector::float_2 *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* ZHEMM - C = alpha * A * B + beta * C, Hermitian A on either side */
+  hcblasStatus hcblas_zhemm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            hc::short_vector::double_2 *B,
+                            const __int64_t bOffset, const __int64_t ldb,
+                            const hc::short_vector::double_2 &beta,
+                            hc::short_vector::double_2 *C,
+                            const __int64_t cOffset, const __int64_t ldc);
+
+  /* ZHEMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_zhemm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo, const int M,
+                            const int N,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            hc::short_vector::double_2 *B[],
+                            const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const hc::short_vector::double_2 &beta,
+                            hc::short_vector::double_2 *C[],
+                            const __int64_t cOffset,
+                            const __int64_t C_batchOffset, const __int64_t ldc,
+                            const int batchSize);
+
+  /* STRMM - B = alpha * op(A) * B or B = alpha * B * op(A) */
+  hcblasStatus hcblas_strmm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const float &alpha, float *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            float *B, const __int64_t bOffset,
+                            const __int64_t ldb);
+
+  /* STRMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_strmm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const float &alpha, float *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            float *B[], const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const int batchSize);
+
+  /* DTRMM - B = alpha * op(A) * B or B = alpha * B * op(A) */
+  hcblasStatus hcblas_dtrmm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const double &alpha, double *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            double *B, const __int64_t bOffset,
+                            const __int64_t ldb);
+
+  /* DTRMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_dtrmm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const double &alpha, double *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            double *B[], const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const int batchSize);
+
+  /* CTRMM - B = alpha * op(A) * B or B = alpha * B * op(A) */
+  hcblasStatus hcblas_ctrmm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            hc::short_vector::float_2 *B,
+                            const __int64_t bOffset, const __int64_t ldb);
+
+  /* CTRMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_ctrmm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N, const hc::short_vector::float_2 &alpha,
+                            hc::short_vector::float_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            hc::short_vector::float_2 *B[],
+                            const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const int batchSize);
+
+  /* ZTRMM - B = alpha * op(A) * B or B = alpha * B * op(A) */
+  hcblasStatus hcblas_ztrmm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A,
+                            const __int64_t aOffset, const __int64_t lda,
+                            hc::short_vector::double_2 *B,
+                            const __int64_t bOffset, const __int64_t ldb);
+
+  /* ZTRMM - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_ztrmm(hc::accelerator_view accl_view, hcblasOrder order,
+                            hcblasSide side, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasDiag diag, const int M,
+                            const int N,
+                            const hc::short_vector::double_2 &alpha,
+                            hc::short_vector::double_2 *A[],
+                            const __int64_t aOffset,
+                            const __int64_t A_batchOffset, const __int64_t lda,
+                            hc::short_vector::double_2 *B[],
+                            const __int64_t bOffset,
+                            const __int64_t B_batchOffset, const __int64_t ldb,
+                            const int batchSize);
+
+  /* SGEMMT - C = alpha * op(A) * op(B) + beta * C on one triangle */
+  hcblasStatus hcblas_sgemmt(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             hcblasTranspose typeB, const int N, const int K,
+                             const float &alpha, float *A,
+                             const __int64_t aOffset, const __int64_t lda,
+                             float *B, const __int64_t bOffset,
+                             const __int64_t ldb, const float &beta, float *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* SGEMMT - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_sgemmt(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             hcblasTranspose typeB, const int N, const int K,
+                             const float &alpha, float *A[],
+                             const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             float *B[], const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const float &beta, float *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
+  /* DGEMMT - C = alpha * op(A) * op(B) + beta * C on one triangle */
+  hcblasStatus hcblas_dgemmt(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             hcblasTranspose typeB, const int N, const int K,
+                             const double &alpha, double *A,
+                             const __int64_t aOffset, const __int64_t lda,
+                             double *B, const __int64_t bOffset,
+                             const __int64_t ldb, const double &beta, double *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* DGEMMT - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_dgemmt(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             hcblasTranspose typeB, const int N, const int K,
+                             const double &alpha, double *A[],
+                             const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             double *B[], const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const double &beta, double *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
+  /* CGEMMT - C = alpha * op(A) * op(B) + beta * C on one triangle */
+  hcblasStatus hcblas_cgemmt(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             hcblasTranspose typeB, const int N, const int K,
+                             const hc::short_vector::float_2 &alpha,
+                             hc::short_vector::float_2 *A,
+                             const __int64_t aOffset, const __int64_t lda,
+                             hc::short_vector::float_2 *B,
+                             const __int64_t bOffset, const __int64_t ldb,
+                             const hc::short_vector::float_2 &beta,
+                             hc::short_vector::float_2 *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* CGEMMT - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_cgemmt(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             hcblasTranspose typeB, const int N, const int K,
+                             const hc::short_vector::float_2 &alpha,
+                             hc::short_vector::float_2 *A[],
+                             const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             hc::short_vector::float_2 *B[],
+                             const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const hc::short_vector::float_2 &beta,
+                             hc::short_vector::float_2 *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
+  /* ZGEMMT - C = alpha * op(A) * op(B) + beta * C on one triangle */
+  hcblasStatus hcblas_zgemmt(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             hcblasTranspose typeB, const int N, const int K,
+                             const hc::short_vector::double_2 &alpha,
+                             hc::short_vector::double_2 *A,
+                             const __int64_t aOffset, const __int64_t lda,
+                             hc::short_vector::double_2 *B,
+                             const __int64_t bOffset, const __int64_t ldb,
+                             const hc::short_vector::double_2 &beta,
+                             hc::short_vector::double_2 *C,
+                             const __int64_t cOffset, const __int64_t ldc);
+
+  /* ZGEMMT - Overloaded function with arguments related to batch processing */
+  hcblasStatus hcblas_zgemmt(hc::accelerator_view accl_view, hcblasOrder order,
+                             hcblasUplo uplo, hcblasTranspose typeA,
+                             hcblasTranspose typeB, const int N, const int K,
+                             const hc::short_vector::double_2 &alpha,
+                             hc::short_vector::double_2 *A[],
+                             const __int64_t aOffset,
+                             const __int64_t A_batchOffset, const __int64_t lda,
+                             hc::short_vector::double_2 *B[],
+                             const __int64_t bOffset,
+                             const __int64_t B_batchOffset, const __int64_t ldb,
+                             const hc::short_vector::double_2 &beta,
+                             hc::short_vector::double_2 *C[],
+                             const __int64_t cOffset,
+                             const __int64_t C_batchOffset, const __int64_t ldc,
+                             const int batchSize);
+
   /* SSCAL - X = alpha * X */
   /* SSCAL - Overloaded function with arguments of type hc::array */
   hcblasStatus hcblas_sscal(hc::accelerator_view accl_view, const int N,
@@ -326,6 +1187,16 @@ struct Hcblaslibrary {
                             const __int64_t xOffset,
                             const __int64_t X_batchOffset, const int batchSize);
 
+  /* SSCAL - Overloaded functions with alpha in memory of pointerMode */
+  hcblasStatus hcblas_sscal(hc::accelerator_view accl_view, const int N,
+                            const float *alpha, float *X, const int incX,
+                            const __int64_t xOffset);
+
+  hcblasStatus hcblas_sscal(hc::accelerator_view accl_view, const int N,
+                            const float *alpha, float *X, const int incX,
+                            const __int64_t xOffset,
+                            const __int64_t X_batchOffset, const int batchSize);
+
   /* DSCAL - X = alpha * X */
   /* DSCAL - Overloaded function with arguments of type hc::array */
   hcblasStatus hcblas_dscal(hc::accelerator_view accl_view, const int N,
@@ -338,6 +1209,16 @@ struct Hcblaslibrary {
                             const __int64_t xOffset,
                             const __int64_t X_batchOffset, const int batchSize);
 
+  /* DSCAL - Overloaded functions with alpha in memory of pointerMode */
+  hcblasStatus hcblas_dscal(hc::accelerator_view accl_view, const int N,
+                            const double *alpha, double *X, const int incX,
+                            const __int64_t xOffset);
+
+  hcblasStatus hcblas_dscal(hc::accelerator_view accl_view, const int N,
+                            const double *alpha, double *X, const int incX,
+                            const __int64_t xOffset,
+                            const __int64_t X_batchOffset, const int batchSize);
+
   /* CSCAL - X = alpha * X */
   /* CSCAL - Overloaded function with arguments of type hc::array */
   hcblasStatus hcblas_cscal(hc::accelerator_view accl_view, const int N,
@@ -429,7 +1310,9 @@ struct Hcblaslibrary {
                            const __int64_t xOffset, const float *Y,
                            const int incY, const __int64_t yOffset, float &dot);
 
-  /* SDOT - Overloaded function with arguments related to batch processing */
+  /* SDOT - Overloaded function with arguments related to batch processing;
+     dot is a single total over all batchSize entries, the sum of the
+     per-entry results of hcblas_sdot_batched and hcblasSdotBatched */
   hcblasStatus hcblas_sdot(hc::accelerator_view accl_view, const int N,
                            const float *X, const int incX,
                            const __int64_t xOffset, const float *Y,
@@ -437,6 +1320,37 @@ struct Hcblaslibrary {
                            const __int64_t X_batchOffset,
                            const __int64_t Y_batchOffset, const int batchSize);
 
+  /* SDOT - Overloaded functions with the result in memory of pointerMode;
+     the batch form stores the single total, as above */
+  hcblasStatus hcblas_sdot(hc::accelerator_view accl_view, const int N,
+                           const float *X, const int incX,
+                           const __int64_t xOffset, const float *Y,
+                           const int incY, const __int64_t yOffset, float *dot);
+
+  hcblasStatus hcblas_sdot(hc::accelerator_view accl_view, const int N,
+                           const float *X, const int incX,
+                           const __int64_t xOffset, const float *Y,
+                           const int incY, const __int64_t yOffset, float *dot,
+                           const __int64_t X_batchOffset,
+                           const __int64_t Y_batchOffset, const int batchSize);
+
+  /* SDOT - Batched forms with one result per entry, dot[0 .. batchSize - 1]
+     in memory of pointerMode; strided batches or arrays of vectors */
+  hcblasStatus hcblas_sdot_batched(hc::accelerator_view accl_view,
+                                   const int N, const float *X, const int incX,
+                                   const __int64_t xOffset, const float *Y,
+                                   const int incY, const __int64_t yOffset,
+                                   float *dot, const __int64_t X_batchOffset,
+                                   const __int64_t Y_batchOffset,
+                                   const int batchSize);
+
+  hcblasStatus hcblas_sdot_batched(hc::accelerator_view accl_view,
+                                   const int N, const float *const X[],
+                                   const int incX, const __int64_t xOffset,
+                                   const float *const Y[], const int incY,
+                                   const __int64_t yOffset, float *dot,
+                                   const int batchSize);
+
   /* DDOT - Double Precision Dot product */
   /* DDOT - Overloaded function with arguments of type hc::array */
   hcblasStatus hcblas_ddot(hc::accelerator_view accl_view, const int N,
@@ -445,7 +1359,9 @@ struct Hcblaslibrary {
                            const int incY, const __int64_t yOffset,
                            double &dot);
 
-  /* DDOT - Overloaded function with arguments related to batch processing */
+  /* DDOT - Overloaded function with arguments related to batch processing;
+     dot is a single total over all batchSize entries, the sum of the
+     per-entry results of hcblas_ddot_batched and hcblasDdotBatched */
   hcblasStatus hcblas_ddot(hc::accelerator_view accl_view, const int N,
                            const double *X, const int incX,
                            const __int64_t xOffset, const double *Y,
@@ -453,29 +1369,100 @@ struct Hcblaslibrary {
                            const __int64_t X_batchOffset,
                            const __int64_t Y_batchOffset, const int batchSize);
 
+  /* DDOT - Overloaded functions with the result in memory of pointerMode;
+     the batch form stores the single total, as above */
+  hcblasStatus hcblas_ddot(hc::accelerator_view accl_view, const int N,
+                           const double *X, const int incX,
+                           const __int64_t xOffset, const double *Y,
+                           const int incY, const __int64_t yOffset,
+                           double *dot);
+
+  hcblasStatus hcblas_ddot(hc::accelerator_view accl_view, const int N,
+                           const double *X, const int incX,
+                           const __int64_t xOffset, const double *Y,
+                           const int incY, const __int64_t yOffset, double *dot,
+                           const __int64_t X_batchOffset,
+                           const __int64_t Y_batchOffset, const int batchSize);
+
+  /* DDOT - Batched forms with one result per entry, dot[0 .. batchSize - 1]
+     in memory of pointerMode; strided batches or arrays of vectors */
+  hcblasStatus hcblas_ddot_batched(hc::accelerator_view accl_view,
+                                   const int N, const double *X, const int incX,
+                                   const __int64_t xOffset, const double *Y,
+                                   const int incY, const __int64_t yOffset,
+                                   double *dot, const __int64_t X_batchOffset,
+                                   const __int64_t Y_batchOffset,
+                                   const int batchSize);
+
+  hcblasStatus hcblas_ddot_batched(hc::accelerator_view accl_view,
+                                   const int N, const double *const X[],
+                                   const int incX, const __int64_t xOffset,
+                                   const double *const Y[], const int incY,
+                                   const __int64_t yOffset, double *dot,
+                                   const int batchSize);
+
+  /* SDOT/DDOT - Device workspace bytes a non-batched call carves
+     (work-group partial sums, the sum and the arrival counter) */
+  size_t hcblas_sdot_workspaceSize(hc::accelerator_view accl_view,
+                                   const int N);
+  size_t hcblas_ddot_workspaceSize(hc::accelerator_view accl_view,
+                                   const int N);
+
   /* SASUM - Absolute value of a Vector - Single Precision */
-  /* SASUM - Overloaded function with arguments of type hc::array */
+  /* SASUM - Overloaded function with arguments of type hc::array; the
+     result Y is in memory of pointerMode */
   hcblasStatus hcblas_sasum(hc::accelerator_view accl_view, const int N,
                             float *X, const int incX, const __int64_t xOffset,
                             float *Y);
 
-  /* SASUM - Overloaded function with arguments related to batch processing */
+  /* SASUM - Overloaded function with arguments related to batch processing;
+     Y is a single total over all batchSize entries, the sum of the
+     per-entry results of hcblas_sasum_batched and hcblasSasumBatched */
   hcblasStatus hcblas_sasum(hc::accelerator_view accl_view, const int N,
                             float *X, const int incX, const __int64_t xOffset,
                             float *Y, const __int64_t X_batchOffset,
                             const int batchSize);
 
+  /* SASUM - Batched forms with one result per entry, Y[0 .. batchSize - 1]
+     in memory of pointerMode; strided batches or arrays of vectors */
+  hcblasStatus hcblas_sasum_batched(hc::accelerator_view accl_view,
+                                    const int N, const float *X, const int incX,
+                                    const __int64_t xOffset, float *Y,
+                                    const __int64_t X_batchOffset,
+                                    const int batchSize);
+
+  hcblasStatus hcblas_sasum_batched(hc::accelerator_view accl_view,
+                                    const int N, const float *const X[],
+                                    const int incX, const __int64_t xOffset,
+                                    float *Y, const int batchSize);
+
   /* DASUM - Absolute value of a Vector - Double Precision */
-  /* DASUM - Overloaded function with arguments of type hc::array */
+  /* DASUM - Overloaded function with arguments of type hc::array; the
+     result Y is in memory of pointerMode */
   hcblasStatus hcblas_dasum(hc::accelerator_view accl_view, const int N,
                             double *X, const int incX, const __int64_t xOffset,
                             double *Y);
 
-  /* DASUM - Overloaded function with arguments related to batch processing */
+  /* DASUM - Overloaded function with arguments related to batch processing;
+     Y is a single total over all batchSize entries, the sum of the
+     per-entry results of hcblas_dasum_batched and hcblasDasumBatched */
   hcblasStatus hcblas_dasum(hc::accelerator_view accl_view, const int N,
                             double *X, const int incX, const __int64_t xOffset,
                             double *Y, const __int64_t X_batchOffset,
                             const int batchSize);
+
+  /* DASUM - Batched forms with one result per entry, Y[0 .. batchSize - 1]
+     in memory of pointerMode; strided batches or arrays of vectors */
+  hcblasStatus hcblas_dasum_batched(hc::accelerator_view accl_view,
+                                    const int N, const double *X,
+                                    const int incX, const __int64_t xOffset,
+                                    double *Y, const __int64_t X_batchOffset,
+                                    const int batchSize);
+
+  hcblasStatus hcblas_dasum_batched(hc::accelerator_view accl_view,
+                                    const int N, const double *const X[],
+                                    const int incX, const __int64_t xOffset,
+                                    double *Y, const int batchSize);
 };
 
 #endif  // LIB_INCLUDE_HCBLASLIB_H_
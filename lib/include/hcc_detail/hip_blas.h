@@ -70,6 +70,8 @@ hipblasStatus_t hipblasSasum(hipblasHandle_t handle, int n, const float *x,
 hipblasStatus_t hipblasDasum(hipblasHandle_t handle, int n, const double *x,
                              int incx, double *result);
 
+// Batched asum/dot: batchCount vectors n elements apart, result holds
+// batchCount values, result[i] for vector i
 hipblasStatus_t hipblasSasumBatched(hipblasHandle_t handle, int n, float *x,
                                     int incx, float *result, int batchCount);
 
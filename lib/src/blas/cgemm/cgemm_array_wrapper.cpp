@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "./cgemm_array_kernels.h"
+#include "src/blas/host/hcblas_host.h"
 
 hcblasStatus cgemm_alpha0_col(hc::accelerator_view accl_view,
                               hc::short_vector::float_2 *A, __int64_t aOffset,
@@ -224,6 +225,23 @@ hcblasStatus Hcblaslibrary::hcblas_cgemm(
     return HCBLAS_INVALID;
   }
 
+  // CPU accelerator: interleaved complex host engine
+  if (hostExecution) {
+    typedef HostComplexFloat Cplx;
+    if (!host_gemm_tuned<Cplx>(NULL, tuningDb, trace, order == ColMajor,
+                               typeA == Trans, typeB == Trans, M, N, K,
+                               Cplx(Calpha.x, Calpha.y),
+                               reinterpret_cast<const Cplx *>(Acmplx + aOffset),
+                               lda,
+                               reinterpret_cast<const Cplx *>(Bcmplx + bOffset),
+                               ldb, Cplx(Cbeta.x, Cbeta.y),
+                               reinterpret_cast<Cplx *>(Ccmplx + cOffset),
+                               ldc)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   if (!Calpha.x && !Calpha.y) {
     if (order)
       status =
@@ -302,6 +320,24 @@ hcblasStatus Hcblaslibrary::hcblas_cgemm(
     return HCBLAS_INVALID;
   }
 
+  // The batched complex kernels address X[elt] + xOffset and ignore the
+  // batch offsets, so the host path does the same
+  if (hostExecution) {
+    typedef HostComplexFloat Cplx;
+    if (!host_gemm_batched<Cplx>(order == ColMajor, typeA == Trans,
+                                 typeB == Trans, M, N, K,
+                                 Cplx(Calpha.x, Calpha.y),
+                                 reinterpret_cast<Cplx *const *>(Acmplx),
+                                 aOffset, 0, lda,
+                                 reinterpret_cast<Cplx *const *>(Bcmplx),
+                                 bOffset, 0, ldb, Cplx(Cbeta.x, Cbeta.y),
+                                 reinterpret_cast<Cplx *const *>(Ccmplx),
+                                 cOffset, 0, ldc, batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   if (!Calpha.x && !Calpha.y) {
     if (order)
       status = cgemm_alpha0_colbatch(accl_view, Acmplx, aOffset, A_batchOffset,
@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
@@ -91,6 +92,14 @@ hcblasStatus Hcblaslibrary::hcblas_cscal(hc::accelerator_view accl_view,
   if (X == NULL || N <= 0 || incX <= 0) {
     return HCBLAS_INVALID;
   }
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    typedef HostComplexFloat Cplx;
+    host_scal<Cplx>(N, Cplx(alpha.x, alpha.y),
+                    reinterpret_cast<Cplx *>(X + xOffset), incX);
+    return HCBLAS_SUCCEEDS;
+  }
+
   cscal_HC(accl_view, N, alpha, X, incX, xOffset);
   return HCBLAS_SUCCEEDS;
 }
@@ -106,6 +115,15 @@ hcblasStatus Hcblaslibrary::hcblas_cscal(
   if (X == NULL || N <= 0 || incX <= 0) {
     return HCBLAS_INVALID;
   }
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    typedef HostComplexFloat Cplx;
+    host_scal_batched<Cplx>(N, Cplx(alpha.x, alpha.y),
+                            reinterpret_cast<Cplx *>(X + xOffset), incX,
+                            X_batchOffset, batchSize);
+    return HCBLAS_SUCCEEDS;
+  }
+
   cscal_HC(accl_view, N, alpha, X, incX, xOffset, X_batchOffset, batchSize);
   return HCBLAS_SUCCEEDS;
 }
@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
@@ -89,6 +90,13 @@ hcblasStatus Hcblaslibrary::hcblas_csscal(hc::accelerator_view accl_view,
   if (X == NULL || N <= 0 || incX <= 0) {
     return HCBLAS_INVALID;
   }
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    HostComplexFloat *x = reinterpret_cast<HostComplexFloat *>(X + xOffset);
+    host_scal_real<float>(N, alpha, x, incX);
+    return HCBLAS_SUCCEEDS;
+  }
+
   csscal_HC(accl_view, N, alpha, X, incX, xOffset);
   return HCBLAS_SUCCEEDS;
 }
@@ -103,6 +111,14 @@ hcblasStatus Hcblaslibrary::hcblas_csscal(
   if (X == NULL || N <= 0 || incX <= 0) {
     return HCBLAS_INVALID;
   }
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    HostComplexFloat *x = reinterpret_cast<HostComplexFloat *>(X + xOffset);
+    host_scal_real_batched<float>(N, alpha, x, incX, X_batchOffset,
+                                  batchSize);
+    return HCBLAS_SUCCEEDS;
+  }
+
   csscal_HC(accl_view, N, alpha, X, incX, xOffset, X_batchOffset, batchSize);
   return HCBLAS_SUCCEEDS;
 }
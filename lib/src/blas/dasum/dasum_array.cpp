@@ -21,242 +21,43 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/reduce/reduce_engine.h"
+#include "src/blas/scratch/scratch_pool.h"
 #include <hc.hpp>
 #include <hc_am.hpp>
 #include <hc_math.hpp>
 
-#define TILE_SIZE 256
-
-void dasum_HC(hc::accelerator_view accl_view, __int64_t n, double* xView,
-              __int64_t incx, __int64_t xOffset, double* Y) {
-  *Y = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
-  // simultaneous live threads
-  const unsigned int thread_count = tile_count * TILE_SIZE;
-  // global buffer (return type)
-  hc::accelerator accl = accl_view.get_accelerator();
-  double* dev_global_buffer =
-      (double*)hc::am_alloc(sizeof(double) * tile_count, accl, 0);
-  // configuration
-  hc::extent<1> extent(thread_count);
-  hc::parallel_for_each(
-      accl_view, extent.tile(TILE_SIZE), [=](hc::tiled_index<1> tid)[[hc]] {
-        // shared tile buffer
-        tile_static double local_buffer[TILE_SIZE];
-        // indexes
-        int idx = tid.global[0];
-        // this threads's shared memory pointer
-        double& smem = local_buffer[tid.local[0]];
-        // initialize local buffer
-        smem = 0.0f;
-
-        // fold data into local buffer
-        while (idx < n) {
-          // reduction of smem and X[idx] with results stored in smem
-          smem += hc::fast_math::fabsf(xView[xOffset + hc::index<1>(idx)[0]]);
-          // next chunk
-          idx += thread_count;
-        }
-
-        // synchronize
-        tid.barrier.wait_with_tile_static_memory_fence();
-        // reduce all values in this tile
-        unsigned int local = tid.local[0];
-        double* mem = &smem;
-
-        // unrolled for performance
-        if (local < 128) {
-          mem[0] = mem[0] + mem[128];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 64) {
-          mem[0] = mem[0] + mem[64];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 32) {
-          mem[0] = mem[0] + mem[32];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 16) {
-          mem[0] = mem[0] + mem[16];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 8) {
-          mem[0] = mem[0] + mem[8];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 4) {
-          mem[0] = mem[0] + mem[4];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 2) {
-          mem[0] = mem[0] + mem[2];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 1) {
-          mem[0] = mem[0] + mem[1];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        // only 1 thread per tile does the inter tile communication
-        if (tid.local[0] == 0) {
-          // write to global buffer in this tiles
-          dev_global_buffer[tid.tile[0]] = smem;
-        }
-      }) ;
-
-  // create host buffer
-  double* host_global_buffer =
-      reinterpret_cast<double*>(malloc(sizeof(double) * tile_count));
-  // Copy device contents back to host
-  accl_view.copy(dev_global_buffer, host_global_buffer,
-                 sizeof(double) * tile_count);
-
-  // 2nd pass reduction
-  for (int i = 0; i < tile_count; i++) {
-    *Y = (hc::fast_math::isnan(static_cast<float>(*Y)) ||
-          hc::fast_math::isinf(static_cast<float>(*Y)))
-             ? 0
-             : *Y;
-    *Y += host_global_buffer[i];
-  }
-
-  // free up resources
-  free(host_global_buffer);
-  hc::am_free(dev_global_buffer);
+// DASUM of n elements into Y, device memory when devY is set and
+// host memory otherwise; false when the scratch cannot be leased
+bool dasum_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+              __int64_t n, double *xView, __int64_t incx, __int64_t xOffset,
+              double *Y, bool devY) {
+  ReduceAsum<double> op = {xView, xOffset, incx, 0};
+  return reduce_device(accl_view, scratch, n, 1, op, devY ? Y : NULL, Y);
 }
 
-void dasum_HC(hc::accelerator_view accl_view, __int64_t n, double* xView,
-              __int64_t incx, __int64_t xOffset, double* Y,
-              __int64_t X_batchOffset, int batchSize) {
-  *Y = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
-  // simultaneous live threads
-  const unsigned int thread_count = tile_count * TILE_SIZE;
-  // global buffer (return type)
-  hc::accelerator accl = accl_view.get_accelerator();
-  double* dev_global_buffer =
-      (double*)hc::am_alloc(sizeof(double) * batchSize * tile_count, accl, 0);
-  // configuration
-  hc::extent<2> extent(batchSize, thread_count);
-  hc::parallel_for_each(
-      accl_view, extent.tile(1, TILE_SIZE), [=](hc::tiled_index<2> tid)[[hc]] {
-        // shared tile buffer
-        tile_static double local_buffer[TILE_SIZE];
-        // indexes
-        int elt = tid.tile[0];
-        int idx = tid.global[1];
-        // this threads's shared memory pointer
-        double& smem = local_buffer[tid.local[1]];
-        // initialize local buffer
-        smem = 0.0f;
-
-        // fold data into local buffer
-        while (idx < n) {
-          // reduction of smem and X[idx] with results stored in smem
-          smem += hc::fast_math::fabsf(
-              xView[xOffset + X_batchOffset * elt + hc::index<1>(idx)[0]]);
-          // next chunk
-          idx += thread_count;
-        }
-
-        // synchronize
-        tid.barrier.wait_with_tile_static_memory_fence();
-        // reduce all values in this tile
-        unsigned int local = tid.local[1];
-        double* mem = &smem;
-
-        // unrolled for performance
-        if (local < 128) {
-          mem[0] = mem[0] + mem[128];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 64) {
-          mem[0] = mem[0] + mem[64];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 32) {
-          mem[0] = mem[0] + mem[32];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 16) {
-          mem[0] = mem[0] + mem[16];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 8) {
-          mem[0] = mem[0] + mem[8];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 4) {
-          mem[0] = mem[0] + mem[4];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 2) {
-          mem[0] = mem[0] + mem[2];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 1) {
-          mem[0] = mem[0] + mem[1];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        // only 1 thread per tile does the inter tile communication
-        if (tid.local[1] == 0) {
-          // write to global buffer in this tiles
-          dev_global_buffer[tile_count * elt + tid.tile[1]] = smem;
-        }
-      }) ;
-
-  // create host buffer
-  double* host_global_buffer = reinterpret_cast<double*>(
-      malloc(sizeof(double) * batchSize * tile_count));
-  // Copy device contents back to host
-  accl_view.copy(dev_global_buffer, host_global_buffer,
-                 sizeof(double) * batchSize * tile_count);
+// Batched form: the total over all batchSize entries
+bool dasum_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+              __int64_t n, double *xView, __int64_t incx, __int64_t xOffset,
+              double *Y, __int64_t X_batchOffset, int batchSize, bool devY) {
+  ReduceAsum<double> op = {xView, xOffset, incx, X_batchOffset};
+  ReduceJoined<double, ReduceAsum<double>> joined = {op, n};
+  return reduce_device(accl_view, scratch, n * batchSize, 1, joined,
+                       devY ? Y : NULL, Y);
+}
 
-  // 2nd pass reduction
-  for (int i = 0; i < tile_count * batchSize; i++) {
-    *Y = (hc::fast_math::isnan(static_cast<float>(*Y)) ||
-          hc::fast_math::isinf(static_cast<float>(*Y)))
-             ? 0
-             : *Y;
-    *Y += host_global_buffer[i];
-  }
-  // free up resources
-  free(host_global_buffer);
-  hc::am_free(dev_global_buffer);
+// Batched form with one result per entry, stored to Y in device memory
+// when devY is set and in host memory otherwise. P is const double * for
+// strided batches and const double *const * for pointer arrays.
+template <typename P>
+bool dasum_batched_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+                      __int64_t n, P xView, __int64_t incx, __int64_t xOffset,
+                      double *Y, __int64_t X_batchOffset, int batchSize,
+                      bool devY) {
+  ReduceAsum<double, P> op = {xView, xOffset, incx, X_batchOffset};
+  return reduce_device(accl_view, scratch, n, batchSize, op, devY ? Y : NULL,
+                       Y);
 }
 
 // DASUM Call Type I: Inputs and outputs are HCC float array containers
@@ -268,7 +69,16 @@ hcblasStatus Hcblaslibrary::hcblas_dasum(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  dasum_HC(accl_view, N, X, incX, xOffset, Y);
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    *Y = host_asum<double>(N, X + xOffset, incX);
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!dasum_HC(accl_view, scratch, N, X, incX, xOffset, Y,
+                pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
   return HCBLAS_SUCCEEDS;
 }
 
@@ -284,7 +94,71 @@ hcblasStatus Hcblaslibrary::hcblas_dasum(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  dasum_HC(accl_view, N, X, incX, xOffset, Y, X_batchOffset, batchSize);
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    std::vector<double> sums(batchSize);
+    host_asum_batched<double>(N, X + xOffset, incX, X_batchOffset, batchSize,
+                              sums.data());
+    // The batched form reports one total over all entries
+    *Y = 0;
+    for (int i = 0; i < batchSize; i++) *Y += sums[i];
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!dasum_HC(accl_view, scratch, N, X, incX, xOffset, Y, X_batchOffset,
+                batchSize, pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
+  return HCBLAS_SUCCEEDS;
+}
+
+// DASUM_BATCHED Type I - One result per batch entry, Y[0 .. batchSize - 1]
+// in memory of pointerMode
+hcblasStatus Hcblaslibrary::hcblas_dasum_batched(
+    hc::accelerator_view accl_view, const int N, const double *X,
+    const int incX, const __int64_t xOffset, double *Y,
+    const __int64_t X_batchOffset, const int batchSize) {
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || batchSize < 0) {
+    return HCBLAS_INVALID;
+  }
+  if (batchSize == 0) return HCBLAS_SUCCEEDS;
+
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    host_asum_batched<double>(N, X + xOffset, incX, X_batchOffset, batchSize,
+                              Y);
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!dasum_batched_HC(accl_view, scratch, N, X, incX, xOffset, Y,
+                        X_batchOffset, batchSize,
+                        pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
   return HCBLAS_SUCCEEDS;
 }
 
+// DASUM_BATCHED Type II - Pointer arrays: entry i is X[i], the array in
+// device memory
+hcblasStatus Hcblaslibrary::hcblas_dasum_batched(
+    hc::accelerator_view accl_view, const int N, const double *const X[],
+    const int incX, const __int64_t xOffset, double *Y, const int batchSize) {
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || batchSize < 0) {
+    return HCBLAS_INVALID;
+  }
+  if (batchSize == 0) return HCBLAS_SUCCEEDS;
+
+  // CPU accelerator: the array is host memory too
+  if (hostExecution) {
+    for (int i = 0; i < batchSize; i++) {
+      Y[i] = host_asum<double>(N, X[i] + xOffset, incX);
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!dasum_batched_HC(accl_view, scratch, N, X, incX, xOffset, Y, 0,
+                        batchSize, pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
+  return HCBLAS_SUCCEEDS;
+}
@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
@@ -77,6 +78,12 @@ hcblasStatus Hcblaslibrary::hcblas_dcopy(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    host_copy<double>(N, X + xOffset, incX, Y + yOffset, incY);
+    return HCBLAS_SUCCEEDS;
+  }
+
   dcopy_HC(accl_view, N, X, incX, xOffset, Y, incY, yOffset);
   return HCBLAS_SUCCEEDS;
 }
@@ -93,6 +100,13 @@ hcblasStatus Hcblaslibrary::hcblas_dcopy(
     return HCBLAS_INVALID;
   }
 
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    host_copy_batched<double>(N, X + xOffset, incX, X_batchOffset, Y + yOffset,
+                              incY, Y_batchOffset, batchSize);
+    return HCBLAS_SUCCEEDS;
+  }
+
   dcopy_HC(accl_view, N, X, incX, xOffset, Y, incY, yOffset, X_batchOffset,
            Y_batchOffset, batchSize);
   return HCBLAS_SUCCEEDS;
@@ -21,284 +21,215 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/reduce/reduce_engine.h"
+#include "src/blas/scratch/scratch_pool.h"
 #include <hc.hpp>
 #include <hc_am.hpp>
 #include <hc_math.hpp>
 
-#define TILE_SIZE 256
-
-double ddot_HC(hc::accelerator_view accl_view, __int64_t n, const double *xView,
-               __int64_t incx, __int64_t xOffset, const double *yView,
-               __int64_t incy, __int64_t yOffset, double out) {
-  out = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
-  // simultaneous live threads
-  const unsigned int thread_count = tile_count * TILE_SIZE;
-  // global buffer (return type)
-  hc::accelerator accl = accl_view.get_accelerator();
-  double *dev_global_buffer =
-      (double *)hc::am_alloc(sizeof(double) * tile_count, accl, 0);
-  // configuration
-  hc::extent<1> extent(thread_count);
-  hc::parallel_for_each(accl_view, extent.tile(TILE_SIZE),
-                        [=](hc::tiled_index<1> tid)[[hc]] {
-                          // shared tile buffer
-                          tile_static double local_buffer[TILE_SIZE];
-                          // indexes
-                          int idx = tid.global[0];
-                          // this threads's shared memory pointer
-                          double &smem = local_buffer[tid.local[0]];
-                          // initialize local buffer
-                          smem = 0.0f;
-
-                          // fold data into local buffer
-                          while (idx < n) {
-                            // reduction of smem and X[idx] with results stored
-                            // in smem
-                            smem += xView[xOffset + hc::index<1>(idx)[0]] *
-                                    yView[yOffset + hc::index<1>(idx)[0]];
-                            // next chunk
-                            idx += thread_count;
-                          }
-
-                          // synchronize
-                          tid.barrier.wait_with_tile_static_memory_fence();
-                          // reduce all values in this tile
-                          unsigned int local = tid.local[0];
-                          double *mem = &smem;
-
-                          // unrolled for performance
-                          if (local < 128) {
-                            mem[0] = mem[0] + mem[128];
-                          }
-
-                          tid.barrier.wait_with_tile_static_memory_fence();
-
-                          if (local < 64) {
-                            mem[0] = mem[0] + mem[64];
-                          }
-
-                          tid.barrier.wait_with_tile_static_memory_fence();
-
-                          if (local < 32) {
-                            mem[0] = mem[0] + mem[32];
-                          }
-
-                          tid.barrier.wait_with_tile_static_memory_fence();
-
-                          if (local < 16) {
-                            mem[0] = mem[0] + mem[16];
-                          }
-
-                          tid.barrier.wait_with_tile_static_memory_fence();
-
-                          if (local < 8) {
-                            mem[0] = mem[0] + mem[8];
-                          }
-
-                          tid.barrier.wait_with_tile_static_memory_fence();
-
-                          if (local < 4) {
-                            mem[0] = mem[0] + mem[4];
-                          }
-
-                          tid.barrier.wait_with_tile_static_memory_fence();
-
-                          if (local < 2) {
-                            mem[0] = mem[0] + mem[2];
-                          }
-
-                          tid.barrier.wait_with_tile_static_memory_fence();
-
-                          if (local < 1) {
-                            mem[0] = mem[0] + mem[1];
-                          }
+// DDOT of n elements into dot, device memory when devDot is set and
+// host memory otherwise; false when the scratch cannot be leased
+bool ddot_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+             __int64_t n, const double *xView, __int64_t incx,
+             __int64_t xOffset, const double *yView, __int64_t incy,
+             __int64_t yOffset, double *dot, bool devDot) {
+  ReduceDot<double> op = {xView, xOffset, incx, 0, yView, yOffset, incy, 0};
+  return reduce_device(accl_view, scratch, n, 1, op, devDot ? dot : NULL,
+                       dot);
+}
 
-                          tid.barrier.wait_with_tile_static_memory_fence();
+// Batched form: the total over all batchSize entries
+bool ddot_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+             __int64_t n, const double *xView, __int64_t incx,
+             __int64_t xOffset, const double *yView, __int64_t incy,
+             __int64_t yOffset, const __int64_t X_batchOffset,
+             const __int64_t Y_batchOffset, const int batchSize,
+             double *dot, bool devDot) {
+  ReduceDot<double> op = {xView, xOffset, incx, X_batchOffset,
+                          yView, yOffset, incy, Y_batchOffset};
+  ReduceJoined<double, ReduceDot<double>> joined = {op, n};
+  return reduce_device(accl_view, scratch, n * batchSize, 1, joined,
+                       devDot ? dot : NULL, dot);
+}
 
-                          // only 1 thread per tile does the inter tile
-                          // communication
-                          if (tid.local[0] == 0) {
-                            // write to global buffer in this tiles
-                            dev_global_buffer[tid.tile[0]] = smem;
-                          }
-                        }) ;
+// Batched form with one result per entry, stored to dot in device memory
+// when devDot is set and in host memory otherwise. P is const double * for
+// strided batches and const double *const * for pointer arrays.
+template <typename P>
+bool ddot_batched_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+                     __int64_t n, P xView, __int64_t incx, __int64_t xOffset,
+                     P yView, __int64_t incy, __int64_t yOffset,
+                     __int64_t X_batchOffset, __int64_t Y_batchOffset,
+                     int batchSize, double *dot, bool devDot) {
+  ReduceDot<double, P> op = {xView, xOffset, incx, X_batchOffset,
+                             yView, yOffset, incy, Y_batchOffset};
+  return reduce_device(accl_view, scratch, n, batchSize, op,
+                       devDot ? dot : NULL, dot);
+}
 
-  // create host buffer
-  double *host_global_buffer =
-      reinterpret_cast<double *>(malloc(sizeof(double) * tile_count));
-  // Copy device contents back to host
-  accl_view.copy(dev_global_buffer, host_global_buffer,
-                 sizeof(double) * tile_count);
+// DDOT Call Type I: Inputs and outputs are HCC double array containers
+hcblasStatus Hcblaslibrary::hcblas_ddot(hc::accelerator_view accl_view,
+                                        const int N, const double *X,
+                                        const int incX, const __int64_t xOffset,
+                                        const double *Y, const int incY,
+                                        const __int64_t yOffset, double &dot) {
+  /*Check the conditions*/
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
 
-  // 2nd pass reduction
-  for (int i = 0; i < tile_count; i++) {
-    out = (hc::fast_math::isnan(static_cast<float>(out)) ||
-           hc::fast_math::isinf(static_cast<float>(out)))
-              ? 0
-              : out;
-    out += host_global_buffer[i];
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    dot = host_dot<double>(N, X + xOffset, incX, Y + yOffset, incY);
+    return HCBLAS_SUCCEEDS;
   }
 
-  // free up resources
-  free(host_global_buffer);
-  hc::am_free(dev_global_buffer);
-  return out;
+  if (!ddot_HC(accl_view, scratch, N, X, incX, xOffset, Y, incY, yOffset, &dot,
+               false)) {
+    return HCBLAS_INVALID;
+  }
+  return HCBLAS_SUCCEEDS;
 }
 
-double ddot_HC(hc::accelerator_view accl_view, __int64_t n, const double *xView,
-               __int64_t incx, __int64_t xOffset, const double *yView,
-               __int64_t incy, __int64_t yOffset, double out,
-               const __int64_t X_batchOffset, const __int64_t Y_batchOffset,
-               const int batchSize)
-
-{
-  out = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
-  // simultaneous live threads
-  const unsigned int thread_count = tile_count * TILE_SIZE;
-  // global buffer (return type)
-  hc::accelerator accl = accl_view.get_accelerator();
-  double *dev_global_buffer =
-      (double *)hc::am_alloc(sizeof(double) * batchSize * tile_count, accl, 0);
-  // configuration
-  hc::extent<2> extent(batchSize, thread_count);
-  hc::parallel_for_each(
-      accl_view, extent.tile(1, TILE_SIZE), [=](hc::tiled_index<2> tid)[[hc]] {
-        // shared tile buffer
-        tile_static double local_buffer[TILE_SIZE];
-        // indexes
-        int elt = tid.tile[0];
-        int idx = tid.global[1];
-        // this threads's shared memory pointer
-        double &smem = local_buffer[tid.local[1]];
-        // initialize local buffer
-        smem = 0.0f;
-
-        // fold data into local buffer
-        while (idx < n) {
-          // reduction of smem and X[idx] with results stored in smem
-          smem += xView[xOffset + X_batchOffset * elt + hc::index<1>(idx)[0]] *
-                  yView[yOffset + Y_batchOffset * elt + hc::index<1>(idx)[0]];
-          // next chunk
-          idx += thread_count;
-        }
-
-        // synchronize
-        tid.barrier.wait_with_tile_static_memory_fence();
-        // reduce all values in this tile
-        unsigned int local = tid.local[1];
-        double *mem = &smem;
-
-        // unrolled for performance
-        if (local < 128) {
-          mem[0] = mem[0] + mem[128];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 64) {
-          mem[0] = mem[0] + mem[64];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 32) {
-          mem[0] = mem[0] + mem[32];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 16) {
-          mem[0] = mem[0] + mem[16];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 8) {
-          mem[0] = mem[0] + mem[8];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 4) {
-          mem[0] = mem[0] + mem[4];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 2) {
-          mem[0] = mem[0] + mem[2];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 1) {
-          mem[0] = mem[0] + mem[1];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        // only 1 thread per tile does the inter tile communication
-        if (tid.local[1] == 0) {
-          // write to global buffer in this tiles
-          dev_global_buffer[elt * tile_count + tid.tile[1]] = smem;
-        }
-      }) ;
-
-  // create host buffer
-  double *host_global_buffer = reinterpret_cast<double *>(
-      malloc(sizeof(double) * batchSize * tile_count));
-  // Copy device contents back to host
-  accl_view.copy(dev_global_buffer, host_global_buffer,
-                 sizeof(double) * batchSize * tile_count);
-
-  // 2nd pass reduction
-  for (int i = 0; i < tile_count * batchSize; i++) {
-    out = (hc::fast_math::isnan(static_cast<float>(out)) ||
-           hc::fast_math::isinf(static_cast<float>(out)))
-              ? 0
-              : out;
-    out += host_global_buffer[i];
+// DDOT Type II - Overloaded function with arguments related to batch processing
+hcblasStatus Hcblaslibrary::hcblas_ddot(
+    hc::accelerator_view accl_view, const int N, const double *X,
+    const int incX, const __int64_t xOffset, const double *Y, const int incY,
+    const __int64_t yOffset, double &dot, const __int64_t X_batchOffset,
+    const __int64_t Y_batchOffset, const int batchSize) {
+  /*Check the conditions*/
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
   }
 
-  // free up resources
-  free(host_global_buffer);
-  hc::am_free(dev_global_buffer);
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    std::vector<double> dots(batchSize);
+    host_dot_batched<double>(N, X + xOffset, incX, X_batchOffset, Y + yOffset,
+                             incY, Y_batchOffset, batchSize, dots.data());
+    // The batched form reports one total over all entries
+    dot = 0;
+    for (int i = 0; i < batchSize; i++) dot += dots[i];
+    return HCBLAS_SUCCEEDS;
+  }
 
-  return out;
+  if (!ddot_HC(accl_view, scratch, N, X, incX, xOffset, Y, incY, yOffset,
+               X_batchOffset, Y_batchOffset, batchSize, &dot, false)) {
+    return HCBLAS_INVALID;
+  }
+  return HCBLAS_SUCCEEDS;
 }
 
-// DDOT Call Type I: Inputs and outputs are HCC double array containers
+// DDOT Type III - the result dot is in memory of pointerMode
 hcblasStatus Hcblaslibrary::hcblas_ddot(hc::accelerator_view accl_view,
                                         const int N, const double *X,
                                         const int incX, const __int64_t xOffset,
                                         const double *Y, const int incY,
-                                        const __int64_t yOffset, double &dot) {
-  /*Check the conditions*/
+                                        const __int64_t yOffset, double *dot) {
+  if (dot == NULL) {
+    return HCBLAS_INVALID;
+  }
+  // Host pointers, or the CPU accelerator whose device memory is host memory
+  if (pointerMode == HostPointer || hostExecution) {
+    return hcblas_ddot(accl_view, N, X, incX, xOffset, Y, incY, yOffset, *dot);
+  }
   if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
     return HCBLAS_INVALID;
   }
 
-  dot = ddot_HC(accl_view, N, X, incX, xOffset, Y, incY, yOffset, dot);
+  if (!ddot_HC(accl_view, scratch, N, X, incX, xOffset, Y, incY, yOffset, dot,
+               true)) {
+    return HCBLAS_INVALID;
+  }
   return HCBLAS_SUCCEEDS;
 }
 
-// DDOT Type II - Overloaded function with arguments related to batch processing
+// DDOT Type IV - Batch processing with the result in memory of pointerMode
 hcblasStatus Hcblaslibrary::hcblas_ddot(
     hc::accelerator_view accl_view, const int N, const double *X,
     const int incX, const __int64_t xOffset, const double *Y, const int incY,
-    const __int64_t yOffset, double &dot, const __int64_t X_batchOffset,
+    const __int64_t yOffset, double *dot, const __int64_t X_batchOffset,
     const __int64_t Y_batchOffset, const int batchSize) {
-  /*Check the conditions*/
+  if (dot == NULL) {
+    return HCBLAS_INVALID;
+  }
+  if (pointerMode == HostPointer || hostExecution) {
+    return hcblas_ddot(accl_view, N, X, incX, xOffset, Y, incY, yOffset, *dot,
+                       X_batchOffset, Y_batchOffset, batchSize);
+  }
   if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
     return HCBLAS_INVALID;
   }
 
-  dot = ddot_HC(accl_view, N, X, incX, xOffset, Y, incY, yOffset, dot,
-                X_batchOffset, Y_batchOffset, batchSize);
+  if (!ddot_HC(accl_view, scratch, N, X, incX, xOffset, Y, incY, yOffset,
+               X_batchOffset, Y_batchOffset, batchSize, dot, true)) {
+    return HCBLAS_INVALID;
+  }
   return HCBLAS_SUCCEEDS;
 }
 
+// DDOT_BATCHED Type I - One result per batch entry, dot[0 .. batchSize - 1]
+// in memory of pointerMode
+hcblasStatus Hcblaslibrary::hcblas_ddot_batched(
+    hc::accelerator_view accl_view, const int N, const double *X,
+    const int incX, const __int64_t xOffset, const double *Y, const int incY,
+    const __int64_t yOffset, double *dot, const __int64_t X_batchOffset,
+    const __int64_t Y_batchOffset, const int batchSize) {
+  if (X == NULL || Y == NULL || dot == NULL || N <= 0 || incX <= 0 ||
+      incY <= 0 || batchSize < 0) {
+    return HCBLAS_INVALID;
+  }
+  if (batchSize == 0) return HCBLAS_SUCCEEDS;
+
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    host_dot_batched<double>(N, X + xOffset, incX, X_batchOffset, Y + yOffset,
+                             incY, Y_batchOffset, batchSize, dot);
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!ddot_batched_HC(accl_view, scratch, N, X, incX, xOffset, Y, incY,
+                       yOffset, X_batchOffset, Y_batchOffset, batchSize, dot,
+                       pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
+  return HCBLAS_SUCCEEDS;
+}
+
+// DDOT_BATCHED Type II - Pointer arrays: entry i is X[i] and Y[i], the
+// arrays in device memory
+hcblasStatus Hcblaslibrary::hcblas_ddot_batched(
+    hc::accelerator_view accl_view, const int N, const double *const X[],
+    const int incX, const __int64_t xOffset, const double *const Y[],
+    const int incY, const __int64_t yOffset, double *dot, const int batchSize) {
+  if (X == NULL || Y == NULL || dot == NULL || N <= 0 || incX <= 0 ||
+      incY <= 0 || batchSize < 0) {
+    return HCBLAS_INVALID;
+  }
+  if (batchSize == 0) return HCBLAS_SUCCEEDS;
+
+  // CPU accelerator: the arrays are host memory too
+  if (hostExecution) {
+    for (int i = 0; i < batchSize; i++) {
+      dot[i] = host_dot<double>(N, X[i] + xOffset, incX, Y[i] + yOffset, incY);
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!ddot_batched_HC(accl_view, scratch, N, X, incX, xOffset, Y, incY,
+                       yOffset, 0, 0, batchSize, dot,
+                       pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
+  return HCBLAS_SUCCEEDS;
+}
+
+// Device workspace carved by a non-batched DDOT of N elements: the
+// work-group partials, the sum copied back to the host and the arrival
+// counter
+size_t Hcblaslibrary::hcblas_ddot_workspaceSize(
+    hc::accelerator_view accl_view, const int N) {
+  if (hostExecution || N <= 0) return 0;
+  return reduce_workspace_bytes<double>(N, 1);
+}
@@ -24,6 +24,7 @@ THE SOFTWARE.
 #define LIB_SRC_BLAS_DGEMM_DGEMM_ARRAY_KERNELS_H_
 
 #include "include/hcblaslib.h"
+#include "src/blas/gemmselect/gemm_select.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
@@ -392,37 +393,16 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS8XMTS4(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_MX096_NX096_KX16_TS16XMTS6(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view, double *A,
-                            __int64_t aOffset, double *B, __int64_t bOffset,
-                            double *C, __int64_t cOffset, int M, int N, int K,
-                            int lda, int ldb, int ldc, double alpha,
-                            double beta);
-
 hcblasStatus gemm_NoTransA_MICRO_NBK_M096_N096_K096_TS16XMTS6(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
@@ -433,21 +413,6 @@ hcblasStatus gemm_NoTransA_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
 hcblasStatus gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
@@ -468,27 +433,6 @@ hcblasStatus gemm_NoTransA_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, double *A,
-                           __int64_t aOffset, double *B, __int64_t bOffset,
-                           double *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, double alpha,
-                           double beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
-    const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
-
 hcblasStatus gemm_NoTransB_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     hc::accelerator_view accl_view, const double *A, __int64_t aOffset,
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
@@ -519,16 +463,37 @@ hcblasStatus gemm_NoTransB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const double *B, __int64_t bOffset, double *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, double alpha, double beta);
 
-hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, double *A,
-                           __int64_t aOffset, double *B, __int64_t bOffset,
-                           double *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, double alpha,
-                           double beta);
+/*
+* Kernel registries consulted by the column major dispatch routine
+*/
 
-hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, double *A,
-                          __int64_t aOffset, double *B, __int64_t bOffset,
-                          double *C, __int64_t cOffset, int M, int N, int K,
-                          int lda, int ldb, int ldc, double alpha, double beta);
+typedef hcblasStatus (*DgemmKernelFn)(hc::accelerator_view accl_view,
+                                      ScratchPool *scratch, double *A,
+                                      __int64_t aOffset, double *B,
+                                      __int64_t bOffset, double *C,
+                                      __int64_t cOffset, int M, int N, int K,
+                                      int lda, int ldb, int ldc, double alpha,
+                                      double beta);
+
+struct DgemmKernelEntry {
+  GemmKernelInfo info;
+  DgemmKernelFn fn;
+};
+
+// Column major DGEMM variants for a transpose case ('n' or 't' per operand),
+// the last entry being a general kernel. Used by hcblas-tune to time every
+// variant the selection table can name.
+const DgemmKernelEntry *dgemm_kernel_registry(char transA, char transB,
+                                              int *count);
+
+// Column major DGEMM running the registry entry the selection table names
+// for the call
+hcblasStatus dgemm_dispatch(hc::accelerator_view accl_view,
+                            ScratchPool *scratch, char transA, char transB,
+                            double *A, __int64_t aOffset, double *B,
+                            __int64_t bOffset, double *C, __int64_t cOffset,
+                            int M, int N, int K, int lda, int ldb, int ldc,
+                            double alpha, double beta);
 
 /*
 * SGEMM Kernels for Batch processing in column major order
@@ -21,36 +21,35 @@ THE SOFTWARE.
 */
 
 #include "./dgemm_array_kernels.h"
+#include "src/blas/gemmgen/gemm_tiled_kernel.h"
+#include "src/blas/host/hcblas_host.h"
 
 // Sgemm Wrapper routine that invokes the appropriate kernel routines depending
 // on the input dimension M N and K
-hcblasStatus gemm_HC(hc::accelerator_view accl_view, const int order,
-                     char TransA, char TransB, const int M, const int N,
-                     const int K, const double alpha, double *A_mat,
-                     __int64_t aOffset, __int64_t lda, double *B_mat,
-                     __int64_t bOffset, __int64_t ldb, const double beta,
-                     double *C_mat, __int64_t cOffset, __int64_t ldc) {
+hcblasStatus gemm_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+                     const int order, char TransA, char TransB, const int M,
+                     const int N, const int K, const double alpha,
+                     double *A_mat, __int64_t aOffset, __int64_t lda,
+                     double *B_mat, __int64_t bOffset, __int64_t ldb,
+                     const double beta, double *C_mat, __int64_t cOffset,
+                     __int64_t ldc) {
   hcblasStatus status = HCBLAS_SUCCEEDS;
   // Start the operations
 
   if (order) {
-    if (TransB == 'n') {
-      if (TransA == 'n') {
-        status =
-            gemm_NoTransAB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                           cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-      } else {
-        status = gemm_NoTransB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                               cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-      }
-    } else if (TransA == 'n') {
-      status = gemm_NoTransA(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                             cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-    } else {
-      status = gemm_TransAB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                            cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-    }
+    status = dgemm_dispatch(accl_view, scratch, TransA, TransB, A_mat,
+                            aOffset, B_mat, bOffset, C_mat, cOffset, M, N, K,
+                            lda, ldb, ldc, alpha, beta);
   } else {
+    // Row major has no registry, so shapes the fixed tile grids serve badly
+    // run split-K or stream-K ahead of the hand-written kernels
+    if (gemm_tiled_schedule_rmajor<double, double>(accl_view, scratch, TransA,
+                                                   TransB, A_mat, aOffset,
+                                                   B_mat, bOffset, C_mat,
+                                                   cOffset, M, N, K, lda, ldb,
+                                                   ldc, alpha, beta)) {
+      return HCBLAS_SUCCEEDS;
+    }
     if (TransB == 'n') {
       if (TransA == 'n') {
         status = gemm_NoTransAB_rMajor(accl_view, A_mat, aOffset, B_mat,
@@ -308,6 +307,17 @@ hcblasStatus Hcblaslibrary::hcblas_dgemm(
     return HCBLAS_INVALID;
   }
 
+  // CPU accelerator: run the blocked host engine on the host pointers
+  if (hostExecution) {
+    if (!host_gemm_tuned<double>(NULL, tuningDb, trace, order == ColMajor,
+                                 typeA == Trans, typeB == Trans, M, N, K, alpha,
+                                 A + aOffset, lda, B + bOffset, ldb, beta,
+                                 C + cOffset, ldc)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   // For alpha = 0
   if (alpha == 0) {
     if (order) {
@@ -319,8 +329,8 @@ hcblasStatus Hcblaslibrary::hcblas_dgemm(
     }
     return status;
   }
-  status = gemm_HC(accl_view, order, typeA, typeB, M, N, K, alpha, A, aOffset,
-                   lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+  status = gemm_HC(accl_view, scratch, order, typeA, typeB, M, N, K, alpha, A,
+                   aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
   return status;
 }
 
@@ -342,6 +352,17 @@ hcblasStatus Hcblaslibrary::hcblas_dgemm(
     return HCBLAS_INVALID;
   }
 
+  if (hostExecution) {
+    if (!host_gemm_batched<double>(order == ColMajor, typeA == Trans,
+                                   typeB == Trans, M, N, K, alpha, A, aOffset,
+                                   A_batchOffset, lda, B, bOffset,
+                                   B_batchOffset, ldb, beta, C, cOffset,
+                                   C_batchOffset, ldc, batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   /*  // For alpha = 0
     if (alpha == 0) {
       if (order) {
@@ -363,3 +384,11 @@ hcblasStatus Hcblaslibrary::hcblas_dgemm(
   return status;
 }
 
+// Device workspace carved by a non-batched DGEMM of this shape; the
+// split-K or stream-K schedule the heuristics default to is the only part
+// that takes scratch and does not depend on the layout or the transposes
+size_t Hcblaslibrary::hcblas_dgemm_workspaceSize(
+    hc::accelerator_view accl_view, const int M, const int N, const int K) {
+  if (hostExecution || M <= 0 || N <= 0 || K <= 0) return 0;
+  return gemm_tiled_workspace<double, double>(accl_view, M, N, K);
+}
@@ -0,0 +1,172 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Bodies of the tiled GEMM kernels, compiled both for the device, by
+* gemm_tiled_kernel.h with hc.hpp, and for the CPU, by host_sgemm_tiled.cpp
+* on the host runtime (host_tiled.h with HCBLAS_HOST_KERNELS). The includer
+* provides hc:: and tile_static; nothing here depends on which one it is.
+*/
+
+#ifndef LIB_SRC_BLAS_GEMMGEN_GEMM_TILED_BLOCK_H_
+#define LIB_SRC_BLAS_GEMMGEN_GEMM_TILED_BLOCK_H_
+
+// Accumulates op(A)[rowBase:, kBegin:kEnd] * op(B)[kBegin:kEnd, colBase:]
+// into the work-item's micro tile rC through the work-group's local tiles lA
+// and lB. kBegin is a multiple of KSTEP; every work-item of the group calls
+// it with the same arguments.
+template <typename T, typename Acc, int TILE, int MTM, int MTN, int KSTEP,
+          int PAD, bool TRANSA, bool TRANSB>
+void gemm_tiled_block(const hc::tiled_index<3> &tidx, T *lA, T *lB,
+                      const T *A, __int64_t aOffset, const T *B,
+                      __int64_t bOffset, int M, int N, int lda, int ldb,
+                      int rowBase, int colBase, int kBegin, int kEnd,
+                      Acc (&rC)[MTM][MTN]) [[hc]] {
+  enum {
+    BM = TILE * MTM,
+    BN = TILE * MTN,
+    LDA_S = BM + PAD,
+    LDB_S = BN + PAD,
+    THREADS = TILE * TILE
+  };
+  const int idx = tidx.local[2];
+  const int idy = tidx.local[1];
+  const int idt = idy * TILE + idx;
+  Acc rA[MTM];
+  Acc rB[MTN];
+
+  for (int k0 = kBegin; k0 < kEnd; k0 += KSTEP) {
+    // lA[k][m] = op(A)(rowBase + m, k0 + k), walking memory order so
+    // neighbouring work-items read neighbouring elements
+    for (int e = idt; e < KSTEP * BM; e += THREADS) {
+      const int m = TRANSA ? e / KSTEP : e % BM;
+      const int k = TRANSA ? e % KSTEP : e / BM;
+      const int row = rowBase + m;
+      const int kk = k0 + k;
+      T a = 0;
+      if (row < M && kk < kEnd) {
+        a = TRANSA ? A[aOffset + static_cast<__int64_t>(row) * lda + kk]
+                   : A[aOffset + static_cast<__int64_t>(kk) * lda + row];
+      }
+      lA[k * LDA_S + m] = a;
+    }
+    // lB[k][n] = op(B)(k0 + k, colBase + n)
+    for (int e = idt; e < KSTEP * BN; e += THREADS) {
+      const int n = TRANSB ? e % BN : e / KSTEP;
+      const int k = TRANSB ? e / BN : e % KSTEP;
+      const int col = colBase + n;
+      const int kk = k0 + k;
+      T b = 0;
+      if (col < N && kk < kEnd) {
+        b = TRANSB ? B[bOffset + static_cast<__int64_t>(kk) * ldb + col]
+                   : B[bOffset + static_cast<__int64_t>(col) * ldb + kk];
+      }
+      lB[k * LDB_S + n] = b;
+    }
+    tidx.barrier.wait();
+
+    for (int k = 0; k < KSTEP; k++) {
+      for (int i = 0; i < MTM; i++) {
+        rA[i] = static_cast<Acc>(lA[k * LDA_S + idx + i * TILE]);
+      }
+      for (int j = 0; j < MTN; j++) {
+        rB[j] = static_cast<Acc>(lB[k * LDB_S + idy + j * TILE]);
+      }
+      for (int i = 0; i < MTM; i++) {
+        for (int j = 0; j < MTN; j++) {
+          rC[i][j] += rA[i] * rB[j];
+        }
+      }
+    }
+    tidx.barrier.wait();
+  }
+}
+
+// C = alpha * acc + beta * C at element c; beta == 0 never reads C, which may
+// then hold anything, NaN included
+template <typename T, typename Acc>
+inline void gemm_tiled_store(T *C, __int64_t c, Acc acc, T alpha, T beta)
+    [[hc]] {
+  Acc v = static_cast<Acc>(alpha) * acc;
+  if (static_cast<Acc>(beta) != 0) {
+    v += static_cast<Acc>(beta) * static_cast<Acc>(C[c]);
+  }
+  C[c] = static_cast<T>(v);
+}
+
+// The tiled kernel over K cut into `splits` ranges of whole K steps, one
+// range per layer of the launch. Without a partial buffer C is updated in
+// place; otherwise layer s stores its unscaled product to partial + s * M * N
+// (column major, leading dimension M) for gemm_split_k_reduce.
+template <typename T, typename Acc, int TILE, int MTM, int MTN, int KSTEP,
+          int PAD, bool TRANSA, bool TRANSB>
+void gemm_tiled_launch(hc::accelerator_view accl_view, T *A,
+                       __int64_t aOffset, T *B, __int64_t bOffset, T *C,
+                       __int64_t cOffset, int M, int N, int K, int lda,
+                       int ldb, int ldc, T alpha, T beta, int splits,
+                       Acc *partial) {
+  enum { BM = TILE * MTM, BN = TILE * MTN };
+  const int blocksM = (M + BM - 1) / BM;
+  const int blocksN = (N + BN - 1) / BN;
+  const int kChunk = ((K + splits - 1) / splits + KSTEP - 1) / KSTEP * KSTEP;
+  const __int64_t size = static_cast<__int64_t>(M) * N;
+  hc::extent<3> grdExt(splits, blocksN * TILE, blocksM * TILE);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, TILE, TILE);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    tile_static T lA[KSTEP * (BM + PAD)];
+    tile_static T lB[KSTEP * (BN + PAD)];
+    Acc rC[MTM][MTN];
+    for (int i = 0; i < MTM; i++) {
+      for (int j = 0; j < MTN; j++) {
+        rC[i][j] = 0;
+      }
+    }
+    const int split = tidx.tile[0];
+    const int rowBase = tidx.tile[2] * BM;
+    const int colBase = tidx.tile[1] * BN;
+    const int idx = tidx.local[2];
+    const int idy = tidx.local[1];
+    const int kBegin = split * kChunk;
+    const int kEnd = kBegin + kChunk < K ? kBegin + kChunk : K;
+    gemm_tiled_block<T, Acc, TILE, MTM, MTN, KSTEP, PAD, TRANSA, TRANSB>(
+        tidx, lA, lB, A, aOffset, B, bOffset, M, N, lda, ldb, rowBase,
+        colBase, kBegin, kEnd, rC);
+
+    for (int j = 0; j < MTN; j++) {
+      const int col = colBase + idy + j * TILE;
+      if (col >= N) break;
+      for (int i = 0; i < MTM; i++) {
+        const int row = rowBase + idx + i * TILE;
+        if (row >= M) break;
+        if (partial != NULL) {
+          partial[split * size + static_cast<__int64_t>(col) * M + row] =
+              rC[i][j];
+          continue;
+        }
+        gemm_tiled_store(C, cOffset + static_cast<__int64_t>(col) * ldc + row,
+                         rC[i][j], alpha, beta);
+      }
+    }
+  });
+}
+
+#endif  // LIB_SRC_BLAS_GEMMGEN_GEMM_TILED_BLOCK_H_
@@ -0,0 +1,487 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Tiled GEMM kernel generator. One template produces the micro-tiled kernels
+* the per-precision sources spell out by hand: a TILE x TILE work-group
+* computes a (TILE * MTM) x (TILE * MTN) block of column major C, each
+* work-item an MTM x MTN micro tile accumulated in Acc (float for half data),
+* stepping KSTEP columns of op(A) and rows of op(B) through local memory
+* whose rows are padded by PAD elements against bank conflicts. Loads and the
+* store are bounds checked, so every instantiation admits any M, N and K.
+*
+* GEMM_TILED_VARIANTS lists the instantiations registries expose: the shapes
+* of the hand-written TS16XMTS2/4/6 and Mini_Batch kernels plus 8x8,
+* non-square and K-step 32 micro tiles. The kernel bodies themselves live in
+* gemm_tiled_block.h, which the host runtime compiles too.
+*
+* gemm_split_k runs the same kernels over K split into ranges, for shapes
+* whose blocks of C are too few to occupy the device. gemm_stream_k runs them
+* on persistent work-groups that share the MAC-loop iterations of all blocks
+* evenly, for shapes whose last wave of blocks would leave the device mostly
+* idle. Registries expose both as the SPLIT_K and STREAM_K variants
+* (GEMM_TILED_SCHEDULES), and gemm_tiled_schedule_default names the one the
+* heuristics pick, which selection prefers over the built-in rules only.
+*/
+
+#ifndef LIB_SRC_BLAS_GEMMGEN_GEMM_TILED_KERNEL_H_
+#define LIB_SRC_BLAS_GEMMGEN_GEMM_TILED_KERNEL_H_
+
+#include "include/hcblaslib.h"
+#include "src/blas/gemmselect/gemm_select.h"
+#include "src/blas/scratch/scratch_pool.h"
+#include "src/blas/trace/dispatch_trace.h"
+#include <cstring>
+#include <hc.hpp>
+#include <hc_am.hpp>
+#include "./gemm_tiled_block.h"
+
+template <typename T, typename Acc, int TILE, int MTM, int MTN, int KSTEP,
+          int PAD, bool TRANSA, bool TRANSB>
+hcblasStatus gemm_tiled(hc::accelerator_view accl_view, ScratchPool *scratch,
+                        T *A, __int64_t aOffset, T *B, __int64_t bOffset,
+                        T *C, __int64_t cOffset, int M, int N, int K, int lda,
+                        int ldb, int ldc, T alpha, T beta) {
+  gemm_tiled_launch<T, Acc, TILE, MTM, MTN, KSTEP, PAD, TRANSA, TRANSB>(
+      accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+      alpha, beta, 1, static_cast<Acc *>(NULL));
+  return HCBLAS_SUCCEEDS;
+}
+
+// Sums the split partial products pairwise in a fixed tree, so the result
+// does not depend on scheduling, then applies C = alpha * sum + beta * C
+template <typename T, typename Acc>
+void gemm_split_k_reduce(hc::accelerator_view accl_view, Acc *partial,
+                         int splits, T *C, __int64_t cOffset, int M, int N,
+                         int ldc, T alpha, T beta) {
+  const __int64_t size = static_cast<__int64_t>(M) * N;
+  hc::extent<1> grdExt((size + 255) & ~static_cast<__int64_t>(255));
+  hc::tiled_extent<1> t_ext = grdExt.tile(256);
+  for (int stride = 1; stride < splits; stride *= 2) {
+    hc::parallel_for_each(accl_view, t_ext,
+                          [=](hc::tiled_index<1> tidx)[[hc]] {
+      const __int64_t e = tidx.global[0];
+      if (e >= size) return;
+      for (int s = 0; s + stride < splits; s += 2 * stride) {
+        partial[s * size + e] += partial[(s + stride) * size + e];
+      }
+    });
+  }
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<1> tidx)[[hc]] {
+    const __int64_t e = tidx.global[0];
+    if (e >= size) return;
+    gemm_tiled_store(C, cOffset + (e / M) * ldc + e % M, partial[e], alpha,
+                     beta);
+  });
+}
+
+// Split-K configuration: 64 x 64 blocks of C, at least GEMM_SPLIT_K_MIN of K
+// per range and two work-groups per compute unit to fill the device
+#define GEMM_SPLIT_K_MIN 4096
+
+inline int gemm_split_k_splits(hc::accelerator_view accl_view, int M, int N,
+                               int K) {
+  const long long tiles =
+      static_cast<long long>((M + 63) / 64) * ((N + 63) / 64);
+  const int workers = 2 * accl_view.get_accelerator().get_cu_count();
+  return gemm_split_k_count(tiles, workers, K, GEMM_SPLIT_K_MIN);
+}
+
+// Elements of Acc in the partial buffers of gemm_split_k
+inline __int64_t gemm_split_k_partials(int M, int N, int splits) {
+  return static_cast<__int64_t>(splits) * M * N;
+}
+
+// Column major C = alpha * op(A) * op(B) + beta * C with K split `splits`
+// ways through the 16 x (4x4) tiled kernel and partial buffers in Acc,
+// leased from scratch. Returns false, leaving C untouched, when the
+// partials cannot be leased.
+template <typename T, typename Acc>
+bool gemm_split_k(hc::accelerator_view accl_view, ScratchPool *scratch,
+                  char transA, char transB, T *A, __int64_t aOffset, T *B,
+                  __int64_t bOffset, T *C, __int64_t cOffset, int M, int N,
+                  int K, int lda, int ldb, int ldc, T alpha, T beta,
+                  int splits) {
+  ScratchDevice<Acc> lease(scratch, accl_view,
+                           gemm_split_k_partials(M, N, splits));
+  Acc *partial = lease.data();
+  if (partial == NULL) return false;
+  if (transA == 'n' && transB == 'n') {
+    gemm_tiled_launch<T, Acc, 16, 4, 4, 16, 1, false, false>(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        alpha, beta, splits, partial);
+  } else if (transA == 'n') {
+    gemm_tiled_launch<T, Acc, 16, 4, 4, 16, 1, false, true>(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        alpha, beta, splits, partial);
+  } else if (transB == 'n') {
+    gemm_tiled_launch<T, Acc, 16, 4, 4, 16, 1, true, false>(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        alpha, beta, splits, partial);
+  } else {
+    gemm_tiled_launch<T, Acc, 16, 4, 4, 16, 1, true, true>(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        alpha, beta, splits, partial);
+  }
+  gemm_split_k_reduce(accl_view, partial, splits, C, cOffset, M, N, ldc, alpha,
+                      beta);
+  return true;
+}
+
+// Stream-K: `workers` persistent work-groups share the blocksM * blocksN *
+// kIters MAC-loop iterations of the whole product, worker w taking
+// [w * total / workers, (w + 1) * total / workers). A block one worker covers
+// entirely goes straight to C; a worker's partial first and last blocks go
+// to its two BM x BN slots of partial for gemm_stream_k_fixup.
+template <typename T, typename Acc, int TILE, int MTM, int MTN, int KSTEP,
+          int PAD, bool TRANSA, bool TRANSB>
+void gemm_stream_k_launch(hc::accelerator_view accl_view, T *A,
+                          __int64_t aOffset, T *B, __int64_t bOffset, T *C,
+                          __int64_t cOffset, int M, int N, int K, int lda,
+                          int ldb, int ldc, T alpha, T beta, int workers,
+                          Acc *partial) {
+  enum { BM = TILE * MTM, BN = TILE * MTN };
+  const int blocksM = (M + BM - 1) / BM;
+  const int blocksN = (N + BN - 1) / BN;
+  const int kIters = (K + KSTEP - 1) / KSTEP;
+  const long long total = static_cast<long long>(blocksM) * blocksN * kIters;
+  hc::extent<3> grdExt(workers, TILE, TILE);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, TILE, TILE);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    tile_static T lA[KSTEP * (BM + PAD)];
+    tile_static T lB[KSTEP * (BN + PAD)];
+    const int w = tidx.tile[0];
+    const int idx = tidx.local[2];
+    const int idy = tidx.local[1];
+    const long long begin = w * total / workers;
+    const long long end = (w + 1) * total / workers;
+    const long long firstBlock = begin / kIters;
+    for (long long iter = begin; iter < end;) {
+      const long long block = iter / kIters;
+      const int kb = static_cast<int>(iter % kIters);
+      const int ke = end - iter < kIters - kb
+                         ? kb + static_cast<int>(end - iter)
+                         : kIters;
+      const int rowBase = static_cast<int>(block % blocksM) * BM;
+      const int colBase = static_cast<int>(block / blocksM) * BN;
+      Acc rC[MTM][MTN];
+      for (int i = 0; i < MTM; i++) {
+        for (int j = 0; j < MTN; j++) {
+          rC[i][j] = 0;
+        }
+      }
+      gemm_tiled_block<T, Acc, TILE, MTM, MTN, KSTEP, PAD, TRANSA, TRANSB>(
+          tidx, lA, lB, A, aOffset, B, bOffset, M, N, lda, ldb, rowBase,
+          colBase, kb * KSTEP, ke * KSTEP < K ? ke * KSTEP : K, rC);
+
+      const bool whole = kb == 0 && ke == kIters;
+      Acc *slot = partial + (2 * w + (block == firstBlock ? 0 : 1)) * BM * BN;
+      for (int j = 0; j < MTN; j++) {
+        const int c = idy + j * TILE;
+        if (colBase + c >= N) break;
+        for (int i = 0; i < MTM; i++) {
+          const int r = idx + i * TILE;
+          if (rowBase + r >= M) break;
+          if (!whole) {
+            slot[c * BM + r] = rC[i][j];
+            continue;
+          }
+          gemm_tiled_store(C,
+                           cOffset +
+                               static_cast<__int64_t>(colBase + c) * ldc +
+                               rowBase + r,
+                           rC[i][j], alpha, beta);
+        }
+      }
+      iter += ke - kb;
+    }
+  });
+}
+
+// Completes the blocks several stream-K workers shared: their slots are
+// summed in worker order, so the result does not depend on scheduling, and
+// C = alpha * sum + beta * C is applied once
+template <typename T, typename Acc, int BM, int BN>
+void gemm_stream_k_fixup(hc::accelerator_view accl_view, Acc *partial,
+                         int workers, int kIters, T *C, __int64_t cOffset,
+                         int M, int N, int ldc, T alpha, T beta) {
+  const int blocksM = (M + BM - 1) / BM;
+  const int blocksN = (N + BN - 1) / BN;
+  const long long total = static_cast<long long>(blocksM) * blocksN * kIters;
+  hc::extent<1> grdExt(blocksM * blocksN * 256);
+  hc::tiled_extent<1> t_ext = grdExt.tile(256);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<1> tidx)[[hc]] {
+    const long long block = tidx.tile[0];
+    // Workers holding the block's first and last iterations
+    const long long w0 = ((block * kIters + 1) * workers - 1) / total;
+    const long long w1 = (((block + 1) * kIters) * workers - 1) / total;
+    if (w0 == w1) return;
+    const int rowBase = static_cast<int>(block % blocksM) * BM;
+    const int colBase = static_cast<int>(block / blocksM) * BN;
+    for (int e = tidx.local[0]; e < BM * BN; e += 256) {
+      const int row = rowBase + e % BM;
+      const int col = colBase + e / BM;
+      if (row >= M || col >= N) continue;
+      Acc sum = 0;
+      for (long long w = w0; w <= w1; w++) {
+        const long long firstBlock = (w * total / workers) / kIters;
+        sum += partial[(2 * w + (block == firstBlock ? 0 : 1)) * BM * BN + e];
+      }
+      gemm_tiled_store(C, cOffset + static_cast<__int64_t>(col) * ldc + row,
+                       sum, alpha, beta);
+    }
+  });
+}
+
+// Work-groups of the 16 x (4x4) kernel the device keeps resident at once:
+// as many per compute unit as local memory allows, at most
+// GEMM_STREAM_K_GROUPS_PER_CU
+#define GEMM_STREAM_K_GROUPS_PER_CU 4
+
+template <typename T>
+int gemm_stream_k_workers(hc::accelerator_view accl_view) {
+  hc::accelerator acc = accl_view.get_accelerator();
+  const size_t lds = 2 * 16 * (64 + 1) * sizeof(T);
+  size_t perCU = acc.get_max_tile_static_size() / lds;
+  if (perCU < 1) perCU = 1;
+  if (perCU > GEMM_STREAM_K_GROUPS_PER_CU) perCU = GEMM_STREAM_K_GROUPS_PER_CU;
+  return static_cast<int>(perCU * acc.get_cu_count());
+}
+
+// Elements of Acc in the partial buffers of gemm_stream_k
+inline __int64_t gemm_stream_k_partials(int workers) {
+  return static_cast<__int64_t>(2) * workers * 64 * 64;
+}
+
+// Column major C = alpha * op(A) * op(B) + beta * C through the 16 x (4x4)
+// tiled kernel scheduled stream-K over `workers` work-groups, partials
+// leased from scratch. Returns false, leaving C untouched, when the partials
+// cannot be leased.
+template <typename T, typename Acc>
+bool gemm_stream_k(hc::accelerator_view accl_view, ScratchPool *scratch,
+                   char transA, char transB, T *A, __int64_t aOffset, T *B,
+                   __int64_t bOffset, T *C, __int64_t cOffset, int M, int N,
+                   int K, int lda, int ldb, int ldc, T alpha, T beta,
+                   int workers) {
+  ScratchDevice<Acc> lease(scratch, accl_view,
+                           gemm_stream_k_partials(workers));
+  Acc *partial = lease.data();
+  if (partial == NULL) return false;
+  if (transA == 'n' && transB == 'n') {
+    gemm_stream_k_launch<T, Acc, 16, 4, 4, 16, 1, false, false>(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        alpha, beta, workers, partial);
+  } else if (transA == 'n') {
+    gemm_stream_k_launch<T, Acc, 16, 4, 4, 16, 1, false, true>(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        alpha, beta, workers, partial);
+  } else if (transB == 'n') {
+    gemm_stream_k_launch<T, Acc, 16, 4, 4, 16, 1, true, false>(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        alpha, beta, workers, partial);
+  } else {
+    gemm_stream_k_launch<T, Acc, 16, 4, 4, 16, 1, true, true>(
+        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
+        alpha, beta, workers, partial);
+  }
+  gemm_stream_k_fixup<T, Acc, 64, 64>(accl_view, partial, workers,
+                                      (K + 15) / 16, C, cOffset, M, N, ldc,
+                                      alpha, beta);
+  return true;
+}
+
+// Device scratch bytes the default schedule of an M x N x K call leases. A
+// schedule a table or the tuner picks instead may want more, and runs
+// unsplit when the pool cannot lease it.
+template <typename T, typename Acc>
+size_t gemm_tiled_workspace(hc::accelerator_view accl_view, int M, int N,
+                            int K) {
+  const int splits = gemm_split_k_splits(accl_view, M, N, K);
+  if (splits > 1) {
+    return ScratchPool::workspaceBytes(sizeof(Acc) *
+                                       gemm_split_k_partials(M, N, splits));
+  }
+  const long long tiles =
+      static_cast<long long>((M + 63) / 64) * ((N + 63) / 64);
+  const int workers = gemm_stream_k_workers<T>(accl_view);
+  if (gemm_stream_k_wanted(tiles, workers, (K + 15) / 16)) {
+    return ScratchPool::workspaceBytes(sizeof(Acc) *
+                                       gemm_stream_k_partials(workers));
+  }
+  return 0;
+}
+
+// K ranges of the SPLIT_K registry variant: as many as gemm_split_k_splits
+// asks, at least two while K has two steps; fewer than two runs unsplit
+inline int gemm_tiled_split_k_ranges(hc::accelerator_view accl_view, int M,
+                                     int N, int K) {
+  const int kIters = (K + 15) / 16;
+  int splits = gemm_split_k_splits(accl_view, M, N, K);
+  if (splits < 2) splits = 2;
+  if (splits > kIters) splits = kIters;
+  return splits;
+}
+
+// Work-groups of the STREAM_K registry variant: the device's resident ones,
+// no more than there are MAC-loop iterations; 0 runs data-parallel
+template <typename T>
+int gemm_tiled_stream_k_groups(hc::accelerator_view accl_view, int M, int N,
+                               int K) {
+  const long long iters = static_cast<long long>((M + 63) / 64) *
+                          ((N + 63) / 64) * ((K + 15) / 16);
+  int workers = gemm_stream_k_workers<T>(accl_view);
+  if (workers > iters) workers = static_cast<int>(iters);
+  return workers;
+}
+
+// SPLIT_K registry variant: K cut into gemm_tiled_split_k_ranges ranges.
+// Runs the kernel unsplit when the partials cannot be leased.
+template <typename T, typename Acc, bool TRANSA, bool TRANSB>
+hcblasStatus gemm_tiled_split_k(hc::accelerator_view accl_view,
+                                ScratchPool *scratch, T *A, __int64_t aOffset,
+                                T *B, __int64_t bOffset, T *C,
+                                __int64_t cOffset, int M, int N, int K,
+                                int lda, int ldb, int ldc, T alpha, T beta) {
+  const int splits = gemm_tiled_split_k_ranges(accl_view, M, N, K);
+  if (splits > 1 &&
+      gemm_split_k<T, Acc>(accl_view, scratch, TRANSA ? 't' : 'n',
+                           TRANSB ? 't' : 'n', A, aOffset, B, bOffset, C,
+                           cOffset, M, N, K, lda, ldb, ldc, alpha, beta,
+                           splits)) {
+    return HCBLAS_SUCCEEDS;
+  }
+  return gemm_tiled<T, Acc, 16, 4, 4, 16, 1, TRANSA, TRANSB>(
+      accl_view, scratch, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda,
+      ldb, ldc, alpha, beta);
+}
+
+// STREAM_K registry variant: gemm_tiled_stream_k_groups work-groups. Runs
+// the kernel data-parallel when the partials cannot be leased.
+template <typename T, typename Acc, bool TRANSA, bool TRANSB>
+hcblasStatus gemm_tiled_stream_k(hc::accelerator_view accl_view,
+                                 ScratchPool *scratch, T *A,
+                                 __int64_t aOffset, T *B, __int64_t bOffset,
+                                 T *C, __int64_t cOffset, int M, int N, int K,
+                                 int lda, int ldb, int ldc, T alpha, T beta) {
+  const int workers = gemm_tiled_stream_k_groups<T>(accl_view, M, N, K);
+  if (workers > 0 &&
+      gemm_stream_k<T, Acc>(accl_view, scratch, TRANSA ? 't' : 'n',
+                            TRANSB ? 't' : 'n', A, aOffset, B, bOffset, C,
+                            cOffset, M, N, K, lda, ldb, ldc, alpha, beta,
+                            workers)) {
+    return HCBLAS_SUCCEEDS;
+  }
+  return gemm_tiled<T, Acc, 16, 4, 4, 16, 1, TRANSA, TRANSB>(
+      accl_view, scratch, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda,
+      ldb, ldc, alpha, beta);
+}
+
+// Registry entries of the two schedules for element type T accumulating in
+// Acc, followed by a comma
+#define GEMM_TILED_SCHEDULES(T, Acc, TRANSA, TRANSB)                          \
+  {{"SPLIT_K", {1, 1, 1}, 16, 4},                                             \
+   gemm_tiled_split_k<T, Acc, TRANSA, TRANSB>},                               \
+      {{"STREAM_K", {1, 1, 1}, 16, 4},                                        \
+       gemm_tiled_stream_k<T, Acc, TRANSA, TRANSB>},
+
+// Launch geometry of registry kernel info for a trace event: the K ranges
+// or persistent work-groups and the fixup pass of SPLIT_K and STREAM_K as
+// they run, the work-group grid of the other kernels
+template <typename T>
+void gemm_tiled_trace(hc::accelerator_view accl_view,
+                      const GemmKernelInfo &info, DispatchTraceEvent *event) {
+  if (strcmp(info.name, "SPLIT_K") == 0) {
+    const int splits =
+        gemm_tiled_split_k_ranges(accl_view, event->M, event->N, event->K);
+    if (splits > 1) {
+      dispatch_trace_split_k(event, 64, 16, splits);
+      return;
+    }
+  } else if (strcmp(info.name, "STREAM_K") == 0) {
+    const int workers = gemm_tiled_stream_k_groups<T>(accl_view, event->M,
+                                                      event->N, event->K);
+    if (workers > 0) {
+      dispatch_trace_stream_k(event, 64, 16, workers);
+      return;
+    }
+  }
+  dispatch_trace_tiled(event, info.tile, info.micro_tile);
+}
+
+// The schedule variant the heuristics want for a column major M x N x K call
+// ("SPLIT_K" when the 64 x 64 blocks of C cannot occupy the device,
+// "STREAM_K" when their last wave would leave much of it idle), or NULL.
+// Dispatch passes it to selection as the default: a user table, the tuning
+// database and the autotuner still override it.
+template <typename T>
+const char *gemm_tiled_schedule_default(hc::accelerator_view accl_view, int M,
+                                        int N, int K) {
+  if (gemm_split_k_splits(accl_view, M, N, K) > 1) return "SPLIT_K";
+  const long long tiles =
+      static_cast<long long>((M + 63) / 64) * ((N + 63) / 64);
+  if (gemm_stream_k_wanted(tiles, gemm_stream_k_workers<T>(accl_view),
+                           (K + 15) / 16)) {
+    return "STREAM_K";
+  }
+  return NULL;
+}
+
+// Row major GEMM has no registry or selection table, so its callers run the
+// default schedule ahead of their own kernels: computes C^T and returns
+// true when one applies and its partials could be leased, otherwise returns
+// false leaving C untouched.
+template <typename T, typename Acc>
+bool gemm_tiled_schedule_rmajor(hc::accelerator_view accl_view,
+                                ScratchPool *scratch, char transA, char transB,
+                                T *A, __int64_t aOffset, T *B,
+                                __int64_t bOffset, T *C, __int64_t cOffset,
+                                int M, int N, int K, int lda, int ldb,
+                                int ldc, T alpha, T beta) {
+  // C^T = op(B)^T * op(A)^T, column major
+  if (gemm_tiled_schedule_default<T>(accl_view, N, M, K) == NULL) {
+    return false;
+  }
+  const int splits = gemm_split_k_splits(accl_view, N, M, K);
+  if (splits > 1) {
+    return gemm_split_k<T, Acc>(accl_view, scratch, transB, transA, B,
+                                bOffset, A, aOffset, C, cOffset, N, M, K, ldb,
+                                lda, ldc, alpha, beta, splits);
+  }
+  return gemm_stream_k<T, Acc>(accl_view, scratch, transB, transA, B, bOffset,
+                               A, aOffset, C, cOffset, N, M, K, ldb, lda, ldc,
+                               alpha, beta,
+                               gemm_stream_k_workers<T>(accl_view));
+}
+
+// X(name, tile, micro rows, micro cols, k step, padding)
+#define GEMM_TILED_VARIANTS(X)             \
+  X(TILED_TS16_MT2X2_K16, 16, 2, 2, 16, 1) \
+  X(TILED_TS16_MT4X4_K16, 16, 4, 4, 16, 1) \
+  X(TILED_TS16_MT6X6_K16, 16, 6, 6, 16, 1) \
+  X(TILED_TS16_MT8X8_K16, 16, 8, 8, 16, 1) \
+  X(TILED_TS16_MT4X8_K16, 16, 4, 8, 16, 1) \
+  X(TILED_TS16_MT8X4_K16, 16, 8, 4, 16, 1) \
+  X(TILED_TS16_MT2X4_K32, 16, 2, 4, 32, 1) \
+  X(TILED_TS16_MT4X4_K32, 16, 4, 4, 32, 1) \
+  X(TILED_TS8_MT4X4_K32, 8, 4, 4, 32, 1)
+
+#endif  // LIB_SRC_BLAS_GEMMGEN_GEMM_TILED_KERNEL_H_
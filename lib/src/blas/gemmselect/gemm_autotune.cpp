@@ -0,0 +1,125 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "./gemm_autotune.h"
+#include <algorithm>
+#include <limits>
+
+size_t GemmTuneKeyHash::operator()(const GemmTuneKey &key) const {
+  size_t h = (static_cast<size_t>(key.precision) << 24) ^
+             (static_cast<size_t>(key.order) << 16) ^
+             (static_cast<size_t>(key.transA) << 8) ^
+             static_cast<size_t>(key.transB);
+  const long long dims[6] = {key.M, key.N, key.K, key.lda, key.ldb, key.ldc};
+  for (int i = 0; i < 6; i++) {
+    h ^= static_cast<size_t>(dims[i]) + 0x9e3779b9 + (h << 6) + (h >> 2);
+  }
+  return h;
+}
+
+GemmAutotuner::GemmAutotuner(int budget, int samples)
+    : budget(budget), samples(std::max(1, samples)) {}
+
+GemmAutotuner::Shard &GemmAutotuner::shard(const GemmTuneKey &key) {
+  return shards[GemmTuneKeyHash()(key) % kShards];
+}
+
+int GemmAutotuner::pinned(const GemmTuneKey &key) {
+  Shard &s = shard(key);
+  std::lock_guard<std::mutex> guard(s.lock);
+  auto it = s.slots.find(key);
+  if (it == s.slots.end() || !it->second.settled) return -1;
+  return it->second.choice;
+}
+
+int GemmAutotuner::next(const GemmTuneKey &key, int count,
+                        const bool *eligible, int coldStart, bool *trial) {
+  *trial = false;
+  Shard &s = shard(key);
+  std::lock_guard<std::mutex> guard(s.lock);
+  auto it = s.slots.find(key);
+  if (it == s.slots.end()) {
+    Slot slot;
+    // The cold start variant is timed first
+    slot.candidates.push_back(coldStart);
+    for (int v = 0; v < count; v++) {
+      if (eligible[v] && v != coldStart) slot.candidates.push_back(v);
+    }
+    slot.best.assign(slot.candidates.size(),
+                     std::numeric_limits<double>::infinity());
+    slot.issued = 0;
+    slot.done = 0;
+    slot.choice = coldStart;
+    slot.settled = false;
+    // Reserve every timed call of the key; pin the cold start when the
+    // budget cannot cover them or there is nothing to choose from
+    const int trials = static_cast<int>(slot.candidates.size()) * samples;
+    int left = budget.load();
+    bool reserved = false;
+    while (slot.candidates.size() > 1 && left >= trials) {
+      if (budget.compare_exchange_weak(left, left - trials)) {
+        reserved = true;
+        break;
+      }
+    }
+    if (!reserved) slot.settled = true;
+    it = s.slots.insert(std::make_pair(key, slot)).first;
+  }
+  Slot &slot = it->second;
+  const int trials = static_cast<int>(slot.candidates.size()) * samples;
+  if (slot.settled || slot.issued >= trials) return slot.choice;
+  *trial = true;
+  return slot.candidates[slot.issued++ % slot.candidates.size()];
+}
+
+bool GemmAutotuner::record(const GemmTuneKey &key, int variant, double ms) {
+  Shard &s = shard(key);
+  std::lock_guard<std::mutex> guard(s.lock);
+  auto it = s.slots.find(key);
+  if (it == s.slots.end() || it->second.settled) return false;
+  Slot &slot = it->second;
+  for (size_t c = 0; c < slot.candidates.size(); c++) {
+    if (slot.candidates[c] == variant) {
+      slot.best[c] = std::min(slot.best[c], ms);
+    }
+  }
+  const int trials = static_cast<int>(slot.candidates.size()) * samples;
+  if (++slot.done < trials) return false;
+  size_t fastest = std::min_element(slot.best.begin(), slot.best.end()) -
+                   slot.best.begin();
+  slot.choice = slot.candidates[fastest];
+  slot.settled = true;
+  return true;
+}
+
+void gemm_tune_db_key(const GemmTuneKey &key, int64_t dbKey[7]) {
+  dbKey[0] = (static_cast<int64_t>(key.precision) << 24) |
+             (static_cast<int64_t>(key.order) << 16) |
+             (static_cast<int64_t>(key.transA) << 8) | key.transB;
+  dbKey[1] = key.M;
+  dbKey[2] = key.N;
+  dbKey[3] = key.K;
+  dbKey[4] = key.lda;
+  dbKey[5] = key.ldb;
+  dbKey[6] = key.ldc;
+}
+
+void gemm_autotuner_release(GemmAutotuner *tuner) { delete tuner; }
@@ -0,0 +1,184 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/*
+* Online GEMM autotuning, opt-in per handle (hcblasSetGemmAutotune). The
+* first calls with an unseen (precision, order, trans, M, N, K, ld) key
+* rotate through the variants that admit the shape and are timed; once every
+* variant has been sampled the fastest is pinned for the key. Each key
+* reserves its timed calls from the tuner's budget up front; keys that no
+* longer fit keep the rule table choice without being timed.
+*
+* With a tuning database (src/blas/tunedb) pinned choices are persisted, and
+* a key found there runs its stored variant without any timing, whether or
+* not the handle tunes.
+*/
+
+#ifndef LIB_SRC_BLAS_GEMMSELECT_GEMM_AUTOTUNE_H_
+#define LIB_SRC_BLAS_GEMMSELECT_GEMM_AUTOTUNE_H_
+
+#include "./gemm_select.h"
+#include "src/blas/tunedb/tuning_db.h"
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Registries larger than this are never tuned
+#define GEMM_TUNE_MAX_VARIANTS 32
+
+struct GemmTuneKey {
+  char precision;
+  char order;
+  char transA;
+  char transB;
+  int M;
+  int N;
+  int K;
+  long long lda;
+  long long ldb;
+  long long ldc;
+
+  bool operator==(const GemmTuneKey &o) const {
+    return precision == o.precision && order == o.order &&
+           transA == o.transA && transB == o.transB && M == o.M && N == o.N &&
+           K == o.K && lda == o.lda && ldb == o.ldb && ldc == o.ldc;
+  }
+};
+
+struct GemmTuneKeyHash {
+  size_t operator()(const GemmTuneKey &key) const;
+};
+
+class GemmAutotuner {
+ public:
+  // budget is the number of timed calls over the tuner's life; each variant
+  // is timed samples times and its fastest sample counts
+  GemmAutotuner(int budget, int samples);
+
+  // Variant pinned for key, -1 while it is unseen or being tuned
+  int pinned(const GemmTuneKey &key);
+
+  // Variant to run for this call. eligible[i] tells whether variant i of
+  // count admits the shape and coldStart is the rule table's pick. Sets
+  // *trial when the call must be timed and passed to record().
+  int next(const GemmTuneKey &key, int count, const bool *eligible,
+           int coldStart, bool *trial);
+  // Returns true when this sample settled the key
+  bool record(const GemmTuneKey &key, int variant, double ms);
+
+  int budget_left() const { return budget.load(); }
+
+ private:
+  struct Slot {
+    std::vector<int> candidates;
+    std::vector<double> best;
+    int issued;
+    int done;
+    // The variant that runs outside trials; final once settled
+    int choice;
+    bool settled;
+  };
+  struct Shard {
+    std::mutex lock;
+    std::unordered_map<GemmTuneKey, Slot, GemmTuneKeyHash> slots;
+  };
+  static const int kShards = 16;
+
+  Shard &shard(const GemmTuneKey &key);
+
+  std::atomic<int> budget;
+  const int samples;
+  Shard shards[kShards];
+};
+
+// Database key of a GEMM call
+void gemm_tune_db_key(const GemmTuneKey &key, int64_t dbKey[7]);
+
+// Picks the registry entry for a call, as gemm_select_kernel does with
+// preferred when tuner and db are NULL; a pinned or stored choice overrides
+// preferred. *trial is set when the caller must time the call and report it
+// with gemm_autotune_record. A non-NULL reason receives where the choice
+// came from: "table", "tuned", "trial" or "tuning_db".
+template <typename Entry>
+const Entry *gemm_autotune_kernel(GemmAutotuner *tuner, const TuningDb *db,
+                                  const GemmTuneKey &key,
+                                  const Entry *entries, int count,
+                                  bool *trial, const char **reason = NULL,
+                                  const char *preferred = NULL) {
+  const char *unused;
+  if (reason == NULL) reason = &unused;
+  *trial = false;
+  const GemmSelectKey selectKey = {key.precision, key.order, key.transA,
+                                   key.transB, false};
+  int variant = tuner != NULL ? tuner->pinned(key) : -1;
+  *reason = "tuned";
+  if (variant >= 0) return &entries[variant];
+  int64_t dbKey[7];
+  int64_t stored;
+  gemm_tune_db_key(key, dbKey);
+  if (db != NULL && db->lookup(TUNING_GEMM_KERNEL, dbKey, &stored)) {
+    for (int e = 0; e < count; e++) {
+      if (static_cast<int64_t>(tuning_hash(entries[e].info.name)) == stored &&
+          entries[e].info.admits(key.M, key.N, key.K)) {
+        *reason = "tuning_db";
+        return &entries[e];
+      }
+    }
+  }
+  *reason = "table";
+  if (tuner == NULL || count > GEMM_TUNE_MAX_VARIANTS) {
+    return gemm_select_kernel(selectKey, key.M, key.N, key.K, entries, count,
+                              preferred);
+  }
+  const Entry *cold = gemm_select_kernel(selectKey, key.M, key.N, key.K,
+                                         entries, count, preferred);
+  bool eligible[GEMM_TUNE_MAX_VARIANTS];
+  for (int e = 0; e < count; e++) {
+    eligible[e] = entries[e].info.admits(key.M, key.N, key.K);
+  }
+  variant = tuner->next(key, count, eligible,
+                        static_cast<int>(cold - entries), trial);
+  if (*trial) {
+    *reason = "trial";
+  } else if (&entries[variant] != cold) {
+    *reason = "tuned";
+  }
+  return &entries[variant];
+}
+
+// Reports a timed trial; the key's final choice is queued for db
+template <typename Entry>
+void gemm_autotune_record(GemmAutotuner *tuner, TuningDb *db,
+                          const GemmTuneKey &key, const Entry *entries,
+                          int variant, double ms) {
+  if (!tuner->record(key, variant, ms) || db == NULL) return;
+  TuningRecord record;
+  record.kind = TUNING_GEMM_KERNEL;
+  record.reserved = 0;
+  gemm_tune_db_key(key, record.key);
+  record.value =
+      static_cast<int64_t>(tuning_hash(entries[tuner->pinned(key)].info.name));
+  db->queue(record);
+}
+
+#endif  // LIB_SRC_BLAS_GEMMSELECT_GEMM_AUTOTUNE_H_
@@ -0,0 +1,489 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./gemm_select.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+// Selection tuned on Fiji for column major SGEMM and DGEMM, transcribed from
+// the original dispatch ladders. Kernels with divisibility constraints (the
+// M128/M064/M096 variants) are skipped by the registry when the shape does
+// not fit, exactly like the ladders' modulo tests. The generated
+// TILED_TS16_MT{2X2,4X4,6X6}_K16 kernels stand in for the hand-written
+// MICRO_NBK_M_N_K_TS16XMTS{2,4,6} ones the ladders named.
+static const char kBuiltinTable[] =
+    "# s C n n: gemm_NoTransAB\n"
+    "s C n n 0 :6700     *         *         -   "
+    "MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2\n"
+    "s C n n 0 *         *         *         -   "
+    "MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2\n"
+    "s C n n 0 *         *         *         -   "
+    "MICRO_NBK_MX064_NX064_KX16_TS16XMTS4\n"
+    "s C n n 0 *         *         *         -   "
+    "MICRO_NBK_MX096_NX096_KX16_TS16XMTS6\n"
+    "s C n n 0 :500      :700      *         -   TILED_TS16_MT2X2_K16\n"
+    "s C n n 0 :700      :500      *         -   TILED_TS16_MT2X2_K16\n"
+    "s C n n 0 *         *         :19       -   TILED_TS16_MT2X2_K16\n"
+    "s C n n 0 :19       *         *         -   TILED_TS16_MT2X2_K16\n"
+    "s C n n 0 *         :19       *         -   TILED_TS16_MT2X2_K16\n"
+    "s C n n 0 *         *         :5000     -   TILED_TS16_MT4X4_K16\n"
+    "s C n n 0 :5000     :8000     :8000     -   TILED_TS16_MT4X4_K16\n"
+    "s C n n 0 :8000     :5000     :8000     -   TILED_TS16_MT4X4_K16\n"
+    "s C n n 0 :3000     :9000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "s C n n 0 :9000     :3000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "s C n n 0 :7000     :4000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "s C n n 0 :4000     :7000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "s C n n 0 :5000     :6000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "s C n n 0 :6000     :5000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "s C n n 0 :50000    :50000    *         -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C n n 0 *         *         *         -   TILED_TS16_MT6X6_K16\n"
+    "# s C n t: gemm_NoTransA\n"
+    "s C n t 0 :4000     *         *         -   "
+    "MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2\n"
+    "s C n t 0 *         *         *         -   "
+    "MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2\n"
+    "s C n t 0 *         *         *         -   "
+    "MICRO_NBK_M064_N064_K064_TS16XMTS4\n"
+    "s C n t 0 *         *         *         -   "
+    "MICRO_NBK_M096_N096_K096_TS16XMTS6\n"
+    "s C n t 0 7000:     9000:     4000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C n t 0 9000:     7000:     4000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C n t 0 7000:     7000:     6000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C n t 0 5000:     7000:     8500:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C n t 0 7000:     5000:     8500:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C n t 0 9000:     *         31:       -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2\n"
+    "s C n t 0 *         9000:     31:       -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2\n"
+    "s C n t 0 8000:     *         4000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2\n"
+    "s C n t 0 *         8000:     4000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2\n"
+    "s C n t 0 7000:     *         6000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2\n"
+    "s C n t 0 *         7000:     6000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2\n"
+    "s C n t 0 700:      *         8500:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2\n"
+    "s C n t 0 *         700:      8500:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2\n"
+    "s C n t 0 :500      :1000     *         -   TILED_TS16_MT2X2_K16\n"
+    "s C n t 0 :1000     :500      *         -   TILED_TS16_MT2X2_K16\n"
+    "s C n t 0 *         *         :30       -   TILED_TS16_MT2X2_K16\n"
+    "s C n t 0 :8999     :8999     :4999     -   TILED_TS16_MT4X4_K16\n"
+    "s C n t 0 :7999     :7999     :5999     -   TILED_TS16_MT4X4_K16\n"
+    "s C n t 0 :6999     :6999     :7999     -   TILED_TS16_MT4X4_K16\n"
+    "s C n t 0 :5999     :5999     :8999     -   TILED_TS16_MT4X4_K16\n"
+    "s C n t 0 *         *         *         -   TILED_TS16_MT6X6_K16\n"
+    "# s C t n: gemm_NoTransB\n"
+    "s C t n 0 :5999     :599      :9        -   STEP_TS8XSS8\n"
+    "s C t n 0 :1799     :79       1801:5999 -   STEP_TS8XSS8\n"
+    "s C t n 0 :599      :599      :5999     -   STEP_NBK_TS16XSS16\n"
+    "s C t n 0 1801:5999 :9        :599      -   STEP_NBK_TS16XSS16\n"
+    "s C t n 0 1801:5999 :9        1801:9999 -   STEP_NBK_TS16XSS16\n"
+    "s C t n 0 :9        :599      :1799     -   STEP_NBK_TS16XSS16\n"
+    "s C t n 0 :599      :1799     :9        -   STEP_NBK_TS16XSS16\n"
+    "s C t n 0 4001:     51:100    8001:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2\n"
+    "s C t n 0 1801:5999 101:599   :599      -   MICRO_NBK_TS16XMTS2\n"
+    "s C t n 0 1801:5999 101:599   1801:5999 -   MICRO_NBK_TS16XMTS2\n"
+    "s C t n 0 :1799     :599      :9        -   MICRO_NBK_TS16XMTS2\n"
+    "s C t n 0 1801:5999 :299      1801:5999 M=K MICRO_NBK_TS16XMTS2\n"
+    "s C t n 0 :9999     :199      *         M=K MICRO_TS16XMTS2\n"
+    "s C t n 0 :599      :1799     :599      -   MICRO_TS16XMTS2\n"
+    "s C t n 0 :1799     :99       :1799     -   MICRO_TS16XMTS2\n"
+    "s C t n 0 601:5999  :299      1801:9999 M<K MICRO_TS16XMTS2\n"
+    "s C t n 0 :2000     *         *         -   "
+    "MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2\n"
+    "s C t n 0 *         *         *         -   "
+    "MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2\n"
+    "s C t n 0 2001:3299 2001:3299 *         -   "
+    "MICRO_NBK_M064_N064_K064_TS16XMTS4\n"
+    "s C t n 0 2001:     2001:     *         -   "
+    "MICRO_NBK_M096_N096_K096_TS16XMTS6\n"
+    "s C t n 0 :2000     :5000     :20       -   TILED_TS16_MT2X2_K16\n"
+    "s C t n 0 4000:     5000:     1500:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C t n 0 5000:     3000:     1500:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C t n 0 7000:     1000:     1500:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C t n 0 3000:     5000:     3000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C t n 0 4000:     3000:     3000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C t n 0 6000:     1000:     3000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C t n 0 2000:     5000:     5000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C t n 0 3000:     2000:     5000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C t n 0 5000:     1000:     5000:     -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "s C t n 0 *         *         *         -   MICRO_NBK_TS16XMTS2\n"
+    "# s C t t: gemm_TransAB\n"
+    "s C t t 0 :599      :599      :9        -   STEP_NBK_TS8XSS8\n"
+    "s C t t 0 :1799     :599      :599      -   STEP_NBK_TS8XSS8\n"
+    "s C t t 0 :599      :599      :1799     -   STEP_NBK_TS16XSS16\n"
+    "s C t t 0 :1799     :599      :1799     -   STEP_NBK_TS16XSS16\n"
+    "s C t t 0 :1799     :1799     :9        -   STEP_NBK_TS16XSS16\n"
+    "s C t t 0 *         *         *         -   MICRO_TS16XMTS2\n"
+    "# d C n n: former dgemm gemm_NoTransAB\n"
+    "d C n n 0 :6700     *         *         -   "
+    "MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2\n"
+    "d C n n 0 *         *         *         -   "
+    "MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2\n"
+    "d C n n 0 *         *         *         -   "
+    "MICRO_NBK_MX064_NX064_KX16_TS16XMTS4\n"
+    "d C n n 0 *         *         *         -   "
+    "MICRO_NBK_MX096_NX096_KX16_TS16XMTS6\n"
+    "d C n n 0 :500      :700      *         -   TILED_TS16_MT2X2_K16\n"
+    "d C n n 0 :700      :500      *         -   TILED_TS16_MT2X2_K16\n"
+    "d C n n 0 *         *         :19       -   TILED_TS16_MT2X2_K16\n"
+    "d C n n 0 *         *         :5000     -   TILED_TS16_MT4X4_K16\n"
+    "d C n n 0 :5000     :8000     :8000     -   TILED_TS16_MT4X4_K16\n"
+    "d C n n 0 :8000     :5000     :8000     -   TILED_TS16_MT4X4_K16\n"
+    "d C n n 0 :3000     :9000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "d C n n 0 :9000     :3000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "d C n n 0 :7000     :4000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "d C n n 0 :4000     :7000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "d C n n 0 :5000     :6000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "d C n n 0 :6000     :5000     :10000    -   TILED_TS16_MT4X4_K16\n"
+    "d C n n 0 :50000    :50000    *         -   "
+    "MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2\n"
+    "d C n n 0 *         *         *         -   TILED_TS16_MT6X6_K16\n"
+    "# d C n t: former dgemm gemm_NoTransA\n"
+    "d C n t 0 *         *         *         -   "
+    "MICRO_NBK_M064_N064_K064_TS16XMTS4\n"
+    "d C n t 0 *         *         *         -   "
+    "MICRO_NBK_M096_N096_K096_TS16XMTS6\n"
+    "d C n t 0 :500      :1000     *         -   TILED_TS16_MT2X2_K16\n"
+    "d C n t 0 :1000     :500      *         -   TILED_TS16_MT2X2_K16\n"
+    "d C n t 0 *         *         :19       -   TILED_TS16_MT2X2_K16\n"
+    "d C n t 0 :8999     :8999     :4999     -   TILED_TS16_MT4X4_K16\n"
+    "d C n t 0 :7999     :7999     :5999     -   TILED_TS16_MT4X4_K16\n"
+    "d C n t 0 :6999     :6999     :7999     -   TILED_TS16_MT4X4_K16\n"
+    "d C n t 0 :5999     :5999     :8999     -   TILED_TS16_MT4X4_K16\n"
+    "d C n t 0 *         *         *         -   TILED_TS16_MT6X6_K16\n"
+    "# d C t n: former dgemm gemm_NoTransB\n"
+    "d C t n 0 2001:3299 2001:3299 *         -   "
+    "MICRO_NBK_M064_N064_K064_TS16XMTS4\n"
+    "d C t n 0 2001:     2001:     *         -   "
+    "MICRO_NBK_M096_N096_K096_TS16XMTS6\n"
+    "d C t n 0 :800      :800      :800      -   TILED_TS16_MT2X2_K16\n"
+    "d C t n 0 :2500     :2500     :2500     -   TILED_TS16_MT4X4_K16\n"
+    "d C t n 0 *         *         *         M=N TILED_TS16_MT6X6_K16\n"
+    "d C t n 0 :999      :999      10001:    -   largeK\n"
+    "d C t n 0 :5999     :599      :9        -   STEP_TS8XSS8\n"
+    "d C t n 0 :1799     :79       1801:5999 -   STEP_TS8XSS8\n"
+    "d C t n 0 :599      :599      :5999     -   STEP_NBK_TS16XSS16\n"
+    "d C t n 0 1801:5999 :9        :599      -   STEP_NBK_TS16XSS16\n"
+    "d C t n 0 1801:5999 :9        1801:9999 -   STEP_NBK_TS16XSS16\n"
+    "d C t n 0 :9        :599      :1799     -   STEP_NBK_TS16XSS16\n"
+    "d C t n 0 :599      :1799     :9        -   STEP_NBK_TS16XSS16\n"
+    "d C t n 0 1801:5999 101:599   :599      -   MICRO_NBK_TS16XMTS2\n"
+    "d C t n 0 1801:5999 101:599   1801:5999 -   MICRO_NBK_TS16XMTS2\n"
+    "d C t n 0 :1799     :599      :9        -   MICRO_NBK_TS16XMTS2\n"
+    "d C t n 0 1801:5999 :299      1801:5999 M=K MICRO_NBK_TS16XMTS2\n"
+    "d C t n 0 :9999     :199      *         M=K MICRO_TS16XMTS2\n"
+    "d C t n 0 :599      :1799     :599      -   MICRO_TS16XMTS2\n"
+    "d C t n 0 :1799     :99       :1799     -   MICRO_TS16XMTS2\n"
+    "d C t n 0 601:5999  :299      1801:9999 M<K MICRO_TS16XMTS2\n"
+    "d C t n 0 *         *         *         -   MICRO_NBK_TS16XMTS2\n"
+    "# d C t t: former dgemm gemm_TransAB\n"
+    "d C t t 0 :599      :599      :9        -   STEP_NBK_TS8XSS8\n"
+    "d C t t 0 :1799     :599      :599      -   STEP_NBK_TS8XSS8\n"
+    "d C t t 0 :599      :599      :1799     -   STEP_NBK_TS16XSS16\n"
+    "d C t t 0 :1799     :599      :1799     -   STEP_NBK_TS16XSS16\n"
+    "d C t t 0 :1799     :1799     :9        -   STEP_NBK_TS16XSS16\n"
+    "d C t t 0 *         *         *         -   MICRO_TS16XMTS2\n"
+    "# Batched s C n n\n"
+    "s C n n 1 10001:    :499      *         -   batch_largeM\n"
+    "s C n n 1 601:1799  :199      601:1799  -   batch_MICRO_TS16XMTS2\n"
+    "s C n n 1 601:1799  :599      :9        -   batch_STEP_TS8XSS8\n"
+    "s C n n 1 :49       :1799     :9        -   batch_STEP_TS8XSS8\n"
+    "s C n n 1 :599      :599      :5999     -   batch_STEP_NBK_TS16XSS16\n"
+    "s C n n 1 1801:9999 :9        601:9999  -   batch_STEP_NBK_TS16XSS16\n"
+    "s C n n 1 :9        601:1799  :5999     -   batch_STEP_NBK_TS16XSS16\n"
+    "s C n n 1 1801:5999 :199      *         M=K batch_MICRO_NBK_TS16XMTS2\n"
+    "s C n n 1 1801:9999 :199      1801:9999 -   batch_MICRO_NBK_TS16XMTS2\n"
+    "s C n n 1 :9999     :1799     :9        -   batch_MICRO_NBK_TS16XMTS2\n"
+    "s C n n 1 1801:5999 :599      :199      -   batch_MICRO_NBK_TS16XMTS2\n"
+    "s C n n 1 6001:9999 :599      :9        -   batch_STEP_TS8XSS8\n"
+    "s C n n 1 *         *         *         -   batch_MICRO_NBK_TS16XMTS2\n"
+    "# Batched s C n t\n"
+    "s C n t 1 10001:    :499      *         -   batch_largeM\n"
+    "s C n t 1 1801:5999 601:1799  :599      -   batch_MICRO_NBK_TS16XMTS2\n"
+    "s C n t 1 601:1799  :599      :9        -   batch_STEP_TS8XSS8\n"
+    "s C n t 1 1801:5999 1801:5999 :9        -   batch_MICRO_TS16XMTS2\n"
+    "s C n t 1 :599      :599      :5999     -   batch_STEP_TS16XSS16\n"
+    "s C n t 1 1801:5999 :9        :1799     -   batch_STEP_TS16XSS16\n"
+    "s C n t 1 :9        :1799     1801:5999 -   batch_STEP_TS16XSS16\n"
+    "s C n t 1 :1799     :9        :599      -   batch_STEP_NBK_TS16XSS16\n"
+    "s C n t 1 :9        :599      :1799     -   batch_STEP_NBK_TS16XSS16\n"
+    "s C n t 1 :599      :1799     :9        -   batch_STEP_NBK_TS16XSS16\n"
+    "s C n t 1 *         *         *         -   batch_MICRO_TS16XMTS2\n"
+    "# Batched s C t n\n"
+    "s C t n 1 10001:    :499      *         -   batch_largeM\n"
+    "s C t n 1 :5999     :599      :9        -   batch_STEP_TS8XSS8\n"
+    "s C t n 1 :1799     :79       1801:5999 -   batch_STEP_TS8XSS8\n"
+    "s C t n 1 :599      :599      :5999     -   batch_STEP_NBK_TS16XSS16\n"
+    "s C t n 1 1801:5999 :9        :599      -   batch_STEP_NBK_TS16XSS16\n"
+    "s C t n 1 1801:5999 :9        1801:9999 -   batch_STEP_NBK_TS16XSS16\n"
+    "s C t n 1 :9        :599      :1799     -   batch_STEP_NBK_TS16XSS16\n"
+    "s C t n 1 :599      :1799     :9        -   batch_STEP_NBK_TS16XSS16\n"
+    "s C t n 1 1801:5999 101:599   :599      -   batch_MICRO_NBK_TS16XMTS2\n"
+    "s C t n 1 1801:5999 101:599   1801:5999 -   batch_MICRO_NBK_TS16XMTS2\n"
+    "s C t n 1 :1799     :599      :9        -   batch_MICRO_NBK_TS16XMTS2\n"
+    "s C t n 1 1801:5999 :299      1801:5999 M=K batch_MICRO_NBK_TS16XMTS2\n"
+    "s C t n 1 :9999     :199      *         M=K batch_MICRO_TS16XMTS2\n"
+    "s C t n 1 :599      :1799     :599      -   batch_MICRO_TS16XMTS2\n"
+    "s C t n 1 :1799     :99       :1799     -   batch_MICRO_TS16XMTS2\n"
+    "s C t n 1 601:5999  :299      1801:9999 M<K batch_MICRO_TS16XMTS2\n"
+    "s C t n 1 *         *         *         -   batch_MICRO_NBK_TS16XMTS2\n"
+    "# Batched s C t t\n"
+    "s C t t 1 :599      :599      :9        -   batch_STEP_NBK_TS8XSS8\n"
+    "s C t t 1 :1799     :599      :599      -   batch_STEP_NBK_TS8XSS8\n"
+    "s C t t 1 :599      :599      :1799     -   batch_STEP_NBK_TS16XSS16\n"
+    "s C t t 1 :1799     :599      :1799     -   batch_STEP_NBK_TS16XSS16\n"
+    "s C t t 1 :1799     :1799     :9        -   batch_STEP_NBK_TS16XSS16\n"
+    "s C t t 1 *         *         *         -   batch_MICRO_TS16XMTS2\n";
+
+bool GemmSelectRule::matches(int M, int N, int K) const {
+  const int dims[3] = {M, N, K};
+  for (int d = 0; d < 3; d++) {
+    if (dims[d] < lo[d] || dims[d] > hi[d]) return false;
+  }
+  if (relation == GEMM_REL_M_EQ_K) return M == K;
+  if (relation == GEMM_REL_M_EQ_N) return M == N;
+  if (relation == GEMM_REL_M_LT_K) return M < K;
+  return true;
+}
+
+unsigned int GemmSelectionTable::pack(const GemmSelectKey &key) {
+  return (static_cast<unsigned char>(key.precision) << 24) |
+         (static_cast<unsigned char>(key.order) << 16) |
+         (static_cast<unsigned char>(key.transA) << 8) |
+         (static_cast<unsigned char>(key.transB) << 1) | (key.batched ? 1 : 0);
+}
+
+// Parses '*' or lo:hi with optional bounds
+static bool parse_range(const std::string &tok, int *lo, int *hi) {
+  *lo = INT_MIN;
+  *hi = INT_MAX;
+  if (tok == "*") return true;
+  size_t colon = tok.find(':');
+  if (colon == std::string::npos) return false;
+  std::string parts[2] = {tok.substr(0, colon), tok.substr(colon + 1)};
+  int *bounds[2] = {lo, hi};
+  for (int i = 0; i < 2; i++) {
+    if (parts[i].empty()) continue;
+    char *end = NULL;
+    long v = strtol(parts[i].c_str(), &end, 10);
+    if (*end != '\0' || v < INT_MIN || v > INT_MAX) return false;
+    *bounds[i] = static_cast<int>(v);
+  }
+  return *lo <= *hi;
+}
+
+static bool parse_flag(const std::string &tok, const char *allowed,
+                       char *out) {
+  if (tok.size() != 1) return false;
+  for (const char *a = allowed; *a != '\0'; a++) {
+    if (tok[0] == *a) {
+      *out = *a;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Names tables written before the TS16XMTS family moved to the generator
+static std::string retired_kernel_alias(const std::string &name) {
+  static const char *const kAliases[][2] = {
+      {"MICRO_NBK_M_N_K_TS16XMTS2", "TILED_TS16_MT2X2_K16"},
+      {"MICRO_NBK_M_N_K_TS16XMTS4", "TILED_TS16_MT4X4_K16"},
+      {"MICRO_NBK_M_N_K_TS16XMTS6", "TILED_TS16_MT6X6_K16"}};
+  for (size_t i = 0; i < sizeof(kAliases) / sizeof(kAliases[0]); i++) {
+    if (name == kAliases[i][0]) return kAliases[i][1];
+  }
+  return name;
+}
+
+bool GemmSelectionTable::parse(const std::string &text, std::string *error) {
+  std::map<unsigned int, std::vector<GemmSelectRule> > parsed = table;
+  std::istringstream lines(text);
+  std::string line;
+  int line_no = 0;
+  while (std::getline(lines, line)) {
+    line_no++;
+    size_t hash = line.find('#');
+    if (hash != std::string::npos) line.erase(hash);
+    std::istringstream fields(line);
+    std::vector<std::string> tok;
+    std::string t;
+    while (fields >> t) tok.push_back(t);
+    if (tok.empty()) continue;
+
+    GemmSelectKey key;
+    GemmSelectRule rule;
+    char batched = '0';
+    bool ok = tok.size() == 10 &&
+              parse_flag(tok[0], "sdhcz", &key.precision) &&
+              parse_flag(tok[1], "CR", &key.order) &&
+              parse_flag(tok[2], "nt", &key.transA) &&
+              parse_flag(tok[3], "nt", &key.transB) &&
+              parse_flag(tok[4], "01", &batched);
+    for (int d = 0; ok && d < 3; d++) {
+      ok = parse_range(tok[5 + d], &rule.lo[d], &rule.hi[d]);
+    }
+    if (ok) {
+      if (tok[8] == "-") {
+        rule.relation = GEMM_REL_NONE;
+      } else if (tok[8] == "M=K") {
+        rule.relation = GEMM_REL_M_EQ_K;
+      } else if (tok[8] == "M=N") {
+        rule.relation = GEMM_REL_M_EQ_N;
+      } else if (tok[8] == "M<K") {
+        rule.relation = GEMM_REL_M_LT_K;
+      } else {
+        ok = false;
+      }
+    }
+    if (!ok) {
+      if (error != NULL) {
+        std::ostringstream msg;
+        msg << "line " << line_no << ": expected 'prec order transA transB "
+            << "batched M N K relation kernel'";
+        *error = msg.str();
+      }
+      return false;
+    }
+    key.batched = batched == '1';
+    rule.kernel = retired_kernel_alias(tok[9]);
+    parsed[pack(key)].push_back(rule);
+  }
+  table.swap(parsed);
+  return true;
+}
+
+bool GemmSelectionTable::load(const char *path, std::string *error) {
+  std::ifstream in(path);
+  if (!in) {
+    if (error != NULL) *error = "cannot open file";
+    return false;
+  }
+  std::ostringstream text;
+  text << in.rdbuf();
+  return parse(text.str(), error);
+}
+
+const std::vector<GemmSelectRule> &GemmSelectionTable::rules(
+    const GemmSelectKey &key) const {
+  static const std::vector<GemmSelectRule> none;
+  std::map<unsigned int, std::vector<GemmSelectRule> >::const_iterator it =
+      table.find(pack(key));
+  return it == table.end() ? none : it->second;
+}
+
+// HGEMM shared the SGEMM ladders and registers the same variants, so its
+// built-in rules are the column major, non-batched 's' rules
+static std::string hgemm_rules(const char *table) {
+  std::istringstream lines(table);
+  std::string line, rules;
+  while (std::getline(lines, line)) {
+    if (line.compare(0, 4, "s C ") != 0 || line.compare(8, 2, "0 ") != 0) {
+      continue;
+    }
+    rules += 'h' + line.substr(1) + '\n';
+  }
+  return rules;
+}
+
+const GemmSelectionTable &gemm_builtin_table() {
+  static GemmSelectionTable *builtin = NULL;
+  static std::once_flag once;
+  std::call_once(once, [] {
+    builtin = new GemmSelectionTable();
+    std::string error;
+    if (!builtin->parse(kBuiltinTable, &error) ||
+        !builtin->parse(hgemm_rules(kBuiltinTable), &error)) {
+      fprintf(stderr, "hcblas: built-in GEMM table: %s\n", error.c_str());
+      abort();
+    }
+  });
+  return *builtin;
+}
+
+// Published once by gemm_selection_init and never freed, so references
+// handed out by gemm_active_table stay valid
+static std::atomic<const GemmSelectionTable *> loaded_table(NULL);
+
+const GemmSelectionTable &gemm_active_table() {
+  const GemmSelectionTable *table = loaded_table.load();
+  return table != NULL ? *table : gemm_builtin_table();
+}
+
+void gemm_selection_init() {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    const char *path = getenv("HCBLAS_GEMM_TABLE");
+    if (path == NULL || *path == '\0') return;
+    GemmSelectionTable *table = new GemmSelectionTable();
+    std::string error;
+    if (!table->load(path, &error)) {
+      fprintf(stderr, "hcblas: ignoring GEMM table %s: %s\n", path,
+              error.c_str());
+      delete table;
+      return;
+    }
+    loaded_table.store(table);
+  });
+}
+
+int gemm_split_k_count(long long tiles, int workers, long long K,
+                       long long minK) {
+  if (tiles <= 0 || tiles >= workers || minK <= 0) return 1;
+  long long splits = (workers + tiles - 1) / tiles;
+  splits = std::min(splits, K / minK);
+  splits = std::min(splits, 64LL);
+  return static_cast<int>(std::max(splits, 1LL));
+}
+
+bool gemm_stream_k_wanted(long long tiles, int workers, long long kIters) {
+  if (workers <= 0 || tiles <= workers || kIters < 8) return false;
+  const long long waves = (tiles + workers - 1) / workers;
+  // Useful share of the launched slots below 80%
+  return tiles * 5 < waves * workers * 4;
+}
@@ -0,0 +1,178 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Data driven GEMM kernel selection. Each precision/transpose combination
+* registers its kernel variants with the shapes they can handle, and an
+* ordered rule table maps (precision, order, transA, transB, batched) and
+* M/N/K ranges to a variant name. The first rule whose ranges contain the
+* call and whose kernel admits the shape wins. The built-in table is the
+* tuning the library ships with; HCBLAS_GEMM_TABLE names a file in the same
+* format, loaded when the first handle is created, whose rules override the
+* built-in ones for the shapes they match. Shapes no file rule admits take
+* the dispatch routine's default, if any (the SPLIT_K or STREAM_K schedule
+* the heuristics want), and otherwise follow the built-in rules.
+*
+* Table format, one rule per line, '#' starts a comment:
+*
+*   prec order transA transB batched  M  N  K  relation  kernel
+*   s    C     n      n      0        :6700  *  *  -  MICRO_NBK_..._MB2
+*
+* prec is s/d/h/c/z, order C or R, trans n or t, batched 0 or 1. A range is
+* '*' or lo:hi (inclusive, either bound may be omitted). relation is '-',
+* 'M=K', 'M=N' or 'M<K'. The retired kernel names MICRO_NBK_M_N_K_TS16XMTS2,
+* 4 and 6 still parse, as the TILED_TS16_MT{2X2,4X4,6X6}_K16 kernels that
+* replaced them.
+*/
+
+#ifndef LIB_SRC_BLAS_GEMMSELECT_GEMM_SELECT_H_
+#define LIB_SRC_BLAS_GEMMSELECT_GEMM_SELECT_H_
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+struct GemmSelectKey {
+  char precision;
+  char order;
+  char transA;
+  char transB;
+  bool batched;
+};
+
+enum GemmRelation {
+  GEMM_REL_NONE = 0,
+  GEMM_REL_M_EQ_K,
+  GEMM_REL_M_EQ_N,
+  GEMM_REL_M_LT_K
+};
+
+struct GemmSelectRule {
+  int lo[3];
+  int hi[3];
+  GemmRelation relation;
+  std::string kernel;
+
+  bool matches(int M, int N, int K) const;
+};
+
+// Static description of a kernel variant
+struct GemmKernelInfo {
+  const char *name;
+  // M, N and K must be multiples of these for the kernel to be correct
+  int multiple[3];
+  // Work-group tile edge and elements per work-item along it (1 for the
+  // STEP kernels, which compute one element each)
+  int tile;
+  int micro_tile;
+
+  bool admits(int M, int N, int K) const {
+    return M % multiple[0] == 0 && N % multiple[1] == 0 &&
+           K % multiple[2] == 0;
+  }
+};
+
+class GemmSelectionTable {
+ public:
+  // Appends the rules in text; on failure returns false, describes the first
+  // bad line in *error and leaves the table unchanged
+  bool parse(const std::string &text, std::string *error);
+  bool load(const char *path, std::string *error);
+
+  // Rules for key in table order (empty when the table has none)
+  const std::vector<GemmSelectRule> &rules(const GemmSelectKey &key) const;
+
+ private:
+  static unsigned int pack(const GemmSelectKey &key);
+  std::map<unsigned int, std::vector<GemmSelectRule> > table;
+};
+
+// Table shipped with the library
+const GemmSelectionTable &gemm_builtin_table();
+
+// User table: the HCBLAS_GEMM_TABLE file when one was loaded, the built-in
+// table otherwise. Selection tries it before the built-in table.
+const GemmSelectionTable &gemm_active_table();
+
+// Loads HCBLAS_GEMM_TABLE once per process. Called on handle creation; a
+// file that cannot be read or parsed is reported and the built-in table
+// stays in effect.
+void gemm_selection_init();
+
+// First entry named kernel that admits the shape, or NULL
+template <typename Entry>
+const Entry *gemm_select_entry(const char *kernel, int M, int N, int K,
+                               const Entry *entries, int count) {
+  for (int e = 0; e < count; e++) {
+    if (strcmp(kernel, entries[e].info.name) == 0 &&
+        entries[e].info.admits(M, N, K)) {
+      return &entries[e];
+    }
+  }
+  return NULL;
+}
+
+// Picks the registry entry for a call. Entry is any struct with a
+// GemmKernelInfo member named info. A user table (HCBLAS_GEMM_TABLE) is
+// tried first; then preferred, the caller's default for the shape (such as
+// gemm_tiled_schedule_default), when non-NULL and admissible; then the
+// built-in rules. Registries list a kernel that admits every shape last as
+// the final fallback.
+template <typename Entry>
+const Entry *gemm_select_kernel(const GemmSelectKey &key, int M, int N, int K,
+                                const Entry *entries, int count,
+                                const char *preferred = NULL) {
+  const GemmSelectionTable *tables[2] = {&gemm_active_table(),
+                                         &gemm_builtin_table()};
+  for (int t = 0; t < 2; t++) {
+    if (t == 0 && tables[0] == tables[1]) continue;
+    if (t == 1 && preferred != NULL) {
+      const Entry *entry =
+          gemm_select_entry(preferred, M, N, K, entries, count);
+      if (entry != NULL) return entry;
+    }
+    const std::vector<GemmSelectRule> &rules = tables[t]->rules(key);
+    for (size_t r = 0; r < rules.size(); r++) {
+      if (!rules[r].matches(M, N, K)) continue;
+      const Entry *entry =
+          gemm_select_entry(rules[r].kernel.c_str(), M, N, K, entries, count);
+      if (entry != NULL) return entry;
+    }
+  }
+  return &entries[count - 1];
+}
+
+// Split-K: the number of consecutive K ranges to compute as separate partial
+// products when the tiles of C (work-groups on a device, micro tiles on the
+// host) number fewer than the workers able to run them. Each range keeps at
+// least minK of K; 1 means no split.
+int gemm_split_k_count(long long tiles, int workers, long long K,
+                       long long minK);
+
+// Stream-K: true when a grid of `tiles` blocks run in waves of `workers`
+// would leave more than a fifth of the launched slots idle (1.1 waves use
+// 55% of two) and every block has enough MAC-loop iterations (kIters) to
+// share between workers
+bool gemm_stream_k_wanted(long long tiles, int workers, long long kIters);
+
+#endif  // LIB_SRC_BLAS_GEMMSELECT_GEMM_SELECT_H_
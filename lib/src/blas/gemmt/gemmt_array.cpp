@@ -0,0 +1,272 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/level3/level3_triangle.h"
+#include <utility>
+
+namespace {
+
+// Shared by the four precisions: checks the call, hands CPU accelerator
+// calls to host_gemmt and folds row major layouts into the column major
+// triangle update (C^T = op(B)^T * op(A)^T swaps the operands and the
+// triangle)
+template <typename T>
+hcblasStatus gemmt_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                            hcblasOrder order, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasTranspose typeB,
+                            int N, int K, T alpha, T *A, __int64_t aOffset,
+                            __int64_t lda, T *B, __int64_t bOffset,
+                            __int64_t ldb, T beta, T *C, __int64_t cOffset,
+                            __int64_t ldc) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || N <= 0 || K < 0) {
+    return HCBLAS_INVALID;
+  }
+
+  // CPU accelerator: host triangle update over host_gemm
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_gemmt<H>(order == ColMajor, uplo == Lower, typeA != NoTrans,
+                       typeA == ConjTrans, typeB != NoTrans, typeB == ConjTrans,
+                       N, K, Level3Host<T>::value(alpha),
+                       reinterpret_cast<const H *>(A + aOffset), lda,
+                       reinterpret_cast<const H *>(B + bOffset), ldb,
+                       Level3Host<T>::value(beta),
+                       reinterpret_cast<H *>(C + cOffset), ldc)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    lower = !lower;
+    std::swap(typeA, typeB);
+    std::swap(A, B);
+    std::swap(aOffset, bOffset);
+    std::swap(lda, ldb);
+  }
+  return triangle_update<T>(accl_view, lib->scratch,
+                            Level3Gemm(lib, accl_view, 1), lower, false, typeA,
+                            typeB, N, K, alpha, A, aOffset, lda, B, bOffset,
+                            ldb, beta, C, cOffset, ldc, 1);
+}
+
+template <typename T>
+hcblasStatus gemmt_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                            hcblasOrder order, hcblasUplo uplo,
+                            hcblasTranspose typeA, hcblasTranspose typeB,
+                            int N, int K, T alpha, T *A[], __int64_t aOffset,
+                            __int64_t A_batchOffset, __int64_t lda, T *B[],
+                            __int64_t bOffset, __int64_t B_batchOffset,
+                            __int64_t ldb, T beta, T *C[], __int64_t cOffset,
+                            __int64_t C_batchOffset, __int64_t ldc,
+                            int batchSize) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || N <= 0 || K < 0 ||
+      batchSize <= 0) {
+    return HCBLAS_INVALID;
+  }
+  // Entry elt starts at X[elt] + xOffset + X_batchOffset, as in the batched
+  // GEMM kernels
+  aOffset += A_batchOffset;
+  bOffset += B_batchOffset;
+  cOffset += C_batchOffset;
+
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_gemmt_batched<H>(order == ColMajor, uplo == Lower,
+                               typeA != NoTrans, typeA == ConjTrans,
+                               typeB != NoTrans, typeB == ConjTrans, N, K,
+                               Level3Host<T>::value(alpha),
+                               reinterpret_cast<H *const *>(A), aOffset, lda,
+                               reinterpret_cast<H *const *>(B), bOffset, ldb,
+                               Level3Host<T>::value(beta),
+                               reinterpret_cast<H *const *>(C), cOffset, ldc,
+                               batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    lower = !lower;
+    std::swap(typeA, typeB);
+    std::swap(A, B);
+    std::swap(aOffset, bOffset);
+    std::swap(lda, ldb);
+  }
+  // Every entry's diagonal blocks share one launch, every off-diagonal block
+  // one batched GEMM
+  return triangle_update<T>(accl_view, lib->scratch,
+                            Level3Gemm(lib, accl_view, batchSize), lower, false,
+                            typeA, typeB, N, K, alpha, A, aOffset, lda, B,
+                            bOffset, ldb, beta, C, cOffset, ldc, batchSize);
+}
+
+}  // namespace
+
+/* SGEMMT - C = alpha * op(A) * op(B) + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_sgemmt(hc::accelerator_view accl_view,
+                                          hcblasOrder order, hcblasUplo uplo,
+                                          hcblasTranspose typeA,
+                                          hcblasTranspose typeB, const int N,
+                                          const int K, const float &alpha,
+                                          float *A, const __int64_t aOffset,
+                                          const __int64_t lda, float *B,
+                                          const __int64_t bOffset,
+                                          const __int64_t ldb,
+                                          const float &beta, float *C,
+                                          const __int64_t cOffset,
+                                          const __int64_t ldc) {
+  return gemmt_dispatch(this, accl_view, order, uplo, typeA, typeB, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                        ldc);
+}
+
+/* SGEMMT - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_sgemmt(hc::accelerator_view accl_view,
+                                          hcblasOrder order, hcblasUplo uplo,
+                                          hcblasTranspose typeA,
+                                          hcblasTranspose typeB, const int N,
+                                          const int K, const float &alpha,
+                                          float *A[], const __int64_t aOffset,
+                                          const __int64_t A_batchOffset,
+                                          const __int64_t lda, float *B[],
+                                          const __int64_t bOffset,
+                                          const __int64_t B_batchOffset,
+                                          const __int64_t ldb,
+                                          const float &beta, float *C[],
+                                          const __int64_t cOffset,
+                                          const __int64_t C_batchOffset,
+                                          const __int64_t ldc,
+                                          const int batchSize) {
+  return gemmt_dispatch(this, accl_view, order, uplo, typeA, typeB, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb, beta, C, cOffset, C_batchOffset,
+                        ldc, batchSize);
+}
+
+/* DGEMMT - C = alpha * op(A) * op(B) + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_dgemmt(hc::accelerator_view accl_view,
+                                          hcblasOrder order, hcblasUplo uplo,
+                                          hcblasTranspose typeA,
+                                          hcblasTranspose typeB, const int N,
+                                          const int K, const double &alpha,
+                                          double *A, const __int64_t aOffset,
+                                          const __int64_t lda, double *B,
+                                          const __int64_t bOffset,
+                                          const __int64_t ldb,
+                                          const double &beta, double *C,
+                                          const __int64_t cOffset,
+                                          const __int64_t ldc) {
+  return gemmt_dispatch(this, accl_view, order, uplo, typeA, typeB, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                        ldc);
+}
+
+/* DGEMMT - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_dgemmt(hc::accelerator_view accl_view,
+                                          hcblasOrder order, hcblasUplo uplo,
+                                          hcblasTranspose typeA,
+                                          hcblasTranspose typeB, const int N,
+                                          const int K, const double &alpha,
+                                          double *A[], const __int64_t aOffset,
+                                          const __int64_t A_batchOffset,
+                                          const __int64_t lda, double *B[],
+                                          const __int64_t bOffset,
+                                          const __int64_t B_batchOffset,
+                                          const __int64_t ldb,
+                                          const double &beta, double *C[],
+                                          const __int64_t cOffset,
+                                          const __int64_t C_batchOffset,
+                                          const __int64_t ldc,
+                                          const int batchSize) {
+  return gemmt_dispatch(this, accl_view, order, uplo, typeA, typeB, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb, beta, C, cOffset, C_batchOffset,
+                        ldc, batchSize);
+}
+
+/* CGEMMT - C = alpha * op(A) * op(B) + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_cgemmt(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, hcblasTranspose typeB, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::float_2 *B,
+    const __int64_t bOffset, const __int64_t ldb,
+    const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return gemmt_dispatch(this, accl_view, order, uplo, typeA, typeB, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                        ldc);
+}
+
+/* CGEMMT - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_cgemmt(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, hcblasTranspose typeB, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::float_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb,
+    const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return gemmt_dispatch(this, accl_view, order, uplo, typeA, typeB, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb, beta, C, cOffset, C_batchOffset,
+                        ldc, batchSize);
+}
+
+/* ZGEMMT - C = alpha * op(A) * op(B) + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_zgemmt(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, hcblasTranspose typeB, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::double_2 *B,
+    const __int64_t bOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return gemmt_dispatch(this, accl_view, order, uplo, typeA, typeB, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                        ldc);
+}
+
+/* ZGEMMT - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_zgemmt(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, hcblasTranspose typeB, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return gemmt_dispatch(this, accl_view, order, uplo, typeA, typeB, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb, beta, C, cOffset, C_batchOffset,
+                        ldc, batchSize);
+}
@@ -1359,117 +1359,6 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_MX064_NX064_KX16_TS16XMTS4(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-  int M_ = (M - 1) / 2 + 1;
-  int N_ = (N - 1) / 2 + 1;
-  int N_R = (N_ + 15) & ~15;
-  int M_R = (M_ + 15) & ~15;
-  int K_R = (K + 15) & ~15;
-  hc::extent<2> grdExt(N_R, M_R);
-  hc::tiled_extent<2> t_ext = grdExt.tile(16, 16);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    hc::half rC[2][2] = {{(hc::half)0}};
-    hc::half rA[1][2];
-    hc::half rB[1][2];
-    tile_static hc::half lA[528];
-    tile_static hc::half lB[528];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int block_k = 0;
-    int alIndex = (idy * 33) + idx;
-    int blIndex = (idx * 33) + idy;
-    int AIndex = aOffset + (gidx * 32) + idx + (idy * lda);
-    int BIndex = bOffset + ((gidy * 32) + idy) * ldb + idx;
-    __int64_t CIndex =
-        cOffset + (gidx * 32) + idx + (((gidy * 32) + idy) * ldc);
-    __int64_t AinitOffset = 0;
-    __int64_t BinitOffset = 0;
-    __int64_t CinitOffset = 0;
-    int N_block = N_R >> 4;
-    int M_block = M_R >> 4;
-    int K_block = K_R >> 4;
-    do {
-      tidx.barrier.wait();
-
-      if (gidx == M_block - 1 || gidy == N_block - 1 ||
-          block_k == K_block - 1) {
-        for (int sec = 0; sec < 2; ++sec) {
-          int secVal = sec << 4;
-
-          if ((gidy * 32 + idy + secVal) < N && (block_k * 16 + idx) < K) {
-            lB[blIndex + secVal] = B[BIndex + BinitOffset + secVal * ldb];
-          } else {
-            lB[blIndex + secVal] = 0;
-          }
-
-          if ((gidx * 32 + idx + secVal) < M && (block_k * 16 + idy) < K) {
-            lA[alIndex + secVal] = A[AIndex + secVal + AinitOffset];
-          } else {
-            lA[alIndex + secVal] = 0;
-          }
-        }
-      } else {
-        lB[blIndex] = B[BIndex + BinitOffset];
-        lB[blIndex + 16] = B[BIndex + BinitOffset + 16 * ldb];
-        lA[alIndex] = A[AIndex + AinitOffset];
-        lA[alIndex + 16] = A[AIndex + 16 + AinitOffset];
-      }
-
-      tidx.barrier.wait();
-
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < 16; iter += 8) {
-        M2x2;
-        M2x2;
-        M2x2;
-        M2x2;
-        M2x2;
-        M2x2;
-        M2x2;
-        M2x2;
-      }
-
-      AinitOffset += lda << 4;
-      BinitOffset += 16;
-    } while (++block_k < (K_R >> 4));
-
-    tidx.barrier.wait();
-    if (gidx == M_block - 1 || gidy == N_block - 1) {
-      if ((gidx * 32 + idx + CinitOffset) < M && (gidy * 32 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[0][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 32 + idx + CinitOffset) < M && (gidy * 32 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[0][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      CinitOffset += 16;
-      if ((gidx * 32 + idx + CinitOffset) < M && (gidy * 32 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[1][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 32 + idx + CinitOffset) < M && (gidy * 32 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[1][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-    } else {
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[0][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[0][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      CinitOffset += 16;
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[1][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[1][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-    }
-  }) ;
-  return HCBLAS_SUCCEEDS;
-}
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS8XMTS4(
     hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
     const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
@@ -1645,472 +1534,6 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS8XMTS4(
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-  int M_ = (M - 1) / 4 + 1;
-  int N_ = (N - 1) / 4 + 1;
-  int N_R = (N_ + 15) & ~15;
-  int M_R = (M_ + 15) & ~15;
-  int K_R = (K + 15) & ~15;
-  hc::extent<2> grdExt(N_R, M_R);
-  hc::tiled_extent<2> t_ext = grdExt.tile(16, 16);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    hc::half rC[4][4] = {{(hc::half)0}};
-    hc::half rA[1][4];
-    hc::half rB[1][4];
-    tile_static hc::half lA[1056];
-    tile_static hc::half lB[1056];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int block_k = 0;
-    int alIndex = (idy * 65) + idx;
-    int blIndex = (idx * 65) + idy;
-    int AIndex = aOffset + (gidx * 64) + idx + (idy * lda);
-    int BIndex = bOffset + ((gidy * 64) + idy) * ldb + idx;
-    __int64_t CIndex =
-        cOffset + (gidx * 64) + idx + (((gidy * 64) + idy) * ldc);
-    __int64_t AinitOffset = 0;
-    __int64_t BinitOffset = 0;
-    __int64_t CinitOffset = 0;
-    int N_block = N_R >> 4;
-    int M_block = M_R >> 4;
-    int K_block = K_R >> 4;
-    do {
-      tidx.barrier.wait();
-
-      if (gidx == M_block - 1 || gidy == N_block - 1 ||
-          block_k == K_block - 1) {
-        for (int sec = 0; sec < 4; ++sec) {
-          int secVal = sec << 4;
-
-          if ((gidy * 64 + idy + secVal) < N && (block_k * 16 + idx) < K) {
-            lB[blIndex + secVal] = B[BIndex + BinitOffset + secVal * ldb];
-          } else {
-            lB[blIndex + secVal] = 0;
-          }
-
-          if ((gidx * 64 + idx + secVal) < M && (block_k * 16 + idy) < K) {
-            lA[alIndex + secVal] = A[AIndex + secVal + AinitOffset];
-          } else {
-            lA[alIndex + secVal] = 0;
-          }
-        }
-      } else {
-        lB[blIndex] = B[BIndex + BinitOffset];
-        lB[blIndex + 16] = B[BIndex + BinitOffset + 16 * ldb];
-        lB[blIndex + 32] = B[BIndex + BinitOffset + 32 * ldb];
-        lB[blIndex + 48] = B[BIndex + BinitOffset + 48 * ldb];
-        lA[alIndex] = A[AIndex + AinitOffset];
-        lA[alIndex + 16] = A[AIndex + 16 + AinitOffset];
-        lA[alIndex + 32] = A[AIndex + 32 + AinitOffset];
-        lA[alIndex + 48] = A[AIndex + 48 + AinitOffset];
-      }
-
-      tidx.barrier.wait();
-
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < 16; iter += 8) {
-        M4x4;
-        M4x4;
-        M4x4;
-        M4x4;
-        M4x4;
-        M4x4;
-        M4x4;
-        M4x4;
-      }
-
-      AinitOffset += lda << 4;
-      BinitOffset += 16;
-    } while (++block_k < (K_R >> 4));
-
-    tidx.barrier.wait();
-    if (gidx == M_block - 1 || gidy == N_block - 1) {
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[0][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[0][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[0][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[0][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      CinitOffset += 16;
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[1][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[1][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[1][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[1][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      CinitOffset += 16;
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[2][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[2][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[2][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[2][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      CinitOffset += 16;
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[3][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[3][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[3][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 64 + idx + CinitOffset) < M && (gidy * 64 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[3][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-    } else {
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[0][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[0][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[0][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[0][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      CinitOffset += 16;
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[1][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[1][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[1][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[1][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      CinitOffset += 16;
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[2][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[2][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[2][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[2][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      CinitOffset += 16;
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[3][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[3][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[3][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[3][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-    }
-  }) ;
-  return HCBLAS_SUCCEEDS;
-}
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
-    const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, hc::half alpha, hc::half beta) {
-  int M_ = (M - 1) / 6 + 1;
-  int N_ = (N - 1) / 6 + 1;
-  int N_R = (N_ + 15) & ~15;
-  int M_R = (M_ + 15) & ~15;
-  int K_R = (K + 15) & ~15;
-  hc::extent<2> grdExt(N_R, M_R);
-  hc::tiled_extent<2> t_ext = grdExt.tile(16, 16);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    hc::half rC[6][6] = {{(hc::half)0}};
-    hc::half rA[1][6];
-    hc::half rB[1][6];
-    tile_static hc::half lA[1552];
-    tile_static hc::half lB[1552];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int block_k = 0;
-    int alIndex = (idy * 97) + idx;
-    int blIndex = (idx * 97) + idy;
-    int AIndex = aOffset + (gidx * 96) + idx + (idy * lda);
-    int BIndex = bOffset + ((gidy * 96) + idy) * ldb + idx;
-    __int64_t CIndex =
-        cOffset + (gidx * 96) + idx + (((gidy * 96) + idy) * ldc);
-    __int64_t AinitOffset = 0;
-    __int64_t BinitOffset = 0;
-    __int64_t CinitOffset = 0;
-    int N_block = N_R >> 4;
-    int M_block = M_R >> 4;
-    int K_block = K_R >> 4;
-    do {
-      tidx.barrier.wait();
-
-      if (gidx == M_block - 1 || gidy == N_block - 1 ||
-          block_k == K_block - 1) {
-        for (int sec = 0; sec < 6; ++sec) {
-          int secVal = sec << 4;
-
-          if ((gidy * 96 + idy + secVal) < N && (block_k * 16 + idx) < K) {
-            lB[blIndex + secVal] = B[BIndex + BinitOffset + secVal * ldb];
-          } else {
-            lB[blIndex + secVal] = 0;
-          }
-
-          if ((gidx * 96 + idx + secVal) < M && (block_k * 16 + idy) < K) {
-            lA[alIndex + secVal] = A[AIndex + secVal + AinitOffset];
-          } else {
-            lA[alIndex + secVal] = 0;
-          }
-        }
-      } else {
-        lB[blIndex] = B[BIndex + BinitOffset];
-        lB[blIndex + 16] = B[BIndex + BinitOffset + 16 * ldb];
-        lB[blIndex + 32] = B[BIndex + BinitOffset + 32 * ldb];
-        lB[blIndex + 48] = B[BIndex + BinitOffset + 48 * ldb];
-        lB[blIndex + 64] = B[BIndex + BinitOffset + 64 * ldb];
-        lB[blIndex + 80] = B[BIndex + BinitOffset + 80 * ldb];
-        lA[alIndex] = A[AIndex + AinitOffset];
-        lA[alIndex + 16] = A[AIndex + 16 + AinitOffset];
-        lA[alIndex + 32] = A[AIndex + 32 + AinitOffset];
-        lA[alIndex + 48] = A[AIndex + 48 + AinitOffset];
-        lA[alIndex + 64] = A[AIndex + 64 + AinitOffset];
-        lA[alIndex + 80] = A[AIndex + 80 + AinitOffset];
-      }
-
-      tidx.barrier.wait();
-
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < 16; iter += 8) {
-        M6x6;
-        M6x6;
-        M6x6;
-        M6x6;
-        M6x6;
-        M6x6;
-        M6x6;
-        M6x6;
-      }
-
-      AinitOffset += lda << 4;
-      BinitOffset += 16;
-    } while (++block_k < (K_R >> 4));
-
-    tidx.barrier.wait();
-    if (gidx == M_block - 1 || gidy == N_block - 1) {
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[0][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[0][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[0][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[0][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 4 * 16) < N)
-        C[CIndex + CinitOffset + 64 * ldc] =
-            alpha * rC[0][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 5 * 16) < N)
-        C[CIndex + CinitOffset + 80 * ldc] =
-            alpha * rC[0][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[1][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[1][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[1][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[1][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 4 * 16) < N)
-        C[CIndex + CinitOffset + 64 * ldc] =
-            alpha * rC[1][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 5 * 16) < N)
-        C[CIndex + CinitOffset + 80 * ldc] =
-            alpha * rC[1][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[2][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[2][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[2][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[2][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 4 * 16) < N)
-        C[CIndex + CinitOffset + 64 * ldc] =
-            alpha * rC[2][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 5 * 16) < N)
-        C[CIndex + CinitOffset + 80 * ldc] =
-            alpha * rC[2][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[3][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[3][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[3][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[3][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 4 * 16) < N)
-        C[CIndex + CinitOffset + 64 * ldc] =
-            alpha * rC[3][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 5 * 16) < N)
-        C[CIndex + CinitOffset + 80 * ldc] =
-            alpha * rC[3][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[4][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[4][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[4][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[4][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 4 * 16) < N)
-        C[CIndex + CinitOffset + 64 * ldc] =
-            alpha * rC[4][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 5 * 16) < N)
-        C[CIndex + CinitOffset + 80 * ldc] =
-            alpha * rC[4][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 0 * 16) < N)
-        C[CIndex + CinitOffset + 0 * ldc] =
-            alpha * rC[5][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 1 * 16) < N)
-        C[CIndex + CinitOffset + 16 * ldc] =
-            alpha * rC[5][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 2 * 16) < N)
-        C[CIndex + CinitOffset + 32 * ldc] =
-            alpha * rC[5][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 3 * 16) < N)
-        C[CIndex + CinitOffset + 48 * ldc] =
-            alpha * rC[5][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 4 * 16) < N)
-        C[CIndex + CinitOffset + 64 * ldc] =
-            alpha * rC[5][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      if ((gidx * 96 + idx + CinitOffset) < M && (gidy * 96 + idy + 5 * 16) < N)
-        C[CIndex + CinitOffset + 80 * ldc] =
-            alpha * rC[5][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-    } else {
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[0][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[0][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[0][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[0][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      C[CIndex + CinitOffset + 64 * ldc] =
-          alpha * rC[0][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      C[CIndex + CinitOffset + 80 * ldc] =
-          alpha * rC[0][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[1][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[1][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[1][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[1][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      C[CIndex + CinitOffset + 64 * ldc] =
-          alpha * rC[1][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      C[CIndex + CinitOffset + 80 * ldc] =
-          alpha * rC[1][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[2][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[2][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[2][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[2][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      C[CIndex + CinitOffset + 64 * ldc] =
-          alpha * rC[2][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      C[CIndex + CinitOffset + 80 * ldc] =
-          alpha * rC[2][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[3][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[3][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[3][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[3][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      C[CIndex + CinitOffset + 64 * ldc] =
-          alpha * rC[3][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      C[CIndex + CinitOffset + 80 * ldc] =
-          alpha * rC[3][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[4][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[4][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[4][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[4][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      C[CIndex + CinitOffset + 64 * ldc] =
-          alpha * rC[4][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      C[CIndex + CinitOffset + 80 * ldc] =
-          alpha * rC[4][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-      CinitOffset += 16;
-      C[CIndex + CinitOffset + 0 * ldc] =
-          alpha * rC[5][0] + beta * C[CIndex + CinitOffset + 0 * ldc];
-      C[CIndex + CinitOffset + 16 * ldc] =
-          alpha * rC[5][1] + beta * C[CIndex + CinitOffset + 16 * ldc];
-      C[CIndex + CinitOffset + 32 * ldc] =
-          alpha * rC[5][2] + beta * C[CIndex + CinitOffset + 32 * ldc];
-      C[CIndex + CinitOffset + 48 * ldc] =
-          alpha * rC[5][3] + beta * C[CIndex + CinitOffset + 48 * ldc];
-      C[CIndex + CinitOffset + 64 * ldc] =
-          alpha * rC[5][4] + beta * C[CIndex + CinitOffset + 64 * ldc];
-      C[CIndex + CinitOffset + 80 * ldc] =
-          alpha * rC[5][5] + beta * C[CIndex + CinitOffset + 80 * ldc];
-    }
-  }) ;
-  return HCBLAS_SUCCEEDS;
-}
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_MX096_NX096_KX16_TS16XMTS6(
     hc::accelerator_view accl_view, const hc::half *A, __int64_t aOffset,
     const hc::half *B, __int64_t bOffset, hc::half *C, __int64_t cOffset, int M,
@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "./hgemm_array_kernels.h"
+#include "src/blas/gemmgen/gemm_tiled_kernel.h"
 #include <hc_math.hpp>
 
 hcblasStatus gemm_NoTransAB_STEP_TS8XSS8(
@@ -3179,205 +3180,135 @@ hcblasStatus gemm_NoTransB_largeK(hc::accelerator_view accl_view, hc::half *A,
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view, hc::half *A,
-                            __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                            hc::half *C, __int64_t cOffset, int M, int N, int K,
-                            int lda, int ldb, int ldc, hc::half alpha,
-                            hc::half beta) {
-  if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0 && M <= 6700) {
-    return gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0) {
-    return gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 64 == 0 && N % 64 == 0 && K % 16 == 0) {
-    return gemm_NoTransAB_MICRO_NBK_MX064_NX064_KX16_TS16XMTS4(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 96 == 0 && N % 96 == 0 && K % 16 == 0) {
-    return gemm_NoTransAB_MICRO_NBK_MX096_NX096_KX16_TS16XMTS6(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((M <= 500 && N <= 700) || (M <= 700 && N <= 500) || K < 20 ||
-             M < 20 || N < 20) {
-    return gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((K <= 5000) ||
-             (((M <= 5000 && N <= 8000) || (M <= 8000 && N <= 5000)) &&
-              K <= 8000) ||
-             (((M <= 3000 && N <= 9000) || (M <= 9000 && N <= 3000) ||
-               (M <= 7000 && N <= 4000) || (M <= 4000 && N <= 7000) ||
-               (M <= 5000 && N <= 6000) || (M <= 6000 && N <= 5000)) &&
-              K <= 10000)) {
-    return gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M <= 50000 && N <= 50000) {
-    return gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else {
-    return gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
+// Registry entry for a hand-written kernel. The lambda gives every variant
+// the dispatch signature (some kernels take const A and B, none takes
+// scratch).
+#define HGEMM_KERNEL(prefix, variant, mM, mN, mK, tile, micro)                \
+  {                                                                           \
+    {#variant, {mM, mN, mK}, tile, micro},                                    \
+        [](hc::accelerator_view accl_view, ScratchPool *, hc::half *A,        \
+           __int64_t aOffset, hc::half *B, __int64_t bOffset, hc::half *C,    \
+           __int64_t cOffset, int M, int N, int K, int lda, int ldb,          \
+           int ldc, hc::half alpha, hc::half beta) {                          \
+          return gemm_##prefix##_##variant(accl_view, A, aOffset, B,          \
+                                           bOffset, C, cOffset, M, N, K,      \
+                                           lda, ldb, ldc, alpha, beta);       \
+        }                                                                     \
   }
-}
 
-hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, hc::half *A,
-                           __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                           hc::half *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, hc::half alpha,
-                           hc::half beta) {
-  if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0 && M <= 4000) {
-    return gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0) {
-    return gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 64 == 0 && N % 64 == 0 && K % 16 == 0) {
-    return gemm_NoTransA_MICRO_NBK_M064_N064_K064_TS16XMTS4(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 96 == 0 && N % 96 == 0 && K % 16 == 0) {
-    return gemm_NoTransA_MICRO_NBK_M096_N096_K096_TS16XMTS6(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((K >= 4000 &&
-              ((M >= 7000 && N >= 9000) || (M >= 9000 && N >= 7000))) ||
-             (K >= 6000 && (M >= 7000 && N >= 7000)) ||
-             (K >= 8500 &&
-              ((M >= 5000 && N >= 7000) || (M >= 7000 && N >= 5000)))) {
-    return gemm_NoTransA_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((K > 30 && (M >= 9000 || N >= 9000)) ||
-             (K >= 4000 && (M >= 8000 || N >= 8000)) ||
-             (K >= 6000 && (M >= 7000 || N >= 7000)) ||
-             (K >= 8500 && (M >= 700 || N >= 700))) {
-    return gemm_NoTransA_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((M <= 500 && N <= 1000) || (N <= 500 && M <= 1000) || K <= 30) {
-    return gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
-  } else if ((M < 9000 && N < 9000 & K < 5000) ||
-             (M < 8000 && N < 8000 && K < 6000) ||
-             (M < 7000 && N < 7000 && K < 8000) ||
-             (M < 6000 && N < 6000 && K < 9000)) {
-    return gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
-  } else {
-    return gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
+// Registry entries for the generated kernels, accumulating in float
+#define HGEMM_TILED(name, tile, mtm, mtn, kstep, pad, transA, transB)         \
+  {{#name, {1, 1, 1}, tile, mtm},                                             \
+   gemm_tiled<hc::half, float, tile, mtm, mtn, kstep, pad, transA, transB>},
+#define HGEMM_TILED_NN(name, tile, mtm, mtn, kstep, pad) \
+  HGEMM_TILED(name, tile, mtm, mtn, kstep, pad, false, false)
+#define HGEMM_TILED_NT(name, tile, mtm, mtn, kstep, pad) \
+  HGEMM_TILED(name, tile, mtm, mtn, kstep, pad, false, true)
+#define HGEMM_TILED_TN(name, tile, mtm, mtn, kstep, pad) \
+  HGEMM_TILED(name, tile, mtm, mtn, kstep, pad, true, false)
+#define HGEMM_TILED_TT(name, tile, mtm, mtn, kstep, pad) \
+  HGEMM_TILED(name, tile, mtm, mtn, kstep, pad, true, true)
+
+// The same variants as SGEMM, whose ladders HGEMM shared; the built-in 'h'
+// rules are the 's' ones. The last entry per transpose case handles every
+// shape.
+static const HgemmKernelEntry kNoTransABKernels[] = {
+    HGEMM_KERNEL(NoTransAB, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2,
+                 128, 128, 128, 16, 2),
+    HGEMM_KERNEL(NoTransAB, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2,
+                 128, 128, 128, 16, 4),
+    HGEMM_KERNEL(NoTransAB, MICRO_NBK_MX064_NX064_KX16_TS16XMTS4, 64, 64, 16,
+                 16, 4),
+    HGEMM_KERNEL(NoTransAB, MICRO_NBK_MX096_NX096_KX16_TS16XMTS6, 96, 96, 16,
+                 16, 6),
+    HGEMM_KERNEL(NoTransAB, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2, 1, 1, 1,
+                 16, 4),
+    GEMM_TILED_SCHEDULES(hc::half, float, false, false)
+    GEMM_TILED_VARIANTS(HGEMM_TILED_NN)};
+
+static const HgemmKernelEntry kNoTransAKernels[] = {
+    HGEMM_KERNEL(NoTransA, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2,
+                 128, 128, 128, 16, 2),
+    HGEMM_KERNEL(NoTransA, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2,
+                 128, 128, 128, 16, 4),
+    HGEMM_KERNEL(NoTransA, MICRO_NBK_M064_N064_K064_TS16XMTS4, 64, 64, 16, 16,
+                 4),
+    HGEMM_KERNEL(NoTransA, MICRO_NBK_M096_N096_K096_TS16XMTS6, 96, 96, 16, 16,
+                 6),
+    HGEMM_KERNEL(NoTransA, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2, 1, 1, 1,
+                 16, 4),
+    HGEMM_KERNEL(NoTransA, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2, 1, 1, 1,
+                 16, 2),
+    GEMM_TILED_SCHEDULES(hc::half, float, false, true)
+    GEMM_TILED_VARIANTS(HGEMM_TILED_NT)};
+
+static const HgemmKernelEntry kNoTransBKernels[] = {
+    HGEMM_KERNEL(NoTransB, STEP_TS8XSS8, 1, 1, 1, 8, 1),
+    HGEMM_KERNEL(NoTransB, STEP_NBK_TS16XSS16, 1, 1, 1, 16, 1),
+    HGEMM_KERNEL(NoTransB, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2, 1, 1, 1,
+                 16, 2),
+    HGEMM_KERNEL(NoTransB, MICRO_TS16XMTS2, 1, 1, 1, 16, 2),
+    HGEMM_KERNEL(NoTransB, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2,
+                 128, 128, 128, 16, 2),
+    HGEMM_KERNEL(NoTransB, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2,
+                 128, 128, 128, 16, 4),
+    HGEMM_KERNEL(NoTransB, MICRO_NBK_M064_N064_K064_TS16XMTS4, 64, 64, 16, 16,
+                 4),
+    HGEMM_KERNEL(NoTransB, MICRO_NBK_M096_N096_K096_TS16XMTS6, 96, 96, 16, 16,
+                 6),
+    HGEMM_KERNEL(NoTransB, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2, 1, 1, 1,
+                 16, 4),
+    GEMM_TILED_SCHEDULES(hc::half, float, true, false)
+    GEMM_TILED_VARIANTS(HGEMM_TILED_TN)
+    HGEMM_KERNEL(NoTransB, MICRO_NBK_TS16XMTS2, 1, 1, 1, 16, 2)};
+
+static const HgemmKernelEntry kTransABKernels[] = {
+    HGEMM_KERNEL(TransAB, STEP_NBK_TS8XSS8, 1, 1, 1, 8, 1),
+    HGEMM_KERNEL(TransAB, STEP_NBK_TS16XSS16, 1, 1, 1, 16, 1),
+    GEMM_TILED_SCHEDULES(hc::half, float, true, true)
+    GEMM_TILED_VARIANTS(HGEMM_TILED_TT)
+    HGEMM_KERNEL(TransAB, MICRO_TS16XMTS2, 1, 1, 1, 16, 2)};
+
+#undef HGEMM_KERNEL
+#undef HGEMM_TILED
+#undef HGEMM_TILED_NN
+#undef HGEMM_TILED_NT
+#undef HGEMM_TILED_TN
+#undef HGEMM_TILED_TT
+
+#define KERNEL_COUNT(table) static_cast<int>(sizeof(table) / sizeof(table[0]))
+
+const HgemmKernelEntry *hgemm_kernel_registry(char transA, char transB,
+                                              int *count) {
+  if (transA == 'n' && transB == 'n') {
+    *count = KERNEL_COUNT(kNoTransABKernels);
+    return kNoTransABKernels;
   }
-}
-
-hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, hc::half *A,
-                           __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                           hc::half *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, hc::half alpha,
-                           hc::half beta) {
-  if ((M < 6000 && N < 600 && K < 10) ||
-      (M < 1800 && N < 80 && K > 1800 && K < 6000)) {
-    return gemm_NoTransB_STEP_TS8XSS8(accl_view, A, aOffset, B, bOffset, C,
-                                      cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                      beta);
-  } else if ((M < 600 && N < 600 && K < 6000) ||
-             (M > 1800 && M < 6000 && (K < 600 || (K > 1800 && K < 10000)) &&
-              N < 10) ||
-             (M < 10 && N < 600 && K < 1800) ||
-             (M < 600 && N < 1800 && K < 10)) {
-    return gemm_NoTransB_STEP_NBK_TS16XSS16(accl_view, A, aOffset, B, bOffset,
-                                            C, cOffset, M, N, K, lda, ldb, ldc,
-                                            alpha, beta);
-  } else if (M > 4000 && K > 8000 && N <= 100 && N > 50) {
-    return gemm_NoTransB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((M > 1800 && M < 6000 && N > 100 && N < 600 &&
-              (K < 600 || (K < 6000 && K > 1800))) ||
-             (M < 1800 && N < 600 && K < 10) ||
-             (M > 1800 && M < 6000 && K > 1800 && K < 6000 && N < 300 &&
-              M == K)) {
-    return gemm_NoTransB_MICRO_NBK_TS16XMTS2(accl_view, A, aOffset, B, bOffset,
-                                             C, cOffset, M, N, K, lda, ldb, ldc,
-                                             alpha, beta);
-  } else if ((M == K && M < 10000 && N < 200) ||
-             (M < 600 && N < 1800 && K < 600) ||
-             (M < 1800 && N < 100 && K < 1800) ||
-             (M > 600 && M < 6000 && K > 1800 && K < 10000 && N < 300 &&
-              M < K)) {
-    return gemm_NoTransB_MICRO_TS16XMTS2(accl_view, A, aOffset, B, bOffset, C,
-                                         cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                         beta);
+  if (transA == 'n') {
+    *count = KERNEL_COUNT(kNoTransAKernels);
+    return kNoTransAKernels;
   }
-  if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0 && M <= 2000) {
-    return gemm_NoTransB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0) {
-    return gemm_NoTransB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 64 == 0 && N % 64 == 0 && K % 16 == 0 && M > 2000 &&
-             M < 3300 && N > 2000 && N < 3300) {
-    return gemm_NoTransB_MICRO_NBK_M064_N064_K064_TS16XMTS4(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 96 == 0 && N % 96 == 0 && K % 16 == 0 && M > 2000 &&
-             N > 2000) {
-    return gemm_NoTransB_MICRO_NBK_M096_N096_K096_TS16XMTS6(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M <= 2000 && N <= 5000 && K <= 20) {
-    return gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
-  } else if ((K >= 1500 &&
-              ((M >= 4000 && N >= 5000) || (M >= 5000 && N >= 3000) ||
-               (M >= 7000 && N >= 1000))) ||
-             (K >= 3000 &&
-              ((M >= 3000 && N >= 5000) || (M >= 4000 && N >= 3000) ||
-               (M >= 6000 && N >= 1000))) ||
-             (K >= 5000 &&
-              ((M >= 2000 && N >= 5000) || (M >= 3000 && N >= 2000) ||
-               (M >= 5000 && N >= 1000)))) {
-    return gemm_NoTransB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else {
-    return gemm_NoTransB_MICRO_NBK_TS16XMTS2(accl_view, A, aOffset, B, bOffset,
-                                             C, cOffset, M, N, K, lda, ldb, ldc,
-                                             alpha, beta);
+  if (transB == 'n') {
+    *count = KERNEL_COUNT(kNoTransBKernels);
+    return kNoTransBKernels;
   }
+  *count = KERNEL_COUNT(kTransABKernels);
+  return kTransABKernels;
 }
 
-hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, hc::half *A,
-                          __int64_t aOffset, hc::half *B, __int64_t bOffset,
-                          hc::half *C, __int64_t cOffset, int M, int N, int K,
-                          int lda, int ldb, int ldc, hc::half alpha,
-                          hc::half beta) {
-  if ((M < 600 && N < 600 && K < 10) || (M < 1800 && N < 600 && K < 600)) {
-    return gemm_TransAB_STEP_NBK_TS8XSS8(accl_view, A, aOffset, B, bOffset, C,
-                                         cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                         beta);
-  } else if ((M < 600 && N < 600 && K < 1800) ||
-             (M < 1800 && ((N < 600 && K < 1800) || (N < 1800 && K < 10)))) {
-    return gemm_TransAB_STEP_NBK_TS16XSS16(accl_view, A, aOffset, B, bOffset, C,
-                                           cOffset, M, N, K, lda, ldb, ldc,
-                                           alpha, beta);
-  } else {
-    return gemm_TransAB_MICRO_TS16XMTS2(accl_view, A, aOffset, B, bOffset, C,
-                                        cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                        beta);
-  }
+hcblasStatus hgemm_dispatch(hc::accelerator_view accl_view,
+                            ScratchPool *scratch, char transA, char transB,
+                            hc::half *A, __int64_t aOffset, hc::half *B,
+                            __int64_t bOffset, hc::half *C, __int64_t cOffset,
+                            int M, int N, int K, int lda, int ldb, int ldc,
+                            hc::half alpha, hc::half beta) {
+  int count = 0;
+  const HgemmKernelEntry *kernels =
+      hgemm_kernel_registry(transA, transB, &count);
+  const GemmSelectKey key = {'h', 'C', transA, transB, false};
+  const HgemmKernelEntry *kernel = gemm_select_kernel(
+      key, M, N, K, kernels, count,
+      gemm_tiled_schedule_default<hc::half>(accl_view, M, N, K));
+  return kernel->fn(accl_view, scratch, A, aOffset, B, bOffset, C, cOffset, M,
+                    N, K, lda, ldb, ldc, alpha, beta);
 }
-
@@ -21,36 +21,35 @@ THE SOFTWARE.
 */
 
 #include "./hgemm_array_kernels.h"
+#include "src/blas/gemmgen/gemm_tiled_kernel.h"
+#include "src/blas/host/hcblas_host.h"
 
 // Sgemm Wrapper routine that invokes the appropriate kernel routines depending
 // on the input dimension M N and K
-hcblasStatus gemm_HC(hc::accelerator_view accl_view, const int order,
-                     char TransA, char TransB, const int M, const int N,
-                     const int K, const hc::half alpha, hc::half *A_mat,
-                     __int64_t aOffset, __int64_t lda, hc::half *B_mat,
-                     __int64_t bOffset, __int64_t ldb, const hc::half beta,
-                     hc::half *C_mat, __int64_t cOffset, __int64_t ldc) {
+hcblasStatus gemm_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+                     const int order, char TransA, char TransB, const int M,
+                     const int N, const int K, const hc::half alpha,
+                     hc::half *A_mat, __int64_t aOffset, __int64_t lda,
+                     hc::half *B_mat, __int64_t bOffset, __int64_t ldb,
+                     const hc::half beta, hc::half *C_mat, __int64_t cOffset,
+                     __int64_t ldc) {
   hcblasStatus status = HCBLAS_SUCCEEDS;
   // Start the operations
 
   if (order) {
-    if (TransB == 'n') {
-      if (TransA == 'n') {
-        status =
-            gemm_NoTransAB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                           cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-      } else {
-        status = gemm_NoTransB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                               cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-      }
-    } else if (TransA == 'n') {
-      status = gemm_NoTransA(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                             cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-    } else {
-      status = gemm_TransAB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                            cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
-    }
+    status = hgemm_dispatch(accl_view, scratch, TransA, TransB, A_mat,
+                            aOffset, B_mat, bOffset, C_mat, cOffset, M, N, K,
+                            lda, ldb, ldc, alpha, beta);
   } else {
+    // Row major has no registry, so shapes the fixed tile grids serve badly
+    // run split-K or stream-K ahead of the hand-written kernels
+    if (gemm_tiled_schedule_rmajor<hc::half, float>(accl_view, scratch, TransA,
+                                                    TransB, A_mat, aOffset,
+                                                    B_mat, bOffset, C_mat,
+                                                    cOffset, M, N, K, lda, ldb,
+                                                    ldc, alpha, beta)) {
+      return HCBLAS_SUCCEEDS;
+    }
     if (TransB == 'n') {
       if (TransA == 'n') {
         status = gemm_NoTransAB_rMajor(accl_view, A_mat, aOffset, B_mat,
@@ -296,6 +295,19 @@ hcblasStatus Hcblaslibrary::hcblas_hgemm(
     return HCBLAS_INVALID;
   }
 
+  // CPU accelerator: FP32 accumulation on the host, C rounded once
+  if (hostExecution) {
+    if (!host_hgemm(order == ColMajor, typeA == Trans, typeB == Trans, M, N, K,
+                    static_cast<float>(alpha),
+                    reinterpret_cast<const uint16_t *>(A + aOffset), lda,
+                    reinterpret_cast<const uint16_t *>(B + bOffset), ldb,
+                    static_cast<float>(beta),
+                    reinterpret_cast<uint16_t *>(C + cOffset), ldc)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   // For alpha = 0
   if (alpha == 0) {
     if (order) {
@@ -307,8 +319,8 @@ hcblasStatus Hcblaslibrary::hcblas_hgemm(
     }
     return status;
   }
-  status = gemm_HC(accl_view, order, typeA, typeB, M, N, K, alpha, A, aOffset,
-                   lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+  status = gemm_HC(accl_view, scratch, order, typeA, typeB, M, N, K, alpha, A,
+                   aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
   return status;
 }
 
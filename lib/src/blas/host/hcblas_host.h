@@ -0,0 +1,281 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Host (CPU) implementations of the hcblas routines. They are used when a
+* handle is bound to the CPU accelerator, where launching the tiled hc
+* kernels would only emulate a GPU. Matrices follow the Hcblaslibrary
+* conventions: column major unless colMajor is false, offsets already
+* applied to the pointers.
+*/
+
+#ifndef LIB_SRC_BLAS_HOST_HCBLAS_HOST_H_
+#define LIB_SRC_BLAS_HOST_HCBLAS_HOST_H_
+
+#include <cstdint>
+#include "./host_complex.h"
+
+class GemmAutotuner;
+class TuningDb;
+class DispatchTrace;
+
+/* C = alpha * op(A) * op(B) + beta * C for T = float, double,
+   HostComplexFloat and HostComplexDouble (op is a plain transpose). Returns
+   false when a packing buffer cannot be allocated; every bool routine below
+   reports that failure the same way */
+template <typename T>
+bool host_gemm(bool colMajor, bool transA, bool transB, int M, int N, int K,
+               T alpha, const T *A, __int64_t lda, const T *B, __int64_t ldb,
+               T beta, T *C, __int64_t ldc);
+
+/* Host GEMM variants the selection table can name, one per supported
+   micro-kernel run threaded (_mt) or on the calling thread (_st), e.g.
+   host_avx2_16x6_mt. The last variant is the default. host_gemm_variant runs
+   one variant directly, bypassing the table */
+template <typename T>
+int host_gemm_variant_count();
+template <typename T>
+const char *host_gemm_variant_name(int variant);
+template <typename T>
+bool host_gemm_variant(int variant, bool colMajor, bool transA, bool transB,
+                       int M, int N, int K, T alpha, const T *A,
+                       __int64_t lda, const T *B, __int64_t ldb, T beta, T *C,
+                       __int64_t ldc);
+
+/* host_gemm with online tuning: a non-NULL tuner times the variants on the
+   first calls of each shape and then pins the fastest, a non-NULL db
+   supplies and keeps choices across processes (gemm_autotune.h). A non-NULL
+   trace records the call (dispatch_trace.h) */
+template <typename T>
+bool host_gemm_tuned(GemmAutotuner *tuner, TuningDb *db, DispatchTrace *trace,
+                     bool colMajor, bool transA, bool transB, int M, int N,
+                     int K, T alpha, const T *A, __int64_t lda, const T *B,
+                     __int64_t ldb, T beta, T *C, __int64_t ldc);
+
+/* Half precision GEMM on IEEE binary16 bit patterns (hc::half storage).
+   Operands are widened to FP32 while packing, products accumulate in FP32 and
+   C is rounded to half once */
+bool host_hgemm(bool colMajor, bool transA, bool transB, int M, int N, int K,
+                float alpha, const uint16_t *A, __int64_t lda,
+                const uint16_t *B, __int64_t ldb, float beta, uint16_t *C,
+                __int64_t ldc);
+
+/* Device SGEMM kernels run unchanged on the host runtime (host_tiled.h), so
+   kernel changes can be checked and timed without a GPU. host_gemm offers
+   them to the autotuner as its host_tiled_* float variants. */
+enum HostTiledKernel {
+  HOST_TILED_TS8XSS8,    // sgemm_micro_kernels.h, one element per work-item
+  HOST_TILED_TS16XMTS2,  // sgemm_micro_kernels.h, 2 x 2 micro tiles
+  HOST_TILED_TS16XMTS4   // gemm_tiled_block.h, 4 x 4 micro tiles
+};
+#define HOST_TILED_KERNELS 3
+
+/* Column major C = alpha * op(A) * op(B) + beta * C through kernel. The
+   TS8XSS8 and TS16XMTS2 kernels take neither operand transposed; other
+   calls to them run TS16XMTS4, which takes any. */
+void host_sgemm_tiled(HostTiledKernel kernel, bool transA, bool transB, int M,
+                      int N, int K, float alpha, const float *A,
+                      __int64_t lda, const float *B, __int64_t ldb,
+                      float beta, float *C, __int64_t ldc);
+
+/* Batched GEMM: matrix elt starts at X[elt] + xOffset + X_batchOffset, the
+   same addressing as the batched tiled kernels */
+template <typename T>
+bool host_gemm_batched(bool colMajor, bool transA, bool transB, int M, int N,
+                       int K, T alpha, T *const A[], __int64_t aOffset,
+                       __int64_t A_batchOffset, __int64_t lda, T *const B[],
+                       __int64_t bOffset, __int64_t B_batchOffset,
+                       __int64_t ldb, T beta, T *const C[], __int64_t cOffset,
+                       __int64_t C_batchOffset, __int64_t ldc, int batchSize);
+
+/* Solves op(A) X = alpha B (left) or X op(A) = alpha B for X, which
+   overwrites B; A is M x M or N x N, lower or upper triangular, with an
+   implicit unit diagonal when unit. op is a transpose when trans, conjugate
+   when conj as well. The batched form solves entry elt on A[elt] + aOffset
+   and B[elt] + bOffset, one entry per pool task */
+template <typename T>
+bool host_trsm(bool colMajor, bool left, bool lower, bool trans, bool conj,
+               bool unit, int M, int N, T alpha, const T *A, __int64_t lda,
+               T *B, __int64_t ldb);
+
+template <typename T>
+bool host_trsm_batched(bool colMajor, bool left, bool lower, bool trans,
+                       bool conj, bool unit, int M, int N, T alpha,
+                       T *const A[], __int64_t aOffset, __int64_t lda,
+                       T *const B[], __int64_t bOffset, __int64_t ldb,
+                       int batchSize);
+
+/* B = alpha op(A) B (left) or B = alpha B op(A), in place; A is M x M or
+   N x N, lower or upper triangular, with an implicit unit diagonal when
+   unit. op is a transpose when trans, conjugate when conj as well. The
+   batched form multiplies entry elt on A[elt] + aOffset and B[elt] +
+   bOffset, one entry per pool task */
+template <typename T>
+bool host_trmm(bool colMajor, bool left, bool lower, bool trans, bool conj,
+               bool unit, int M, int N, T alpha, const T *A, __int64_t lda,
+               T *B, __int64_t ldb);
+
+template <typename T>
+bool host_trmm_batched(bool colMajor, bool left, bool lower, bool trans,
+                       bool conj, bool unit, int M, int N, T alpha,
+                       T *const A[], __int64_t aOffset, __int64_t lda,
+                       T *const B[], __int64_t bOffset, __int64_t ldb,
+                       int batchSize);
+
+/* C = alpha * op(A) * op(A)^T + beta * C on the lower or upper triangle of
+   the N x N matrix C, op(A) N x K (A^T when trans); the other triangle is
+   not touched. herm makes it op(A) * op(A)^H with a real diagonal (HERK).
+   The batched form runs entry elt on A[elt] + aOffset and C[elt] + cOffset,
+   one entry per pool task */
+template <typename T>
+bool host_syrk(bool colMajor, bool lower, bool trans, bool herm, int N, int K,
+               T alpha, const T *A, __int64_t lda, T beta, T *C,
+               __int64_t ldc);
+
+template <typename T>
+bool host_syrk_batched(bool colMajor, bool lower, bool trans, bool herm, int N,
+                       int K, T alpha, T *const A[], __int64_t aOffset,
+                       __int64_t lda, T beta, T *const C[], __int64_t cOffset,
+                       __int64_t ldc, int batchSize);
+
+/* C = alpha * op(A) * op(B)^T + alpha * op(B) * op(A)^T + beta * C on one
+   triangle of C, op(A) and op(B) N x K. herm makes the products ^H with
+   conj(alpha) on the second (HER2K). Both products are packed side by side
+   and run as one rank-2K update of the triangle */
+template <typename T>
+bool host_syr2k(bool colMajor, bool lower, bool trans, bool herm, int N, int K,
+                T alpha, const T *A, __int64_t lda, const T *B, __int64_t ldb,
+                T beta, T *C, __int64_t ldc);
+
+template <typename T>
+bool host_syr2k_batched(bool colMajor, bool lower, bool trans, bool herm,
+                        int N, int K, T alpha, T *const A[], __int64_t aOffset,
+                        __int64_t lda, T *const B[], __int64_t bOffset,
+                        __int64_t ldb, T beta, T *const C[], __int64_t cOffset,
+                        __int64_t ldc, int batchSize);
+
+/* C = alpha * op(A) * op(B) + beta * C on the lower or upper triangle of
+   the N x N matrix C, op(A) N x K and op(B) K x N general; the other
+   triangle is not touched. op is a transpose when trans, conjugate when
+   conj as well. The batched form runs one entry per pool task */
+template <typename T>
+bool host_gemmt(bool colMajor, bool lower, bool transA, bool conjA,
+                bool transB, bool conjB, int N, int K, T alpha, const T *A,
+                __int64_t lda, const T *B, __int64_t ldb, T beta, T *C,
+                __int64_t ldc);
+
+template <typename T>
+bool host_gemmt_batched(bool colMajor, bool lower, bool transA, bool conjA,
+                        bool transB, bool conjB, int N, int K, T alpha,
+                        T *const A[], __int64_t aOffset, __int64_t lda,
+                        T *const B[], __int64_t bOffset, __int64_t ldb,
+                        T beta, T *const C[], __int64_t cOffset,
+                        __int64_t ldc, int batchSize);
+
+/* C = alpha * A * B + beta * C (left) or alpha * B * A + beta * C with A
+   symmetric, or Hermitian when herm, read from its lower or upper triangle
+   only; A is M x M on the left side and N x N on the right. The batched
+   form runs one entry per pool task */
+template <typename T>
+bool host_symm(bool colMajor, bool left, bool lower, bool herm, int M, int N,
+               T alpha, const T *A, __int64_t lda, const T *B, __int64_t ldb,
+               T beta, T *C, __int64_t ldc);
+
+template <typename T>
+bool host_symm_batched(bool colMajor, bool left, bool lower, bool herm, int M,
+                       int N, T alpha, T *const A[], __int64_t aOffset,
+                       __int64_t lda, T *const B[], __int64_t bOffset,
+                       __int64_t ldb, T beta, T *const C[], __int64_t cOffset,
+                       __int64_t ldc, int batchSize);
+
+/* y = alpha * op(A) * x + beta * y with A M x N, any lda and positive
+   strides. Column major N and row major T fold four columns into a block of
+   y per pass and split rows across threads; the other two cases reduce four
+   columns against x at a time and split columns. beta == 0 never reads y. */
+template <typename T>
+bool host_gemv(bool colMajor, bool trans, int M, int N, T alpha, const T *A,
+               __int64_t lda, const T *X, __int64_t incX, T beta, T *Y,
+               __int64_t incY);
+
+/* Batched GEMV: entry elt uses A + A_batchOffset * elt and likewise for X
+   and Y, the addressing of the batched tiled kernels */
+template <typename T>
+bool host_gemv_batched(bool colMajor, bool trans, int M, int N, T alpha,
+                       const T *A, __int64_t A_batchOffset, __int64_t lda,
+                       const T *X, __int64_t X_batchOffset, __int64_t incX,
+                       T beta, T *Y, __int64_t Y_batchOffset, __int64_t incY,
+                       int batchSize);
+
+/* Level-1 routines on vectors of n elements with strides inc > 0. Long
+   vectors are cut into page aligned slices that are always handled by the
+   same pool thread; reductions add the slice partials in a fixed order.
+   The batched forms address entry elt at X + X_batchOffset * elt and
+   reductions store one result per entry. */
+template <typename T>
+T host_asum(long n, const T *x, long incx);
+
+template <typename T>
+T host_dot(long n, const T *x, long incx, const T *y, long incy);
+
+template <typename T>
+void host_axpy(long n, T alpha, const T *x, long incx, T *y, long incy);
+
+template <typename T>
+void host_copy(long n, const T *x, long incx, T *y, long incy);
+
+/* x = alpha * x for T = float, double, HostComplexFloat and
+   HostComplexDouble; alpha == 0 clears x like the device kernels */
+template <typename T>
+void host_scal(long n, T alpha, T *x, long incx);
+
+/* Complex vector scaled by a real alpha (csscal, zdscal) */
+template <typename R>
+void host_scal_real(long n, R alpha, HostComplex<R> *x, long incx);
+
+template <typename T>
+void host_asum_batched(long n, const T *x, long incx, __int64_t X_batchOffset,
+                       int batchSize, T *result);
+
+template <typename T>
+void host_dot_batched(long n, const T *x, long incx, __int64_t X_batchOffset,
+                      const T *y, long incy, __int64_t Y_batchOffset,
+                      int batchSize, T *result);
+
+template <typename T>
+void host_axpy_batched(long n, T alpha, const T *x, long incx,
+                       __int64_t X_batchOffset, T *y, long incy,
+                       __int64_t Y_batchOffset, int batchSize);
+
+template <typename T>
+void host_copy_batched(long n, const T *x, long incx, __int64_t X_batchOffset,
+                       T *y, long incy, __int64_t Y_batchOffset,
+                       int batchSize);
+
+template <typename T>
+void host_scal_batched(long n, T alpha, T *x, long incx,
+                       __int64_t X_batchOffset, int batchSize);
+
+template <typename R>
+void host_scal_real_batched(long n, R alpha, HostComplex<R> *x, long incx,
+                            __int64_t X_batchOffset, int batchSize);
+
+#endif  // LIB_SRC_BLAS_HOST_HCBLAS_HOST_H_
@@ -0,0 +1,101 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Interleaved complex element used by the host engines. It has the layout of
+* hc::short_vector::float_2/double_2 and hcComplex/hcDoubleComplex (real part
+* first), so wrappers reinterpret those pointers directly.
+*/
+
+#ifndef LIB_SRC_BLAS_HOST_HOST_COMPLEX_H_
+#define LIB_SRC_BLAS_HOST_HOST_COMPLEX_H_
+
+template <typename R>
+struct HostComplex {
+  R re;
+  R im;
+
+  HostComplex() : re(0), im(0) {}
+  HostComplex(R r) : re(r), im(0) {}  // NOLINT: real promotes implicitly
+  HostComplex(R r, R i) : re(r), im(i) {}
+
+  HostComplex &operator+=(const HostComplex &o) {
+    re += o.re;
+    im += o.im;
+    return *this;
+  }
+  HostComplex &operator*=(const HostComplex &o) {
+    const R r = re * o.re - im * o.im;
+    im = re * o.im + im * o.re;
+    re = r;
+    return *this;
+  }
+};
+
+template <typename R>
+inline HostComplex<R> operator*(const HostComplex<R> &a,
+                                const HostComplex<R> &b) {
+  return HostComplex<R>(a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re);
+}
+
+template <typename R>
+inline HostComplex<R> operator+(const HostComplex<R> &a,
+                                const HostComplex<R> &b) {
+  return HostComplex<R>(a.re + b.re, a.im + b.im);
+}
+
+template <typename R>
+inline HostComplex<R> operator-(const HostComplex<R> &a,
+                                const HostComplex<R> &b) {
+  return HostComplex<R>(a.re - b.re, a.im - b.im);
+}
+
+template <typename R>
+inline HostComplex<R> operator/(const HostComplex<R> &a,
+                                const HostComplex<R> &b) {
+  const R d = b.re * b.re + b.im * b.im;
+  return HostComplex<R>((a.re * b.re + a.im * b.im) / d,
+                        (a.im * b.re - a.re * b.im) / d);
+}
+
+template <typename R>
+inline bool operator==(const HostComplex<R> &a, const HostComplex<R> &b) {
+  return a.re == b.re && a.im == b.im;
+}
+
+template <typename R>
+inline bool operator!=(const HostComplex<R> &a, const HostComplex<R> &b) {
+  return !(a == b);
+}
+
+// Complex conjugate; the identity on the real types
+template <typename R>
+inline HostComplex<R> host_conj(const HostComplex<R> &a) {
+  return HostComplex<R>(a.re, -a.im);
+}
+inline float host_conj(float a) { return a; }
+inline double host_conj(double a) { return a; }
+
+typedef HostComplex<float> HostComplexFloat;
+typedef HostComplex<double> HostComplexDouble;
+
+#endif  // LIB_SRC_BLAS_HOST_HOST_COMPLEX_H_
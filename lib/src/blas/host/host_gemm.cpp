@@ -0,0 +1,741 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Cache-blocked, multithreaded host GEMM.
+*
+* The loop nest follows the usual five-loop structure: the jc loop walks
+* NC-wide column blocks of C (sized for L3), the pc loop KC-deep slices of
+* the K dimension (sized so micro-panels stay in L1), and the ic loop
+* MC-tall row blocks (sized for L2). Each block of op(B) is packed once into
+* NR-wide panels shared by all threads; each thread packs its own block of
+* op(A) into MR-tall panels and runs the micro-kernel over MR x NR tiles.
+* Row major calls are mapped onto the column major core by computing C^T.
+* Shapes with too few tiles of C to occupy the pool split K instead (see
+* gemm_split_k).
+*/
+
+#include "./hcblas_host.h"
+#include "./host_gemm_kernels.h"
+#include "./host_half.h"
+#include "./host_platform.h"
+#include "./host_threadpool.h"
+#include "src/blas/gemmselect/gemm_autotune.h"
+#include "src/blas/trace/dispatch_trace.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename T>
+struct GemmBlocking {
+  HostGemmKernel<T> kernel;
+  long kc;
+  long mc;
+  long nc;
+};
+
+template <typename T>
+GemmBlocking<T> gemm_blocking(HostIsa isa) {
+  const HostCpuInfo &cpu = host_cpu_info();
+  GemmBlocking<T> blk;
+  blk.kernel = host_gemm_kernel<T>(isa);
+  const long mr = blk.kernel.mr;
+  const long nr = blk.kernel.nr;
+  // One A and one B micro-panel in three quarters of L1
+  long kc = static_cast<long>(cpu.l1d * 3 / 4) / ((mr + nr) * sizeof(T));
+  kc = std::min(512L, std::max(64L, kc & ~7L));
+  // The packed A block in half of L2
+  long mc = static_cast<long>(cpu.l2 / 2) / (kc * sizeof(T));
+  mc = std::max(mr, mc / mr * mr);
+  // The packed B block in half of L3
+  long nc = static_cast<long>(cpu.l3 / 2) / (kc * sizeof(T));
+  nc = std::max(nr, std::min(4096L, nc) / nr * nr);
+  blk.kc = kc;
+  blk.mc = mc;
+  blk.nc = nc;
+  return blk;
+}
+
+// Blocking for each ISA level; only levels the CPU supports are used
+template <typename T>
+const GemmBlocking<T> &cached_blocking(HostIsa isa) {
+  static const GemmBlocking<T> blk[3] = {
+      gemm_blocking<T>(HOST_ISA_GENERIC), gemm_blocking<T>(HOST_ISA_AVX2),
+      gemm_blocking<T>(HOST_ISA_AVX512)};
+  return blk[isa];
+}
+
+// Packs op(A)[0:mc, 0:kc] into MR-tall panels, zero padding the last one
+template <typename T>
+void pack_a(bool trans, long mc, long kc, const T *A, long lda, int mr,
+            T *dst) {
+  for (long ir = 0; ir < mc; ir += mr) {
+    const long m = std::min<long>(mr, mc - ir);
+    for (long p = 0; p < kc; p++) {
+      if (!trans) {
+        const T *src = A + ir + p * lda;
+        for (long i = 0; i < m; i++) dst[i] = src[i];
+      } else {
+        const T *src = A + (ir * lda) + p;
+        for (long i = 0; i < m; i++) dst[i] = src[i * lda];
+      }
+      for (long i = m; i < mr; i++) dst[i] = T(0);
+      dst += mr;
+    }
+  }
+}
+
+// Packs op(B)[0:kc, 0:nc] into NR-wide panels, zero padding the last one
+template <typename T>
+void pack_b(bool trans, long kc, long nc, const T *B, long ldb, int nr,
+            T *dst) {
+  for (long jr = 0; jr < nc; jr += nr) {
+    const long n = std::min<long>(nr, nc - jr);
+    for (long p = 0; p < kc; p++) {
+      if (!trans) {
+        const T *src = B + p + jr * ldb;
+        for (long j = 0; j < n; j++) dst[j] = src[j * ldb];
+      } else {
+        const T *src = B + (p * ldb) + jr;
+        for (long j = 0; j < n; j++) dst[j] = src[j];
+      }
+      for (long j = n; j < nr; j++) dst[j] = T(0);
+      dst += nr;
+    }
+  }
+}
+
+// Half precision operands are widened to float while packing, so the float
+// micro-kernels run unchanged and accumulate in FP32
+void pack_a(bool trans, long mc, long kc, const uint16_t *A, long lda, int mr,
+            float *dst) {
+  for (long ir = 0; ir < mc; ir += mr) {
+    const long m = std::min<long>(mr, mc - ir);
+    if (!trans) {
+      for (long p = 0; p < kc; p++) {
+        host_half_to_float(A + ir + p * lda, dst + p * mr, m);
+        for (long i = m; i < mr; i++) dst[p * mr + i] = 0.0f;
+      }
+    } else {
+      for (long i = 0; i < m; i++) {
+        const uint16_t *src = A + (ir + i) * lda;
+        for (long p = 0; p < kc; p++) {
+          dst[p * mr + i] = host_half_to_float(src[p]);
+        }
+      }
+      for (long p = 0; p < kc; p++) {
+        for (long i = m; i < mr; i++) dst[p * mr + i] = 0.0f;
+      }
+    }
+    dst += mr * kc;
+  }
+}
+
+void pack_b(bool trans, long kc, long nc, const uint16_t *B, long ldb, int nr,
+            float *dst) {
+  for (long jr = 0; jr < nc; jr += nr) {
+    const long n = std::min<long>(nr, nc - jr);
+    if (trans) {
+      for (long p = 0; p < kc; p++) {
+        host_half_to_float(B + p * ldb + jr, dst + p * nr, n);
+        for (long j = n; j < nr; j++) dst[p * nr + j] = 0.0f;
+      }
+    } else {
+      for (long j = 0; j < n; j++) {
+        const uint16_t *src = B + (jr + j) * ldb;
+        for (long p = 0; p < kc; p++) {
+          dst[p * nr + j] = host_half_to_float(src[p]);
+        }
+      }
+      for (long p = 0; p < kc; p++) {
+        for (long j = n; j < nr; j++) dst[p * nr + j] = 0.0f;
+      }
+    }
+    dst += nr * kc;
+  }
+}
+
+// C[0:m, 0:n] = alpha * ab + beta * C; C is not read when beta is zero
+template <typename T>
+void update_tile(long m, long n, const T *ab, int mr, T alpha, T beta, T *C,
+                 long ldc) {
+  for (long j = 0; j < n; j++) {
+    T *c = C + j * ldc;
+    const T *t = ab + j * mr;
+    if (beta == T(0)) {
+      for (long i = 0; i < m; i++) c[i] = alpha * t[i];
+    } else if (beta == T(1)) {
+      for (long i = 0; i < m; i++) c[i] += alpha * t[i];
+    } else {
+      for (long i = 0; i < m; i++) c[i] = alpha * t[i] + beta * c[i];
+    }
+  }
+}
+
+template <typename T>
+void scale_c(long M, long N, T beta, T *C, long ldc) {
+  for (long j = 0; j < N; j++) {
+    T *c = C + j * ldc;
+    if (beta == T(0)) {
+      for (long i = 0; i < M; i++) c[i] = T(0);
+    } else {
+      for (long i = 0; i < M; i++) c[i] *= beta;
+    }
+  }
+}
+
+// c[0:m] = round(alpha * t + beta * c) for a half column of C, combining in
+// float so each element is rounded once
+void update_half_column(long m, const float *t, float alpha, float beta,
+                        uint16_t *c) {
+  float col[256];
+  for (long i0 = 0; i0 < m; i0 += 256) {
+    const long len = std::min(256L, m - i0);
+    if (beta == 0.0f) {
+      for (long i = 0; i < len; i++) col[i] = alpha * t[i0 + i];
+    } else {
+      host_half_to_float(c + i0, col, len);
+      for (long i = 0; i < len; i++) {
+        col[i] = alpha * t[i0 + i] + beta * col[i];
+      }
+    }
+    host_float_to_half(col, c + i0, len);
+  }
+}
+
+// Half C tile update; only used when all of K fits in one KC block, see
+// hgemm_col_major
+void update_tile(long m, long n, const float *ab, int mr, float alpha,
+                 float beta, uint16_t *C, long ldc) {
+  for (long j = 0; j < n; j++) {
+    update_half_column(m, ab + j * mr, alpha, beta, C + j * ldc);
+  }
+}
+
+void scale_c(long M, long N, float beta, uint16_t *C, long ldc) {
+  for (long j = 0; j < N; j++) {
+    uint16_t *c = C + j * ldc;
+    for (long i = 0; i < M; i++) {
+      const float scaled = beta * host_half_to_float(c[i]);
+      c[i] = (beta == 0.0f) ? 0 : host_float_to_half(scaled);
+    }
+  }
+}
+
+// S is the storage type of A and B, SC the storage type of C and T the type
+// packed and computed in. A serial call keeps every task on the calling
+// thread, which wins for shapes too small to amortize waking the pool.
+// Returns false when a packing buffer cannot be allocated; C may then be
+// partly updated.
+template <typename S, typename SC, typename T>
+bool gemm_col_major(const GemmBlocking<T> &blk, bool serial, bool transA,
+                    bool transB, long M, long N, long K, T alpha, const S *A,
+                    long lda, const S *B, long ldb, T beta, SC *C, long ldc) {
+  HostThreadPool &pool = HostThreadPool::instance();
+  auto run = [&](int tasks, const std::function<void(int)> &fn) {
+    if (serial) {
+      for (int t = 0; t < tasks; t++) fn(t);
+    } else {
+      pool.parallel_for(tasks, fn);
+    }
+  };
+  if (alpha == T(0) || K == 0) {
+    run(static_cast<int>(std::min<long>(N, 64)), [&](int t) {
+      long cols = (N + 63) / 64;
+      long j0 = std::min(N, t * cols);
+      long j1 = std::min(N, j0 + cols);
+      scale_c(M, j1 - j0, beta, C + j0 * ldc, ldc);
+    });
+    return true;
+  }
+
+  const int mr = blk.kernel.mr;
+  const int nr = blk.kernel.nr;
+  const long kcMax = std::min(blk.kc, K);
+  const long ncMax = std::min(blk.nc, (N + nr - 1) / nr * nr);
+  // Shrink MC when M alone cannot feed every thread
+  const int threads = serial ? 1 : pool.num_threads();
+  long mcMax = std::min(blk.mc, (M + mr - 1) / mr * mr);
+  const long mrPerThread = ((M + mr - 1) / mr + threads - 1) / threads;
+  mcMax = std::max<long>(mr, std::min(mcMax, mrPerThread * mr * 2));
+
+  static thread_local HostBuffer bBuffer;
+  T *packedB = static_cast<T *>(bBuffer.get(kcMax * ncMax * sizeof(T)));
+  if (packedB == NULL) return false;
+  // Set by a task that could not allocate its packed block of op(A)
+  std::atomic<bool> failed(false);
+
+  for (long jc = 0; jc < N; jc += ncMax) {
+    const long nc = std::min(ncMax, N - jc);
+    const long nPanels = (nc + nr - 1) / nr;
+    for (long pc = 0; pc < K; pc += kcMax) {
+      const long kc = std::min(kcMax, K - pc);
+      const T betaBlock = (pc == 0) ? beta : T(1);
+
+      // Pack op(B)[pc:pc+kc, jc:jc+nc], several panels per task
+      const long panelsPerTask = std::max(1L, nPanels / (4 * threads));
+      const int packTasks =
+          static_cast<int>((nPanels + panelsPerTask - 1) / panelsPerTask);
+      run(packTasks, [&](int t) {
+        const long p0 = t * panelsPerTask;
+        const long p1 = std::min(nPanels, p0 + panelsPerTask);
+        const long j0 = p0 * nr;
+        const long j1 = std::min(nc, p1 * nr);
+        const S *src = transB ? B + (pc * ldb) + (jc + j0)
+                              : B + pc + (jc + j0) * ldb;
+        pack_b(transB, kc, j1 - j0, src, ldb, nr, packedB + j0 * kc);
+      });
+
+      // Tasks are ic blocks, split further into groups of NR panels when
+      // there are fewer row blocks than threads
+      const long mBlocks = (M + mcMax - 1) / mcMax;
+      const long nGroups =
+          std::min(nPanels, std::max(1L, (threads + mBlocks - 1) / mBlocks));
+      const long panelsPerGroup = (nPanels + nGroups - 1) / nGroups;
+      run(static_cast<int>(mBlocks * nGroups), [&](int t) {
+        const long ic = (t / nGroups) * mcMax;
+        const long g = t % nGroups;
+        const long mc = std::min(mcMax, M - ic);
+        const long jr0 = g * panelsPerGroup * nr;
+        const long jr1 = std::min(nc, jr0 + panelsPerGroup * nr);
+        if (jr0 >= jr1) return;
+
+        static thread_local HostBuffer aBuffer;
+        const long mcPadded = (mc + mr - 1) / mr * mr;
+        T *packedA = static_cast<T *>(aBuffer.get(mcPadded * kc * sizeof(T)));
+        if (packedA == NULL) {
+          failed = true;
+          return;
+        }
+        const S *src = transA ? A + (ic * lda) + pc : A + ic + pc * lda;
+        pack_a(transA, mc, kc, src, lda, mr, packedA);
+
+        alignas(64) T ab[HOST_GEMM_MAX_TILE];
+        for (long jr = jr0; jr < jr1; jr += nr) {
+          const long n = std::min<long>(nr, nc - jr);
+          const T *b = packedB + jr * kc;
+          for (long ir = 0; ir < mc; ir += mr) {
+            const long m = std::min<long>(mr, mc - ir);
+            blk.kernel.fn(kc, packedA + ir * kc, b, ab);
+            update_tile(m, n, ab, mr, alpha, betaBlock,
+                        C + (ic + ir) + (jc + jr) * ldc, ldc);
+          }
+        }
+      });
+      if (failed) return false;
+    }
+  }
+  return true;
+}
+
+// Split-K: fewer micro tiles of C than pool threads would leave threads idle
+// while K is walked one KC block at a time. Each task instead multiplies one
+// K range into its own M x N workspace, the workspaces are summed pairwise in
+// a fixed tree, so the result does not depend on scheduling, and the sum is
+// applied to C once. Returns false, leaving C untouched, when the
+// workspaces cannot be allocated.
+template <typename T>
+int split_k_count(const GemmBlocking<T> &blk, long M, long N, long K) {
+  const long long tiles = static_cast<long long>((M + blk.kernel.mr - 1) /
+                                                 blk.kernel.mr) *
+                          ((N + blk.kernel.nr - 1) / blk.kernel.nr);
+  return gemm_split_k_count(tiles, HostThreadPool::instance().num_threads(), K,
+                            4 * blk.kc);
+}
+
+template <typename T>
+bool gemm_split_k(const GemmBlocking<T> &blk, int splits, bool transA,
+                  bool transB, long M, long N, long K, T alpha, const T *A,
+                  long lda, const T *B, long ldb, T beta, T *C, long ldc) {
+  HostThreadPool &pool = HostThreadPool::instance();
+  static thread_local HostBuffer wBuffer;
+  const long size = M * N;
+  T *W = static_cast<T *>(wBuffer.get(splits * size * sizeof(T)));
+  if (W == NULL) return false;
+  const long chunk = (K + splits - 1) / splits;
+  std::atomic<bool> failed(false);
+  pool.parallel_for(splits, [&](int s) {
+    const long k0 = std::min(K, s * chunk);
+    const long k1 = std::min(K, k0 + chunk);
+    const T *a = transA ? A + k0 : A + k0 * lda;
+    const T *b = transB ? B + k0 * ldb : B + k0;
+    if (!gemm_col_major(blk, true, transA, transB, M, N, k1 - k0, T(1), a,
+                        lda, b, ldb, T(0), W + s * size, M)) {
+      failed = true;
+    }
+  });
+  if (failed) return false;
+
+  const int colTasks = static_cast<int>(std::min<long>(N, 64));
+  const long cols = (N + colTasks - 1) / colTasks;
+  for (long stride = 1; stride < splits; stride *= 2) {
+    pool.parallel_for(colTasks, [&](int t) {
+      const long i0 = std::min(N, t * cols) * M;
+      const long i1 = std::min(N, (t + 1) * cols) * M;
+      for (long s = 0; s + stride < splits; s += 2 * stride) {
+        T *dst = W + s * size;
+        const T *src = W + (s + stride) * size;
+        for (long i = i0; i < i1; i++) dst[i] += src[i];
+      }
+    });
+  }
+  pool.parallel_for(colTasks, [&](int t) {
+    const long j0 = std::min(N, t * cols);
+    const long j1 = std::min(N, j0 + cols);
+    update_tile(M, j1 - j0, W + j0 * M, static_cast<int>(M), alpha, beta,
+                C + j0 * ldc, ldc);
+  });
+  return true;
+}
+
+template <typename T>
+char precision_of();
+template <>
+char precision_of<float>() { return 's'; }
+template <>
+char precision_of<double>() { return 'd'; }
+template <>
+char precision_of<HostComplexFloat>() { return 'c'; }
+template <>
+char precision_of<HostComplexDouble>() { return 'z'; }
+
+template <typename T>
+const char *routine_of();
+template <>
+const char *routine_of<float>() { return "sgemm"; }
+template <>
+const char *routine_of<double>() { return "dgemm"; }
+template <>
+const char *routine_of<HostComplexFloat>() { return "cgemm"; }
+template <>
+const char *routine_of<HostComplexDouble>() { return "zgemm"; }
+
+template <typename T>
+struct HostGemmVariant {
+  GemmKernelInfo info;
+  std::string name;
+  HostIsa isa;
+  bool serial;
+  // HostTiledKernel run on the host runtime, -1 for the blocked GEMM
+  int tiled;
+};
+
+// The device kernels on the host runtime (host_sgemm_tiled), float only
+template <typename T>
+void add_tiled_variants(std::vector<HostGemmVariant<T> > *) {}
+
+template <>
+void add_tiled_variants<float>(std::vector<HostGemmVariant<float> > *v) {
+  static const char *const names[HOST_TILED_KERNELS] = {
+      "host_tiled_TS8XSS8", "host_tiled_TS16XMTS2", "host_tiled_TS16XMTS4"};
+  static const int tiles[HOST_TILED_KERNELS] = {8, 16, 16};
+  static const int microTiles[HOST_TILED_KERNELS] = {1, 2, 4};
+  for (int k = 0; k < HOST_TILED_KERNELS; k++) {
+    HostGemmVariant<float> var;
+    var.name = names[k];
+    var.info.multiple[0] = var.info.multiple[1] = var.info.multiple[2] = 1;
+    var.info.tile = tiles[k];
+    var.info.micro_tile = microTiles[k];
+    var.isa = HOST_ISA_GENERIC;
+    var.serial = false;
+    var.tiled = k;
+    v->push_back(var);
+  }
+}
+
+template <typename T>
+bool gemm_tiled_variant(int, bool, bool, bool, int, int, int, T, const T *,
+                        __int64_t, const T *, __int64_t, T, T *, __int64_t) {
+  return false;
+}
+
+template <>
+bool gemm_tiled_variant<float>(int kernel, bool colMajor, bool transA,
+                               bool transB, int M, int N, int K, float alpha,
+                               const float *A, __int64_t lda, const float *B,
+                               __int64_t ldb, float beta, float *C,
+                               __int64_t ldc) {
+  const HostTiledKernel k = static_cast<HostTiledKernel>(kernel);
+  if (colMajor) {
+    host_sgemm_tiled(k, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta,
+                     C, ldc);
+  } else {
+    host_sgemm_tiled(k, transB, transA, N, M, K, alpha, B, ldb, A, lda, beta,
+                     C, ldc);
+  }
+  return true;
+}
+
+// The tiled device kernels, then threaded and serial variants of every
+// micro-kernel the CPU supports, ending with the default: the widest kernel,
+// threaded
+template <typename T>
+const std::vector<HostGemmVariant<T> > &gemm_variants() {
+  static const std::vector<HostGemmVariant<T> > variants = [] {
+    std::vector<HostGemmVariant<T> > v;
+    add_tiled_variants<T>(&v);
+    const HostIsa best = host_cpu_info().isa;
+    for (int isa = HOST_ISA_GENERIC; isa <= best; isa++) {
+      const GemmBlocking<T> &blk =
+          cached_blocking<T>(static_cast<HostIsa>(isa));
+      for (int serial = 1; serial >= 0; serial--) {
+        HostGemmVariant<T> var;
+        var.name = std::string("host_") + blk.kernel.name +
+                   (serial ? "_st" : "_mt");
+        var.info.multiple[0] = var.info.multiple[1] = var.info.multiple[2] = 1;
+        var.info.tile = blk.kernel.mr;
+        var.info.micro_tile = blk.kernel.nr;
+        var.isa = static_cast<HostIsa>(isa);
+        var.serial = serial != 0;
+        var.tiled = -1;
+        v.push_back(var);
+      }
+    }
+    for (size_t i = 0; i < v.size(); i++) v[i].info.name = v[i].name.c_str();
+    return v;
+  }();
+  return variants;
+}
+
+}  // namespace
+
+// Half GEMM. C is rounded to half exactly once: when K spans several KC
+// blocks, each column block of C is first accumulated in an FP32 workspace.
+static bool hgemm_col_major(bool transA, bool transB, long M, long N, long K,
+                            float alpha, const uint16_t *A, long lda,
+                            const uint16_t *B, long ldb, float beta,
+                            uint16_t *C, long ldc) {
+  const GemmBlocking<float> &blk = cached_blocking<float>(host_cpu_info().isa);
+  if (alpha == 0.0f || K <= blk.kc) {
+    return gemm_col_major(blk, false, transA, transB, M, N, K, alpha, A, lda,
+                          B, ldb, beta, C, ldc);
+  }
+  HostThreadPool &pool = HostThreadPool::instance();
+  static thread_local HostBuffer wBuffer;
+  const long nb = std::min<long>(blk.nc, N);
+  float *W = static_cast<float *>(wBuffer.get(M * nb * sizeof(float)));
+  if (W == NULL) return false;
+  for (long jc = 0; jc < N; jc += nb) {
+    const long nc = std::min(nb, N - jc);
+    const uint16_t *Bj = transB ? B + jc : B + jc * ldb;
+    if (!gemm_col_major(blk, false, transA, transB, M, nc, K, alpha, A, lda,
+                        Bj, ldb, 0.0f, W, M)) {
+      return false;
+    }
+    pool.parallel_for(static_cast<int>(nc), [&](int j) {
+      update_half_column(M, W + j * M, 1.0f, beta, C + (jc + j) * ldc);
+    });
+  }
+  return true;
+}
+
+template <typename T>
+int host_gemm_variant_count() {
+  return static_cast<int>(gemm_variants<T>().size());
+}
+
+template <typename T>
+const char *host_gemm_variant_name(int variant) {
+  return gemm_variants<T>()[variant].info.name;
+}
+
+template <typename T>
+bool host_gemm_variant(int variant, bool colMajor, bool transA, bool transB,
+                       int M, int N, int K, T alpha, const T *A,
+                       __int64_t lda, const T *B, __int64_t ldb, T beta, T *C,
+                       __int64_t ldc) {
+  const HostGemmVariant<T> &var = gemm_variants<T>()[variant];
+  if (var.tiled >= 0) {
+    return gemm_tiled_variant(var.tiled, colMajor, transA, transB, M, N, K,
+                              alpha, A, lda, B, ldb, beta, C, ldc);
+  }
+  const GemmBlocking<T> &blk = cached_blocking<T>(var.isa);
+  const int splits =
+      (var.serial || alpha == T(0)) ? 1 : split_k_count(blk, M, N, K);
+  // A split whose workspaces cannot be allocated runs unsplit instead
+  if (splits > 1) {
+    const bool done =
+        colMajor ? gemm_split_k(blk, splits, transA, transB, M, N, K, alpha,
+                                A, lda, B, ldb, beta, C, ldc)
+                 : gemm_split_k(blk, splits, transB, transA, N, M, K, alpha,
+                                B, ldb, A, lda, beta, C, ldc);
+    if (done) return true;
+  }
+  if (colMajor) {
+    return gemm_col_major(blk, var.serial, transA, transB, M, N, K, alpha, A,
+                          lda, B, ldb, beta, C, ldc);
+  }
+  // Row major C is column major C^T = op(B)^T * op(A)^T
+  return gemm_col_major(blk, var.serial, transB, transA, N, M, K, alpha, B,
+                        ldb, A, lda, beta, C, ldc);
+}
+
+template <typename T>
+bool host_gemm_tuned(GemmAutotuner *tuner, TuningDb *db, DispatchTrace *trace,
+                     bool colMajor, bool transA, bool transB, int M, int N,
+                     int K, T alpha, const T *A, __int64_t lda, const T *B,
+                     __int64_t ldb, T beta, T *C, __int64_t ldc) {
+  const std::vector<HostGemmVariant<T> > &variants = gemm_variants<T>();
+  const GemmTuneKey key = {precision_of<T>(), colMajor ? 'C' : 'R',
+                           transA ? 't' : 'n', transB ? 't' : 'n', M, N, K,
+                           lda, ldb, ldc};
+  bool trial = false;
+  const char *reason = NULL;
+  const HostGemmVariant<T> *var = gemm_autotune_kernel(
+      tuner, db, key, &variants[0], static_cast<int>(variants.size()),
+      &trial, &reason);
+  const int v = static_cast<int>(var - &variants[0]);
+  if (!trial && trace == NULL) {
+    return host_gemm_variant(v, colMajor, transA, transB, M, N, K, alpha, A,
+                             lda, B, ldb, beta, C, ldc);
+  }
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  if (!host_gemm_variant(v, colMajor, transA, transB, M, N, K, alpha, A, lda,
+                         B, ldb, beta, C, ldc)) {
+    return false;
+  }
+  const double ms = dispatch_trace_ms(start);
+  if (trial) gemm_autotune_record(tuner, db, key, &variants[0], v, ms);
+  if (trace != NULL) {
+    DispatchTraceEvent event = dispatch_trace_gemm(
+        routine_of<T>(), key.order, key.transA, key.transB, M, N, K);
+    event.elapsed_ms = ms;
+    event.variant = var->info.name;
+    event.reason = reason;
+    if (var->tiled >= 0) {
+      dispatch_trace_tiled(&event, var->info.tile, var->info.micro_tile);
+    } else {
+      // Row major runs C^T, whose rows are the micro-kernel's columns
+      const int mr = var->info.tile;
+      const int nr = var->info.micro_tile;
+      dispatch_trace_panels(&event, colMajor ? mr : nr, colMajor ? nr : mr);
+    }
+    trace->record(event, start);
+  }
+  return true;
+}
+
+template <typename T>
+bool host_gemm(bool colMajor, bool transA, bool transB, int M, int N, int K,
+               T alpha, const T *A, __int64_t lda, const T *B, __int64_t ldb,
+               T beta, T *C, __int64_t ldc) {
+  return host_gemm_tuned<T>(NULL, NULL, NULL, colMajor, transA, transB, M, N,
+                            K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+bool host_hgemm(bool colMajor, bool transA, bool transB, int M, int N, int K,
+                float alpha, const uint16_t *A, __int64_t lda,
+                const uint16_t *B, __int64_t ldb, float beta, uint16_t *C,
+                __int64_t ldc) {
+  if (colMajor) {
+    return hgemm_col_major(transA, transB, M, N, K, alpha, A, lda, B, ldb,
+                           beta, C, ldc);
+  }
+  return hgemm_col_major(transB, transA, N, M, K, alpha, B, ldb, A, lda, beta,
+                         C, ldc);
+}
+
+template <typename T>
+bool host_gemm_batched(bool colMajor, bool transA, bool transB, int M, int N,
+                       int K, T alpha, T *const A[], __int64_t aOffset,
+                       __int64_t A_batchOffset, __int64_t lda, T *const B[],
+                       __int64_t bOffset, __int64_t B_batchOffset,
+                       __int64_t ldb, T beta, T *const C[], __int64_t cOffset,
+                       __int64_t C_batchOffset, __int64_t ldc, int batchSize) {
+  HostThreadPool &pool = HostThreadPool::instance();
+  std::atomic<bool> failed(false);
+  std::function<void(int)> one = [&](int elt) {
+    if (!host_gemm(colMajor, transA, transB, M, N, K, alpha,
+                   A[elt] + aOffset + A_batchOffset, lda,
+                   B[elt] + bOffset + B_batchOffset, ldb, beta,
+                   C[elt] + cOffset + C_batchOffset, ldc)) {
+      failed = true;
+    }
+  };
+  if (batchSize >= pool.num_threads()) {
+    // One matrix per task; the nested GEMM then runs on its own thread
+    pool.parallel_for(batchSize, one);
+  } else {
+    for (int elt = 0; elt < batchSize; elt++) one(elt);
+  }
+  return !failed;
+}
+
+template bool host_gemm<float>(bool, bool, bool, int, int, int, float,
+                               const float *, __int64_t, const float *,
+                               __int64_t, float, float *, __int64_t);
+template bool host_gemm<double>(bool, bool, bool, int, int, int, double,
+                                const double *, __int64_t, const double *,
+                                __int64_t, double, double *, __int64_t);
+template bool host_gemm_batched<float>(bool, bool, bool, int, int, int, float,
+                                       float *const[], __int64_t, __int64_t,
+                                       __int64_t, float *const[], __int64_t,
+                                       __int64_t, __int64_t, float,
+                                       float *const[], __int64_t, __int64_t,
+                                       __int64_t, int);
+template bool host_gemm_batched<double>(bool, bool, bool, int, int, int,
+                                        double, double *const[], __int64_t,
+                                        __int64_t, __int64_t, double *const[],
+                                        __int64_t, __int64_t, __int64_t,
+                                        double, double *const[], __int64_t,
+                                        __int64_t, __int64_t, int);
+template bool host_gemm<HostComplexFloat>(
+    bool, bool, bool, int, int, int, HostComplexFloat,
+    const HostComplexFloat *, __int64_t, const HostComplexFloat *, __int64_t,
+    HostComplexFloat, HostComplexFloat *, __int64_t);
+template bool host_gemm<HostComplexDouble>(
+    bool, bool, bool, int, int, int, HostComplexDouble,
+    const HostComplexDouble *, __int64_t, const HostComplexDouble *,
+    __int64_t, HostComplexDouble, HostComplexDouble *, __int64_t);
+template bool host_gemm_batched<HostComplexFloat>(
+    bool, bool, bool, int, int, int, HostComplexFloat,
+    HostComplexFloat *const[], __int64_t, __int64_t, __int64_t,
+    HostComplexFloat *const[], __int64_t, __int64_t, __int64_t,
+    HostComplexFloat, HostComplexFloat *const[], __int64_t, __int64_t,
+    __int64_t, int);
+template bool host_gemm_batched<HostComplexDouble>(
+    bool, bool, bool, int, int, int, HostComplexDouble,
+    HostComplexDouble *const[], __int64_t, __int64_t, __int64_t,
+    HostComplexDouble *const[], __int64_t, __int64_t, __int64_t,
+    HostComplexDouble, HostComplexDouble *const[], __int64_t, __int64_t,
+    __int64_t, int);
+
+#define HOST_GEMM_VARIANT(T)                                                 \
+  template int host_gemm_variant_count<T>();                                 \
+  template const char *host_gemm_variant_name<T>(int);                       \
+  template bool host_gemm_variant<T>(int, bool, bool, bool, int, int, int, T, \
+                                     const T *, __int64_t, const T *,        \
+                                     __int64_t, T, T *, __int64_t);          \
+  template bool host_gemm_tuned<T>(GemmAutotuner *, TuningDb *,              \
+                                   DispatchTrace *, bool, bool, bool, int,   \
+                                   int, int, T, const T *, __int64_t,        \
+                                   const T *, __int64_t, T, T *, __int64_t);
+HOST_GEMM_VARIANT(float)
+HOST_GEMM_VARIANT(double)
+HOST_GEMM_VARIANT(HostComplexFloat)
+HOST_GEMM_VARIANT(HostComplexDouble)
+#undef HOST_GEMM_VARIANT
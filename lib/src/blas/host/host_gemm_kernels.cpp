@@ -0,0 +1,397 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./host_gemm_kernels.h"
+#include "./host_complex.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HOST_GEMM_X86 1
+#endif
+
+// Portable kernel relying on the compiler to vectorize the MR loop
+template <typename T, int MR, int NR>
+static void gemm_ukernel_generic(long kc, const T *a, const T *b, T *ab) {
+  T acc[MR * NR] = {};
+  for (long p = 0; p < kc; p++) {
+    for (int j = 0; j < NR; j++) {
+      const T bj = b[j];
+      for (int i = 0; i < MR; i++) {
+        acc[j * MR + i] += a[i] * bj;
+      }
+    }
+    a += MR;
+    b += NR;
+  }
+  for (int i = 0; i < MR * NR; i++) ab[i] = acc[i];
+}
+
+#ifdef HOST_GEMM_X86
+
+// The x86 kernels hold two vector registers of A per k step and broadcast NR
+// values of B, keeping the 2 * NR accumulators in named registers (GCC does
+// not promote accumulator arrays to registers reliably).
+#define UK_DECL(j) VEC c0_##j = ZERO(), c1_##j = ZERO();
+#define UK_FMA(j)                  \
+  {                                \
+    const VEC bj = BCAST(b + j);   \
+    c0_##j = FMA(a0, bj, c0_##j);  \
+    c1_##j = FMA(a1, bj, c1_##j);  \
+  }
+#define UK_STORE(j)                     \
+  STORE(ab + j * 2 * WIDTH, c0_##j);    \
+  STORE(ab + j * 2 * WIDTH + WIDTH, c1_##j);
+#define UK_COLS6(OP) OP(0) OP(1) OP(2) OP(3) OP(4) OP(5)
+#define UK_COLS12(OP) UK_COLS6(OP) OP(6) OP(7) OP(8) OP(9) OP(10) OP(11)
+
+#define UK_BODY(COLS)                                                  \
+  COLS(UK_DECL)                                                        \
+  for (long p = 0; p < kc; p++) {                                      \
+    const VEC a0 = LOAD(a);                                            \
+    const VEC a1 = LOAD(a + WIDTH);                                    \
+    _mm_prefetch(reinterpret_cast<const char *>(a + 8 * WIDTH),        \
+                 _MM_HINT_T0);                                         \
+    COLS(UK_FMA)                                                       \
+    a += 2 * WIDTH;                                                    \
+    b += NR;                                                           \
+  }                                                                    \
+  COLS(UK_STORE)
+
+// AVX2 float 16x6: 12 accumulators out of the 16 ymm registers
+__attribute__((target("avx2,fma"))) static void sgemm_ukernel_avx2_16x6(
+    long kc, const float *a, const float *b, float *ab) {
+#define VEC __m256
+#define WIDTH 8
+#define NR 6
+#define ZERO _mm256_setzero_ps
+#define BCAST _mm256_broadcast_ss
+#define FMA _mm256_fmadd_ps
+#define LOAD _mm256_load_ps
+#define STORE _mm256_store_ps
+  UK_BODY(UK_COLS6)
+#undef VEC
+#undef WIDTH
+#undef NR
+#undef ZERO
+#undef BCAST
+#undef FMA
+#undef LOAD
+#undef STORE
+}
+
+// AVX2 double 8x6
+__attribute__((target("avx2,fma"))) static void dgemm_ukernel_avx2_8x6(
+    long kc, const double *a, const double *b, double *ab) {
+#define VEC __m256d
+#define WIDTH 4
+#define NR 6
+#define ZERO _mm256_setzero_pd
+#define BCAST _mm256_broadcast_sd
+#define FMA _mm256_fmadd_pd
+#define LOAD _mm256_load_pd
+#define STORE _mm256_store_pd
+  UK_BODY(UK_COLS6)
+#undef VEC
+#undef WIDTH
+#undef NR
+#undef ZERO
+#undef BCAST
+#undef FMA
+#undef LOAD
+#undef STORE
+}
+
+// AVX-512 float 32x12: 24 accumulators out of the 32 zmm registers
+__attribute__((target("avx512f"))) static void sgemm_ukernel_avx512_32x12(
+    long kc, const float *a, const float *b, float *ab) {
+#define VEC __m512
+#define WIDTH 16
+#define NR 12
+#define ZERO _mm512_setzero_ps
+#define BCAST(p) _mm512_set1_ps(*(p))
+#define FMA _mm512_fmadd_ps
+#define LOAD _mm512_load_ps
+#define STORE _mm512_store_ps
+  UK_BODY(UK_COLS12)
+#undef VEC
+#undef WIDTH
+#undef NR
+#undef ZERO
+#undef BCAST
+#undef FMA
+#undef LOAD
+#undef STORE
+}
+
+// AVX-512 double 16x12
+__attribute__((target("avx512f"))) static void dgemm_ukernel_avx512_16x12(
+    long kc, const double *a, const double *b, double *ab) {
+#define VEC __m512d
+#define WIDTH 8
+#define NR 12
+#define ZERO _mm512_setzero_pd
+#define BCAST(p) _mm512_set1_pd(*(p))
+#define FMA _mm512_fmadd_pd
+#define LOAD _mm512_load_pd
+#define STORE _mm512_store_pd
+  UK_BODY(UK_COLS12)
+#undef VEC
+#undef WIDTH
+#undef NR
+#undef ZERO
+#undef BCAST
+#undef FMA
+#undef LOAD
+#undef STORE
+}
+
+// Complex kernels work on interleaved (re, im) panels. Each k step
+// multiplies two vectors of A by the broadcast real and imaginary parts of
+// NR values of B into separate accumulators; the cross terms are combined
+// once after the k loop with a pair swap and addsub:
+//   re = sum(ar * br) - sum(ai * bi),  im = sum(ai * br) + sum(ar * bi)
+#define CUK_DECL(j) VEC r0_##j = ZERO(), r1_##j = ZERO(), i0_##j = ZERO(), \
+                        i1_##j = ZERO();
+#define CUK_FMA(j)                            \
+  {                                           \
+    const VEC br = BCAST(b + 2 * j);          \
+    const VEC bi = BCAST(b + 2 * j + 1);      \
+    r0_##j = FMA(a0, br, r0_##j);             \
+    r1_##j = FMA(a1, br, r1_##j);             \
+    i0_##j = FMA(a0, bi, i0_##j);             \
+    i1_##j = FMA(a1, bi, i1_##j);             \
+  }
+#define CUK_STORE(j)                                            \
+  STORE(ab + j * 2 * WIDTH, ADDSUB(r0_##j, SWAP(i0_##j)));      \
+  STORE(ab + j * 2 * WIDTH + WIDTH, ADDSUB(r1_##j, SWAP(i1_##j)));
+#define UK_COLS3(OP) OP(0) OP(1) OP(2)
+
+#define CUK_BODY(COLS)                                          \
+  COLS(CUK_DECL)                                                \
+  for (long p = 0; p < kc; p++) {                               \
+    const VEC a0 = LOAD(a);                                     \
+    const VEC a1 = LOAD(a + WIDTH);                             \
+    _mm_prefetch(reinterpret_cast<const char *>(a + 8 * WIDTH), \
+                 _MM_HINT_T0);                                  \
+    COLS(CUK_FMA)                                               \
+    a += 2 * WIDTH;                                             \
+    b += 2 * NR;                                                \
+  }                                                             \
+  COLS(CUK_STORE)
+
+// AVX2 complex float 8x3: 4 complex values per ymm, 12 accumulators
+__attribute__((target("avx2,fma"))) static void cgemm_ukernel_avx2_8x3(
+    long kc, const HostComplexFloat *ac, const HostComplexFloat *bc,
+    HostComplexFloat *abc) {
+  const float *a = reinterpret_cast<const float *>(ac);
+  const float *b = reinterpret_cast<const float *>(bc);
+  float *ab = reinterpret_cast<float *>(abc);
+#define VEC __m256
+#define WIDTH 8
+#define NR 3
+#define ZERO _mm256_setzero_ps
+#define BCAST _mm256_broadcast_ss
+#define FMA _mm256_fmadd_ps
+#define LOAD _mm256_load_ps
+#define STORE _mm256_store_ps
+#define SWAP(x) _mm256_permute_ps(x, 0xb1)
+#define ADDSUB _mm256_addsub_ps
+  CUK_BODY(UK_COLS3)
+#undef VEC
+#undef WIDTH
+#undef NR
+#undef ZERO
+#undef BCAST
+#undef FMA
+#undef LOAD
+#undef STORE
+#undef SWAP
+#undef ADDSUB
+}
+
+// AVX2 complex double 4x3: 2 complex values per ymm
+__attribute__((target("avx2,fma"))) static void zgemm_ukernel_avx2_4x3(
+    long kc, const HostComplexDouble *ac, const HostComplexDouble *bc,
+    HostComplexDouble *abc) {
+  const double *a = reinterpret_cast<const double *>(ac);
+  const double *b = reinterpret_cast<const double *>(bc);
+  double *ab = reinterpret_cast<double *>(abc);
+#define VEC __m256d
+#define WIDTH 4
+#define NR 3
+#define ZERO _mm256_setzero_pd
+#define BCAST _mm256_broadcast_sd
+#define FMA _mm256_fmadd_pd
+#define LOAD _mm256_load_pd
+#define STORE _mm256_store_pd
+#define SWAP(x) _mm256_permute_pd(x, 0x5)
+#define ADDSUB _mm256_addsub_pd
+  CUK_BODY(UK_COLS3)
+#undef VEC
+#undef WIDTH
+#undef NR
+#undef ZERO
+#undef BCAST
+#undef FMA
+#undef LOAD
+#undef STORE
+#undef SWAP
+#undef ADDSUB
+}
+
+// AVX-512 has no addsub; fmaddsub(x, 1, y) gives the same x -/+ y pattern
+__attribute__((target("avx512f"))) static void cgemm_ukernel_avx512_16x6(
+    long kc, const HostComplexFloat *ac, const HostComplexFloat *bc,
+    HostComplexFloat *abc) {
+  const float *a = reinterpret_cast<const float *>(ac);
+  const float *b = reinterpret_cast<const float *>(bc);
+  float *ab = reinterpret_cast<float *>(abc);
+  const __m512 ones = _mm512_set1_ps(1.0f);
+#define VEC __m512
+#define WIDTH 16
+#define NR 6
+#define ZERO _mm512_setzero_ps
+#define BCAST(p) _mm512_set1_ps(*(p))
+#define FMA _mm512_fmadd_ps
+#define LOAD _mm512_load_ps
+#define STORE _mm512_store_ps
+#define SWAP(x) _mm512_permute_ps(x, 0xb1)
+#define ADDSUB(x, y) _mm512_fmaddsub_ps(x, ones, y)
+  CUK_BODY(UK_COLS6)
+#undef VEC
+#undef WIDTH
+#undef NR
+#undef ZERO
+#undef BCAST
+#undef FMA
+#undef LOAD
+#undef STORE
+#undef SWAP
+#undef ADDSUB
+}
+
+__attribute__((target("avx512f"))) static void zgemm_ukernel_avx512_8x6(
+    long kc, const HostComplexDouble *ac, const HostComplexDouble *bc,
+    HostComplexDouble *abc) {
+  const double *a = reinterpret_cast<const double *>(ac);
+  const double *b = reinterpret_cast<const double *>(bc);
+  double *ab = reinterpret_cast<double *>(abc);
+  const __m512d ones = _mm512_set1_pd(1.0);
+#define VEC __m512d
+#define WIDTH 8
+#define NR 6
+#define ZERO _mm512_setzero_pd
+#define BCAST(p) _mm512_set1_pd(*(p))
+#define FMA _mm512_fmadd_pd
+#define LOAD _mm512_load_pd
+#define STORE _mm512_store_pd
+#define SWAP(x) _mm512_permute_pd(x, 0x55)
+#define ADDSUB(x, y) _mm512_fmaddsub_pd(x, ones, y)
+  CUK_BODY(UK_COLS6)
+#undef VEC
+#undef WIDTH
+#undef NR
+#undef ZERO
+#undef BCAST
+#undef FMA
+#undef LOAD
+#undef STORE
+#undef SWAP
+#undef ADDSUB
+}
+
+#endif  // HOST_GEMM_X86
+
+template <typename T>
+static HostGemmKernel<T> make_kernel(int mr, int nr,
+                                     typename HostGemmKernel<T>::Fn fn,
+                                     const char *name) {
+  HostGemmKernel<T> k;
+  k.mr = mr;
+  k.nr = nr;
+  k.fn = fn;
+  k.name = name;
+  return k;
+}
+
+template <>
+HostGemmKernel<float> host_gemm_kernel<float>(HostIsa isa) {
+#ifdef HOST_GEMM_X86
+  if (isa >= HOST_ISA_AVX512) {
+    return make_kernel<float>(32, 12, sgemm_ukernel_avx512_32x12,
+                              "avx512_32x12");
+  }
+  if (isa >= HOST_ISA_AVX2) {
+    return make_kernel<float>(16, 6, sgemm_ukernel_avx2_16x6, "avx2_16x6");
+  }
+#endif
+  return make_kernel<float>(8, 4, gemm_ukernel_generic<float, 8, 4>,
+                            "generic_8x4");
+}
+
+template <>
+HostGemmKernel<double> host_gemm_kernel<double>(HostIsa isa) {
+#ifdef HOST_GEMM_X86
+  if (isa >= HOST_ISA_AVX512) {
+    return make_kernel<double>(16, 12, dgemm_ukernel_avx512_16x12,
+                               "avx512_16x12");
+  }
+  if (isa >= HOST_ISA_AVX2) {
+    return make_kernel<double>(8, 6, dgemm_ukernel_avx2_8x6, "avx2_8x6");
+  }
+#endif
+  return make_kernel<double>(4, 4, gemm_ukernel_generic<double, 4, 4>,
+                             "generic_4x4");
+}
+
+template <>
+HostGemmKernel<HostComplexFloat> host_gemm_kernel<HostComplexFloat>(
+    HostIsa isa) {
+#ifdef HOST_GEMM_X86
+  if (isa >= HOST_ISA_AVX512) {
+    return make_kernel<HostComplexFloat>(16, 6, cgemm_ukernel_avx512_16x6,
+                                         "avx512_c16x6");
+  }
+  if (isa >= HOST_ISA_AVX2) {
+    return make_kernel<HostComplexFloat>(8, 3, cgemm_ukernel_avx2_8x3,
+                                         "avx2_c8x3");
+  }
+#endif
+  return make_kernel<HostComplexFloat>(
+      4, 2, gemm_ukernel_generic<HostComplexFloat, 4, 2>, "generic_c4x2");
+}
+
+template <>
+HostGemmKernel<HostComplexDouble> host_gemm_kernel<HostComplexDouble>(
+    HostIsa isa) {
+#ifdef HOST_GEMM_X86
+  if (isa >= HOST_ISA_AVX512) {
+    return make_kernel<HostComplexDouble>(8, 6, zgemm_ukernel_avx512_8x6,
+                                          "avx512_z8x6");
+  }
+  if (isa >= HOST_ISA_AVX2) {
+    return make_kernel<HostComplexDouble>(4, 3, zgemm_ukernel_avx2_4x3,
+                                          "avx2_z4x3");
+  }
+#endif
+  return make_kernel<HostComplexDouble>(
+      2, 2, gemm_ukernel_generic<HostComplexDouble, 2, 2>, "generic_z2x2");
+}
@@ -0,0 +1,65 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Register-blocked GEMM micro-kernels for the host engine.
+*
+* A micro-kernel multiplies a packed MR x kc panel of op(A) by a packed
+* kc x NR panel of op(B) and writes the MR x NR product, column major, to ab.
+* Panels are laid out one k step after the other: MR contiguous values of A
+* and NR contiguous values of B per step, zero padded at the matrix edges.
+*/
+
+#ifndef LIB_SRC_BLAS_HOST_HOST_GEMM_KERNELS_H_
+#define LIB_SRC_BLAS_HOST_HOST_GEMM_KERNELS_H_
+
+#include "./host_complex.h"
+#include "./host_platform.h"
+
+// Largest MR * NR over all kernels, used to size the tile buffer
+#define HOST_GEMM_MAX_TILE 384
+
+template <typename T>
+struct HostGemmKernel {
+  typedef void (*Fn)(long kc, const T *a, const T *b, T *ab);
+  int mr;
+  int nr;
+  Fn fn;
+  const char *name;
+};
+
+// Picks the widest kernel the running CPU supports
+template <typename T>
+HostGemmKernel<T> host_gemm_kernel(HostIsa isa);
+
+template <>
+HostGemmKernel<float> host_gemm_kernel<float>(HostIsa isa);
+template <>
+HostGemmKernel<double> host_gemm_kernel<double>(HostIsa isa);
+template <>
+HostGemmKernel<HostComplexFloat> host_gemm_kernel<HostComplexFloat>(
+    HostIsa isa);
+template <>
+HostGemmKernel<HostComplexDouble> host_gemm_kernel<HostComplexDouble>(
+    HostIsa isa);
+
+#endif  // LIB_SRC_BLAS_HOST_HOST_GEMM_KERNELS_H_
@@ -0,0 +1,401 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./hcblas_host.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+#include "./host_platform.h"
+#include "./host_simd.h"
+#include "./host_threadpool.h"
+
+// GEMV reads every element of A exactly once, so the engine is written
+// around streaming A at memory speed. Everything is expressed on a column
+// major matrix (a row major matrix is its transpose) with two sweeps:
+//
+//  axpy sweep, y = A * x:   four columns are folded into a block of y that
+//                           stays in L1; threads own disjoint row ranges.
+//  dot sweep,  y = A' * x:  four columns are reduced against the same block
+//                           of x with one accumulator per column; threads
+//                           own disjoint column ranges, or row ranges with
+//                           private partial results when A is tall and thin.
+
+// Bytes of A each thread streams at least, and the row granularity of the
+// slices so neighbouring threads never write the same cache line of y
+#define HOST_GEMV_MIN_BYTES (64 * 1024)
+#define HOST_GEMV_ROW_ALIGN 64
+
+namespace {
+
+/* Portable kernels */
+
+// y[0, m) += A[:, 0:4] * x[0:4]
+template <typename T>
+void axpy4_generic(long m, const T *a, long lda, const T *x, T *y) {
+  const T *a0 = a, *a1 = a + lda, *a2 = a + 2 * lda, *a3 = a + 3 * lda;
+  const T x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3];
+  for (long i = 0; i < m; i++) {
+    y[i] += a0[i] * x0 + a1[i] * x1 + a2[i] * x2 + a3[i] * x3;
+  }
+}
+
+template <typename T>
+void axpy1_generic(long m, const T *a, T x0, T *y) {
+  for (long i = 0; i < m; i++) y[i] += a[i] * x0;
+}
+
+// acc[0:4] += A[0:m, 0:4]' * x[0, m)
+template <typename T>
+void dot4_generic(long m, const T *a, long lda, const T *x, T *acc) {
+  const T *a0 = a, *a1 = a + lda, *a2 = a + 2 * lda, *a3 = a + 3 * lda;
+  T s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  for (long i = 0; i < m; i++) {
+    s0 += a0[i] * x[i];
+    s1 += a1[i] * x[i];
+    s2 += a2[i] * x[i];
+    s3 += a3[i] * x[i];
+  }
+  acc[0] += s0;
+  acc[1] += s1;
+  acc[2] += s2;
+  acc[3] += s3;
+}
+
+template <typename T>
+T dot1_generic(long m, const T *a, const T *x) {
+  T s0 = 0, s1 = 0;
+  long i = 0;
+  for (; i + 2 <= m; i += 2) {
+    s0 += a[i] * x[i];
+    s1 += a[i + 1] * x[i + 1];
+  }
+  if (i < m) s0 += a[i] * x[i];
+  return s0 + s1;
+}
+
+#ifdef HOST_SIMD_X86
+/* AVX2 versions of the four column kernels, shared between precisions
+   through the VEC/WIDTH macros */
+
+#define GEMV_AXPY4_BODY                                                 \
+  const T *a0 = a, *a1 = a + lda, *a2 = a + 2 * lda, *a3 = a + 3 * lda; \
+  const VEC x0 = SET1(x[0]), x1 = SET1(x[1]);                           \
+  const VEC x2 = SET1(x[2]), x3 = SET1(x[3]);                           \
+  long i = 0;                                                           \
+  for (; i + WIDTH <= m; i += WIDTH) {                                  \
+    VEC t = FMA(LOADU(a0 + i), x0, LOADU(y + i));                       \
+    t = FMA(LOADU(a1 + i), x1, t);                                      \
+    t = FMA(LOADU(a2 + i), x2, t);                                      \
+    STOREU(y + i, FMA(LOADU(a3 + i), x3, t));                           \
+  }                                                                     \
+  if (i < m) axpy4_generic(m - i, a + i, lda, x, y + i);
+
+#define GEMV_DOT4_BODY                                                  \
+  const T *a0 = a, *a1 = a + lda, *a2 = a + 2 * lda, *a3 = a + 3 * lda; \
+  VEC s0 = SET1(0), s1 = SET1(0), s2 = SET1(0), s3 = SET1(0);           \
+  long i = 0;                                                           \
+  for (; i + WIDTH <= m; i += WIDTH) {                                  \
+    const VEC xv = LOADU(x + i);                                        \
+    s0 = FMA(LOADU(a0 + i), xv, s0);                                    \
+    s1 = FMA(LOADU(a1 + i), xv, s1);                                    \
+    s2 = FMA(LOADU(a2 + i), xv, s2);                                    \
+    s3 = FMA(LOADU(a3 + i), xv, s3);                                    \
+  }                                                                     \
+  acc[0] += host_hsum(s0);                                              \
+  acc[1] += host_hsum(s1);                                              \
+  acc[2] += host_hsum(s2);                                              \
+  acc[3] += host_hsum(s3);                                              \
+  if (i < m) dot4_generic(m - i, a + i, lda, x + i, acc);
+
+#define T float
+#define VEC __m256
+#define WIDTH 8
+#define SET1 _mm256_set1_ps
+#define LOADU _mm256_loadu_ps
+#define STOREU _mm256_storeu_ps
+#define FMA _mm256_fmadd_ps
+__attribute__((target("avx2,fma"))) void axpy4_avx2(long m, const T *a,
+                                                    long lda, const T *x,
+                                                    T *y) {
+  GEMV_AXPY4_BODY
+}
+__attribute__((target("avx2,fma"))) void dot4_avx2(long m, const T *a,
+                                                   long lda, const T *x,
+                                                   T *acc) {
+  GEMV_DOT4_BODY
+}
+#undef T
+#undef VEC
+#undef WIDTH
+#undef SET1
+#undef LOADU
+#undef STOREU
+#undef FMA
+
+#define T double
+#define VEC __m256d
+#define WIDTH 4
+#define SET1 _mm256_set1_pd
+#define LOADU _mm256_loadu_pd
+#define STOREU _mm256_storeu_pd
+#define FMA _mm256_fmadd_pd
+__attribute__((target("avx2,fma"))) void axpy4_avx2(long m, const T *a,
+                                                    long lda, const T *x,
+                                                    T *y) {
+  GEMV_AXPY4_BODY
+}
+__attribute__((target("avx2,fma"))) void dot4_avx2(long m, const T *a,
+                                                   long lda, const T *x,
+                                                   T *acc) {
+  GEMV_DOT4_BODY
+}
+#undef T
+#undef VEC
+#undef WIDTH
+#undef SET1
+#undef LOADU
+#undef STOREU
+#undef FMA
+#endif  // HOST_SIMD_X86
+
+template <typename T>
+struct GemvKernels {
+  void (*axpy4)(long, const T *, long, const T *, T *);
+  void (*dot4)(long, const T *, long, const T *, T *);
+};
+
+template <typename T>
+GemvKernels<T> gemv_kernels() {
+  GemvKernels<T> k;
+  k.axpy4 = axpy4_generic<T>;
+  k.dot4 = dot4_generic<T>;
+#ifdef HOST_SIMD_X86
+  if (host_cpu_info().isa >= HOST_ISA_AVX2) {
+    k.axpy4 = axpy4_avx2;
+    k.dot4 = dot4_avx2;
+  }
+#endif
+  return k;
+}
+
+// y = alpha * t + beta * y over n strided entries; beta == 0 never reads y
+template <typename T>
+void store_y(long n, T alpha, const T *t, T beta, T *y, long incy) {
+  if (beta == T(0)) {
+    for (long i = 0; i < n; i++) y[i * incy] = alpha * t[i];
+  } else {
+    for (long i = 0; i < n; i++) {
+      y[i * incy] = alpha * t[i] + beta * y[i * incy];
+    }
+  }
+}
+
+// Number of slices for a sweep that streams `bytes` of A over `units` rows or
+// columns, each slice a multiple of `align` units
+int slice_count(double bytes, long units, long align) {
+  long byBytes = static_cast<long>(bytes / HOST_GEMV_MIN_BYTES);
+  long byUnits = (units + align - 1) / align;
+  long n = std::min<long>(HostThreadPool::instance().num_threads(),
+                          std::min(byBytes, byUnits));
+  return static_cast<int>(std::max<long>(n, 1));
+}
+
+// y = alpha * A * x + beta * y, A column major m x n, x contiguous. Returns
+// false when a slice cannot allocate its block of y; y may then be partly
+// updated.
+template <typename T>
+bool gemv_axpy_sweep(long m, long n, T alpha, const T *A, long lda,
+                     const T *x, T beta, T *y, long incy) {
+  const GemvKernels<T> k = gemv_kernels<T>();
+  const long yBlock = std::max<long>(
+      HOST_GEMV_ROW_ALIGN, host_cpu_info().l1d / 4 / sizeof(T) /
+                               HOST_GEMV_ROW_ALIGN * HOST_GEMV_ROW_ALIGN);
+  const int slices =
+      slice_count(static_cast<double>(m) * n * sizeof(T), m,
+                  HOST_GEMV_ROW_ALIGN);
+  long chunk = (m + slices - 1) / slices;
+  chunk = (chunk + HOST_GEMV_ROW_ALIGN - 1) / HOST_GEMV_ROW_ALIGN *
+          HOST_GEMV_ROW_ALIGN;
+
+  std::atomic<bool> failed(false);
+  HostThreadPool::instance().parallel_pinned(slices, [&](int s) {
+    static thread_local HostBuffer tBuffer;
+    T *t = static_cast<T *>(tBuffer.get(yBlock * sizeof(T)));
+    if (t == NULL) {
+      failed = true;
+      return;
+    }
+    const long r0 = s * chunk, r1 = std::min(m, r0 + chunk);
+    for (long i0 = r0; i0 < r1; i0 += yBlock) {
+      const long mb = std::min(yBlock, r1 - i0);
+      std::fill(t, t + mb, T(0));
+      long j = 0;
+      for (; j + 4 <= n; j += 4) k.axpy4(mb, A + i0 + j * lda, lda, x + j, t);
+      for (; j < n; j++) axpy1_generic(mb, A + i0 + j * lda, x[j], t);
+      store_y(mb, alpha, t, beta, y + i0 * incy, incy);
+    }
+  });
+  return !failed;
+}
+
+// acc[0, c1 - c0) += A[r0:r1, c0:c1]' * x[r0:r1]
+template <typename T>
+void dot_tile(const GemvKernels<T> &k, long r0, long r1, long c0, long c1,
+              const T *A, long lda, const T *x, T *acc) {
+  // Rows are blocked so the slice of x stays in L2 across the columns
+  const long xBlock = std::max<long>(
+      1024, host_cpu_info().l2 / 2 / sizeof(T) / 64 * 64);
+  for (long i0 = r0; i0 < r1; i0 += xBlock) {
+    const long mb = std::min(xBlock, r1 - i0);
+    long j = c0;
+    for (; j + 4 <= c1; j += 4) {
+      k.dot4(mb, A + i0 + j * lda, lda, x + i0, acc + (j - c0));
+    }
+    for (; j < c1; j++) {
+      acc[j - c0] += dot1_generic(mb, A + i0 + j * lda, x + i0);
+    }
+  }
+}
+
+// y = alpha * A' * x + beta * y, A column major m x n, x contiguous; the
+// return value as for gemv_axpy_sweep
+template <typename T>
+bool gemv_dot_sweep(long m, long n, T alpha, const T *A, long lda, const T *x,
+                    T beta, T *y, long incy) {
+  const GemvKernels<T> k = gemv_kernels<T>();
+  const double bytes = static_cast<double>(m) * n * sizeof(T);
+  HostThreadPool &pool = HostThreadPool::instance();
+  const int colSlices = slice_count(bytes, n, 4);
+  const int rowSlices = slice_count(bytes, m, 1024);
+
+  if (colSlices >= pool.num_threads() || colSlices >= rowSlices) {
+    long chunk = (n + colSlices - 1) / colSlices;
+    chunk = (chunk + 3) / 4 * 4;
+    std::atomic<bool> failed(false);
+    pool.parallel_pinned(colSlices, [&](int s) {
+      const long c0 = s * chunk, c1 = std::min(n, c0 + chunk);
+      if (c0 >= c1) return;
+      static thread_local HostBuffer accBuffer;
+      T *acc = static_cast<T *>(accBuffer.get((c1 - c0) * sizeof(T)));
+      if (acc == NULL) {
+        failed = true;
+        return;
+      }
+      std::fill(acc, acc + (c1 - c0), T(0));
+      dot_tile(k, 0, m, c0, c1, A, lda, x, acc);
+      store_y(c1 - c0, alpha, acc, beta, y + c0 * incy, incy);
+    });
+    return !failed;
+  }
+
+  // Too few columns to keep every thread busy: split the rows instead and
+  // add the private partial results in slice order
+  long chunk = (m + rowSlices - 1) / rowSlices;
+  chunk = (chunk + 1023) / 1024 * 1024;
+  std::vector<T> partial(static_cast<size_t>(rowSlices) * n, T(0));
+  pool.parallel_pinned(rowSlices, [&](int s) {
+    const long r0 = s * chunk, r1 = std::min(m, r0 + chunk);
+    if (r0 < r1) dot_tile(k, r0, r1, 0, n, A, lda, x, &partial[s * n]);
+  });
+  for (int s = 1; s < rowSlices; s++) {
+    for (long j = 0; j < n; j++) partial[j] += partial[s * n + j];
+  }
+  store_y(n, alpha, &partial[0], beta, y, incy);
+  return true;
+}
+
+}  // namespace
+
+template <typename T>
+bool host_gemv(bool colMajor, bool trans, int M, int N, T alpha, const T *A,
+               __int64_t lda, const T *X, __int64_t incX, T beta, T *Y,
+               __int64_t incY) {
+  const long lenY = trans ? N : M;
+  const long lenX = trans ? M : N;
+  if (alpha == T(0)) {
+    for (long i = 0; i < lenY; i++) {
+      Y[i * incY] = (beta == T(0)) ? T(0) : beta * Y[i * incY];
+    }
+    return true;
+  }
+
+  // Strided x is gathered once so the kernels only see unit stride
+  const T *x = X;
+  static thread_local HostBuffer xBuffer;
+  if (incX != 1) {
+    T *packed = static_cast<T *>(xBuffer.get(lenX * sizeof(T)));
+    if (packed == NULL) return false;
+    for (long i = 0; i < lenX; i++) packed[i] = X[i * incX];
+    x = packed;
+  }
+
+  // A row major M x N matrix is the column major N x M matrix A'
+  const long m = colMajor ? M : N, n = colMajor ? N : M;
+  if (colMajor != trans) {
+    return gemv_axpy_sweep<T>(m, n, alpha, A, lda, x, beta, Y, incY);
+  }
+  return gemv_dot_sweep<T>(m, n, alpha, A, lda, x, beta, Y, incY);
+}
+
+template <typename T>
+bool host_gemv_batched(bool colMajor, bool trans, int M, int N, T alpha,
+                       const T *A, __int64_t A_batchOffset, __int64_t lda,
+                       const T *X, __int64_t X_batchOffset, __int64_t incX,
+                       T beta, T *Y, __int64_t Y_batchOffset, __int64_t incY,
+                       int batchSize) {
+  HostThreadPool &pool = HostThreadPool::instance();
+  std::atomic<bool> failed(false);
+  std::function<void(int)> one = [&](int elt) {
+    if (!host_gemv(colMajor, trans, M, N, alpha, A + A_batchOffset * elt, lda,
+                   X + X_batchOffset * elt, incX, beta,
+                   Y + Y_batchOffset * elt, incY)) {
+      failed = true;
+    }
+  };
+  const double bytes = static_cast<double>(M) * N * sizeof(T);
+  if (batchSize >= pool.num_threads() ||
+      bytes < HOST_GEMV_MIN_BYTES * pool.num_threads()) {
+    // One matrix per task; the nested GEMV then runs on its own thread
+    pool.parallel_for(batchSize, one);
+  } else {
+    for (int elt = 0; elt < batchSize; elt++) one(elt);
+  }
+  return !failed;
+}
+
+template bool host_gemv<float>(bool, bool, int, int, float, const float *,
+                               __int64_t, const float *, __int64_t, float,
+                               float *, __int64_t);
+template bool host_gemv<double>(bool, bool, int, int, double, const double *,
+                                __int64_t, const double *, __int64_t, double,
+                                double *, __int64_t);
+template bool host_gemv_batched<float>(bool, bool, int, int, float,
+                                       const float *, __int64_t, __int64_t,
+                                       const float *, __int64_t, __int64_t,
+                                       float, float *, __int64_t, __int64_t,
+                                       int);
+template bool host_gemv_batched<double>(bool, bool, int, int, double,
+                                        const double *, __int64_t, __int64_t,
+                                        const double *, __int64_t, __int64_t,
+                                        double, double *, __int64_t,
+                                        __int64_t, int);
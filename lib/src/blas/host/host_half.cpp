@@ -0,0 +1,118 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./host_half.h"
+#include "./host_platform.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HOST_HALF_X86 1
+#endif
+
+typedef void (*HalfToFloatFn)(const uint16_t *, float *, long);
+typedef void (*FloatToHalfFn)(const float *, uint16_t *, long);
+
+static void half_to_float_generic(const uint16_t *src, float *dst, long n) {
+  for (long i = 0; i < n; i++) dst[i] = host_half_to_float(src[i]);
+}
+
+static void float_to_half_generic(const float *src, uint16_t *dst, long n) {
+  for (long i = 0; i < n; i++) dst[i] = host_float_to_half(src[i]);
+}
+
+#ifdef HOST_HALF_X86
+
+__attribute__((target("avx,f16c"))) static void half_to_float_f16c(
+    const uint16_t *src, float *dst, long n) {
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+  }
+  for (; i < n; i++) dst[i] = _cvtsh_ss(src[i]);
+}
+
+__attribute__((target("avx,f16c"))) static void float_to_half_f16c(
+    const float *src, uint16_t *dst, long n) {
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i),
+                                _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), h);
+  }
+  for (; i < n; i++) dst[i] = _cvtss_sh(src[i], _MM_FROUND_TO_NEAREST_INT);
+}
+
+__attribute__((target("avx512f,f16c"))) static void half_to_float_avx512(
+    const uint16_t *src, float *dst, long n) {
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+    _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(h));
+  }
+  for (; i < n; i++) dst[i] = _cvtsh_ss(src[i]);
+}
+
+__attribute__((target("avx512f,f16c"))) static void float_to_half_avx512(
+    const float *src, uint16_t *dst, long n) {
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256i h = _mm512_cvtps_ph(_mm512_loadu_ps(src + i),
+                                _MM_FROUND_TO_NEAREST_INT);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), h);
+  }
+  for (; i < n; i++) dst[i] = _cvtss_sh(src[i], _MM_FROUND_TO_NEAREST_INT);
+}
+
+#endif  // HOST_HALF_X86
+
+struct HalfConverters {
+  HalfToFloatFn toFloat;
+  FloatToHalfFn toHalf;
+};
+
+static HalfConverters select_converters() {
+  const HostCpuInfo &cpu = host_cpu_info();
+  HalfConverters c = {half_to_float_generic, float_to_half_generic};
+#ifdef HOST_HALF_X86
+  if (cpu.f16c && cpu.isa >= HOST_ISA_AVX512) {
+    c.toFloat = half_to_float_avx512;
+    c.toHalf = float_to_half_avx512;
+  } else if (cpu.f16c) {
+    c.toFloat = half_to_float_f16c;
+    c.toHalf = float_to_half_f16c;
+  }
+#endif
+  return c;
+}
+
+static const HalfConverters &converters() {
+  static const HalfConverters c = select_converters();
+  return c;
+}
+
+void host_half_to_float(const uint16_t *src, float *dst, long n) {
+  converters().toFloat(src, dst, n);
+}
+
+void host_float_to_half(const float *src, uint16_t *dst, long n) {
+  converters().toHalf(src, dst, n);
+}
@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* IEEE binary16 <-> binary32 conversion for the host engines. Half values are
+* carried as their uint16_t bit pattern so this code stays independent of
+* hc::half. Bulk conversions use F16C (or AVX-512F) when available.
+*/
+
+#ifndef LIB_SRC_BLAS_HOST_HOST_HALF_H_
+#define LIB_SRC_BLAS_HOST_HOST_HALF_H_
+
+#include <cstdint>
+#include <cstring>
+
+inline float host_half_to_float(uint16_t h) {
+  const uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+  uint32_t exp = (h >> 10) & 0x1f;
+  uint32_t mant = h & 0x3ff;
+  uint32_t bits;
+  if (exp == 0x1f) {
+    // Inf / NaN (NaNs come back quiet, as with F16C)
+    bits = sign | 0x7f800000 | (mant << 13) | (mant ? 0x400000 : 0);
+  } else if (exp != 0) {
+    bits = sign | ((exp + 112) << 23) | (mant << 13);
+  } else if (mant == 0) {
+    bits = sign;
+  } else {
+    // Subnormal half: normalize into a float
+    exp = 113;
+    while ((mant & 0x400) == 0) {
+      mant <<= 1;
+      exp--;
+    }
+    bits = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+  }
+  float f;
+  memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// Round to nearest even, the same rounding as _MM_FROUND_TO_NEAREST_INT
+inline uint16_t host_float_to_half(float f) {
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  const uint32_t absBits = bits & 0x7fffffff;
+  if (absBits >= 0x7f800000) {
+    // Inf stays Inf, NaN stays a quiet NaN
+    return sign | 0x7c00 | (absBits > 0x7f800000 ? 0x200 : 0);
+  }
+  if (absBits >= 0x477ff000) {
+    // Rounds to a magnitude beyond the largest half
+    return sign | 0x7c00;
+  }
+  if (absBits < 0x38800000) {
+    // Subnormal or zero half; 0x33000000 is half the smallest subnormal
+    if (absBits <= 0x33000000) return sign;
+    const uint32_t shift = 126 - (absBits >> 23);
+    const uint32_t mant = (absBits & 0x7fffff) | 0x800000;
+    uint32_t half = mant >> shift;
+    const uint32_t rem = mant & ((1u << shift) - 1);
+    const uint32_t mid = 1u << (shift - 1);
+    if (rem > mid || (rem == mid && (half & 1))) half++;
+    return sign | static_cast<uint16_t>(half);
+  }
+  uint32_t half = ((absBits >> 13) - (112 << 10));
+  const uint32_t rem = absBits & 0x1fff;
+  if (rem > 0x1000 || (rem == 0x1000 && (half & 1))) half++;
+  return sign | static_cast<uint16_t>(half);
+}
+
+// Contiguous conversions of n values
+void host_half_to_float(const uint16_t *src, float *dst, long n);
+void host_float_to_half(const float *src, uint16_t *dst, long n);
+
+#endif  // LIB_SRC_BLAS_HOST_HOST_HALF_H_
@@ -0,0 +1,480 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./hcblas_host.h"
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "./host_platform.h"
+#include "./host_reduce.h"
+#include "./host_simd.h"
+#include "./host_threadpool.h"
+
+// Level-1 routines are bandwidth bound: one pass over each operand with one
+// or two flops per element. The kernels below stream contiguous vectors with
+// unaligned SIMD loads and keep four independent accumulators so reductions
+// are limited by memory rather than by the add latency. AVX-512 is not used;
+// it does not move more bytes per second than AVX2 on these loops.
+
+// Each thread streams at least this many bytes of the primary operand, below
+// that a single core already saturates its share of the memory bandwidth
+#define HOST_L1_MIN_SLICE (64 * 1024)
+// Slices are cut at page multiples so no page is shared by two threads and
+// first touch placement follows the pinned thread that owns the slice
+#define HOST_L1_PAGE 4096
+
+namespace {
+
+/* Portable kernels, also used for strided vectors */
+
+template <typename T>
+T asum_generic(long n, const T *x, long incx) {
+  T s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += std::fabs(x[i * incx]);
+    s1 += std::fabs(x[(i + 1) * incx]);
+    s2 += std::fabs(x[(i + 2) * incx]);
+    s3 += std::fabs(x[(i + 3) * incx]);
+  }
+  for (; i < n; i++) s0 += std::fabs(x[i * incx]);
+  return (s0 + s1) + (s2 + s3);
+}
+
+template <typename T>
+T dot_generic(long n, const T *x, long incx, const T *y, long incy) {
+  T s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += x[i * incx] * y[i * incy];
+    s1 += x[(i + 1) * incx] * y[(i + 1) * incy];
+    s2 += x[(i + 2) * incx] * y[(i + 2) * incy];
+    s3 += x[(i + 3) * incx] * y[(i + 3) * incy];
+  }
+  for (; i < n; i++) s0 += x[i * incx] * y[i * incy];
+  return (s0 + s1) + (s2 + s3);
+}
+
+template <typename T>
+void axpy_generic(long n, T alpha, const T *x, long incx, T *y, long incy) {
+  for (long i = 0; i < n; i++) y[i * incy] += alpha * x[i * incx];
+}
+
+template <typename T>
+void scal_generic(long n, T alpha, T *x, long incx) {
+  for (long i = 0; i < n; i++) x[i * incx] *= alpha;
+}
+
+template <typename T>
+void copy_generic(long n, const T *x, long incx, T *y, long incy) {
+  if (incx == 1 && incy == 1) {
+    memcpy(y, x, n * sizeof(T));
+    return;
+  }
+  for (long i = 0; i < n; i++) y[i * incy] = x[i * incx];
+}
+
+#ifdef HOST_SIMD_X86
+/* AVX2 kernels for contiguous vectors. The bodies are shared between single
+   and double precision through the VEC/WIDTH macros. */
+
+#define L1_ASUM_BODY                                          \
+  const VEC sign = SET1(-0.0);                                \
+  VEC a0 = SET1(0), a1 = SET1(0), a2 = SET1(0), a3 = SET1(0); \
+  long i = 0;                                                 \
+  for (; i + 4 * WIDTH <= n; i += 4 * WIDTH) {                \
+    a0 = ADD(a0, ANDNOT(sign, LOADU(x + i)));                 \
+    a1 = ADD(a1, ANDNOT(sign, LOADU(x + i + WIDTH)));         \
+    a2 = ADD(a2, ANDNOT(sign, LOADU(x + i + 2 * WIDTH)));     \
+    a3 = ADD(a3, ANDNOT(sign, LOADU(x + i + 3 * WIDTH)));     \
+  }                                                           \
+  for (; i + WIDTH <= n; i += WIDTH) {                        \
+    a0 = ADD(a0, ANDNOT(sign, LOADU(x + i)));                 \
+  }                                                           \
+  a0 = ADD(ADD(a0, a1), ADD(a2, a3));                         \
+  return host_hsum(a0) + asum_generic(n - i, x + i, 1);
+
+#define L1_DOT_BODY                                                   \
+  VEC a0 = SET1(0), a1 = SET1(0), a2 = SET1(0), a3 = SET1(0);         \
+  long i = 0;                                                         \
+  for (; i + 4 * WIDTH <= n; i += 4 * WIDTH) {                        \
+    a0 = FMA(LOADU(x + i), LOADU(y + i), a0);                         \
+    a1 = FMA(LOADU(x + i + WIDTH), LOADU(y + i + WIDTH), a1);         \
+    a2 = FMA(LOADU(x + i + 2 * WIDTH), LOADU(y + i + 2 * WIDTH), a2); \
+    a3 = FMA(LOADU(x + i + 3 * WIDTH), LOADU(y + i + 3 * WIDTH), a3); \
+  }                                                                   \
+  for (; i + WIDTH <= n; i += WIDTH) {                                \
+    a0 = FMA(LOADU(x + i), LOADU(y + i), a0);                         \
+  }                                                                   \
+  a0 = ADD(ADD(a0, a1), ADD(a2, a3));                                 \
+  return host_hsum(a0) + dot_generic(n - i, x + i, 1, y + i, 1);
+
+#define L1_AXPY_BODY                                   \
+  const VEC a = SET1(alpha);                           \
+  long i = 0;                                          \
+  for (; i + 2 * WIDTH <= n; i += 2 * WIDTH) {         \
+    STOREU(y + i, FMA(a, LOADU(x + i), LOADU(y + i))); \
+    STOREU(y + i + WIDTH, FMA(a, LOADU(x + i + WIDTH), \
+                              LOADU(y + i + WIDTH)));  \
+  }                                                    \
+  axpy_generic(n - i, alpha, x + i, 1, y + i, 1);
+
+#define L1_SCAL_BODY                                     \
+  const VEC a = SET1(alpha);                             \
+  long i = 0;                                            \
+  for (; i + 2 * WIDTH <= n; i += 2 * WIDTH) {           \
+    STOREU(x + i, MUL(a, LOADU(x + i)));                 \
+    STOREU(x + i + WIDTH, MUL(a, LOADU(x + i + WIDTH))); \
+  }                                                      \
+  scal_generic(n - i, alpha, x + i, 1);
+
+#define VEC __m256
+#define WIDTH 8
+#define SET1 _mm256_set1_ps
+#define LOADU _mm256_loadu_ps
+#define STOREU _mm256_storeu_ps
+#define ADD _mm256_add_ps
+#define MUL _mm256_mul_ps
+#define ANDNOT _mm256_andnot_ps
+#define FMA _mm256_fmadd_ps
+__attribute__((target("avx2,fma"))) float asum_avx2(long n, const float *x) {
+  L1_ASUM_BODY
+}
+__attribute__((target("avx2,fma"))) float dot_avx2(long n, const float *x,
+                                                   const float *y) {
+  L1_DOT_BODY
+}
+__attribute__((target("avx2,fma"))) void axpy_avx2(long n, float alpha,
+                                                   const float *x, float *y) {
+  L1_AXPY_BODY
+}
+__attribute__((target("avx2,fma"))) void scal_avx2(long n, float alpha,
+                                                   float *x) {
+  L1_SCAL_BODY
+}
+#undef VEC
+#undef WIDTH
+#undef SET1
+#undef LOADU
+#undef STOREU
+#undef ADD
+#undef MUL
+#undef ANDNOT
+#undef FMA
+
+#define VEC __m256d
+#define WIDTH 4
+#define SET1 _mm256_set1_pd
+#define LOADU _mm256_loadu_pd
+#define STOREU _mm256_storeu_pd
+#define ADD _mm256_add_pd
+#define MUL _mm256_mul_pd
+#define ANDNOT _mm256_andnot_pd
+#define FMA _mm256_fmadd_pd
+__attribute__((target("avx2,fma"))) double asum_avx2(long n, const double *x) {
+  L1_ASUM_BODY
+}
+__attribute__((target("avx2,fma"))) double dot_avx2(long n, const double *x,
+                                                    const double *y) {
+  L1_DOT_BODY
+}
+__attribute__((target("avx2,fma"))) void axpy_avx2(long n, double alpha,
+                                                   const double *x,
+                                                   double *y) {
+  L1_AXPY_BODY
+}
+__attribute__((target("avx2,fma"))) void scal_avx2(long n, double alpha,
+                                                   double *x) {
+  L1_SCAL_BODY
+}
+#undef VEC
+#undef WIDTH
+#undef SET1
+#undef LOADU
+#undef STOREU
+#undef ADD
+#undef MUL
+#undef ANDNOT
+#undef FMA
+
+// Complex scaling on interleaved (re, im) pairs: x * ar -/+ swap(x) * ai
+__attribute__((target("avx2,fma"))) void scal_avx2(long n,
+                                                   HostComplexFloat alpha,
+                                                   HostComplexFloat *x) {
+  float *p = reinterpret_cast<float *>(x);
+  const __m256 ar = _mm256_set1_ps(alpha.re);
+  const __m256 ai = _mm256_set1_ps(alpha.im);
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256 v = _mm256_loadu_ps(p + 2 * i);
+    __m256 sw = _mm256_mul_ps(_mm256_permute_ps(v, 0xb1), ai);
+    _mm256_storeu_ps(p + 2 * i, _mm256_fmaddsub_ps(v, ar, sw));
+  }
+  scal_generic(n - i, alpha, x + i, 1);
+}
+
+__attribute__((target("avx2,fma"))) void scal_avx2(long n,
+                                                   HostComplexDouble alpha,
+                                                   HostComplexDouble *x) {
+  double *p = reinterpret_cast<double *>(x);
+  const __m256d ar = _mm256_set1_pd(alpha.re);
+  const __m256d ai = _mm256_set1_pd(alpha.im);
+  long i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m256d v = _mm256_loadu_pd(p + 2 * i);
+    __m256d sw = _mm256_mul_pd(_mm256_permute_pd(v, 0x5), ai);
+    _mm256_storeu_pd(p + 2 * i, _mm256_fmaddsub_pd(v, ar, sw));
+  }
+  scal_generic(n - i, alpha, x + i, 1);
+}
+#endif  // HOST_SIMD_X86
+
+inline bool use_avx2() { return host_cpu_info().isa >= HOST_ISA_AVX2; }
+
+/* Contiguous entry points with ISA dispatch */
+
+template <typename T>
+T asum_contig(long n, const T *x) {
+#ifdef HOST_SIMD_X86
+  if (use_avx2()) return asum_avx2(n, x);
+#endif
+  return asum_generic(n, x, 1);
+}
+
+template <typename T>
+T dot_contig(long n, const T *x, const T *y) {
+#ifdef HOST_SIMD_X86
+  if (use_avx2()) return dot_avx2(n, x, y);
+#endif
+  return dot_generic(n, x, 1, y, 1);
+}
+
+template <typename T>
+void axpy_contig(long n, T alpha, const T *x, T *y) {
+#ifdef HOST_SIMD_X86
+  if (use_avx2()) return axpy_avx2(n, alpha, x, y);
+#endif
+  axpy_generic(n, alpha, x, 1, y, 1);
+}
+
+template <typename T>
+void scal_contig(long n, T alpha, T *x) {
+#ifdef HOST_SIMD_X86
+  if (use_avx2()) return scal_avx2(n, alpha, x);
+#endif
+  scal_generic(n, alpha, x, 1);
+}
+
+/* Static partitioning, see host_reduce.h */
+
+// Runs fn(begin, end) over static slices of [0, n)
+template <typename F>
+void for_slices(long n, size_t elemBytes, size_t streamBytes, const F &fn) {
+  HostSlices sl = host_slices(n, elemBytes, streamBytes);
+  if (sl.count == 1) {
+    fn(0L, n);
+    return;
+  }
+  HostThreadPool::instance().parallel_pinned(sl.count, [&](int s) {
+    long begin = s * sl.chunk;
+    long end = begin + sl.chunk < n ? begin + sl.chunk : n;
+    fn(begin, end);
+  });
+}
+
+// Batches whose entries are too short to be split across every thread are
+// spread over the pool one entry per task instead
+inline bool batch_per_task(long n, size_t streamBytes, int batchSize) {
+  const long threads = HostThreadPool::instance().num_threads();
+  const long bytes = n * streamBytes;
+  if (batchSize < 2 || bytes * batchSize < HOST_L1_MIN_SLICE) return false;
+  return batchSize >= threads || bytes < HOST_L1_MIN_SLICE * threads;
+}
+
+template <typename F>
+void for_batch(long n, size_t streamBytes, int batchSize, const F &fn) {
+  if (batch_per_task(n, streamBytes, batchSize)) {
+    HostThreadPool::instance().parallel_for(batchSize, [&](int e) { fn(e); });
+  } else {
+    for (int e = 0; e < batchSize; e++) fn(e);
+  }
+}
+
+}  // namespace
+
+HostSlices host_slices(long n, size_t elemBytes, size_t streamBytes) {
+  HostSlices sl;
+  const long page = HOST_L1_PAGE / elemBytes;
+  long maxSlices = n * streamBytes / HOST_L1_MIN_SLICE;
+  int threads = HostThreadPool::instance().num_threads();
+  sl.count = maxSlices < threads ? static_cast<int>(maxSlices) : threads;
+  if (sl.count < 1) sl.count = 1;
+  sl.chunk = (n + sl.count - 1) / sl.count;
+  sl.chunk = (sl.chunk + page - 1) / page * page;
+  sl.count = static_cast<int>((n + sl.chunk - 1) / sl.chunk);
+  return sl;
+}
+
+template <typename T>
+T host_asum(long n, const T *x, long incx) {
+  return host_reduce<T>(n, sizeof(T) * incx, [=](long b, long e) {
+    return incx == 1 ? asum_contig(e - b, x + b)
+                     : asum_generic(e - b, x + b * incx, incx);
+  });
+}
+
+template <typename T>
+T host_dot(long n, const T *x, long incx, const T *y, long incy) {
+  return host_reduce<T>(n, sizeof(T) * 2, [=](long b, long e) {
+    return (incx == 1 && incy == 1)
+               ? dot_contig(e - b, x + b, y + b)
+               : dot_generic(e - b, x + b * incx, incx, y + b * incy, incy);
+  });
+}
+
+template <typename T>
+void host_axpy(long n, T alpha, const T *x, long incx, T *y, long incy) {
+  for_slices(n, sizeof(T), sizeof(T) * 3, [=](long b, long e) {
+    if (incx == 1 && incy == 1) {
+      axpy_contig(e - b, alpha, x + b, y + b);
+    } else {
+      axpy_generic(e - b, alpha, x + b * incx, incx, y + b * incy, incy);
+    }
+  });
+}
+
+template <typename T>
+void host_copy(long n, const T *x, long incx, T *y, long incy) {
+  for_slices(n, sizeof(T), sizeof(T) * 2, [=](long b, long e) {
+    copy_generic(e - b, x + b * incx, incx, y + b * incy, incy);
+  });
+}
+
+template <typename T>
+void host_scal(long n, T alpha, T *x, long incx) {
+  const bool zero = (alpha == T(0));
+  for_slices(n, sizeof(T), sizeof(T) * 2, [=](long b, long e) {
+    if (zero) {
+      // alpha == 0 clears x, matching the device kernels
+      for (long i = b; i < e; i++) x[i * incx] = T(0);
+    } else if (incx == 1) {
+      scal_contig(e - b, alpha, x + b);
+    } else {
+      scal_generic(e - b, alpha, x + b * incx, incx);
+    }
+  });
+}
+
+template <typename R>
+void host_scal_real(long n, R alpha, HostComplex<R> *x, long incx) {
+  R *p = reinterpret_cast<R *>(x);
+  if (incx == 1) {
+    host_scal<R>(2 * n, alpha, p, 1);
+    return;
+  }
+  // Strided pairs: scale the real and the imaginary lanes separately
+  host_scal<R>(n, alpha, p, 2 * incx);
+  host_scal<R>(n, alpha, p + 1, 2 * incx);
+}
+
+template <typename T>
+void host_asum_batched(long n, const T *x, long incx, __int64_t X_batchOffset,
+                       int batchSize, T *result) {
+  for_batch(n, sizeof(T) * incx, batchSize, [=](int e) {
+    result[e] = host_asum(n, x + X_batchOffset * e, incx);
+  });
+}
+
+template <typename T>
+void host_dot_batched(long n, const T *x, long incx, __int64_t X_batchOffset,
+                      const T *y, long incy, __int64_t Y_batchOffset,
+                      int batchSize, T *result) {
+  for_batch(n, sizeof(T) * 2, batchSize, [=](int e) {
+    result[e] =
+        host_dot(n, x + X_batchOffset * e, incx, y + Y_batchOffset * e, incy);
+  });
+}
+
+template <typename T>
+void host_axpy_batched(long n, T alpha, const T *x, long incx,
+                       __int64_t X_batchOffset, T *y, long incy,
+                       __int64_t Y_batchOffset, int batchSize) {
+  for_batch(n, sizeof(T) * 3, batchSize, [=](int e) {
+    host_axpy(n, alpha, x + X_batchOffset * e, incx, y + Y_batchOffset * e,
+              incy);
+  });
+}
+
+template <typename T>
+void host_copy_batched(long n, const T *x, long incx, __int64_t X_batchOffset,
+                       T *y, long incy, __int64_t Y_batchOffset,
+                       int batchSize) {
+  for_batch(n, sizeof(T) * 2, batchSize, [=](int e) {
+    host_copy(n, x + X_batchOffset * e, incx, y + Y_batchOffset * e, incy);
+  });
+}
+
+template <typename T>
+void host_scal_batched(long n, T alpha, T *x, long incx,
+                       __int64_t X_batchOffset, int batchSize) {
+  for_batch(n, sizeof(T) * 2, batchSize, [=](int e) {
+    host_scal(n, alpha, x + X_batchOffset * e, incx);
+  });
+}
+
+template <typename R>
+void host_scal_real_batched(long n, R alpha, HostComplex<R> *x, long incx,
+                            __int64_t X_batchOffset, int batchSize) {
+  for_batch(n, sizeof(R) * 4, batchSize, [=](int e) {
+    host_scal_real(n, alpha, x + X_batchOffset * e, incx);
+  });
+}
+
+#define HOST_L1_REAL(T)                                                     \
+  template T host_asum<T>(long, const T *, long);                           \
+  template T host_dot<T>(long, const T *, long, const T *, long);           \
+  template void host_axpy<T>(long, T, const T *, long, T *, long);          \
+  template void host_asum_batched<T>(long, const T *, long, __int64_t, int, \
+                                     T *);                                  \
+  template void host_dot_batched<T>(long, const T *, long, __int64_t,       \
+                                    const T *, long, __int64_t, int, T *);  \
+  template void host_axpy_batched<T>(long, T, const T *, long, __int64_t,   \
+                                     T *, long, __int64_t, int);            \
+  template void host_copy<T>(long, const T *, long, T *, long);             \
+  template void host_copy_batched<T>(long, const T *, long, __int64_t, T *, \
+                                     long, __int64_t, int);
+#define HOST_L1_SCAL(T)                           \
+  template void host_scal<T>(long, T, T *, long); \
+  template void host_scal_batched<T>(long, T, T *, long, __int64_t, int);
+
+HOST_L1_REAL(float)
+HOST_L1_REAL(double)
+HOST_L1_SCAL(float)
+HOST_L1_SCAL(double)
+HOST_L1_SCAL(HostComplexFloat)
+HOST_L1_SCAL(HostComplexDouble)
+template void host_scal_real<float>(long, float, HostComplexFloat *, long);
+template void host_scal_real<double>(long, double, HostComplexDouble *, long);
+template void host_scal_real_batched<float>(long, float, HostComplexFloat *,
+                                            long, __int64_t, int);
+template void host_scal_real_batched<double>(long, double, HostComplexDouble *,
+                                             long, __int64_t, int);
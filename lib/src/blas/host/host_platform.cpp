@@ -0,0 +1,104 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./host_platform.h"
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+static size_t cache_size(int name, size_t fallback) {
+  long size = sysconf(name);
+  return (size > 0) ? static_cast<size_t>(size) : fallback;
+}
+
+static HostCpuInfo detect_cpu() {
+  HostCpuInfo info;
+  info.isa = HOST_ISA_GENERIC;
+  info.f16c = false;
+  memset(info.brand, 0, sizeof(info.brand));
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    info.isa = HOST_ISA_AVX2;
+  }
+  if (info.isa == HOST_ISA_AVX2 && __builtin_cpu_supports("avx512f")) {
+    info.isa = HOST_ISA_AVX512;
+  }
+  // F16C is implied by every AVX2 part we run on but is checked separately
+  // so the half precision packing never assumes it
+  unsigned int eax, ebx, ecx, edx;
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    info.f16c = (ecx & bit_F16C) != 0;
+  }
+  if (__get_cpuid_max(0x80000000, NULL) >= 0x80000004) {
+    unsigned int *brand = reinterpret_cast<unsigned int *>(info.brand);
+    for (unsigned int leaf = 0; leaf < 3; leaf++, brand += 4) {
+      __get_cpuid(0x80000002 + leaf, &brand[0], &brand[1], &brand[2],
+                  &brand[3]);
+    }
+  }
+#endif
+
+  const char *cap = getenv("HCBLAS_HOST_ISA");
+  if (cap != NULL) {
+    if (strcmp(cap, "generic") == 0) {
+      info.isa = HOST_ISA_GENERIC;
+      info.f16c = false;
+    } else if (strcmp(cap, "avx2") == 0 && info.isa > HOST_ISA_AVX2) {
+      info.isa = HOST_ISA_AVX2;
+    }
+  }
+
+  info.l1d = cache_size(_SC_LEVEL1_DCACHE_SIZE, 32 * 1024);
+  info.l2 = cache_size(_SC_LEVEL2_CACHE_SIZE, 256 * 1024);
+  info.l3 = cache_size(_SC_LEVEL3_CACHE_SIZE, 8 * 1024 * 1024);
+  // Some virtual machines report an L2 smaller than L1 or no L3 at all
+  if (info.l2 < info.l1d) info.l2 = 8 * info.l1d;
+  if (info.l3 < info.l2) info.l3 = 4 * info.l2;
+  return info;
+}
+
+const HostCpuInfo &host_cpu_info() {
+  static const HostCpuInfo info = detect_cpu();
+  return info;
+}
+
+HostBuffer::~HostBuffer() { free(ptr); }
+
+void *HostBuffer::get(size_t size) {
+  if (size > bytes) {
+    free(ptr);
+    ptr = NULL;
+    bytes = 0;
+    // Round up to a page so small growth steps do not reallocate every call
+    size_t rounded = (size + 4095) & ~static_cast<size_t>(4095);
+    if (posix_memalign(&ptr, 64, rounded) != 0) {
+      ptr = NULL;
+      return NULL;
+    }
+    bytes = rounded;
+  }
+  return ptr;
+}
@@ -0,0 +1,66 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Host platform queries shared by the host engines: instruction set support,
+* cache geometry and aligned scratch buffers.
+*/
+
+#ifndef LIB_SRC_BLAS_HOST_HOST_PLATFORM_H_
+#define LIB_SRC_BLAS_HOST_HOST_PLATFORM_H_
+
+#include <cstddef>
+
+/* Instruction set levels the host micro-kernels are compiled for */
+enum HostIsa { HOST_ISA_GENERIC = 0, HOST_ISA_AVX2 = 1, HOST_ISA_AVX512 = 2 };
+
+struct HostCpuInfo {
+  HostIsa isa;
+  bool f16c;
+  // Data cache sizes in bytes (per core for L1/L2, shared for L3)
+  size_t l1d;
+  size_t l2;
+  size_t l3;
+  // CPUID brand string, empty where unavailable
+  char brand[49];
+};
+
+// Returns the cached CPU description. The ISA level can be capped with the
+// HCBLAS_HOST_ISA environment variable (generic, avx2 or avx512).
+const HostCpuInfo &host_cpu_info();
+
+// Grow-only, 64 byte aligned scratch buffer. One instance is kept per thread
+// for GEMM packing so repeated calls do not touch the allocator.
+class HostBuffer {
+ public:
+  HostBuffer() : ptr(NULL), bytes(0) {}
+  ~HostBuffer();
+  void *get(size_t size);
+
+ private:
+  HostBuffer(const HostBuffer &);
+  HostBuffer &operator=(const HostBuffer &);
+  void *ptr;
+  size_t bytes;
+};
+
+#endif  // LIB_SRC_BLAS_HOST_HOST_PLATFORM_H_
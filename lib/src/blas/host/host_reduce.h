@@ -0,0 +1,64 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Host side of the two-stage reductions, the counterpart of
+* src/blas/reduce/reduce_engine.h for CPU handles. A vector is cut into
+* static slices, one per pool thread; each slice yields a partial and the
+* partials are added in slot order, so the result does not depend on thread
+* timing.
+*/
+
+#ifndef LIB_SRC_BLAS_HOST_HOST_REDUCE_H_
+#define LIB_SRC_BLAS_HOST_HOST_REDUCE_H_
+
+#include <vector>
+#include "./host_threadpool.h"
+
+/* Slot s of a call always covers the same index range of a vector of a
+   given length and always runs on the same pool thread. */
+struct HostSlices {
+  int count;
+  long chunk;
+};
+
+// Slices of [0, n) for elements of elemBytes; streamBytes is the number of
+// bytes moved per element over all operands
+HostSlices host_slices(long n, size_t elemBytes, size_t streamBytes);
+
+// Sum of partial(begin, end) over the slices of [0, n)
+template <typename T, typename F>
+T host_reduce(long n, size_t streamBytes, const F &partial) {
+  HostSlices sl = host_slices(n, sizeof(T), streamBytes);
+  if (sl.count == 1) return partial(0L, n);
+  std::vector<T> parts(sl.count);
+  HostThreadPool::instance().parallel_pinned(sl.count, [&](int s) {
+    long begin = s * sl.chunk;
+    long end = begin + sl.chunk < n ? begin + sl.chunk : n;
+    parts[s] = partial(begin, end);
+  });
+  T sum = 0;
+  for (int s = 0; s < sl.count; s++) sum += parts[s];
+  return sum;
+}
+
+#endif  // LIB_SRC_BLAS_HOST_HOST_REDUCE_H_
@@ -0,0 +1,68 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// The device SGEMM kernels built for the host runtime: hc:: is hc_host here
+#define HCBLAS_HOST_KERNELS
+#include "./host_tiled.h"
+#include "./hcblas_host.h"
+#include "src/blas/gemmgen/gemm_tiled_block.h"
+#include "src/blas/sgemm/sgemm_micro_kernels.h"
+
+namespace {
+
+template <bool TRANSA, bool TRANSB>
+void sgemm_tiled_mts4(int M, int N, int K, float alpha, const float *A,
+                      __int64_t lda, const float *B, __int64_t ldb,
+                      float beta, float *C, __int64_t ldc) {
+  hc::accelerator_view accl_view;
+  gemm_tiled_launch<float, float, 16, 4, 4, 16, 1, TRANSA, TRANSB>(
+      accl_view, const_cast<float *>(A), 0, const_cast<float *>(B), 0, C, 0,
+      M, N, K, lda, ldb, ldc, alpha, beta, 1, static_cast<float *>(NULL));
+}
+
+}  // namespace
+
+void host_sgemm_tiled(HostTiledKernel kernel, bool transA, bool transB, int M,
+                      int N, int K, float alpha, const float *A,
+                      __int64_t lda, const float *B, __int64_t ldb,
+                      float beta, float *C, __int64_t ldc) {
+  hc::accelerator_view accl_view;
+  if (!transA && !transB && kernel == HOST_TILED_TS8XSS8) {
+    sgemm_NoTransAB_STEP_TS8XSS8_launch(accl_view, A, 0, B, 0, C, 0, M, N, K,
+                                        lda, ldb, ldc, alpha, beta);
+  } else if (!transA && !transB && kernel == HOST_TILED_TS16XMTS2) {
+    sgemm_NoTransAB_MICRO_TS16XMTS2_launch(accl_view, A, 0, B, 0, C, 0, M, N,
+                                           K, lda, ldb, ldc, alpha, beta);
+  } else if (!transA && !transB) {
+    sgemm_tiled_mts4<false, false>(M, N, K, alpha, A, lda, B, ldb, beta, C,
+                                   ldc);
+  } else if (!transA) {
+    sgemm_tiled_mts4<false, true>(M, N, K, alpha, A, lda, B, ldb, beta, C,
+                                  ldc);
+  } else if (!transB) {
+    sgemm_tiled_mts4<true, false>(M, N, K, alpha, A, lda, B, ldb, beta, C,
+                                  ldc);
+  } else {
+    sgemm_tiled_mts4<true, true>(M, N, K, alpha, A, lda, B, ldb, beta, C,
+                                 ldc);
+  }
+}
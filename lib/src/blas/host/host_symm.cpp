@@ -0,0 +1,132 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./hcblas_host.h"
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+#include "./host_threadpool.h"
+
+// Symmetric and Hermitian products: the full A is never formed. Each pass
+// mirrors HOST_SYMM_NB rows (left side) or columns (right side) of it out of
+// the stored triangle into a panel and runs one host_gemm for the matching
+// rows or columns of C, so C is written once.
+
+#define HOST_SYMM_NB 256
+
+namespace {
+
+template <typename T>
+T real_part(T a) {
+  return a;
+}
+template <typename R>
+HostComplex<R> real_part(const HostComplex<R> &a) {
+  return HostComplex<R>(a.re);
+}
+
+// A(row, col) of the full matrix from its stored triangle
+template <typename T>
+T symm_element(const T *A, __int64_t lda, bool lower, bool herm, int row,
+               int col) {
+  if (lower ? row >= col : row <= col) {
+    const T v = A[row + col * lda];
+    return herm && row == col ? real_part(v) : v;
+  }
+  const T v = A[col + row * lda];
+  return herm ? host_conj(v) : v;
+}
+
+}  // namespace
+
+template <typename T>
+bool host_symm(bool colMajor, bool left, bool lower, bool herm, int M, int N,
+               T alpha, const T *A, __int64_t lda, const T *B, __int64_t ldb,
+               T beta, T *C, __int64_t ldc) {
+  if (!colMajor) {
+    // Row major C = A * B is C^T = B^T * A^T in column major, with A^T the
+    // other triangle of A
+    left = !left;
+    lower = !lower;
+    std::swap(M, N);
+  }
+  const int K = left ? M : N;
+  std::vector<T> panel(static_cast<size_t>(std::min(HOST_SYMM_NB, K)) * K);
+  for (int p0 = 0; p0 < K; p0 += HOST_SYMM_NB) {
+    const int nb = std::min(HOST_SYMM_NB, K - p0);
+    // Rows p0 .. p0 + nb - 1 of A as an nb x K panel, or columns as K x nb
+    T *w = panel.data();
+    HostThreadPool::instance().parallel_for(K, [=](int k) {
+      for (int i = 0; i < nb; i++) {
+        if (left) {
+          w[i + static_cast<size_t>(k) * nb] =
+              symm_element(A, lda, lower, herm, p0 + i, k);
+        } else {
+          w[k + static_cast<size_t>(i) * K] =
+              symm_element(A, lda, lower, herm, k, p0 + i);
+        }
+      }
+    });
+    bool done;
+    if (left) {
+      done = host_gemm<T>(true, false, false, nb, N, K, alpha, w, nb, B, ldb,
+                          beta, C + p0, ldc);
+    } else {
+      done = host_gemm<T>(true, false, false, M, nb, K, alpha, B, ldb, w, K,
+                          beta, C + p0 * ldc, ldc);
+    }
+    if (!done) return false;
+  }
+  return true;
+}
+
+template <typename T>
+bool host_symm_batched(bool colMajor, bool left, bool lower, bool herm, int M,
+                       int N, T alpha, T *const A[], __int64_t aOffset,
+                       __int64_t lda, T *const B[], __int64_t bOffset,
+                       __int64_t ldb, T beta, T *const C[], __int64_t cOffset,
+                       __int64_t ldc, int batchSize) {
+  // One entry per task; nested pool calls run on the calling thread
+  std::atomic<bool> failed(false);
+  HostThreadPool::instance().parallel_for(batchSize, [&](int e) {
+    if (!host_symm(colMajor, left, lower, herm, M, N, alpha, A[e] + aOffset,
+                   lda, B[e] + bOffset, ldb, beta, C[e] + cOffset, ldc)) {
+      failed = true;
+    }
+  });
+  return !failed;
+}
+
+#define HOST_SYMM(T)                                                          \
+  template bool host_symm<T>(bool, bool, bool, bool, int, int, T, const T *,  \
+                             __int64_t, const T *, __int64_t, T, T *,         \
+                             __int64_t);                                      \
+  template bool host_symm_batched<T>(                                         \
+      bool, bool, bool, bool, int, int, T, T *const[], __int64_t, __int64_t,  \
+      T *const[], __int64_t, __int64_t, T, T *const[], __int64_t, __int64_t,  \
+      int);
+
+HOST_SYMM(float)
+HOST_SYMM(double)
+HOST_SYMM(HostComplexFloat)
+HOST_SYMM(HostComplexDouble)
@@ -0,0 +1,302 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./hcblas_host.h"
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include "./host_threadpool.h"
+
+// Triangular products: the diagonal is cut into HOST_SYRK_NB blocks whose
+// triangles are computed directly, a column per pool task, and the rest of
+// the triangle is split recursively into square halves whose rectangular
+// parts go to host_gemm, which carries almost all of the flops.
+
+#define HOST_SYRK_NB 128
+
+namespace {
+
+template <typename T>
+struct IsComplex {
+  static const bool value = false;
+};
+template <typename R>
+struct IsComplex<HostComplex<R> > {
+  static const bool value = true;
+};
+
+template <typename T>
+T real_part(T a) {
+  return a;
+}
+template <typename R>
+HostComplex<R> real_part(const HostComplex<R> &a) {
+  return HostComplex<R>(a.re);
+}
+
+// Packed conj(X) of a rows x cols matrix, leading dimension rows
+template <typename T>
+std::vector<T> conj_copy(const T *X, __int64_t ldx, int rows, int cols) {
+  std::vector<T> out(static_cast<size_t>(rows) * cols);
+  T *o = out.data();
+  HostThreadPool::instance().parallel_for(cols, [=](int j) {
+    for (int i = 0; i < rows; i++) {
+      o[i + static_cast<size_t>(j) * rows] = host_conj(X[i + j * ldx]);
+    }
+  });
+  return out;
+}
+
+// Off-diagonal part of the triangle of C[i0, i0 + m) x [i0, i0 + m)
+template <typename T>
+bool triangle_split(bool lower, bool transA, bool transB, int i0, int m,
+                    int K, T alpha, const T *A, __int64_t lda, const T *B,
+                    __int64_t ldb, T beta, T *C, __int64_t ldc) {
+  if (m <= HOST_SYRK_NB) return true;
+  const int m1 = ((m + HOST_SYRK_NB - 1) / HOST_SYRK_NB + 1) / 2 * HOST_SYRK_NB;
+  const int m2 = m - m1;
+  // Below the diagonal for the lower triangle, right of it for the upper
+  const int r0 = lower ? i0 + m1 : i0;
+  const int c0 = lower ? i0 : i0 + m1;
+  return host_gemm<T>(true, transA, transB, lower ? m2 : m1, lower ? m1 : m2,
+                      K, alpha, A + (transA ? r0 * lda : r0), lda,
+                      B + (transB ? c0 : c0 * ldb), ldb, beta,
+                      C + r0 + c0 * ldc, ldc) &&
+         triangle_split(lower, transA, transB, i0, m1, K, alpha, A, lda, B,
+                        ldb, beta, C, ldc) &&
+         triangle_split(lower, transA, transB, i0 + m1, m2, K, alpha, A, lda,
+                        B, ldb, beta, C, ldc);
+}
+
+// Column major C = alpha * op(A) * op(B) + beta * C on one triangle of the
+// n x n matrix C; op is a transpose when trans, conjugate when conj as
+// well. herm keeps the diagonal real. Returns false when host_gemm cannot
+// allocate its packing buffers.
+template <typename T>
+bool triangle_update(bool lower, bool herm, bool transA, bool conjA,
+                     bool transB, bool conjB, int n, int K, T alpha,
+                     const T *A, __int64_t lda, const T *B, __int64_t ldb,
+                     T beta, T *C, __int64_t ldc) {
+  const bool betaZero = beta == T(0);
+  const bool scaleOnly = K == 0 || alpha == T(0);
+  conjA = conjA && transA && IsComplex<T>::value;
+  conjB = conjB && transB && IsComplex<T>::value;
+  // Diagonal blocks, one column of C per task
+  HostThreadPool::instance().parallel_for(n, [&](int c) {
+    const int i0 = c / HOST_SYRK_NB * HOST_SYRK_NB;
+    const int rBegin = lower ? c : i0;
+    const int rEnd = lower ? std::min(i0 + HOST_SYRK_NB, n) : c + 1;
+    T acc[HOST_SYRK_NB];
+    for (int r = rBegin; r < rEnd; r++) acc[r - i0] = T(0);
+    for (int k = 0; k < K && !scaleOnly; k++) {
+      T y = transB ? B[c + k * ldb] : B[k + c * ldb];
+      if (conjB) y = host_conj(y);
+      for (int r = rBegin; r < rEnd; r++) {
+        T x = transA ? A[k + r * lda] : A[r + k * lda];
+        if (conjA) x = host_conj(x);
+        acc[r - i0] += x * y;
+      }
+    }
+    for (int r = rBegin; r < rEnd; r++) {
+      T v = betaZero ? T(0) : beta * C[r + c * ldc];
+      if (!scaleOnly) v += alpha * acc[r - i0];
+      if (herm && r == c) v = real_part(v);
+      C[r + c * ldc] = v;
+    }
+  });
+  if (n <= HOST_SYRK_NB) return true;
+  if (scaleOnly) {
+    // The diagonal blocks are done; scale the rest of the triangle
+    HostThreadPool::instance().parallel_for(n, [&](int c) {
+      const int i0 = c / HOST_SYRK_NB * HOST_SYRK_NB;
+      const int rBegin = lower ? std::min(i0 + HOST_SYRK_NB, n) : 0;
+      const int rEnd = lower ? n : i0;
+      for (int r = rBegin; r < rEnd; r++) {
+        C[r + c * ldc] = betaZero ? T(0) : beta * C[r + c * ldc];
+      }
+    });
+    return true;
+  }
+  // host_gemm has no conjugate: conjugated operands go through copies
+  std::vector<T> copyA, copyB;
+  if (conjA) {
+    copyA = conj_copy(A, lda, K, n);
+    A = copyA.data();
+    lda = K;
+  }
+  if (conjB) {
+    copyB = conj_copy(B, ldb, n, K);
+    B = copyB.data();
+    ldb = n;
+  }
+  return triangle_split(lower, transA, transB, 0, n, K, alpha, A, lda, B, ldb,
+                        beta, C, ldc);
+}
+
+}  // namespace
+
+template <typename T>
+bool host_syrk(bool colMajor, bool lower, bool trans, bool herm, int N, int K,
+               T alpha, const T *A, __int64_t lda, T beta, T *C,
+               __int64_t ldc) {
+  if (!colMajor) {
+    // Row major C and A are C^T and A^T in column major: the other triangle
+    // of the product with the other transpose (C^T = conj(C) for HERK)
+    lower = !lower;
+    trans = !trans;
+  }
+  return triangle_update(lower, herm, trans, herm, !trans, herm, N, K, alpha,
+                         A, lda, A, lda, beta, C, ldc);
+}
+
+template <typename T>
+bool host_syrk_batched(bool colMajor, bool lower, bool trans, bool herm, int N,
+                       int K, T alpha, T *const A[], __int64_t aOffset,
+                       __int64_t lda, T beta, T *const C[], __int64_t cOffset,
+                       __int64_t ldc, int batchSize) {
+  // One entry per task; nested pool calls run on the calling thread
+  std::atomic<bool> failed(false);
+  HostThreadPool::instance().parallel_for(batchSize, [&](int e) {
+    if (!host_syrk(colMajor, lower, trans, herm, N, K, alpha, A[e] + aOffset,
+                   lda, beta, C[e] + cOffset, ldc)) {
+      failed = true;
+    }
+  });
+  return !failed;
+}
+
+template <typename T>
+bool host_syr2k(bool colMajor, bool lower, bool trans, bool herm, int N, int K,
+                T alpha, const T *A, __int64_t lda, const T *B, __int64_t ldb,
+                T beta, T *C, __int64_t ldc) {
+  if (!colMajor) {
+    // As for SYRK; HER2K's conj(C) also swaps alpha for conj(alpha)
+    lower = !lower;
+    trans = !trans;
+    if (herm) alpha = host_conj(alpha);
+  }
+  if (K == 0 || alpha == T(0)) {
+    return triangle_update(lower, herm, false, false, true, false, N, 0, T(1),
+                           C, ldc, C, ldc, beta, C, ldc);
+  }
+  // P = [op(A) op(B)] and Q = [alpha * op(B)  alpha2 * op(A)], conjugated
+  // for HER2K, so that P * Q^T is the whole rank-2K update and C is swept
+  // once
+  const bool conjOp = herm && trans;
+  const T alpha2 = herm ? host_conj(alpha) : alpha;
+  const size_t size = static_cast<size_t>(N) * K;
+  std::vector<T> packed(4 * size);
+  T *p = packed.data();
+  T *q = p + 2 * size;
+  HostThreadPool::instance().parallel_for(K, [=](int k) {
+    for (int i = 0; i < N; i++) {
+      T x = trans ? A[k + i * lda] : A[i + k * lda];
+      T y = trans ? B[k + i * ldb] : B[i + k * ldb];
+      if (conjOp) {
+        x = host_conj(x);
+        y = host_conj(y);
+      }
+      p[i + static_cast<size_t>(k) * N] = x;
+      p[i + static_cast<size_t>(K + k) * N] = y;
+      q[i + static_cast<size_t>(k) * N] = alpha * (herm ? host_conj(y) : y);
+      q[i + static_cast<size_t>(K + k) * N] =
+          alpha2 * (herm ? host_conj(x) : x);
+    }
+  });
+  return triangle_update(lower, herm, false, false, true, false, N, 2 * K,
+                         T(1), p, N, q, N, beta, C, ldc);
+}
+
+template <typename T>
+bool host_syr2k_batched(bool colMajor, bool lower, bool trans, bool herm,
+                        int N, int K, T alpha, T *const A[], __int64_t aOffset,
+                        __int64_t lda, T *const B[], __int64_t bOffset,
+                        __int64_t ldb, T beta, T *const C[], __int64_t cOffset,
+                        __int64_t ldc, int batchSize) {
+  std::atomic<bool> failed(false);
+  HostThreadPool::instance().parallel_for(batchSize, [&](int e) {
+    if (!host_syr2k(colMajor, lower, trans, herm, N, K, alpha, A[e] + aOffset,
+                    lda, B[e] + bOffset, ldb, beta, C[e] + cOffset, ldc)) {
+      failed = true;
+    }
+  });
+  return !failed;
+}
+
+template <typename T>
+bool host_gemmt(bool colMajor, bool lower, bool transA, bool conjA,
+                bool transB, bool conjB, int N, int K, T alpha, const T *A,
+                __int64_t lda, const T *B, __int64_t ldb, T beta, T *C,
+                __int64_t ldc) {
+  if (!colMajor) {
+    // Row major C^T = op(B)^T * op(A)^T in column major: the operands trade
+    // places and the triangle flips
+    return host_gemmt(true, !lower, transB, conjB, transA, conjA, N, K, alpha,
+                      B, ldb, A, lda, beta, C, ldc);
+  }
+  return triangle_update(lower, false, transA, conjA, transB, conjB, N, K,
+                         alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <typename T>
+bool host_gemmt_batched(bool colMajor, bool lower, bool transA, bool conjA,
+                        bool transB, bool conjB, int N, int K, T alpha,
+                        T *const A[], __int64_t aOffset, __int64_t lda,
+                        T *const B[], __int64_t bOffset, __int64_t ldb,
+                        T beta, T *const C[], __int64_t cOffset,
+                        __int64_t ldc, int batchSize) {
+  std::atomic<bool> failed(false);
+  HostThreadPool::instance().parallel_for(batchSize, [&](int e) {
+    if (!host_gemmt(colMajor, lower, transA, conjA, transB, conjB, N, K, alpha,
+                    A[e] + aOffset, lda, B[e] + bOffset, ldb, beta,
+                    C[e] + cOffset, ldc)) {
+      failed = true;
+    }
+  });
+  return !failed;
+}
+
+#define HOST_SYRK(T)                                                          \
+  template bool host_syrk<T>(bool, bool, bool, bool, int, int, T, const T *,  \
+                             __int64_t, T, T *, __int64_t);                   \
+  template bool host_syrk_batched<T>(bool, bool, bool, bool, int, int, T,     \
+                                     T *const[], __int64_t, __int64_t, T,     \
+                                     T *const[], __int64_t, __int64_t, int);  \
+  template bool host_syr2k<T>(bool, bool, bool, bool, int, int, T, const T *, \
+                              __int64_t, const T *, __int64_t, T, T *,        \
+                              __int64_t);                                     \
+  template bool host_syr2k_batched<T>(                                        \
+      bool, bool, bool, bool, int, int, T, T *const[], __int64_t, __int64_t,  \
+      T *const[], __int64_t, __int64_t, T, T *const[], __int64_t, __int64_t,  \
+      int);                                                                   \
+  template bool host_gemmt<T>(bool, bool, bool, bool, bool, bool, int, int,   \
+                              T, const T *, __int64_t, const T *, __int64_t,  \
+                              T, T *, __int64_t);                             \
+  template bool host_gemmt_batched<T>(                                        \
+      bool, bool, bool, bool, bool, bool, int, int, T, T *const[], __int64_t, \
+      __int64_t, T *const[], __int64_t, __int64_t, T, T *const[], __int64_t,  \
+      __int64_t, int);
+
+HOST_SYRK(float)
+HOST_SYRK(double)
+HOST_SYRK(HostComplexFloat)
+HOST_SYRK(HostComplexDouble)
@@ -0,0 +1,137 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./host_threadpool.h"
+#include <cstdlib>
+
+// Set while a thread executes pool tasks so nested parallel_for calls do not
+// wait on the pool they are already running in
+static thread_local bool inside_pool = false;
+
+static int default_thread_count() {
+  const char *env = getenv("HCBLAS_NUM_THREADS");
+  if (env != NULL) {
+    int n = atoi(env);
+    if (n > 0) return n;
+  }
+  unsigned int hw = std::thread::hardware_concurrency();
+  return hw > 0 ? static_cast<int>(hw) : 1;
+}
+
+HostThreadPool &HostThreadPool::instance() {
+  static HostThreadPool pool(default_thread_count());
+  return pool;
+}
+
+HostThreadPool::HostThreadPool(int threads)
+    : generation(0),
+      stopping(false),
+      finished(0),
+      task_count(0),
+      next_task(0),
+      pinned(false),
+      job(NULL) {
+  for (int i = 1; i < threads; i++) {
+    workers.push_back(std::thread(&HostThreadPool::worker_loop, this, i));
+  }
+}
+
+HostThreadPool::~HostThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  for (size_t i = 0; i < workers.size(); i++) {
+    workers[i].join();
+  }
+}
+
+void HostThreadPool::run_tasks(int id) {
+  bool was_inside = inside_pool;
+  inside_pool = true;
+  if (pinned) {
+    if (id < task_count) (*job)(id);
+  } else {
+    for (;;) {
+      int task = next_task.fetch_add(1);
+      if (task >= task_count) break;
+      (*job)(task);
+    }
+  }
+  inside_pool = was_inside;
+}
+
+void HostThreadPool::worker_loop(int id) {
+  unsigned long seen = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(state_mutex);
+      while (!stopping && generation == seen) wake.wait(lock);
+      if (stopping) return;
+      seen = generation;
+    }
+    run_tasks(id);
+    {
+      std::lock_guard<std::mutex> lock(state_mutex);
+      if (++finished == static_cast<int>(workers.size())) done.notify_all();
+    }
+  }
+}
+
+void HostThreadPool::parallel_for(int tasks,
+                                  const std::function<void(int)> &fn) {
+  dispatch(tasks, false, fn);
+}
+
+void HostThreadPool::parallel_pinned(int slots,
+                                     const std::function<void(int)> &fn) {
+  dispatch(slots < num_threads() ? slots : num_threads(), true, fn);
+}
+
+void HostThreadPool::dispatch(int tasks, bool is_pinned,
+                              const std::function<void(int)> &fn) {
+  if (tasks <= 0) return;
+  if (tasks == 1 || workers.empty() || inside_pool) {
+    for (int task = 0; task < tasks; task++) fn(task);
+    return;
+  }
+
+  std::lock_guard<std::mutex> submit(submit_mutex);
+  {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    job = &fn;
+    task_count = tasks;
+    pinned = is_pinned;
+    next_task.store(0);
+    finished = 0;
+    generation++;
+  }
+  wake.notify_all();
+  run_tasks(0);
+
+  // Every worker checks in once per generation, so none can still hold a
+  // reference to fn (or miss the next job) after this wait
+  std::unique_lock<std::mutex> lock(state_mutex);
+  while (finished < static_cast<int>(workers.size())) done.wait(lock);
+  job = NULL;
+}
@@ -0,0 +1,84 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Persistent worker pool used by the host engines. Work is expressed as a
+* number of independent tasks; the calling thread participates, and calls
+* made from inside a task run serially so engines can nest freely.
+*/
+
+#ifndef LIB_SRC_BLAS_HOST_HOST_THREADPOOL_H_
+#define LIB_SRC_BLAS_HOST_HOST_THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class HostThreadPool {
+ public:
+  // Process wide pool. Its size is taken from HCBLAS_NUM_THREADS when set and
+  // from the hardware concurrency otherwise.
+  static HostThreadPool &instance();
+
+  // Number of threads taking part in parallel_for, including the caller
+  int num_threads() const { return static_cast<int>(workers.size()) + 1; }
+
+  // Runs fn(task) for every task in [0, tasks) and returns once all finished.
+  // Tasks are handed out dynamically in increasing order.
+  void parallel_for(int tasks, const std::function<void(int)> &fn);
+
+  // Runs fn(slot) for every slot in [0, slots), slots <= num_threads(). Slot
+  // s always runs on the same pool thread (the caller takes slot 0), so
+  // repeated static partitions of a vector keep each slice on the thread,
+  // and hence the NUMA node, that first touched it.
+  void parallel_pinned(int slots, const std::function<void(int)> &fn);
+
+  ~HostThreadPool();
+
+ private:
+  explicit HostThreadPool(int threads);
+  HostThreadPool(const HostThreadPool &);
+  HostThreadPool &operator=(const HostThreadPool &);
+
+  void worker_loop(int id);
+  void run_tasks(int id);
+  void dispatch(int tasks, bool is_pinned, const std::function<void(int)> &fn);
+
+  std::vector<std::thread> workers;
+  // Serializes independent callers so one job owns the pool at a time
+  std::mutex submit_mutex;
+  std::mutex state_mutex;
+  std::condition_variable wake;
+  std::condition_variable done;
+  unsigned long generation;
+  bool stopping;
+  int finished;
+  int task_count;
+  std::atomic<int> next_task;
+  bool pinned;
+  const std::function<void(int)> *job;
+};
+
+#endif  // LIB_SRC_BLAS_HOST_HOST_THREADPOOL_H_
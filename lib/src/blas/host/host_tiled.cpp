@@ -0,0 +1,181 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./host_tiled.h"
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace hc_host {
+
+namespace {
+
+// Work-item stacks are reserved, not committed: only the pages an item
+// touches are ever backed by memory. A guard page below each stack turns an
+// overflow into a fault instead of silent corruption of the neighbour.
+const size_t kFiberStack = 128 * 1024;
+
+struct Fiber {
+  ucontext_t context;
+  bool done;
+  bool waiting;
+};
+
+struct TileScheduler {
+  TileScheduler()
+      : stacks(NULL),
+        mapped_items(0),
+        current(-1),
+        active(false),
+        barrier_hit(false),
+        item(NULL),
+        ctx(NULL) {}
+  ~TileScheduler() {
+    if (stacks != NULL) munmap(stacks, mapped_items * slot_bytes());
+  }
+
+  static size_t slot_bytes() {
+    return kFiberStack + static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  }
+
+  ucontext_t main;
+  std::vector<Fiber> fibers;
+  char *stacks;
+  size_t mapped_items;
+  // Fiber currently running, -1 while items run as plain calls
+  int current;
+  bool active;
+  bool barrier_hit;
+  void (*item)(void *ctx, int item_id);
+  void *ctx;
+};
+
+// One scheduler per thread: a tile never leaves the thread that started it
+thread_local TileScheduler sched;
+
+void fail(const char *what) {
+  fprintf(stderr, "hcblas host tiles: %s\n", what);
+  abort();
+}
+
+void reserve_stacks(TileScheduler &s, int items) {
+  if (static_cast<size_t>(items) <= s.mapped_items) return;
+  const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t slot = TileScheduler::slot_bytes();
+  if (s.stacks != NULL) munmap(s.stacks, s.mapped_items * slot);
+  void *mem = mmap(NULL, items * slot, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (mem == MAP_FAILED) fail("cannot reserve work-item stacks");
+  s.stacks = static_cast<char *>(mem);
+  s.mapped_items = items;
+  for (int i = 0; i < items; i++) {
+    mprotect(s.stacks + i * slot, page, PROT_NONE);
+  }
+  s.fibers.resize(items);
+}
+
+void fiber_entry() {
+  TileScheduler &s = sched;
+  const int id = s.current;
+  s.item(s.ctx, id);
+  s.fibers[id].done = true;
+  // Returning resumes s.main through uc_link
+}
+
+void start_fiber(TileScheduler &s, int id) {
+  const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  Fiber &f = s.fibers[id];
+  getcontext(&f.context);
+  f.context.uc_stack.ss_sp = s.stacks + id * TileScheduler::slot_bytes() + page;
+  f.context.uc_stack.ss_size = kFiberStack;
+  f.context.uc_link = &s.main;
+  makecontext(&f.context, fiber_entry, 0);
+  f.done = false;
+  f.waiting = false;
+}
+
+void resume_fiber(TileScheduler &s, int id) {
+  s.current = id;
+  s.fibers[id].waiting = false;
+  swapcontext(&s.main, &s.fibers[id].context);
+  s.current = -1;
+}
+
+}  // namespace
+
+void host_tile_barrier_wait() {
+  TileScheduler &s = sched;
+  if (s.current < 0) {
+    fail("barrier reached outside a tile or by a divergent work-item");
+  }
+  Fiber &f = s.fibers[s.current];
+  f.waiting = true;
+  s.barrier_hit = true;
+  swapcontext(&f.context, &s.main);
+}
+
+void host_run_tile(int items, void (*item)(void *ctx, int item_id),
+                   void *ctx) {
+  TileScheduler &s = sched;
+  if (s.active) fail("tiled launch issued from inside a tile");
+  s.active = true;
+  s.item = item;
+  s.ctx = ctx;
+  s.barrier_hit = false;
+  reserve_stacks(s, items);
+
+  // Item 0 runs on a fiber. If it never reaches a barrier the kernel does not
+  // synchronize and the rest of the tile runs as plain calls.
+  start_fiber(s, 0);
+  resume_fiber(s, 0);
+  if (!s.barrier_hit) {
+    for (int i = 1; i < items; i++) item(ctx, i);
+    s.active = false;
+    return;
+  }
+
+  for (int i = 1; i < items; i++) {
+    start_fiber(s, i);
+    resume_fiber(s, i);
+  }
+  // Every live item is now parked at the same barrier or finished. Release
+  // the barrier round by round until the whole tile has run to completion.
+  for (;;) {
+    int done = 0;
+    int waiting = 0;
+    for (int i = 0; i < items; i++) {
+      if (s.fibers[i].done) done++;
+      if (s.fibers[i].waiting) waiting++;
+    }
+    if (done == items) break;
+    if (done > 0 && waiting > 0) {
+      fail("barrier not reached by every work-item of the tile");
+    }
+    for (int i = 0; i < items; i++) resume_fiber(s, i);
+  }
+  s.active = false;
+}
+
+}  // namespace hc_host
@@ -0,0 +1,258 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Host runtime for the tiled hc kernels. It mirrors the subset of the hc
+* launch API the kernels use (index, extent, tiled_extent, tiled_index, tile
+* barriers and parallel_for_each) so a kernel body can run unchanged on the
+* CPU. Tiles are spread over the host pool; the work-items of a tile run as
+* fibers on the thread that owns the tile, and a barrier switches to the next
+* fiber until every item of the tile has arrived. tile_static data becomes
+* thread local storage, which all fibers of a tile share. Kernels whose
+* first work-item finishes without reaching a barrier run the remaining
+* items as plain calls and never pay for a context switch.
+*/
+
+#ifndef LIB_SRC_BLAS_HOST_HOST_TILED_H_
+#define LIB_SRC_BLAS_HOST_HOST_TILED_H_
+
+#include <cmath>
+#include <cstring>
+#include "./host_threadpool.h"
+
+namespace hc_host {
+
+template <int N>
+class index {
+ public:
+  index() {
+    for (int d = 0; d < N; d++) v[d] = 0;
+  }
+  explicit index(int i0) { set(i0, 0, 0); }
+  index(int i0, int i1) { set(i0, i1, 0); }
+  index(int i0, int i1, int i2) { set(i0, i1, i2); }
+
+  int &operator[](int d) { return v[d]; }
+  int operator[](int d) const { return v[d]; }
+
+ private:
+  void set(int i0, int i1, int i2) {
+    const int in[3] = {i0, i1, i2};
+    for (int d = 0; d < N; d++) v[d] = in[d];
+  }
+  int v[N];
+};
+
+template <int N>
+class tiled_extent;
+
+template <int N>
+class extent : public index<N> {
+ public:
+  extent() {}
+  explicit extent(int e0) : index<N>(e0) {}
+  extent(int e0, int e1) : index<N>(e0, e1) {}
+  extent(int e0, int e1, int e2) : index<N>(e0, e1, e2) {}
+
+  long size() const {
+    long n = 1;
+    for (int d = 0; d < N; d++) n *= (*this)[d];
+    return n;
+  }
+
+  tiled_extent<N> tile(int t0) const { return tiled_extent<N>(*this, t0); }
+  tiled_extent<N> tile(int t0, int t1) const {
+    return tiled_extent<N>(*this, t0, t1);
+  }
+  tiled_extent<N> tile(int t0, int t1, int t2) const {
+    return tiled_extent<N>(*this, t0, t1, t2);
+  }
+};
+
+template <int N>
+class tiled_extent : public extent<N> {
+ public:
+  tiled_extent(const extent<N> &e, int t0) : extent<N>(e), tile_dim(t0) {}
+  tiled_extent(const extent<N> &e, int t0, int t1)
+      : extent<N>(e), tile_dim(t0, t1) {}
+  tiled_extent(const extent<N> &e, int t0, int t1, int t2)
+      : extent<N>(e), tile_dim(t0, t1, t2) {}
+
+  extent<N> tile_dim;
+};
+
+// Suspends the calling work-item until every item of its tile has arrived.
+// All fence flavours are equivalent on the host, where a tile lives on a
+// single thread.
+void host_tile_barrier_wait();
+
+class tile_barrier {
+ public:
+  void wait() const { host_tile_barrier_wait(); }
+  void wait_with_all_memory_fence() const { host_tile_barrier_wait(); }
+  void wait_with_global_memory_fence() const { host_tile_barrier_wait(); }
+  void wait_with_tile_static_memory_fence() const { host_tile_barrier_wait(); }
+};
+
+template <int N>
+class tiled_index {
+ public:
+  index<N> global;
+  index<N> local;
+  index<N> tile;
+  index<N> tile_origin;
+  extent<N> tile_dim;
+  tile_barrier barrier;
+
+  operator index<N>() const { return global; }
+};
+
+// Stands in for the queue a kernel is launched on. Host memory is the device
+// memory, so copies between the two are plain memcpy calls.
+class accelerator_view {
+ public:
+  void copy(const void *src, void *dst, size_t bytes) const {
+    memcpy(dst, src, bytes);
+  }
+};
+
+// Returned by parallel_for_each; the host launch is synchronous
+class completion_future {
+ public:
+  void wait() const {}
+};
+
+// Runs item(item_id) for item_id in [0, items) as the work-items of one tile
+// on the calling thread, switching between them at tile barriers
+void host_run_tile(int items, void (*item)(void *ctx, int item_id), void *ctx);
+
+namespace detail {
+
+// Converts a position in [0, e.size()) to an index, last dimension fastest
+template <int N>
+inline index<N> unflatten(long pos, const extent<N> &e) {
+  index<N> idx;
+  for (int d = N - 1; d >= 0; d--) {
+    idx[d] = static_cast<int>(pos % e[d]);
+    pos /= e[d];
+  }
+  return idx;
+}
+
+template <int N, typename Kernel>
+struct TileLaunch {
+  const Kernel *kernel;
+  extent<N> tile_dim;
+  index<N> tile;
+
+  static void run_item(void *ctx, int item_id) {
+    const TileLaunch *self = static_cast<const TileLaunch *>(ctx);
+    tiled_index<N> tidx;
+    tidx.local = unflatten(item_id, self->tile_dim);
+    tidx.tile = self->tile;
+    tidx.tile_dim = self->tile_dim;
+    for (int d = 0; d < N; d++) {
+      tidx.tile_origin[d] = self->tile[d] * self->tile_dim[d];
+      tidx.global[d] = tidx.tile_origin[d] + tidx.local[d];
+    }
+    (*self->kernel)(tidx);
+  }
+};
+
+}  // namespace detail
+
+// Tiled launch. As on the device, an extent that is not a multiple of the
+// tile is rounded up and the kernel is expected to guard its accesses.
+template <typename View, int N, typename Kernel>
+completion_future parallel_for_each(const View &, const tiled_extent<N> &ext,
+                                    const Kernel &kernel) {
+  extent<N> tiles;
+  for (int d = 0; d < N; d++) {
+    tiles[d] = (ext[d] + ext.tile_dim[d] - 1) / ext.tile_dim[d];
+  }
+  const long tile_count = tiles.size();
+  const int items = static_cast<int>(ext.tile_dim.size());
+  if (tile_count <= 0 || items <= 0) return completion_future();
+
+  HostThreadPool::instance().parallel_for(
+      static_cast<int>(tile_count), [&](int t) {
+        detail::TileLaunch<N, Kernel> launch;
+        launch.kernel = &kernel;
+        launch.tile_dim = ext.tile_dim;
+        launch.tile = detail::unflatten(t, tiles);
+        host_run_tile(items, &detail::TileLaunch<N, Kernel>::run_item,
+                      &launch);
+      });
+  return completion_future();
+}
+
+// Flat launch: no barriers, so items are plain calls split into contiguous
+// chunks per task
+template <typename View, int N, typename Kernel>
+completion_future parallel_for_each(const View &, const extent<N> &ext,
+                                    const Kernel &kernel) {
+  const long total = ext.size();
+  if (total <= 0) return completion_future();
+  HostThreadPool &pool = HostThreadPool::instance();
+  const long chunk = 4096;
+  long tasks = (total + chunk - 1) / chunk;
+  const long max_tasks = 8L * pool.num_threads();
+  if (tasks > max_tasks) tasks = max_tasks;
+  pool.parallel_for(static_cast<int>(tasks), [&](int t) {
+    const long begin = total * t / tasks;
+    const long end = total * (t + 1) / tasks;
+    for (long pos = begin; pos < end; pos++) {
+      kernel(detail::unflatten(pos, ext));
+    }
+  });
+  return completion_future();
+}
+
+// The fast_math subset used by the kernels
+namespace fast_math {
+inline float fabsf(float x) { return std::fabs(x); }
+inline float fmaxf(float x, float y) { return std::fmax(x, y); }
+inline float sqrtf(float x) { return std::sqrt(x); }
+template <typename T>
+inline T log(T x) { return std::log(x); }
+template <typename T>
+inline T sqrt(T x) { return std::sqrt(x); }
+template <typename T>
+inline T fabs(T x) { return std::fabs(x); }
+template <typename T>
+inline bool isnan(T x) { return std::isnan(x); }
+template <typename T>
+inline bool isinf(T x) { return std::isinf(x); }
+}  // namespace fast_math
+
+}  // namespace hc_host
+
+// A kernel translation unit built for the host (without hc.hpp), such as
+// host_sgemm_tiled.cpp, defines HCBLAS_HOST_KERNELS before its includes; hc::
+// then resolves to this runtime and tile_static arrays become per thread,
+// hence per tile, storage.
+#ifdef HCBLAS_HOST_KERNELS
+namespace hc = hc_host;
+#define tile_static static thread_local
+#endif
+
+#endif  // LIB_SRC_BLAS_HOST_HOST_TILED_H_
@@ -0,0 +1,214 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./hcblas_host.h"
+#include <algorithm>
+#include <atomic>
+#include "./host_threadpool.h"
+
+// Blocked triangular multiply, in place: diagonal blocks of HOST_TRMM_NB are
+// multiplied directly, split across the pool by columns (left side) or row
+// chunks (right side) of B, and every block then adds the rest of its row of
+// op(A) with one host_gemm call over the blocks of B not yet overwritten.
+
+#define HOST_TRMM_NB 128
+// Columns (left side) or rows (right side) of B per pool task
+#define HOST_TRMM_VECS 32
+
+namespace {
+
+template <typename T>
+struct IsComplex {
+  static const bool value = false;
+};
+template <typename R>
+struct IsComplex<HostComplex<R> > {
+  static const bool value = true;
+};
+
+template <typename T>
+bool is_zero(T a) {
+  return a == T(0);
+}
+
+// x = alpha T x in place for a column x of length nb, T[r][c] = A(c, r) when
+// transT and A(r, c) otherwise. Either way A is walked down its columns.
+template <typename T>
+void multiply_column(bool transT, bool lowerT, bool unit, int nb, const T *A,
+                     __int64_t lda, T alpha, T *x) {
+  for (int s = 0; s < nb; s++) {
+    // Toward the zero triangle, so every x_k read is still the input
+    const int c = lowerT ? nb - 1 - s : s;
+    const int kBegin = lowerT ? 0 : c + 1;
+    const int kEnd = lowerT ? c : nb;
+    if (transT) {
+      // x_c = A(c, c) x_c + sum of A(k, c) x_k
+      T sum = unit ? x[c] : A[c + c * lda] * x[c];
+      for (int k = kBegin; k < kEnd; k++) sum += A[k + c * lda] * x[k];
+      x[c] = sum;
+    } else {
+      // x_r += A(r, c) x_c over the r on the nonzero side of c
+      const int rBegin = lowerT ? c + 1 : 0;
+      const int rEnd = lowerT ? nb : c;
+      for (int r = rBegin; r < rEnd; r++) x[r] = x[r] + A[r + c * lda] * x[c];
+      if (!unit) x[c] = A[c + c * lda] * x[c];
+    }
+  }
+  for (int r = 0; r < nb; r++) x[r] = alpha * x[r];
+}
+
+// X = alpha X T^T in place for rows of X (rows x nb, leading dimension ldx):
+// row y becomes (T y^T)^T, done a column of X at a time
+template <typename T>
+void multiply_rows(bool transT, bool lowerT, bool unit, int nb, const T *A,
+                   __int64_t lda, T alpha, int rows, T *X, __int64_t ldx) {
+  for (int s = 0; s < nb; s++) {
+    const int c = lowerT ? nb - 1 - s : s;
+    T *xc = X + c * ldx;
+    if (!unit) {
+      const T d = A[c + c * lda];
+      for (int i = 0; i < rows; i++) xc[i] = d * xc[i];
+    }
+    const int kBegin = lowerT ? 0 : c + 1;
+    const int kEnd = lowerT ? c : nb;
+    for (int k = kBegin; k < kEnd; k++) {
+      const T t = transT ? A[k + c * lda] : A[c + k * lda];
+      const T *xk = X + k * ldx;
+      for (int i = 0; i < rows; i++) xc[i] = xc[i] + t * xk[i];
+    }
+    for (int i = 0; i < rows; i++) xc[i] = alpha * xc[i];
+  }
+}
+
+template <typename T>
+void for_each_element(int M, int N, T *B, __int64_t ldb, T (*fn)(T)) {
+  HostThreadPool::instance().parallel_for(N, [=](int j) {
+    for (int i = 0; i < M; i++) B[i + j * ldb] = fn(B[i + j * ldb]);
+  });
+}
+
+template <typename T>
+T clear(T) {
+  return T(0);
+}
+
+template <typename T>
+T conjugate(T a) {
+  return host_conj(a);
+}
+
+}  // namespace
+
+template <typename T>
+bool host_trmm(bool colMajor, bool left, bool lower, bool trans, bool conj,
+               bool unit, int M, int N, T alpha, const T *A, __int64_t lda,
+               T *B, __int64_t ldb) {
+  if (!colMajor) {
+    // Row major B is B^T in column major and A is A^T: the right side
+    // product of the transposed problem with the other triangle
+    return host_trmm(true, !left, !lower, trans, conj, unit, N, M, alpha, A,
+                     lda, B, ldb);
+  }
+  if (is_zero(alpha)) {
+    for_each_element(M, N, B, ldb, clear<T>);
+    return true;
+  }
+  // op(A) = A^H: conj(B) is the transposed product of conj(alpha) B^*
+  conj = conj && trans && IsComplex<T>::value;
+  if (conj) {
+    for_each_element(M, N, B, ldb, conjugate<T>);
+    alpha = host_conj(alpha);
+  }
+  const int n = left ? M : N;
+  const int nvec = left ? N : M;
+  // Per vector the product is y = T x with T = op(A) on the left side and
+  // op(A)^T on the right; blocks go backward when T is lower triangular
+  const bool transT = left == trans;
+  const bool lowerT = left ? lower != trans : lower == trans;
+  const int blocks = (n + HOST_TRMM_NB - 1) / HOST_TRMM_NB;
+  const int tasks = (nvec + HOST_TRMM_VECS - 1) / HOST_TRMM_VECS;
+  for (int s = 0; s < blocks; s++) {
+    const int blk = lowerT ? blocks - 1 - s : s;
+    const int i0 = blk * HOST_TRMM_NB;
+    const int nb = std::min(HOST_TRMM_NB, n - i0);
+    const T *Aii = A + i0 + i0 * lda;
+    HostThreadPool::instance().parallel_for(tasks, [&](int task) {
+      const int v0 = task * HOST_TRMM_VECS;
+      const int vn = std::min(HOST_TRMM_VECS, nvec - v0);
+      if (left) {
+        for (int v = v0; v < v0 + vn; v++) {
+          multiply_column(transT, lowerT, unit, nb, Aii, lda, alpha,
+                          B + i0 + v * ldb);
+        }
+      } else {
+        multiply_rows(transT, lowerT, unit, nb, Aii, lda, alpha, vn,
+                      B + v0 + i0 * ldb, ldb);
+      }
+    });
+    const int r0 = lowerT ? 0 : i0 + nb;
+    const int rn = lowerT ? i0 : n - r0;
+    if (rn == 0) continue;
+    bool done;
+    if (left) {
+      done = host_gemm<T>(true, trans, false, nb, N, rn, alpha,
+                          A + (trans ? r0 + i0 * lda : i0 + r0 * lda), lda,
+                          B + r0, ldb, T(1), B + i0, ldb);
+    } else {
+      done = host_gemm<T>(true, false, trans, M, nb, rn, alpha, B + r0 * ldb,
+                          ldb, A + (trans ? i0 + r0 * lda : r0 + i0 * lda), lda,
+                          T(1), B + i0 * ldb, ldb);
+    }
+    if (!done) return false;
+  }
+  if (conj) for_each_element(M, N, B, ldb, conjugate<T>);
+  return true;
+}
+
+template <typename T>
+bool host_trmm_batched(bool colMajor, bool left, bool lower, bool trans,
+                       bool conj, bool unit, int M, int N, T alpha,
+                       T *const A[], __int64_t aOffset, __int64_t lda,
+                       T *const B[], __int64_t bOffset, __int64_t ldb,
+                       int batchSize) {
+  // Many small products: one per task, each run on its pool thread
+  std::atomic<bool> failed(false);
+  HostThreadPool::instance().parallel_for(batchSize, [&](int e) {
+    if (!host_trmm(colMajor, left, lower, trans, conj, unit, M, N, alpha,
+                   A[e] + aOffset, lda, B[e] + bOffset, ldb)) {
+      failed = true;
+    }
+  });
+  return !failed;
+}
+
+#define HOST_TRMM(T)                                                          \
+  template bool host_trmm<T>(bool, bool, bool, bool, bool, bool, int, int, T, \
+                             const T *, __int64_t, T *, __int64_t);          \
+  template bool host_trmm_batched<T>(bool, bool, bool, bool, bool, bool, int, \
+                                     int, T, T *const[], __int64_t,          \
+                                     __int64_t, T *const[], __int64_t,       \
+                                     __int64_t, int);
+
+HOST_TRMM(float)
+HOST_TRMM(double)
+HOST_TRMM(HostComplexFloat)
+HOST_TRMM(HostComplexDouble)
@@ -0,0 +1,215 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./hcblas_host.h"
+#include <algorithm>
+#include <atomic>
+#include "./host_threadpool.h"
+
+// Blocked triangular solve: diagonal blocks of HOST_TRSM_NB are solved
+// directly, split across the pool by columns (left side) or row chunks
+// (right side) of B, and every block is followed by one host_gemm update of
+// the rest of B, which carries almost all of the flops.
+
+#define HOST_TRSM_NB 128
+// Columns (left side) or rows (right side) of B per pool task
+#define HOST_TRSM_VECS 32
+
+namespace {
+
+template <typename T>
+struct IsComplex {
+  static const bool value = false;
+};
+template <typename R>
+struct IsComplex<HostComplex<R> > {
+  static const bool value = true;
+};
+
+template <typename T>
+bool is_zero(T a) {
+  return a == T(0);
+}
+
+// T y = x in place for a column x of length nb, T[r][c] = A(c, r) when
+// transT and A(r, c) otherwise. Either way A is walked down its columns.
+template <typename T>
+void solve_column(bool transT, bool lowerT, bool unit, int nb, const T *A,
+                  __int64_t lda, T scale, T *x) {
+  for (int r = 0; r < nb; r++) x[r] = scale * x[r];
+  for (int s = 0; s < nb; s++) {
+    const int c = lowerT ? s : nb - 1 - s;
+    const int kBegin = lowerT ? 0 : c + 1;
+    const int kEnd = lowerT ? c : nb;
+    if (transT) {
+      // x_c -= sum over solved k of A(k, c) x_k
+      T sum = T(0);
+      for (int k = kBegin; k < kEnd; k++) sum += A[k + c * lda] * x[k];
+      x[c] = x[c] - sum;
+      if (!unit) x[c] = x[c] / A[c + c * lda];
+    } else {
+      if (!unit) x[c] = x[c] / A[c + c * lda];
+      // x_r -= A(r, c) x_c over the unsolved r
+      const int rBegin = lowerT ? c + 1 : 0;
+      const int rEnd = lowerT ? nb : c;
+      for (int r = rBegin; r < rEnd; r++) x[r] = x[r] - A[r + c * lda] * x[c];
+    }
+  }
+}
+
+// Y T^T = X in place for rows of X (rows x nb, leading dimension ldx): row
+// y solves T y^T = x^T, done a column of X at a time
+template <typename T>
+void solve_rows(bool transT, bool lowerT, bool unit, int nb, const T *A,
+                __int64_t lda, T scale, int rows, T *X, __int64_t ldx) {
+  for (int s = 0; s < nb; s++) {
+    const int c = lowerT ? s : nb - 1 - s;
+    T *xc = X + c * ldx;
+    for (int i = 0; i < rows; i++) xc[i] = scale * xc[i];
+    const int kBegin = lowerT ? 0 : c + 1;
+    const int kEnd = lowerT ? c : nb;
+    for (int k = kBegin; k < kEnd; k++) {
+      const T t = transT ? A[k + c * lda] : A[c + k * lda];
+      const T *xk = X + k * ldx;
+      for (int i = 0; i < rows; i++) xc[i] = xc[i] - t * xk[i];
+    }
+    if (!unit) {
+      const T d = A[c + c * lda];
+      for (int i = 0; i < rows; i++) xc[i] = xc[i] / d;
+    }
+  }
+}
+
+template <typename T>
+void for_each_element(int M, int N, T *B, __int64_t ldb, T (*fn)(T)) {
+  HostThreadPool::instance().parallel_for(N, [=](int j) {
+    for (int i = 0; i < M; i++) B[i + j * ldb] = fn(B[i + j * ldb]);
+  });
+}
+
+template <typename T>
+T clear(T) {
+  return T(0);
+}
+
+template <typename T>
+T conjugate(T a) {
+  return host_conj(a);
+}
+
+}  // namespace
+
+template <typename T>
+bool host_trsm(bool colMajor, bool left, bool lower, bool trans, bool conj,
+               bool unit, int M, int N, T alpha, const T *A, __int64_t lda,
+               T *B, __int64_t ldb) {
+  if (!colMajor) {
+    // Row major B is B^T in column major and A is A^T: the right side
+    // system of the transposed problem with the other triangle
+    return host_trsm(true, !left, !lower, trans, conj, unit, N, M, alpha, A,
+                     lda, B, ldb);
+  }
+  if (is_zero(alpha)) {
+    for_each_element(M, N, B, ldb, clear<T>);
+    return true;
+  }
+  // op(A) = A^H: conj(X) solves the transposed system with conj(alpha) B^*
+  conj = conj && trans && IsComplex<T>::value;
+  if (conj) {
+    for_each_element(M, N, B, ldb, conjugate<T>);
+    alpha = host_conj(alpha);
+  }
+  const int n = left ? M : N;
+  const int nvec = left ? N : M;
+  // Per vector the system is T y = b with T = op(A) on the left side and
+  // op(A)^T on the right; blocks go forward when T is lower triangular
+  const bool transT = left == trans;
+  const bool lowerT = left ? lower != trans : lower == trans;
+  const int blocks = (n + HOST_TRSM_NB - 1) / HOST_TRSM_NB;
+  const int tasks = (nvec + HOST_TRSM_VECS - 1) / HOST_TRSM_VECS;
+  for (int s = 0; s < blocks; s++) {
+    const int blk = lowerT ? s : blocks - 1 - s;
+    const int i0 = blk * HOST_TRSM_NB;
+    const int nb = std::min(HOST_TRSM_NB, n - i0);
+    const T scale = s == 0 ? alpha : T(1);
+    const T *Aii = A + i0 + i0 * lda;
+    HostThreadPool::instance().parallel_for(tasks, [&](int task) {
+      const int v0 = task * HOST_TRSM_VECS;
+      const int vn = std::min(HOST_TRSM_VECS, nvec - v0);
+      if (left) {
+        for (int v = v0; v < v0 + vn; v++) {
+          solve_column(transT, lowerT, unit, nb, Aii, lda, scale,
+                       B + i0 + v * ldb);
+        }
+      } else {
+        solve_rows(transT, lowerT, unit, nb, Aii, lda, scale, vn,
+                   B + v0 + i0 * ldb, ldb);
+      }
+    });
+    const int r0 = lowerT ? i0 + nb : 0;
+    const int rn = lowerT ? n - r0 : i0;
+    if (rn == 0) continue;
+    bool done;
+    if (left) {
+      done = host_gemm<T>(true, trans, false, rn, N, nb, T(-1),
+                          A + (trans ? i0 + r0 * lda : r0 + i0 * lda), lda,
+                          B + i0, ldb, scale, B + r0, ldb);
+    } else {
+      done = host_gemm<T>(true, false, trans, M, rn, nb, T(-1), B + i0 * ldb,
+                          ldb, A + (trans ? r0 + i0 * lda : i0 + r0 * lda), lda,
+                          scale, B + r0 * ldb, ldb);
+    }
+    if (!done) return false;
+  }
+  if (conj) for_each_element(M, N, B, ldb, conjugate<T>);
+  return true;
+}
+
+template <typename T>
+bool host_trsm_batched(bool colMajor, bool left, bool lower, bool trans,
+                       bool conj, bool unit, int M, int N, T alpha,
+                       T *const A[], __int64_t aOffset, __int64_t lda,
+                       T *const B[], __int64_t bOffset, __int64_t ldb,
+                       int batchSize) {
+  // Many small systems: one per task, each solved on its pool thread
+  std::atomic<bool> failed(false);
+  HostThreadPool::instance().parallel_for(batchSize, [&](int e) {
+    if (!host_trsm(colMajor, left, lower, trans, conj, unit, M, N, alpha,
+                   A[e] + aOffset, lda, B[e] + bOffset, ldb)) {
+      failed = true;
+    }
+  });
+  return !failed;
+}
+
+#define HOST_TRSM(T)                                                          \
+  template bool host_trsm<T>(bool, bool, bool, bool, bool, bool, int, int, T, \
+                             const T *, __int64_t, T *, __int64_t);          \
+  template bool host_trsm_batched<T>(bool, bool, bool, bool, bool, bool, int, \
+                                     int, T, T *const[], __int64_t,          \
+                                     __int64_t, T *const[], __int64_t,       \
+                                     __int64_t, int);
+
+HOST_TRSM(float)
+HOST_TRSM(double)
+HOST_TRSM(HostComplexFloat)
+HOST_TRSM(HostComplexDouble)
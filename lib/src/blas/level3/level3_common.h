@@ -0,0 +1,314 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Pieces shared by the Level-3 routines other than GEMM (TRSM, SYRK, ...):
+* scalar arithmetic that is complex for hc::short_vector::float_2/double_2
+* (whose own operators work per component), and adapters that give the per
+* precision Hcblaslibrary GEMM entry points one signature so templated
+* drivers can push their block updates through the tuned GEMM paths.
+*/
+
+#ifndef LIB_SRC_BLAS_LEVEL3_LEVEL3_COMMON_H_
+#define LIB_SRC_BLAS_LEVEL3_LEVEL3_COMMON_H_
+
+#include "include/hcblaslib.h"
+#include "src/blas/host/host_complex.h"
+#include <hc.hpp>
+#include <hc_short_vector.hpp>
+
+typedef hc::short_vector::float_2 Level3Complex;
+typedef hc::short_vector::double_2 Level3DoubleComplex;
+
+// Scalar of value r (real part r for the complex types)
+template <typename T>
+struct Level3Scalar {
+  static T real(double r) [[hc, cpu]] { return static_cast<T>(r); }
+  static const bool complex = false;
+};
+
+template <>
+struct Level3Scalar<Level3Complex> {
+  static Level3Complex real(double r) [[hc, cpu]] {
+    return Level3Complex(static_cast<float>(r), 0.0f);
+  }
+  static const bool complex = true;
+};
+
+template <>
+struct Level3Scalar<Level3DoubleComplex> {
+  static Level3DoubleComplex real(double r) [[hc, cpu]] {
+    return Level3DoubleComplex(r, 0.0);
+  }
+  static const bool complex = true;
+};
+
+// Element type of the host engines for T and the conversion of a scalar;
+// arrays are reinterpreted, the layouts match (host_complex.h)
+template <typename T>
+struct Level3Host {
+  typedef T type;
+  static T value(T a) { return a; }
+};
+
+template <>
+struct Level3Host<Level3Complex> {
+  typedef HostComplexFloat type;
+  static type value(const Level3Complex &a) { return type(a.x, a.y); }
+};
+
+template <>
+struct Level3Host<Level3DoubleComplex> {
+  typedef HostComplexDouble type;
+  static type value(const Level3DoubleComplex &a) { return type(a.x, a.y); }
+};
+
+inline float level3_mul(float a, float b) [[hc, cpu]] { return a * b; }
+inline double level3_mul(double a, double b) [[hc, cpu]] { return a * b; }
+inline Level3Complex level3_mul(const Level3Complex &a,
+                                const Level3Complex &b) [[hc, cpu]] {
+  return Level3Complex(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+}
+inline Level3DoubleComplex level3_mul(
+    const Level3DoubleComplex &a, const Level3DoubleComplex &b) [[hc, cpu]] {
+  return Level3DoubleComplex(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+}
+
+inline float level3_div(float a, float b) [[hc, cpu]] { return a / b; }
+inline double level3_div(double a, double b) [[hc, cpu]] { return a / b; }
+inline Level3Complex level3_div(const Level3Complex &a,
+                                const Level3Complex &b) [[hc, cpu]] {
+  const float d = b.x * b.x + b.y * b.y;
+  return Level3Complex((a.x * b.x + a.y * b.y) / d,
+                       (a.y * b.x - a.x * b.y) / d);
+}
+inline Level3DoubleComplex level3_div(
+    const Level3DoubleComplex &a, const Level3DoubleComplex &b) [[hc, cpu]] {
+  const double d = b.x * b.x + b.y * b.y;
+  return Level3DoubleComplex((a.x * b.x + a.y * b.y) / d,
+                             (a.y * b.x - a.x * b.y) / d);
+}
+
+inline float level3_conj(float a) [[hc, cpu]] { return a; }
+inline double level3_conj(double a) [[hc, cpu]] { return a; }
+inline Level3Complex level3_conj(const Level3Complex &a) [[hc, cpu]] {
+  return Level3Complex(a.x, -a.y);
+}
+inline Level3DoubleComplex level3_conj(
+    const Level3DoubleComplex &a) [[hc, cpu]] {
+  return Level3DoubleComplex(a.x, -a.y);
+}
+
+// Real part as a T; HERK-style diagonals have no imaginary part
+inline float level3_real(float a) [[hc, cpu]] { return a; }
+inline double level3_real(double a) [[hc, cpu]] { return a; }
+inline Level3Complex level3_real(const Level3Complex &a) [[hc, cpu]] {
+  return Level3Complex(a.x, 0.0f);
+}
+inline Level3DoubleComplex level3_real(
+    const Level3DoubleComplex &a) [[hc, cpu]] {
+  return Level3DoubleComplex(a.x, 0.0);
+}
+
+inline bool level3_is_zero(float a) { return a == 0.0f; }
+inline bool level3_is_zero(double a) { return a == 0.0; }
+inline bool level3_is_zero(const Level3Complex &a) {
+  return a.x == 0.0f && a.y == 0.0f;
+}
+inline bool level3_is_zero(const Level3DoubleComplex &a) {
+  return a.x == 0.0 && a.y == 0.0;
+}
+
+// Matrix of batch entry elt: single matrices ignore elt, so kernels can be
+// written once over T * and the T ** pointer arrays of the batched forms
+template <typename T>
+inline T *level3_entry(T *X, int elt) [[hc]] {
+  return X;
+}
+template <typename T>
+inline T *level3_entry(T **X, int elt) [[hc]] {
+  return X[elt];
+}
+
+// B = conj(B) when conj, B = 0 otherwise, for M x N blocks of B
+template <typename T, typename P>
+void level3_touch_launch(hc::accelerator_view accl_view, P B,
+                         __int64_t bOffset, __int64_t ldb, int M, int N,
+                         bool conj, int batchSize) {
+  hc::extent<3> grdExt(batchSize, (N + 15) & ~15, (M + 15) & ~15);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, 16, 16);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    const int col = tidx.global[1];
+    const int row = tidx.global[2];
+    if (row < M && col < N) {
+      T *b = level3_entry(B, tidx.tile[0]) + bOffset;
+      b[row + col * ldb] = conj ? level3_conj(b[row + col * ldb])
+                                : Level3Scalar<T>::real(0.0);
+    }
+  });
+}
+
+// Column major C = alpha * op(A) * op(B) + beta * C through the handle's
+// GEMM entry point of T, with op a plain transpose. The batched form takes
+// the pointer arrays of the batched GEMM, every entry at the same offsets.
+inline hcblasStatus level3_gemm(Hcblaslibrary *lib, hc::accelerator_view av,
+                                hcblasTranspose transA,
+                                hcblasTranspose transB, int M, int N, int K,
+                                float alpha, float *A, __int64_t aOffset,
+                                __int64_t lda, float *B, __int64_t bOffset,
+                                __int64_t ldb, float beta, float *C,
+                                __int64_t cOffset, __int64_t ldc) {
+  return lib->hcblas_sgemm(av, ColMajor, transA, transB, M, N, K, alpha, A,
+                           lda, B, ldb, beta, C, ldc, aOffset, bOffset,
+                           cOffset);
+}
+
+inline hcblasStatus level3_gemm(Hcblaslibrary *lib, hc::accelerator_view av,
+                                hcblasTranspose transA,
+                                hcblasTranspose transB, int M, int N, int K,
+                                double alpha, double *A, __int64_t aOffset,
+                                __int64_t lda, double *B, __int64_t bOffset,
+                                __int64_t ldb, double beta, double *C,
+                                __int64_t cOffset, __int64_t ldc) {
+  return lib->hcblas_dgemm(av, ColMajor, transA, transB, M, N, K, alpha, A,
+                           lda, B, ldb, beta, C, ldc, aOffset, bOffset,
+                           cOffset);
+}
+
+inline hcblasStatus level3_gemm(Hcblaslibrary *lib, hc::accelerator_view av,
+                                hcblasTranspose transA,
+                                hcblasTranspose transB, int M, int N, int K,
+                                Level3Complex alpha, Level3Complex *A,
+                                __int64_t aOffset, __int64_t lda,
+                                Level3Complex *B, __int64_t bOffset,
+                                __int64_t ldb, Level3Complex beta,
+                                Level3Complex *C, __int64_t cOffset,
+                                __int64_t ldc) {
+  return lib->hcblas_cgemm(av, ColMajor, transA, transB, M, N, K, alpha, A,
+                           aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                           ldc);
+}
+
+inline hcblasStatus level3_gemm(Hcblaslibrary *lib, hc::accelerator_view av,
+                                hcblasTranspose transA,
+                                hcblasTranspose transB, int M, int N, int K,
+                                Level3DoubleComplex alpha,
+                                Level3DoubleComplex *A, __int64_t aOffset,
+                                __int64_t lda, Level3DoubleComplex *B,
+                                __int64_t bOffset, __int64_t ldb,
+                                Level3DoubleComplex beta,
+                                Level3DoubleComplex *C, __int64_t cOffset,
+                                __int64_t ldc) {
+  return lib->hcblas_zgemm(av, ColMajor, transA, transB, M, N, K, alpha, A,
+                           aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                           ldc);
+}
+
+inline hcblasStatus level3_gemm(Hcblaslibrary *lib, hc::accelerator_view av,
+                                hcblasTranspose transA,
+                                hcblasTranspose transB, int M, int N, int K,
+                                float alpha, float *A[], __int64_t aOffset,
+                                __int64_t lda, float *B[], __int64_t bOffset,
+                                __int64_t ldb, float beta, float *C[],
+                                __int64_t cOffset, __int64_t ldc,
+                                int batchSize) {
+  return lib->hcblas_sgemm(av, ColMajor, transA, transB, M, N, K, alpha, A,
+                           lda, 0, B, ldb, 0, beta, C, ldc, 0, aOffset,
+                           bOffset, cOffset, batchSize);
+}
+
+inline hcblasStatus level3_gemm(Hcblaslibrary *lib, hc::accelerator_view av,
+                                hcblasTranspose transA,
+                                hcblasTranspose transB, int M, int N, int K,
+                                double alpha, double *A[], __int64_t aOffset,
+                                __int64_t lda, double *B[], __int64_t bOffset,
+                                __int64_t ldb, double beta, double *C[],
+                                __int64_t cOffset, __int64_t ldc,
+                                int batchSize) {
+  return lib->hcblas_dgemm(av, ColMajor, transA, transB, M, N, K, alpha, A,
+                           lda, 0, B, ldb, 0, beta, C, ldc, 0, aOffset,
+                           bOffset, cOffset, batchSize);
+}
+
+inline hcblasStatus level3_gemm(Hcblaslibrary *lib, hc::accelerator_view av,
+                                hcblasTranspose transA,
+                                hcblasTranspose transB, int M, int N, int K,
+                                Level3Complex alpha, Level3Complex *A[],
+                                __int64_t aOffset, __int64_t lda,
+                                Level3Complex *B[], __int64_t bOffset,
+                                __int64_t ldb, Level3Complex beta,
+                                Level3Complex *C[], __int64_t cOffset,
+                                __int64_t ldc, int batchSize) {
+  return lib->hcblas_cgemm(av, ColMajor, transA, transB, M, N, K, alpha, A,
+                           aOffset, 0, lda, B, bOffset, 0, ldb, beta, C,
+                           cOffset, 0, ldc, batchSize);
+}
+
+inline hcblasStatus level3_gemm(Hcblaslibrary *lib, hc::accelerator_view av,
+                                hcblasTranspose transA,
+                                hcblasTranspose transB, int M, int N, int K,
+                                Level3DoubleComplex alpha,
+                                Level3DoubleComplex *A[], __int64_t aOffset,
+                                __int64_t lda, Level3DoubleComplex *B[],
+                                __int64_t bOffset, __int64_t ldb,
+                                Level3DoubleComplex beta,
+                                Level3DoubleComplex *C[], __int64_t cOffset,
+                                __int64_t ldc, int batchSize) {
+  return lib->hcblas_zgemm(av, ColMajor, transA, transB, M, N, K, alpha, A,
+                           aOffset, 0, lda, B, bOffset, 0, ldb, beta, C,
+                           cOffset, 0, ldc, batchSize);
+}
+
+// The gemm argument of the blocked drivers: forwards column major updates to
+// level3_gemm on the handle, the pointer array form with batchSize entries
+struct Level3Gemm {
+  Level3Gemm(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+             int batchSize)
+      : lib(lib), accl_view(accl_view), batchSize(batchSize) {}
+
+  template <typename T>
+  hcblasStatus operator()(hcblasTranspose transA, hcblasTranspose transB,
+                          int M, int N, int K, T alpha, T *A,
+                          __int64_t aOffset, __int64_t lda, T *B,
+                          __int64_t bOffset, __int64_t ldb, T beta, T *C,
+                          __int64_t cOffset, __int64_t ldc) const {
+    return level3_gemm(lib, accl_view, transA, transB, M, N, K, alpha, A,
+                       aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+  }
+
+  template <typename T>
+  hcblasStatus operator()(hcblasTranspose transA, hcblasTranspose transB,
+                          int M, int N, int K, T alpha, T **A,
+                          __int64_t aOffset, __int64_t lda, T **B,
+                          __int64_t bOffset, __int64_t ldb, T beta, T **C,
+                          __int64_t cOffset, __int64_t ldc) const {
+    return level3_gemm(lib, accl_view, transA, transB, M, N, K, alpha, A,
+                       aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc,
+                       batchSize);
+  }
+
+  Hcblaslibrary *lib;
+  hc::accelerator_view accl_view;
+  int batchSize;
+};
+
+#endif  // LIB_SRC_BLAS_LEVEL3_LEVEL3_COMMON_H_
@@ -0,0 +1,418 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Triangular product C = alpha * op(A) * op(B) + beta * C that touches only
+* the lower or upper triangle of the n x n matrix C, the engine under SYRK,
+* HERK, SYR2K, HER2K and GEMMT. The diagonal is cut into TRIANGLE_NB blocks
+* computed together by one masked launch; everything off the diagonal is
+* split recursively into square halves whose rectangular parts go to the
+* tuned GEMM paths, so the products are as large as the triangle allows and
+* no block outside the triangle is ever computed.
+*
+* Everything here is column major; the wrappers fold row major layouts into
+* the other triangle.
+*/
+
+#ifndef LIB_SRC_BLAS_LEVEL3_LEVEL3_TRIANGLE_H_
+#define LIB_SRC_BLAS_LEVEL3_LEVEL3_TRIANGLE_H_
+
+#include "src/blas/level3/level3_common.h"
+#include "src/blas/scratch/scratch_pool.h"
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Diagonal block size and K step of the masked diagonal kernel, whose 16 x 16
+// work-items hold 4 x 4 elements of the block each
+#define TRIANGLE_NB 64
+#define TRIANGLE_KSTEP 16
+// Elements per batch entry the scratch copies of the operands stay within:
+// K is walked in panels short enough, never shorter than a K step
+#define TRIANGLE_PACK (1 << 18)
+
+// K panel length for width scratch columns of n elements per panel column
+inline int triangle_kpanel(int n, int K, int width) {
+  __int64_t kp = TRIANGLE_PACK / (static_cast<__int64_t>(n) * width);
+  kp = kp / TRIANGLE_KSTEP * TRIANGLE_KSTEP;
+  if (kp < TRIANGLE_KSTEP) kp = TRIANGLE_KSTEP;
+  return kp < K ? static_cast<int>(kp) : K;
+}
+
+// Device scratch of size elements per batch entry, entry e at buffer + e *
+// size, leased from the handle's pool; an empty scratch leases nothing
+template <typename T>
+struct TriangleScratch {
+  TriangleScratch(ScratchPool *scratch, hc::accelerator_view accl_view,
+                  __int64_t size, int batchSize)
+      : scratch(scratch),
+        accl_view(accl_view),
+        size(size),
+        batchSize(batchSize),
+        lease(scratch, accl_view, size * batchSize),
+        buffer(lease.data()) {}
+  // The scratch as the same kind of pointer as the operands
+  T *data(T *) { return buffer; }
+  // Pointer arrays are read by the kernels, so the table of entries is
+  // leased in device memory too and outlives the queued work like buffer
+  T **data(T **) {
+    if (buffer == NULL) return NULL;
+    std::vector<T *> entries(batchSize);
+    for (int e = 0; e < batchSize; e++) entries[e] = buffer + e * size;
+    table.reset(new ScratchDevice<T *>(scratch, accl_view, batchSize));
+    if (table->data() == NULL) return NULL;
+    accl_view.copy(entries.data(), table->data(), sizeof(T *) * batchSize);
+    return table->data();
+  }
+
+  ScratchPool *scratch;
+  hc::accelerator_view accl_view;
+  __int64_t size;
+  int batchSize;
+  ScratchDevice<T> lease;
+  T *buffer;
+  std::unique_ptr<ScratchDevice<T *> > table;
+};
+
+// Packed conj(X) of a rows x cols operand per entry, leading dimension rows,
+// entry e at out + e * size. The GEMM paths have no conjugate, so an operand
+// used as X^H is read as a plain transpose of its copy.
+template <typename T, typename P>
+void triangle_conj_copy_launch(hc::accelerator_view accl_view, P X,
+                               __int64_t xOffset, __int64_t ldx, int rows,
+                               int cols, T *out, __int64_t size,
+                               int batchSize) {
+  hc::extent<3> grdExt(batchSize, (cols + 15) & ~15, (rows + 15) & ~15);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, 16, 16);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    const int col = tidx.global[1];
+    const int row = tidx.global[2];
+    if (row < rows && col < cols) {
+      const T *x = level3_entry(X, tidx.tile[0]) + xOffset;
+      out[tidx.tile[0] * size + row + col * rows] =
+          level3_conj(x[row + col * ldx]);
+    }
+  });
+}
+
+// C = beta * C over the triangle, zero when betaZero (C is not read then)
+template <typename T, typename P>
+void triangle_scale_launch(hc::accelerator_view accl_view, bool lower,
+                           bool herm, int n, T beta, bool betaZero, P C,
+                           __int64_t cOffset, __int64_t ldc, int batchSize) {
+  hc::extent<3> grdExt(batchSize, (n + 15) & ~15, (n + 15) & ~15);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, 16, 16);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    const int col = tidx.global[1];
+    const int row = tidx.global[2];
+    if (row < n && col < n && (lower ? row >= col : row <= col)) {
+      T *c = level3_entry(C, tidx.tile[0]) + cOffset;
+      T v = betaZero ? Level3Scalar<T>::real(0.0)
+                     : level3_mul(beta, c[row + col * ldc]);
+      if (herm && row == col) v = level3_real(v);
+      c[row + col * ldc] = v;
+    }
+  });
+}
+
+// The triangles of all TRIANGLE_NB diagonal blocks of C in one launch,
+// work-group (elt, blk, 0) taking block blk of entry elt. op(A) and op(B)
+// are staged a K step at a time in local memory; work-items whose 4 x 4
+// elements all lie outside the triangle skip the products.
+template <typename T, typename P>
+void triangle_diag_launch(hc::accelerator_view accl_view, bool lower,
+                          bool herm, hcblasTranspose opA,
+                          hcblasTranspose opB, int n, int K, T alpha, P A,
+                          __int64_t aOffset, __int64_t lda, P B,
+                          __int64_t bOffset, __int64_t ldb, T beta,
+                          bool betaZero, P C, __int64_t cOffset, __int64_t ldc,
+                          int batchSize) {
+  enum { NB = TRIANGLE_NB, KSTEP = TRIANGLE_KSTEP };
+  const int blocks = (n + NB - 1) / NB;
+  const bool complex = Level3Scalar<T>::complex;
+  const bool transA = opA != NoTrans;
+  const bool conjA = opA == ConjTrans && complex;
+  const bool transB = opB != NoTrans;
+  const bool conjB = opB == ConjTrans && complex;
+  hc::extent<3> grdExt(batchSize, blocks * 16, 16);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, 16, 16);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    // lX[k * NB + r] = op(A)(i0 + r, k0 + k), lY[k * NB + c] = op(B)(k0 + k,
+    // i0 + c)
+    tile_static T lX[KSTEP * NB];
+    tile_static T lY[KSTEP * NB];
+    const int elt = tidx.tile[0];
+    const int i0 = tidx.tile[1] * NB;
+    const int nb = n - i0 < NB ? n - i0 : NB;
+    const int tx = tidx.local[2];
+    const int ty = tidx.local[1];
+    const int lid = ty * 16 + tx;
+    const T *a = level3_entry(A, elt) + aOffset;
+    const T *b = level3_entry(B, elt) + bOffset;
+    T *c = level3_entry(C, elt) + cOffset;
+    const T zero = Level3Scalar<T>::real(0.0);
+    const bool active = lower ? tx >= ty : tx <= ty;
+    T acc[4][4];
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) acc[i][j] = zero;
+    }
+    for (int k0 = 0; k0 < K; k0 += KSTEP) {
+      // Loads walk the stored matrices with stride one
+      for (int idx = lid; idx < KSTEP * NB; idx += 256) {
+        int r = transA ? idx / KSTEP : idx % NB;
+        int k = transA ? idx % KSTEP : idx / NB;
+        T x = zero;
+        if (r < nb && k0 + k < K) {
+          x = transA ? a[k0 + k + (i0 + r) * lda] : a[i0 + r + (k0 + k) * lda];
+          if (conjA) x = level3_conj(x);
+        }
+        lX[k * NB + r] = x;
+        r = transB ? idx % NB : idx / KSTEP;
+        k = transB ? idx / NB : idx % KSTEP;
+        T y = zero;
+        if (r < nb && k0 + k < K) {
+          y = transB ? b[i0 + r + (k0 + k) * ldb] : b[k0 + k + (i0 + r) * ldb];
+          if (conjB) y = level3_conj(y);
+        }
+        lY[k * NB + r] = y;
+      }
+      tidx.barrier.wait();
+      if (active) {
+        for (int k = 0; k < KSTEP; k++) {
+          for (int i = 0; i < 4; i++) {
+            const T x = lX[k * NB + tx * 4 + i];
+            for (int j = 0; j < 4; j++) {
+              acc[i][j] += level3_mul(x, lY[k * NB + ty * 4 + j]);
+            }
+          }
+        }
+      }
+      tidx.barrier.wait();
+    }
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) {
+        const int r = tx * 4 + i;
+        const int cc = ty * 4 + j;
+        if (r < nb && cc < nb && (lower ? r >= cc : r <= cc)) {
+          T *e = c + i0 + r + (i0 + cc) * ldc;
+          T v = level3_mul(alpha, acc[i][j]);
+          if (!betaZero) v += level3_mul(beta, *e);
+          if (herm && r == cc) v = level3_real(v);
+          *e = v;
+        }
+      }
+    }
+  });
+}
+
+// The off-diagonal blocks of the triangle update: ranges [i0, i0 + m) of
+// the diagonal still holding some have the part beside the diagonal split at
+// a block boundary go to GEMM, and the two halves are pushed back
+template <typename T, typename P, typename Gemm>
+hcblasStatus triangle_offdiag(Gemm gemm, bool lower, hcblasTranspose opA,
+                              hcblasTranspose opB, int n, int K, T alpha, P A,
+                              __int64_t aOffset, __int64_t lda, P B,
+                              __int64_t bOffset, __int64_t ldb, T beta, P C,
+                              __int64_t cOffset, __int64_t ldc) {
+  enum { NB = TRIANGLE_NB };
+  hcblasStatus status = HCBLAS_SUCCEEDS;
+  std::vector<std::pair<int, int> > ranges(1, std::make_pair(0, n));
+  while (!ranges.empty() && status == HCBLAS_SUCCEEDS) {
+    const int i0 = ranges.back().first;
+    const int m = ranges.back().second;
+    ranges.pop_back();
+    if (m <= NB) continue;
+    const int m1 = ((m + NB - 1) / NB + 1) / 2 * NB;
+    const int m2 = m - m1;
+    // Below the diagonal for the lower triangle, right of it for the upper
+    const int r0 = lower ? i0 + m1 : i0;
+    const int c0 = lower ? i0 : i0 + m1;
+    status = gemm(opA, opB, lower ? m2 : m1, lower ? m1 : m2, K, alpha, A,
+                  aOffset + (opA == NoTrans ? r0 : r0 * lda), lda, B,
+                  bOffset + (opB == NoTrans ? c0 * ldb : c0), ldb, beta, C,
+                  cOffset + r0 + c0 * ldc, ldc);
+    ranges.push_back(std::make_pair(i0, m1));
+    ranges.push_back(std::make_pair(i0 + m1, m2));
+  }
+  return status;
+}
+
+// Column major C = alpha * op(A) * op(B) + beta * C on the lower or upper
+// triangle of the n x n matrix C, op(A) n x K and op(B) K x n. herm keeps
+// the diagonal real. gemm(transA, transB, M, N, K, alpha, A, aOffset, lda,
+// B, bOffset, ldb, beta, C, cOffset, ldc) runs the off-diagonal blocks on
+// the same kind of pointers as A, B and C. Conjugated copies are leased
+// from scratch a K panel at a time, within TRIANGLE_PACK elements per entry;
+// HCBLAS_INVALID when they cannot be leased.
+template <typename T, typename P, typename Gemm>
+hcblasStatus triangle_update(hc::accelerator_view accl_view,
+                             ScratchPool *scratch, Gemm gemm, bool lower,
+                             bool herm, hcblasTranspose opA,
+                             hcblasTranspose opB, int n, int K, T alpha, P A,
+                             __int64_t aOffset, __int64_t lda, P B,
+                             __int64_t bOffset, __int64_t ldb, T beta, P C,
+                             __int64_t cOffset, __int64_t ldc, int batchSize) {
+  enum { NB = TRIANGLE_NB };
+  const bool betaZero = level3_is_zero(beta);
+  if (K == 0 || level3_is_zero(alpha)) {
+    triangle_scale_launch<T>(accl_view, lower, herm, n, beta, betaZero, C,
+                             cOffset, ldc, batchSize);
+    return HCBLAS_SUCCEEDS;
+  }
+  if (!Level3Scalar<T>::complex) {
+    if (opA == ConjTrans) opA = Trans;
+    if (opB == ConjTrans) opB = Trans;
+  }
+  triangle_diag_launch<T>(accl_view, lower, herm, opA, opB, n, K, alpha, A,
+                          aOffset, lda, B, bOffset, ldb, beta, betaZero, C,
+                          cOffset, ldc, batchSize);
+  if (n <= NB) return HCBLAS_SUCCEEDS;
+  const bool conjA = opA == ConjTrans;
+  const bool conjB = opB == ConjTrans;
+  if (!conjA && !conjB) {
+    return triangle_offdiag<T>(gemm, lower, opA, opB, n, K, alpha, A, aOffset,
+                               lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+  }
+
+  // Conjugated operands reach GEMM as transposes of conjugated copies of one
+  // K panel, the panels after the first accumulating into C
+  const int kp = triangle_kpanel(n, K, conjA + conjB);
+  const __int64_t size = static_cast<__int64_t>(n) * kp;
+  TriangleScratch<T> copyA(scratch, accl_view, conjA ? size : 0, batchSize);
+  TriangleScratch<T> copyB(scratch, accl_view, conjB ? size : 0, batchSize);
+  const P packedA = conjA ? copyA.data(A) : A;
+  const P packedB = conjB ? copyB.data(B) : B;
+  if (packedA == NULL || packedB == NULL) return HCBLAS_INVALID;
+  const T one = Level3Scalar<T>::real(1.0);
+  hcblasStatus status = HCBLAS_SUCCEEDS;
+  for (int k0 = 0; k0 < K && status == HCBLAS_SUCCEEDS; k0 += kp) {
+    const int kb = K - k0 < kp ? K - k0 : kp;
+    // op(A) is n x K: stored K x n unless NoTrans
+    P a = A;
+    __int64_t aOff = aOffset + (opA == NoTrans ? k0 * lda : k0);
+    __int64_t aLd = lda;
+    if (conjA) {
+      triangle_conj_copy_launch<T>(accl_view, A, aOff, lda, kb, n,
+                                   copyA.buffer, size, batchSize);
+      a = packedA;
+      aOff = 0;
+      aLd = kb;
+    }
+    // op(B) is K x n: stored n x K unless NoTrans
+    P b = B;
+    __int64_t bOff = bOffset + (opB == NoTrans ? k0 : k0 * ldb);
+    __int64_t bLd = ldb;
+    if (conjB) {
+      triangle_conj_copy_launch<T>(accl_view, B, bOff, ldb, n, kb,
+                                   copyB.buffer, size, batchSize);
+      b = packedB;
+      bOff = 0;
+      bLd = n;
+    }
+    status = triangle_offdiag<T>(gemm, lower, conjA ? Trans : opA,
+                                 conjB ? Trans : opB, n, kb, alpha, a, aOff,
+                                 aLd, b, bOff, bLd, k0 == 0 ? beta : one, C,
+                                 cOffset, ldc);
+  }
+  return status;
+}
+
+// Packs the operands of a rank-2k update as P = [op(A) op(B)] and
+// Q = [alpha * op(B)  alpha2 * op(A)], both n x 2K at P and P + 2 * size of
+// entry e at out + 4 * e * size, so that P * Q^T is the whole update; for
+// herm op is ^H and Q holds conj(op(.)), making P * Q^T = alpha * op(A) *
+// op(B)^H + conj(alpha) * op(B) * op(A)^H
+template <typename T, typename P>
+void triangle_pack2k_launch(hc::accelerator_view accl_view, bool trans,
+                            bool herm, int n, int K, T alpha, T alpha2, P A,
+                            __int64_t aOffset, __int64_t lda, P B,
+                            __int64_t bOffset, __int64_t ldb, T *out,
+                            __int64_t size, int batchSize) {
+  const bool conjOp = herm && trans;
+  hc::extent<3> grdExt(batchSize, (K + 15) & ~15, (n + 15) & ~15);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, 16, 16);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    const int k = tidx.global[1];
+    const int i = tidx.global[2];
+    if (i < n && k < K) {
+      const T *a = level3_entry(A, tidx.tile[0]) + aOffset;
+      const T *b = level3_entry(B, tidx.tile[0]) + bOffset;
+      T *p = out + tidx.tile[0] * 4 * size;
+      T *q = p + 2 * size;
+      T x = trans ? a[k + i * lda] : a[i + k * lda];
+      T y = trans ? b[k + i * ldb] : b[i + k * ldb];
+      if (conjOp) {
+        x = level3_conj(x);
+        y = level3_conj(y);
+      }
+      p[i + k * n] = x;
+      p[i + (K + k) * n] = y;
+      q[i + k * n] = level3_mul(alpha, herm ? level3_conj(y) : y);
+      q[i + (K + k) * n] = level3_mul(alpha2, herm ? level3_conj(x) : x);
+    }
+  });
+}
+
+// C = alpha * op(A) * op(B)^T + alpha * op(B) * op(A)^T + beta * C on one
+// triangle, ^H and conj(alpha) on the second product when herm. Both
+// products run as one rank-2K triangle update of the operands packed a K
+// panel at a time, within TRIANGLE_PACK elements per entry, so C is read and
+// written once per panel; HCBLAS_INVALID when the pack cannot be leased.
+template <typename T, typename P, typename Gemm>
+hcblasStatus triangle_update2k(hc::accelerator_view accl_view,
+                               ScratchPool *scratch, Gemm gemm, bool lower,
+                               bool herm, bool trans, int n, int K, T alpha,
+                               P A, __int64_t aOffset, __int64_t lda, P B,
+                               __int64_t bOffset, __int64_t ldb, T beta, P C,
+                               __int64_t cOffset, __int64_t ldc,
+                               int batchSize) {
+  const T one = Level3Scalar<T>::real(1.0);
+  if (K == 0 || level3_is_zero(alpha)) {
+    return triangle_update<T>(accl_view, scratch, gemm, lower, herm, NoTrans,
+                              Trans, n, 0, one, C, cOffset, ldc, C, cOffset,
+                              ldc, beta, C, cOffset, ldc, batchSize);
+  }
+  // P and Q take 4 * kp columns of n elements per entry
+  const int kp = triangle_kpanel(n, K, 4);
+  const __int64_t size = static_cast<__int64_t>(n) * kp;
+  TriangleScratch<T> pack(scratch, accl_view, 4 * size, batchSize);
+  const P packed = pack.data(A);
+  if (packed == NULL) return HCBLAS_INVALID;
+  const T alpha2 = herm ? level3_conj(alpha) : alpha;
+  hcblasStatus status = HCBLAS_SUCCEEDS;
+  for (int k0 = 0; k0 < K && status == HCBLAS_SUCCEEDS; k0 += kp) {
+    const int kb = K - k0 < kp ? K - k0 : kp;
+    // op(A) and op(B) are n x K: stored K x n when trans
+    triangle_pack2k_launch<T>(accl_view, trans, herm, n, kb, alpha, alpha2, A,
+                              aOffset + (trans ? k0 : k0 * lda), lda, B,
+                              bOffset + (trans ? k0 : k0 * ldb), ldb,
+                              pack.buffer, size, batchSize);
+    status = triangle_update<T>(accl_view, scratch, gemm, lower, herm, NoTrans,
+                                Trans, n, 2 * kb, one, packed, 0, n, packed,
+                                2 * size, n, k0 == 0 ? beta : one, C, cOffset,
+                                ldc, batchSize);
+  }
+  return status;
+}
+
+#endif  // LIB_SRC_BLAS_LEVEL3_LEVEL3_TRIANGLE_H_
@@ -0,0 +1,195 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Single-launch reductions on the device. Every work-group folds a grid
+* stride of its vector into a tile_static tree and stores one partial; the
+* work-group that arrives last at a per entry counter adds the partials up
+* and stores the sum, so no second launch, copy or host pass is needed.
+* The number of work-groups per entry is capped, which keeps that final
+* tree a few loads per work-item for any n.
+*
+* The element operation is a functor: op(elt, i) returns element i of batch
+* entry elt in the accumulator type, and the elements are summed. CPU
+* handles run the same two stages through host_reduce in
+* src/blas/host/host_reduce.h.
+*/
+
+#ifndef LIB_SRC_BLAS_REDUCE_REDUCE_ENGINE_H_
+#define LIB_SRC_BLAS_REDUCE_REDUCE_ENGINE_H_
+
+#include <hc.hpp>
+#include "src/blas/scratch/scratch_pool.h"
+
+// Work-items per work-group
+#define REDUCE_TILE 256
+// Work-groups per batch entry at most
+#define REDUCE_MAX_GROUPS 1024
+
+// Vector of batch entry elt: strided batches start batch elements apart,
+// pointer arrays hold one vector per entry
+template <typename T>
+inline const T *reduce_entry(const T *x, __int64_t batch, int elt)
+    [[hc, cpu]] {
+  return x + batch * elt;
+}
+template <typename T>
+inline const T *reduce_entry(const T *const *x, __int64_t, int elt)
+    [[hc, cpu]] {
+  return x[elt];
+}
+
+// x . y; P is const T * or const T *const *
+template <typename T, typename P = const T *>
+struct ReduceDot {
+  P x;
+  __int64_t xOffset;
+  __int64_t incx;
+  __int64_t xBatch;
+  P y;
+  __int64_t yOffset;
+  __int64_t incy;
+  __int64_t yBatch;
+
+  T operator()(int elt, __int64_t i) const [[hc, cpu]] {
+    return reduce_entry(x, xBatch, elt)[xOffset + i * incx] *
+           reduce_entry(y, yBatch, elt)[yOffset + i * incy];
+  }
+};
+
+// sum |x[i]|
+template <typename T, typename P = const T *>
+struct ReduceAsum {
+  P x;
+  __int64_t xOffset;
+  __int64_t incx;
+  __int64_t xBatch;
+
+  T operator()(int elt, __int64_t i) const [[hc, cpu]] {
+    const T v = reduce_entry(x, xBatch, elt)[xOffset + i * incx];
+    return v < 0 ? -v : v;
+  }
+};
+
+// The entries of op, n elements each, read as one vector; for the batched
+// calls that report a single total
+template <typename Acc, typename Op>
+struct ReduceJoined {
+  Op op;
+  __int64_t n;
+
+  Acc operator()(int, __int64_t i) const [[hc, cpu]] {
+    return op(static_cast<int>(i / n), i % n);
+  }
+};
+
+// Work-groups that reduce one entry of n elements
+inline int reduce_groups(__int64_t n) {
+  const __int64_t tiles = (n + REDUCE_TILE - 1) / REDUCE_TILE;
+  if (tiles < 1) return 1;
+  return static_cast<int>(tiles < REDUCE_MAX_GROUPS ? tiles
+                                                    : REDUCE_MAX_GROUPS);
+}
+
+// Workspace bytes reduce_device carves for entries sums of n elements: the
+// partials and sums, then the arrival counters
+template <typename Acc>
+inline size_t reduce_workspace_bytes(__int64_t n, int entries) {
+  const size_t sums = static_cast<size_t>(entries) * (reduce_groups(n) + 1);
+  return ScratchPool::workspaceBytes(sizeof(Acc) * sums) +
+         ScratchPool::workspaceBytes(sizeof(unsigned int) * entries);
+}
+
+// Tree sum of value over the work-group; sums holds REDUCE_TILE elements
+template <typename Acc>
+Acc reduce_tile_sum(const hc::tile_barrier &barrier, Acc *sums, int local,
+                    Acc value) [[hc]] {
+  sums[local] = value;
+  barrier.wait_with_tile_static_memory_fence();
+  for (int s = REDUCE_TILE / 2; s > 0; s /= 2) {
+    if (local < s) sums[local] += sums[local + s];
+    barrier.wait_with_tile_static_memory_fence();
+  }
+  return sums[0];
+}
+
+// Sum over i in [0, n) of op(elt, i) for every elt in [0, entries), stored
+// to devResult[elt] in device memory, or copied to hostResult[elt] when
+// devResult is NULL. Sums of n <= 0 elements are 0. Returns false, with
+// nothing launched, when the partials or counters cannot be leased.
+template <typename Acc, typename Op>
+bool reduce_device(hc::accelerator_view accl_view, ScratchPool *scratch,
+                   __int64_t n, int entries, const Op &op, Acc *devResult,
+                   Acc *hostResult) {
+  const int groups = reduce_groups(n);
+  const __int64_t stride = static_cast<__int64_t>(groups) * REDUCE_TILE;
+  // Partials of every entry, then the sums when they go to the host
+  ScratchDevice<Acc> dev_scratch(scratch, accl_view,
+                                 entries * (groups + 1));
+  Acc *partials = dev_scratch.data();
+  Acc *result = devResult != NULL ? devResult : partials + entries * groups;
+  ScratchCounters counters(scratch, accl_view, entries);
+  unsigned int *arrived = counters.data();
+  if (partials == NULL || arrived == NULL) return false;
+
+  hc::extent<2> extent(entries, groups * REDUCE_TILE);
+  hc::parallel_for_each(
+      accl_view, extent.tile(1, REDUCE_TILE),
+      [=](hc::tiled_index<2> tid)[[hc]] {
+        tile_static Acc sums[REDUCE_TILE];
+        tile_static bool last;
+        const int elt = tid.tile[0];
+        const int local = tid.local[1];
+        Acc sum = 0;
+        for (__int64_t i = tid.global[1]; i < n; i += stride) {
+          sum += op(elt, i);
+        }
+        sum = reduce_tile_sum(tid.barrier, sums, local, sum);
+        if (local == 0) partials[elt * groups + tid.tile[1]] = sum;
+        // The partial is visible device wide before the group arrives
+        tid.barrier.wait_with_global_memory_fence();
+        if (local == 0) {
+          last = hc::atomic_fetch_add(&arrived[elt], 1u) ==
+                 static_cast<unsigned int>(groups - 1);
+        }
+        tid.barrier.wait_with_all_memory_fence();
+        if (!last) return;
+
+        // Last work-group of the entry: every partial is in place
+        Acc total = 0;
+        for (int g = local; g < groups; g += REDUCE_TILE) {
+          total += partials[elt * groups + g];
+        }
+        total = reduce_tile_sum(tid.barrier, sums, local, total);
+        if (local == 0) {
+          result[elt] = total;
+          arrived[elt] = 0;
+        }
+      });
+
+  if (devResult == NULL) {
+    accl_view.copy(result, hostResult, sizeof(Acc) * entries);
+  }
+  return true;
+}
+
+#endif  // LIB_SRC_BLAS_REDUCE_REDUCE_ENGINE_H_
@@ -21,243 +21,43 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/reduce/reduce_engine.h"
+#include "src/blas/scratch/scratch_pool.h"
 #include <hc.hpp>
 #include <hc_am.hpp>
 #include <hc_math.hpp>
 
-#define TILE_SIZE 256
-
-void sasum_HC(hc::accelerator_view accl_view, __int64_t n, float *xView,
-              __int64_t incx, __int64_t xOffset, float *Y) {
-  *Y = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
-  // simultaneous live threads
-  const unsigned int thread_count = tile_count * TILE_SIZE;
-  // global buffer (return type)
-  hc::accelerator accl = accl_view.get_accelerator();
-  float *dev_global_buffer =
-      (float *)hc::am_alloc(sizeof(float) * tile_count, accl, 0);
-  // configuration
-  hc::extent<1> extent(thread_count);
-  hc::parallel_for_each(
-      accl_view, extent.tile(TILE_SIZE), [=](hc::tiled_index<1> tid)[[hc]] {
-        // shared tile buffer
-        tile_static float local_buffer[TILE_SIZE];
-        // indexes
-        int idx = tid.global[0];
-        // this threads's shared memory pointer
-        float &smem = local_buffer[tid.local[0]];
-        // initialize local buffer
-        smem = 0.0f;
-
-        // fold data into local buffer
-        while (idx < n) {
-          // reduction of smem and X[idx] with results stored in smem
-          smem += hc::fast_math::fabsf(xView[xOffset + hc::index<1>(idx)[0]]);
-          // next chunk
-          idx += thread_count;
-        }
-
-        // synchronize
-        tid.barrier.wait_with_tile_static_memory_fence();
-        // reduce all values in this tile
-        unsigned int local = tid.local[0];
-        float *mem = &smem;
-
-        // unrolled for performance
-        if (local < 128) {
-          mem[0] = mem[0] + mem[128];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 64) {
-          mem[0] = mem[0] + mem[64];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 32) {
-          mem[0] = mem[0] + mem[32];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 16) {
-          mem[0] = mem[0] + mem[16];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 8) {
-          mem[0] = mem[0] + mem[8];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 4) {
-          mem[0] = mem[0] + mem[4];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 2) {
-          mem[0] = mem[0] + mem[2];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 1) {
-          mem[0] = mem[0] + mem[1];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        // only 1 thread per tile does the inter tile communication
-        if (tid.local[0] == 0) {
-          // write to global buffer in this tiles
-          dev_global_buffer[tid.tile[0]] = smem;
-        }
-      }) ;
-
-  // create host buffer
-  float *host_global_buffer =
-      reinterpret_cast<float *>(malloc(sizeof(float) * tile_count));
-  // Copy device contents back to host
-  accl_view.copy(dev_global_buffer, host_global_buffer,
-                 sizeof(float) * tile_count);
-
-  // 2nd pass reduction
-  for (int i = 0; i < tile_count; i++) {
-    *Y = (hc::fast_math::isnan(static_cast<float>(*Y)) ||
-          hc::fast_math::isinf(static_cast<float>(*Y)))
-             ? 0
-             : *Y;
-    *Y += host_global_buffer[i];
-  }
-
-  // free up resources
-  free(host_global_buffer);
-  hc::am_free(dev_global_buffer);
+// SASUM of n elements into Y, device memory when devY is set and
+// host memory otherwise; false when the scratch cannot be leased
+bool sasum_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+              __int64_t n, float *xView, __int64_t incx, __int64_t xOffset,
+              float *Y, bool devY) {
+  ReduceAsum<float> op = {xView, xOffset, incx, 0};
+  return reduce_device(accl_view, scratch, n, 1, op, devY ? Y : NULL, Y);
 }
 
-void sasum_HC(hc::accelerator_view accl_view, __int64_t n, float *xView,
-              __int64_t incx, __int64_t xOffset, float *Y,
-              __int64_t X_batchOffset, int batchSize) {
-  *Y = 0.0;
-  // runtime sizes
-  unsigned int tile_count = (n + TILE_SIZE - 1) / TILE_SIZE;
-  // simultaneous live threads
-  const unsigned int thread_count = tile_count * TILE_SIZE;
-  // global buffer (return type)
-  hc::accelerator accl = accl_view.get_accelerator();
-  float *dev_global_buffer =
-      (float *)hc::am_alloc(sizeof(float) * batchSize * tile_count, accl, 0);
-  // configuration
-  hc::extent<2> extent(batchSize, thread_count);
-  hc::parallel_for_each(
-      accl_view, extent.tile(1, TILE_SIZE), [=](hc::tiled_index<2> tid)[[hc]] {
-        // shared tile buffer
-        tile_static float local_buffer[TILE_SIZE];
-        // indexes
-        int elt = tid.tile[0];
-        int idx = tid.global[1];
-        // this threads's shared memory pointer
-        float &smem = local_buffer[tid.local[1]];
-        // initialize local buffer
-        smem = 0.0f;
-
-        // fold data into local buffer
-        while (idx < n) {
-          // reduction of smem and X[idx] with results stored in smem
-          smem += hc::fast_math::fabsf(
-              xView[xOffset + X_batchOffset * elt + hc::index<1>(idx)[0]]);
-          // next chunk
-          idx += thread_count;
-        }
-
-        // synchronize
-        tid.barrier.wait_with_tile_static_memory_fence();
-        // reduce all values in this tile
-        unsigned int local = tid.local[1];
-        float *mem = &smem;
-
-        // unrolled for performance
-        if (local < 128) {
-          mem[0] = mem[0] + mem[128];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 64) {
-          mem[0] = mem[0] + mem[64];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 32) {
-          mem[0] = mem[0] + mem[32];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 16) {
-          mem[0] = mem[0] + mem[16];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 8) {
-          mem[0] = mem[0] + mem[8];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 4) {
-          mem[0] = mem[0] + mem[4];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 2) {
-          mem[0] = mem[0] + mem[2];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        if (local < 1) {
-          mem[0] = mem[0] + mem[1];
-        }
-
-        tid.barrier.wait_with_tile_static_memory_fence();
-
-        // only 1 thread per tile does the inter tile communication
-        if (tid.local[1] == 0) {
-          // write to global buffer in this tiles
-          dev_global_buffer[elt * tile_count + tid.tile[1]] = smem;
-        }
-      }) ;
-
-  // create host buffer
-  float *host_global_buffer =
-      reinterpret_cast<float *>(malloc(sizeof(float) * batchSize * tile_count));
-  // Copy device contents back to host
-  accl_view.copy(dev_global_buffer, host_global_buffer,
-                 sizeof(float) * batchSize * tile_count);
-
-  // 2nd pass reduction
-  for (int i = 0; i < tile_count * batchSize; i++) {
-    *Y = (hc::fast_math::isnan(static_cast<float>(*Y)) ||
-          hc::fast_math::isinf(static_cast<float>(*Y)))
-             ? 0
-             : *Y;
-    *Y += host_global_buffer[i];
-  }
+// Batched form: the total over all batchSize entries
+bool sasum_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+              __int64_t n, float *xView, __int64_t incx, __int64_t xOffset,
+              float *Y, __int64_t X_batchOffset, int batchSize, bool devY) {
+  ReduceAsum<float> op = {xView, xOffset, incx, X_batchOffset};
+  ReduceJoined<float, ReduceAsum<float>> joined = {op, n};
+  return reduce_device(accl_view, scratch, n * batchSize, 1, joined,
+                       devY ? Y : NULL, Y);
+}
 
-  // free up resources
-  free(host_global_buffer);
-  hc::am_free(dev_global_buffer);
+// Batched form with one result per entry, stored to Y in device memory
+// when devY is set and in host memory otherwise. P is const float * for
+// strided batches and const float *const * for pointer arrays.
+template <typename P>
+bool sasum_batched_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+                      __int64_t n, P xView, __int64_t incx, __int64_t xOffset,
+                      float *Y, __int64_t X_batchOffset, int batchSize,
+                      bool devY) {
+  ReduceAsum<float, P> op = {xView, xOffset, incx, X_batchOffset};
+  return reduce_device(accl_view, scratch, n, batchSize, op, devY ? Y : NULL,
+                       Y);
 }
 
 // SASUM Call Type I: Inputs and outputs are HCC float array containers
@@ -269,7 +69,16 @@ hcblasStatus Hcblaslibrary::hcblas_sasum(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  sasum_HC(accl_view, N, X, incX, xOffset, Y);
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    *Y = host_asum<float>(N, X + xOffset, incX);
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!sasum_HC(accl_view, scratch, N, X, incX, xOffset, Y,
+                pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
   return HCBLAS_SUCCEEDS;
 }
 
@@ -285,7 +94,70 @@ hcblasStatus Hcblaslibrary::hcblas_sasum(hc::accelerator_view accl_view,
     return HCBLAS_INVALID;
   }
 
-  sasum_HC(accl_view, N, X, incX, xOffset, Y, X_batchOffset, batchSize);
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    std::vector<float> sums(batchSize);
+    host_asum_batched<float>(N, X + xOffset, incX, X_batchOffset, batchSize,
+                             sums.data());
+    // The batched form reports one total over all entries
+    *Y = 0;
+    for (int i = 0; i < batchSize; i++) *Y += sums[i];
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!sasum_HC(accl_view, scratch, N, X, incX, xOffset, Y, X_batchOffset,
+                batchSize, pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
+  return HCBLAS_SUCCEEDS;
+}
+
+// SASUM_BATCHED Type I - One result per batch entry, Y[0 .. batchSize - 1]
+// in memory of pointerMode
+hcblasStatus Hcblaslibrary::hcblas_sasum_batched(
+    hc::accelerator_view accl_view, const int N, const float *X, const int incX,
+    const __int64_t xOffset, float *Y, const __int64_t X_batchOffset,
+    const int batchSize) {
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || batchSize < 0) {
+    return HCBLAS_INVALID;
+  }
+  if (batchSize == 0) return HCBLAS_SUCCEEDS;
+
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    host_asum_batched<float>(N, X + xOffset, incX, X_batchOffset, batchSize, Y);
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!sasum_batched_HC(accl_view, scratch, N, X, incX, xOffset, Y,
+                        X_batchOffset, batchSize,
+                        pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
   return HCBLAS_SUCCEEDS;
 }
 
+// SASUM_BATCHED Type II - Pointer arrays: entry i is X[i], the array in
+// device memory
+hcblasStatus Hcblaslibrary::hcblas_sasum_batched(
+    hc::accelerator_view accl_view, const int N, const float *const X[],
+    const int incX, const __int64_t xOffset, float *Y, const int batchSize) {
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || batchSize < 0) {
+    return HCBLAS_INVALID;
+  }
+  if (batchSize == 0) return HCBLAS_SUCCEEDS;
+
+  // CPU accelerator: the array is host memory too
+  if (hostExecution) {
+    for (int i = 0; i < batchSize; i++) {
+      Y[i] = host_asum<float>(N, X[i] + xOffset, incX);
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  if (!sasum_batched_HC(accl_view, scratch, N, X, incX, xOffset, Y, 0,
+                        batchSize, pointerMode == DevicePointer)) {
+    return HCBLAS_INVALID;
+  }
+  return HCBLAS_SUCCEEDS;
+}
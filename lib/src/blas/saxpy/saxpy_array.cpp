@@ -21,19 +21,37 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/tunedb/tuning_db.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
 #define BLOCK_SIZE 256
 
-void axpy_HC(hc::accelerator_view accl_view, __int64_t n, float alpha,
-             const float *X, __int64_t xOffset, __int64_t incx, float *Y,
-             __int64_t yOffset, __int64_t incy) {
-  if (n <= 102400) {
+// Elements each work-item updates: 1 up to saxpy.flat_max, then 3, 5, 7
+// and 15 past the step thresholds. The defaults can be replaced by a tuning
+// database (src/blas/tunedb).
+static int axpy_step(const TuningDb *db, __int64_t n) {
+  if (n <= tuning_db_threshold(db, "saxpy.flat_max", 102400)) return 1;
+  if (n <= tuning_db_threshold(db, "saxpy.step3_max", 409600)) return 3;
+  if (n <= tuning_db_threshold(db, "saxpy.step5_max", 921600)) return 5;
+  if (n <= tuning_db_threshold(db, "saxpy.step7_max", 1939526)) return 7;
+  return 15;
+}
+
+// alphaPtr, when not NULL, is alpha in device memory (DevicePointer mode)
+// and is read by the kernel in place of alphaValue
+void axpy_HC(hc::accelerator_view accl_view, const TuningDb *db, __int64_t n,
+             float alphaValue, const float *alphaPtr, const float *X,
+             __int64_t xOffset, __int64_t incx,
+             float *Y, __int64_t yOffset, __int64_t incy) {
+  const int step_sz = axpy_step(db, n);
+  if (step_sz == 1) {
     __int64_t size = (n + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
     hc::extent<1> compute_domain(size);
     hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
     ](hc::tiled_index<1> tidx)[[hc]] {
+      const float alpha = alphaPtr != NULL ? *alphaPtr : alphaValue;
       if (tidx.global[0] < n) {
         __int64_t Y_index = yOffset + tidx.global[0];
         Y[Y_index] = (hc::fast_math::isnan(static_cast<float>(Y[Y_index])) ||
@@ -44,23 +62,12 @@ void axpy_HC(hc::accelerator_view accl_view, __int64_t n, float alpha,
       }
     }) ;
   } else {
-    int step_sz;
-
-    if (n <= 409600) {
-      step_sz = 3;
-    } else if (n <= 921600) {
-      step_sz = 5;
-    } else if (n <= 1939526) {
-      step_sz = 7;
-    } else {
-      step_sz = 15;
-    }
-
     __int64_t size = (n / step_sz + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
     __int64_t nBlocks = size / BLOCK_SIZE;
     hc::extent<1> compute_domain(size);
     hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
     ](hc::tiled_index<1> tidx)[[hc]] {
+      const float alpha = alphaPtr != NULL ? *alphaPtr : alphaValue;
       if (tidx.tile[0] != nBlocks - 1) {
         for (int iter = 0; iter < step_sz; iter++) {
           __int64_t Y_index = yOffset + tidx.tile[0] * 256 * step_sz +
@@ -96,15 +103,19 @@ void axpy_HC(hc::accelerator_view accl_view, __int64_t n, float alpha,
   }
 }
 
-void axpy_HC(hc::accelerator_view accl_view, __int64_t n, float alpha,
-             const float *X, __int64_t xOffset, __int64_t incx, float *Y,
-             __int64_t yOffset, __int64_t incy, __int64_t X_batchOffset,
-             __int64_t Y_batchOffset, int batchSize) {
-  if (n <= 102400) {
+void axpy_HC(hc::accelerator_view accl_view, const TuningDb *db, __int64_t n,
+             float alphaValue, const float *alphaPtr, const float *X,
+             __int64_t xOffset, __int64_t incx,
+             float *Y, __int64_t yOffset, __int64_t incy,
+             __int64_t X_batchOffset, __int64_t Y_batchOffset,
+             int batchSize) {
+  const int step_sz = axpy_step(db, n);
+  if (step_sz == 1) {
     __int64_t size = (n + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
     hc::extent<2> compute_domain(batchSize, size);
     hc::parallel_for_each(accl_view, compute_domain.tile(1, BLOCK_SIZE), [=
     ](hc::tiled_index<2> tidx)[[hc]] {
+      const float alpha = alphaPtr != NULL ? *alphaPtr : alphaValue;
       int elt = tidx.tile[0];
 
       if (tidx.global[1] < n) {
@@ -117,23 +128,12 @@ void axpy_HC(hc::accelerator_view accl_view, __int64_t n, float alpha,
       }
     }) ;
   } else {
-    int step_sz;
-
-    if (n <= 409600) {
-      step_sz = 3;
-    } else if (n <= 921600) {
-      step_sz = 5;
-    } else if (n <= 1939526) {
-      step_sz = 7;
-    } else {
-      step_sz = 15;
-    }
-
     __int64_t size = (n / step_sz + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
     __int64_t nBlocks = size / BLOCK_SIZE;
     hc::extent<2> compute_domain(batchSize, size);
     hc::parallel_for_each(accl_view, compute_domain.tile(1, BLOCK_SIZE), [=
     ](hc::tiled_index<2> tidx)[[hc]] {
+      const float alpha = alphaPtr != NULL ? *alphaPtr : alphaValue;
       int elt = tidx.tile[0];
 
       if (tidx.tile[1] != nBlocks - 1) {
@@ -191,7 +191,14 @@ hcblasStatus Hcblaslibrary::hcblas_saxpy(hc::accelerator_view accl_view,
     return HCBLAS_SUCCEEDS;
   }
 
-  axpy_HC(accl_view, N, alpha, X, xOffset, incX, Y, yOffset, incY);
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    host_axpy<float>(N, alpha, X + xOffset, incX, Y + yOffset, incY);
+    return HCBLAS_SUCCEEDS;
+  }
+
+  axpy_HC(accl_view, tuningDb, N, alpha, NULL, X, xOffset, incX, Y, yOffset,
+          incY);
   return HCBLAS_SUCCEEDS;
 }
 
@@ -211,8 +218,61 @@ hcblasStatus Hcblaslibrary::hcblas_saxpy(
     return HCBLAS_SUCCEEDS;
   }
 
-  axpy_HC(accl_view, N, alpha, X, xOffset, incX, Y, yOffset, incY,
-          X_batchOffset, Y_batchOffset, batchSize);
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    host_axpy_batched<float>(N, alpha, X + xOffset, incX, X_batchOffset,
+                             Y + yOffset, incY, Y_batchOffset, batchSize);
+    return HCBLAS_SUCCEEDS;
+  }
+
+  axpy_HC(accl_view, tuningDb, N, alpha, NULL, X, xOffset, incX, Y, yOffset,
+          incY, X_batchOffset, Y_batchOffset, batchSize);
+  return HCBLAS_SUCCEEDS;
+}
+
+/* SAXPY - Type III : alpha in memory of pointerMode */
+hcblasStatus Hcblaslibrary::hcblas_saxpy(hc::accelerator_view accl_view,
+                                         const int N, const float *alpha,
+                                         const float *X, const int incX,
+                                         float *Y, const int incY,
+                                         const __int64_t xOffset,
+                                         const __int64_t yOffset) {
+  if (alpha == NULL) {
+    return HCBLAS_INVALID;
+  }
+  // Host pointers, or the CPU accelerator whose device memory is host memory
+  if (pointerMode == HostPointer || hostExecution) {
+    return hcblas_saxpy(accl_view, N, *alpha, X, incX, Y, incY, xOffset,
+                        yOffset);
+  }
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  // alpha is not known here, so alpha = 0 runs the kernel too
+  axpy_HC(accl_view, tuningDb, N, 0, alpha, X, xOffset, incX, Y, yOffset,
+          incY);
   return HCBLAS_SUCCEEDS;
 }
 
+/* SAXPY - Type IV : batch processing with alpha in memory of pointerMode */
+hcblasStatus Hcblaslibrary::hcblas_saxpy(
+    hc::accelerator_view accl_view, const int N, const float *alpha,
+    const float *X, const int incX, const __int64_t X_batchOffset, float *Y,
+    const int incY, const __int64_t Y_batchOffset, const __int64_t xOffset,
+    const __int64_t yOffset, const int batchSize) {
+  if (alpha == NULL) {
+    return HCBLAS_INVALID;
+  }
+  if (pointerMode == HostPointer || hostExecution) {
+    return hcblas_saxpy(accl_view, N, *alpha, X, incX, X_batchOffset, Y, incY,
+                        Y_batchOffset, xOffset, yOffset, batchSize);
+  }
+  if (X == NULL || Y == NULL || N <= 0 || incX <= 0 || incY <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  axpy_HC(accl_view, tuningDb, N, 0, alpha, X, xOffset, incX, Y, yOffset,
+          incY, X_batchOffset, Y_batchOffset, batchSize);
+  return HCBLAS_SUCCEEDS;
+}
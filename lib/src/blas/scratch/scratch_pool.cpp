@@ -0,0 +1,288 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "./scratch_pool.h"
+#include "include/hcblaslib.h"
+#include <hc_am.hpp>
+#include <cstdlib>
+#include <vector>
+
+ScratchPool *scratch_pool_create() { return new ScratchPool(); }
+
+void scratch_pool_release(ScratchPool *pool) { delete pool; }
+
+void ScratchPool::Usage::lease(size_t bytes) {
+  leased += bytes;
+  if (leased > highWater) highWater = leased;
+}
+
+ScratchPool::~ScratchPool() {
+  for (auto &blocks : deviceFree) {
+    for (DeviceBlock &block : blocks) {
+      block.view.wait();
+      hc::am_free(block.ptr);
+    }
+  }
+  for (auto &blocks : counterFree) {
+    for (DeviceBlock &block : blocks) {
+      block.view.wait();
+      hc::am_free(block.ptr);
+    }
+  }
+  for (auto &blocks : hostFree) {
+    for (void *ptr : blocks) free(ptr);
+  }
+}
+
+int ScratchPool::sizeClass(size_t bytes) {
+  int cls = SCRATCH_MIN_CLASS;
+  while (classBytes(cls) < bytes) cls++;
+  return cls;
+}
+
+void *ScratchPool::acquireDevice(hc::accelerator_view accl_view,
+                                 size_t bytes) {
+  const int cls = sizeClass(bytes);
+  std::unique_lock<std::mutex> guard(lock);
+  if (workspace != NULL) return carve(&guard, accl_view, bytes);
+  DeviceBlock block = {NULL, accl_view};
+  if (take(deviceFree, cls, accl_view, &block)) {
+    device.lease(classBytes(cls));
+    guard.unlock();
+    if (!(block.view == accl_view)) block.view.wait();
+    return block.ptr;
+  }
+  guard.unlock();
+  void *ptr = hc::am_alloc(classBytes(cls), accl_view.get_accelerator(), 0);
+  if (ptr == NULL) return NULL;
+  guard.lock();
+  device.reserved += classBytes(cls);
+  device.lease(classBytes(cls));
+  return ptr;
+}
+
+void ScratchPool::releaseDevice(hc::accelerator_view accl_view, void *ptr,
+                                size_t bytes) {
+  const int cls = sizeClass(bytes);
+  std::unique_lock<std::mutex> guard(lock);
+  if (releaseCarved(&guard, accl_view, ptr)) return;
+  if (cls >= static_cast<int>(deviceFree.size())) deviceFree.resize(cls + 1);
+  deviceFree[cls].push_back(DeviceBlock{ptr, accl_view});
+  device.leased -= classBytes(cls);
+}
+
+bool ScratchPool::releaseCarved(std::unique_lock<std::mutex> *guard,
+                                hc::accelerator_view accl_view, void *ptr) {
+  for (size_t i = 0; i < carved.size(); i++) {
+    if (carved[i].ptr != ptr) continue;
+    const WorkspaceLease lease = carved[i];
+    carved.erase(carved.begin() + i);
+    device.leased -= lease.bytes;
+    if (lease.offset < 0) {
+      device.reserved -= lease.bytes;
+      guard->unlock();
+      accl_view.wait();
+      hc::am_free(ptr);
+    }
+    return true;
+  }
+  return false;
+}
+
+bool ScratchPool::take(std::vector<std::vector<DeviceBlock>> &blocks, int cls,
+                       hc::accelerator_view accl_view, DeviceBlock *block) {
+  if (cls >= static_cast<int>(blocks.size())) return false;
+  std::vector<DeviceBlock> &sized = blocks[cls];
+  const hc::accelerator accl = accl_view.get_accelerator();
+  // Newest first: it is the most likely to be on this view already
+  for (size_t i = sized.size(); i-- > 0;) {
+    if (sized[i].view.get_accelerator() != accl) continue;
+    *block = sized[i];
+    sized.erase(sized.begin() + i);
+    return true;
+  }
+  return false;
+}
+
+unsigned int *ScratchPool::acquireCounters(hc::accelerator_view accl_view,
+                                           size_t count) {
+  const size_t bytes = sizeof(unsigned int) * count;
+  const int cls = sizeClass(bytes);
+  std::unique_lock<std::mutex> guard(lock);
+  if (workspace != NULL) {
+    unsigned int *ptr =
+        static_cast<unsigned int *>(carve(&guard, accl_view, bytes));
+    guard.unlock();
+    if (ptr == NULL) return NULL;
+    // The region holds whatever earlier leases left there; zeroed in queue
+    // order, after the work that last used it
+    const __int64_t words = count;
+    hc::extent<1> grdExt((words + 63) & ~63);
+    hc::parallel_for_each(accl_view, grdExt.tile(64),
+                          [=](hc::tiled_index<1> tidx)[[hc]] {
+                            if (tidx.global[0] < words) ptr[tidx.global[0]] = 0;
+                          });
+    return ptr;
+  }
+  DeviceBlock block = {NULL, accl_view};
+  if (take(counterFree, cls, accl_view, &block)) {
+    guard.unlock();
+    if (!(block.view == accl_view)) block.view.wait();
+    return static_cast<unsigned int *>(block.ptr);
+  }
+  guard.unlock();
+  void *ptr = hc::am_alloc(classBytes(cls), accl_view.get_accelerator(), 0);
+  if (ptr == NULL) return NULL;
+  // Zeroed once; every kernel using them leaves them zero again
+  std::vector<char> zeros(classBytes(cls), 0);
+  accl_view.copy(zeros.data(), ptr, classBytes(cls));
+  return static_cast<unsigned int *>(ptr);
+}
+
+void ScratchPool::releaseCounters(hc::accelerator_view accl_view,
+                                  unsigned int *ptr, size_t count) {
+  const int cls = sizeClass(sizeof(unsigned int) * count);
+  std::unique_lock<std::mutex> guard(lock);
+  if (releaseCarved(&guard, accl_view, ptr)) return;
+  if (cls >= static_cast<int>(counterFree.size())) {
+    counterFree.resize(cls + 1);
+  }
+  counterFree[cls].push_back(DeviceBlock{ptr, accl_view});
+}
+
+void *ScratchPool::acquireHost(size_t bytes) {
+  const int cls = sizeClass(bytes);
+  std::lock_guard<std::mutex> guard(lock);
+  if (cls < static_cast<int>(hostFree.size()) && !hostFree[cls].empty()) {
+    void *ptr = hostFree[cls].back();
+    hostFree[cls].pop_back();
+    host.lease(classBytes(cls));
+    return ptr;
+  }
+  void *ptr = malloc(classBytes(cls));
+  if (ptr == NULL) return NULL;
+  host.reserved += classBytes(cls);
+  host.lease(classBytes(cls));
+  return ptr;
+}
+
+void ScratchPool::releaseHost(void *ptr, size_t bytes) {
+  const int cls = sizeClass(bytes);
+  std::lock_guard<std::mutex> guard(lock);
+  if (cls >= static_cast<int>(hostFree.size())) hostFree.resize(cls + 1);
+  hostFree[cls].push_back(ptr);
+  host.leased -= classBytes(cls);
+}
+
+void *ScratchPool::carve(std::unique_lock<std::mutex> *guard,
+                         hc::accelerator_view accl_view, size_t bytes) {
+  const size_t need = workspaceBytes(bytes);
+  // First gap that fits, between the carved leases
+  long long offset = 0;
+  size_t at = 0;
+  for (; at < carved.size() && carved[at].offset >= 0; at++) {
+    if (offset + static_cast<long long>(need) <= carved[at].offset) break;
+    offset = carved[at].offset + static_cast<long long>(carved[at].bytes);
+  }
+  if (offset + need > workspaceSize) {
+    // Too small: memory of its own, freed again on release
+    guard->unlock();
+    void *ptr = hc::am_alloc(need, accl_view.get_accelerator(), 0);
+    guard->lock();
+    if (ptr == NULL) return NULL;
+    carved.push_back(WorkspaceLease{ptr, -1, need});
+    device.reserved += need;
+    device.lease(need);
+    return ptr;
+  }
+  carved.insert(carved.begin() + at,
+                WorkspaceLease{workspace + offset, offset, need});
+  device.lease(need);
+
+  // Work queued on other views may still use any part of the region
+  std::vector<WorkspaceView> drain;
+  bool listed = false;
+  for (size_t v = 0; v < workspaceViews.size(); v++) {
+    if (workspaceViews[v].view == accl_view) {
+      workspaceViews[v].uses++;
+      listed = true;
+    } else {
+      drain.push_back(workspaceViews[v]);
+    }
+  }
+  if (!listed) workspaceViews.push_back(WorkspaceView{accl_view, 1});
+  if (drain.empty()) return workspace + offset;
+  guard->unlock();
+  for (size_t v = 0; v < drain.size(); v++) drain[v].view.wait();
+  guard->lock();
+  // A drained view that took no lease meanwhile is idle
+  for (size_t d = 0; d < drain.size(); d++) {
+    for (size_t v = 0; v < workspaceViews.size(); v++) {
+      if (workspaceViews[v].view == drain[d].view &&
+          workspaceViews[v].uses == drain[d].uses) {
+        workspaceViews.erase(workspaceViews.begin() + v);
+        break;
+      }
+    }
+  }
+  return workspace + offset;
+}
+
+void ScratchPool::setWorkspace(hc::accelerator_view accl_view, void *ptr,
+                               size_t bytes) {
+  std::vector<hc::accelerator_view> drain;
+  std::vector<DeviceBlock> cached;
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    for (size_t v = 0; v < workspaceViews.size(); v++) {
+      drain.push_back(workspaceViews[v].view);
+    }
+    workspaceViews.clear();
+    for (auto &blocks : deviceFree) {
+      cached.insert(cached.end(), blocks.begin(), blocks.end());
+    }
+    deviceFree.clear();
+    for (auto &blocks : counterFree) {
+      cached.insert(cached.end(), blocks.begin(), blocks.end());
+    }
+    counterFree.clear();
+    device.reserved = 0;
+    workspace = static_cast<char *>(ptr);
+    workspaceSize = ptr != NULL ? bytes : 0;
+  }
+  // The old region and the cached blocks are idle once their views drain
+  for (size_t v = 0; v < drain.size(); v++) drain[v].wait();
+  for (DeviceBlock &block : cached) {
+    block.view.wait();
+    hc::am_free(block.ptr);
+  }
+  accl_view.wait();
+}
+
+size_t ScratchPool::highWater(bool onDevice) const {
+  std::lock_guard<std::mutex> guard(lock);
+  return onDevice ? device.highWater : host.highWater;
+}
+
+size_t ScratchPool::reserved(bool onDevice) const {
+  std::lock_guard<std::mutex> guard(lock);
+  return onDevice ? device.reserved : host.reserved;
+}
@@ -0,0 +1,238 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/*
+* Scratch memory owned by a handle. Routines that need temporary device or
+* host buffers (tile partial sums and the like) lease them here instead of
+* allocating on every call. Buffers come in power-of-two size classes from
+* 256 bytes up, so a workload whose sizes keep growing allocates at most one
+* new buffer per doubling; released buffers stay cached for the handle's
+* life.
+*
+* A workspace set by hcblasSetWorkspace replaces the device side: leases
+* are carved from the caller's region, first fit, and nothing is cached.
+* A lease that does not fit gets memory of its own for the call, so a
+* routine still runs, only slower.
+*
+* Leases may be taken concurrently from several threads sharing a handle.
+* A device buffer last used on another accelerator_view is handed out only
+* after that view drains, so kernels still reading it on their own queue
+* are never raced. Those waits and the allocations run with the pool
+* unlocked, so one thread's drain does not stall the others' leases.
+*
+* The single-launch reductions also lease arrival counters here: device
+* words that are zero whenever no kernel holds them. The pool caches them
+* apart from the scratch blocks and leaves them out of highWater and
+* reserved; with a workspace they are carved and counted like any lease.
+*/
+
+#ifndef LIB_SRC_BLAS_SCRATCH_SCRATCH_POOL_H_
+#define LIB_SRC_BLAS_SCRATCH_SCRATCH_POOL_H_
+
+#include <hc.hpp>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+// Smallest size class is 1 << SCRATCH_MIN_CLASS bytes
+#define SCRATCH_MIN_CLASS 8
+
+// Alignment of leases carved from a workspace
+#define SCRATCH_WORKSPACE_ALIGN 256
+
+class ScratchPool {
+ public:
+  ScratchPool() = default;
+  ScratchPool(const ScratchPool &) = delete;
+  ScratchPool &operator=(const ScratchPool &) = delete;
+  ~ScratchPool();
+
+  // At least bytes of device memory usable on accl_view's accelerator;
+  // NULL when it cannot be allocated
+  void *acquireDevice(hc::accelerator_view accl_view, size_t bytes);
+  // Returns a buffer of acquireDevice(accl_view, bytes); work queued on
+  // accl_view may still be using it
+  void releaseDevice(hc::accelerator_view accl_view, void *ptr, size_t bytes);
+
+  // count words of device memory usable on accl_view's accelerator, zero
+  // for the work queued on accl_view next; NULL when they cannot be
+  // allocated
+  unsigned int *acquireCounters(hc::accelerator_view accl_view,
+                                size_t count);
+  // Returns counters of acquireCounters(accl_view, count); the work queued
+  // on accl_view that uses them must leave them zero
+  void releaseCounters(hc::accelerator_view accl_view, unsigned int *ptr,
+                       size_t count);
+
+  void *acquireHost(size_t bytes);
+  void releaseHost(void *ptr, size_t bytes);
+
+  // Device leases come from [ptr, ptr + bytes) while ptr is not NULL and
+  // from the pool again once it is; cached pool memory is freed. No device
+  // lease may be outstanding.
+  void setWorkspace(hc::accelerator_view accl_view, void *ptr, size_t bytes);
+
+  // Most bytes leased at once, counted in whole size classes (aligned
+  // bytes for workspace leases)
+  size_t highWater(bool onDevice) const;
+  // Bytes currently allocated, leased or cached
+  size_t reserved(bool onDevice) const;
+
+  // Size class of a request and its size in bytes
+  static int sizeClass(size_t bytes);
+  static size_t classBytes(int cls) { return static_cast<size_t>(1) << cls; }
+
+  // Workspace bytes taken by a device lease of bytes
+  static size_t workspaceBytes(size_t bytes) {
+    return (bytes + SCRATCH_WORKSPACE_ALIGN - 1) /
+           SCRATCH_WORKSPACE_ALIGN * SCRATCH_WORKSPACE_ALIGN;
+  }
+
+ private:
+  struct DeviceBlock {
+    void *ptr;
+    // View whose queue last used the block
+    hc::accelerator_view view;
+  };
+
+  // A lease carved from the workspace, or allocated for one call when it
+  // did not fit (offset < 0)
+  struct WorkspaceLease {
+    void *ptr;
+    long long offset;
+    size_t bytes;
+  };
+
+  // A lease of the workspace; guard is unlocked while work on other views
+  // drains and while a transient lease is allocated, and locked on return
+  void *carve(std::unique_lock<std::mutex> *guard,
+              hc::accelerator_view accl_view, size_t bytes);
+  // Returns ptr to the workspace when it was carved; guard is unlocked
+  // before a transient lease is freed
+  bool releaseCarved(std::unique_lock<std::mutex> *guard,
+                     hc::accelerator_view accl_view, void *ptr);
+  // Moves a cached block of size class cls on accl_view's accelerator to
+  // *block; false when there is none. Work on block->view may still be
+  // using it, so the caller waits for that view once the lock is dropped.
+  static bool take(std::vector<std::vector<DeviceBlock>> &blocks, int cls,
+                   hc::accelerator_view accl_view, DeviceBlock *block);
+
+  struct Usage {
+    size_t leased = 0;
+    size_t highWater = 0;
+    size_t reserved = 0;
+
+    void lease(size_t bytes);
+  };
+
+  mutable std::mutex lock;
+  // Free blocks indexed by size class
+  std::vector<std::vector<DeviceBlock>> deviceFree;
+  std::vector<std::vector<void *>> hostFree;
+  std::vector<std::vector<DeviceBlock>> counterFree;
+  Usage device;
+  Usage host;
+
+  char *workspace = NULL;
+  size_t workspaceSize = 0;
+  // Workspace leases sorted by offset, transient ones last
+  std::vector<WorkspaceLease> carved;
+  // Views that used the workspace since it last drained, with the number
+  // of leases each took so a drain that raced a new lease keeps the view
+  struct WorkspaceView {
+    hc::accelerator_view view;
+    unsigned long long uses;
+  };
+  std::vector<WorkspaceView> workspaceViews;
+};
+
+// Device buffer of count elements leased from pool for one call; NULL when
+// count is 0
+template <typename T>
+class ScratchDevice {
+ public:
+  ScratchDevice(ScratchPool *pool, hc::accelerator_view accl_view,
+                size_t count)
+      : pool(pool), accl_view(accl_view), bytes(sizeof(T) * count) {
+    ptr = count == 0 ? NULL
+                     : static_cast<T *>(pool->acquireDevice(accl_view, bytes));
+  }
+  ScratchDevice(const ScratchDevice &) = delete;
+  ScratchDevice &operator=(const ScratchDevice &) = delete;
+  ~ScratchDevice() {
+    if (ptr != NULL) pool->releaseDevice(accl_view, ptr, bytes);
+  }
+
+  T *data() const { return ptr; }
+
+ private:
+  ScratchPool *pool;
+  hc::accelerator_view accl_view;
+  size_t bytes;
+  T *ptr;
+};
+
+// Arrival counters leased from pool for one call
+class ScratchCounters {
+ public:
+  ScratchCounters(ScratchPool *pool, hc::accelerator_view accl_view,
+                  size_t count)
+      : pool(pool), accl_view(accl_view), count(count) {
+    ptr = pool->acquireCounters(accl_view, count);
+  }
+  ScratchCounters(const ScratchCounters &) = delete;
+  ScratchCounters &operator=(const ScratchCounters &) = delete;
+  ~ScratchCounters() {
+    if (ptr != NULL) pool->releaseCounters(accl_view, ptr, count);
+  }
+
+  unsigned int *data() const { return ptr; }
+
+ private:
+  ScratchPool *pool;
+  hc::accelerator_view accl_view;
+  size_t count;
+  unsigned int *ptr;
+};
+
+// Host buffer of count elements leased from pool for one call
+template <typename T>
+class ScratchHost {
+ public:
+  ScratchHost(ScratchPool *pool, size_t count)
+      : pool(pool), bytes(sizeof(T) * count) {
+    ptr = count == 0 ? NULL : static_cast<T *>(pool->acquireHost(bytes));
+  }
+  ScratchHost(const ScratchHost &) = delete;
+  ScratchHost &operator=(const ScratchHost &) = delete;
+  ~ScratchHost() {
+    if (ptr != NULL) pool->releaseHost(ptr, bytes);
+  }
+
+  T *data() const { return ptr; }
+
+ private:
+  ScratchPool *pool;
+  size_t bytes;
+  T *ptr;
+};
+
+#endif  // LIB_SRC_BLAS_SCRATCH_SCRATCH_POOL_H_
@@ -21,6 +21,9 @@ THE SOFTWARE.
 */
 
 #include "./sgemm_array_kernels.h"
+#include "./sgemm_micro_kernels.h"
+#include "src/blas/gemmgen/gemm_tiled_kernel.h"
+#include <chrono>
 #include <hc_math.hpp>
 
 hcblasStatus gemm_NoTransAB_STEP_TS8XSS8(hc::accelerator_view accl_view,
@@ -29,81 +32,9 @@ hcblasStatus gemm_NoTransAB_STEP_TS8XSS8(hc::accelerator_view accl_view,
                                          __int64_t cOffset, int M, int N, int K,
                                          int lda, int ldb, int ldc, float alpha,
                                          float beta) {
-#define TILESIZE 8
-#define STEPSIZE 8
-  hc::extent<2> grdExt((N + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    int shiftFactor = hc::fast_math::log2f(STEPSIZE);
-    float rC[1][1];
-    float rA[1][STEPSIZE / TILESIZE];
-    float rB[1][STEPSIZE / TILESIZE];
-    tile_static float lA[TILESIZE * STEPSIZE];  // 8*8+8
-    tile_static float lB[TILESIZE * STEPSIZE];
-    rC[0][0] = 0;
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = ((K + (STEPSIZE - 1)) & ~(STEPSIZE - 1)) >> shiftFactor;
-    int i = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      // Load Sections of A and B into respective shared memory slots
-      for (int sec = 0; sec < STEPSIZE / TILESIZE; ++sec) {
-        // Load Section 'sec' from global memory B onto shared lB
-        if (gidy * TILESIZE + idyT < N &&
-            (idxT + i * STEPSIZE + (TILESIZE * sec)) < K) {
-          lB[idyT * TILESIZE + idxT + (TILESIZE * TILESIZE * sec)] =
-              B[bOffset + (gidy * TILESIZE + idyT) * ldb + idxT + i * STEPSIZE +
-                (TILESIZE * sec)];
-        } else {
-          lB[idyT * TILESIZE + idxT + (TILESIZE * TILESIZE * sec)] = 0;
-        }
-
-        // Load Section 'sec' from global memory A onto shared lA
-        if (gidx * TILESIZE + idxT < M &&
-            (i * STEPSIZE + idyT + (TILESIZE * sec)) < K) {
-          lA[idxT * TILESIZE + idyT + (TILESIZE * TILESIZE * sec)] =
-              A[aOffset + gidx * TILESIZE + idxT + idyT * lda +
-                i * (lda << shiftFactor) + (TILESIZE * sec) * lda];
-        } else {
-          lA[idxT * TILESIZE + idyT + (TILESIZE * TILESIZE * sec)] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx * TILESIZE;
-      int offB = idy * TILESIZE;
-      int offset = 1;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MS1x1(offset, offset);
-      }
-
-      i++;
-    } while (--block_k > 0);
-
-    tidx.barrier.wait();
-
-    if (gidx * TILESIZE + idx < M && gidy * TILESIZE + idy < N) {
-      __int64_t C_index =
-          cOffset + gidx * TILESIZE + idx + (gidy * TILESIZE + idy) * ldc;
-      C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
-                    hc::fast_math::isinf(static_cast<float>(C[C_index])))
-                       ? 0
-                       : C[C_index];
-      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
-    }
-  }) ;
-#undef TILESIZE
-#undef STEPSIZE
+  sgemm_NoTransAB_STEP_TS8XSS8_launch(accl_view, A, aOffset, B, bOffset, C,
+                                      cOffset, M, N, K, lda, ldb, ldc, alpha,
+                                      beta);
   return HCBLAS_SUCCEEDS;
 }
 
@@ -359,84 +290,9 @@ hcblasStatus gemm_NoTransAB_MICRO_TS16XMTS2(hc::accelerator_view accl_view,
                                             float *C, __int64_t cOffset, int M,
                                             int N, int K, int lda, int ldb,
                                             int ldc, float alpha, float beta) {
-#define TILESIZE 16
-#define MICROTILESIZE 2
-  int M_ = hc::fast_math::fmaxf(1, (M / MICROTILESIZE + 1));
-  int N_ = hc::fast_math::fmaxf(1, (N / MICROTILESIZE + 1));
-  hc::extent<2> grdExt((N_ + (TILESIZE - 1)) & ~(TILESIZE - 1),
-                       (M_ + (TILESIZE - 1)) & ~(TILESIZE - 1));
-  hc::tiled_extent<2> t_ext = grdExt.tile(TILESIZE, TILESIZE);
-  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
-    float rC[MICROTILESIZE][MICROTILESIZE] = {{static_cast<float>(0)}};
-    float rA[1][MICROTILESIZE];
-    float rB[1][MICROTILESIZE];
-    tile_static float lA[TILESIZE * TILESIZE * MICROTILESIZE];
-    tile_static float lB[TILESIZE * TILESIZE * MICROTILESIZE];
-    int gidx = tidx.tile[1];
-    int gidy = tidx.tile[0];
-    int idx = tidx.local[1];
-    int idy = tidx.local[0];
-    int idt = TILESIZE * idy + idx;
-    int idxT = idt % TILESIZE;
-    int idyT = idt / TILESIZE;
-    int block_k = 0;
-
-    do {
-      tidx.barrier.wait();
-
-      for (int sec = 0; sec < MICROTILESIZE; ++sec) {
-        if (gidy * TILESIZE * MICROTILESIZE + idyT + (sec * TILESIZE) < N &&
-            block_k * TILESIZE + idxT < K) {
-          lB[(idxT * TILESIZE * MICROTILESIZE) + idyT + (sec * TILESIZE)] =
-              B[bOffset +
-                (gidy * TILESIZE * MICROTILESIZE + idyT + sec * TILESIZE) *
-                    ldb +
-                idxT + block_k * TILESIZE];
-        } else {
-          lB[(idxT * TILESIZE * MICROTILESIZE) + idyT + (sec * TILESIZE)] = 0;
-        }
-
-        if (gidx * TILESIZE * MICROTILESIZE + idxT + (sec * TILESIZE) < M &&
-            block_k * TILESIZE + idyT < K) {
-          lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] =
-              A[aOffset + (gidx * TILESIZE * MICROTILESIZE) + idxT +
-                (sec * TILESIZE) + idyT * lda + block_k * (lda * TILESIZE)];
-        } else {
-          lA[(idyT * TILESIZE * MICROTILESIZE) + idxT + (sec * TILESIZE)] = 0;
-        }
-      }
-
-      tidx.barrier.wait();
-      int offA = idx;
-      int offB = idy;
-
-      for (int iter = 0; iter < TILESIZE; ++iter) {
-        MTS;
-      }
-
-      tidx.barrier.wait();
-    } while (++block_k < (((K + TILESIZE - 1) & ~(TILESIZE - 1)) / TILESIZE));
-
-    int xIndex = gidx * TILESIZE * MICROTILESIZE + idx;
-    int yIndex = (gidy * TILESIZE * MICROTILESIZE + idy) * ldc;
-
-    for (int row = 0; row < MICROTILESIZE; row++) {
-      for (int col = 0; col < MICROTILESIZE; col++) {
-        if (xIndex + (TILESIZE * col) < M &&
-            (yIndex / ldc) + (TILESIZE * row) < N) {
-          __int64_t C_index = cOffset + (xIndex + TILESIZE * col) + yIndex +
-                              (TILESIZE * row) * ldc;
-          C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
-                        hc::fast_math::isinf(static_cast<float>(C[C_index])))
-                           ? 0
-                           : C[C_index];
-          C[C_index] = alpha * rC[col][row] + beta * C[C_index];
-        }
-      }
-    }
-  }) ;
-#undef TILESIZE
-#undef MICROTILESIZE
+  sgemm_NoTransAB_MICRO_TS16XMTS2_launch(accl_view, A, aOffset, B, bOffset, C,
+                                         cOffset, M, N, K, lda, ldb, ldc,
+                                         alpha, beta);
   return HCBLAS_SUCCEEDS;
 }
 
@@ -3288,202 +3144,226 @@ hcblasStatus gemm_NoTransB_largeK(hc::accelerator_view accl_view, float *A,
   return HCBLAS_SUCCEEDS;
 }
 
-hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view, float *A,
-                            __int64_t aOffset, float *B, __int64_t bOffset,
-                            float *C, __int64_t cOffset, int M, int N, int K,
-                            int lda, int ldb, int ldc, float alpha,
-                            float beta) {
-  if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0 && M <= 6700) {
-    return gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0) {
-    return gemm_NoTransAB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 64 == 0 && N % 64 == 0 && K % 16 == 0) {
-    return gemm_NoTransAB_MICRO_NBK_MX064_NX064_KX16_TS16XMTS4(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 96 == 0 && N % 96 == 0 && K % 16 == 0) {
-    return gemm_NoTransAB_MICRO_NBK_MX096_NX096_KX16_TS16XMTS6(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((M <= 500 && N <= 700) || (M <= 700 && N <= 500) || K < 20 ||
-             M < 20 || N < 20) {
-    return gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((K <= 5000) ||
-             (((M <= 5000 && N <= 8000) || (M <= 8000 && N <= 5000)) &&
-              K <= 8000) ||
-             (((M <= 3000 && N <= 9000) || (M <= 9000 && N <= 3000) ||
-               (M <= 7000 && N <= 4000) || (M <= 4000 && N <= 7000) ||
-               (M <= 5000 && N <= 6000) || (M <= 6000 && N <= 5000)) &&
-              K <= 10000)) {
-    return gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M <= 50000 && N <= 50000) {
-    return gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else {
-    return gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
+// Registry entry for a kernel variant. The lambda gives every variant the
+// dispatch signature (some kernels take const A and B, none takes scratch).
+#define SGEMM_KERNEL(prefix, variant, mM, mN, mK, tile, micro)              \
+  {                                                                         \
+    {#variant, {mM, mN, mK}, tile, micro},                                  \
+        [](hc::accelerator_view accl_view, ScratchPool *, float *A,         \
+           __int64_t aOffset, float *B, __int64_t bOffset, float *C,        \
+           __int64_t cOffset, int M, int N, int K, int lda, int ldb,        \
+           int ldc, float alpha, float beta) {                              \
+          return gemm_##prefix##_##variant(accl_view, A, aOffset, B,        \
+                                           bOffset, C, cOffset, M, N, K,    \
+                                           lda, ldb, ldc, alpha, beta);     \
+        }                                                                   \
   }
+
+// Registry entries for the generated kernels. TILED_TS16_MT{2X2,4X4,6X6}_K16
+// replace the hand-written MICRO_NBK_M_N_K_TS16XMTS{2,4,6} kernels, and the
+// built-in rules name them where the ladders ran those; the other shapes are
+// reached through the autotuner, the tuning database and HCBLAS_GEMM_TABLE.
+#define SGEMM_TILED(name, tile, mtm, mtn, kstep, pad, transA, transB)     \
+  {{#name, {1, 1, 1}, tile, mtm},                                          \
+   gemm_tiled<float, float, tile, mtm, mtn, kstep, pad, transA, transB>},
+#define SGEMM_TILED_NN(name, tile, mtm, mtn, kstep, pad) \
+  SGEMM_TILED(name, tile, mtm, mtn, kstep, pad, false, false)
+#define SGEMM_TILED_NT(name, tile, mtm, mtn, kstep, pad) \
+  SGEMM_TILED(name, tile, mtm, mtn, kstep, pad, false, true)
+#define SGEMM_TILED_TN(name, tile, mtm, mtn, kstep, pad) \
+  SGEMM_TILED(name, tile, mtm, mtn, kstep, pad, true, false)
+#define SGEMM_TILED_TT(name, tile, mtm, mtn, kstep, pad) \
+  SGEMM_TILED(name, tile, mtm, mtn, kstep, pad, true, true)
+
+// Kernel variants per transpose case, in no particular order except that the
+// last one handles every shape (every generated kernel does). gemm_select.cpp
+// holds the rules choosing between them; SPLIT_K and STREAM_K are picked by
+// gemm_tiled_schedule_default unless a table names another variant.
+static const SgemmKernelEntry kNoTransABKernels[] = {
+    SGEMM_KERNEL(NoTransAB, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2,
+                 128, 128, 128, 16, 2),
+    SGEMM_KERNEL(NoTransAB, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2,
+                 128, 128, 128, 16, 4),
+    SGEMM_KERNEL(NoTransAB, MICRO_NBK_MX064_NX064_KX16_TS16XMTS4, 64, 64, 16,
+                 16, 4),
+    SGEMM_KERNEL(NoTransAB, MICRO_NBK_MX096_NX096_KX16_TS16XMTS6, 96, 96, 16,
+                 16, 6),
+    SGEMM_KERNEL(NoTransAB, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2, 1, 1, 1,
+                 16, 4),
+    GEMM_TILED_SCHEDULES(float, float, false, false)
+    GEMM_TILED_VARIANTS(SGEMM_TILED_NN)};
+
+static const SgemmKernelEntry kNoTransAKernels[] = {
+    SGEMM_KERNEL(NoTransA, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2,
+                 128, 128, 128, 16, 2),
+    SGEMM_KERNEL(NoTransA, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2,
+                 128, 128, 128, 16, 4),
+    SGEMM_KERNEL(NoTransA, MICRO_NBK_M064_N064_K064_TS16XMTS4, 64, 64, 16, 16,
+                 4),
+    SGEMM_KERNEL(NoTransA, MICRO_NBK_M096_N096_K096_TS16XMTS6, 96, 96, 16, 16,
+                 6),
+    SGEMM_KERNEL(NoTransA, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2, 1, 1, 1,
+                 16, 4),
+    SGEMM_KERNEL(NoTransA, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2, 1, 1, 1,
+                 16, 2),
+    GEMM_TILED_SCHEDULES(float, float, false, true)
+    GEMM_TILED_VARIANTS(SGEMM_TILED_NT)};
+
+static const SgemmKernelEntry kNoTransBKernels[] = {
+    SGEMM_KERNEL(NoTransB, STEP_TS8XSS8, 1, 1, 1, 8, 1),
+    SGEMM_KERNEL(NoTransB, STEP_NBK_TS16XSS16, 1, 1, 1, 16, 1),
+    SGEMM_KERNEL(NoTransB, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2, 1, 1, 1,
+                 16, 2),
+    SGEMM_KERNEL(NoTransB, MICRO_TS16XMTS2, 1, 1, 1, 16, 2),
+    SGEMM_KERNEL(NoTransB, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2,
+                 128, 128, 128, 16, 2),
+    SGEMM_KERNEL(NoTransB, MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2,
+                 128, 128, 128, 16, 4),
+    SGEMM_KERNEL(NoTransB, MICRO_NBK_M064_N064_K064_TS16XMTS4, 64, 64, 16, 16,
+                 4),
+    SGEMM_KERNEL(NoTransB, MICRO_NBK_M096_N096_K096_TS16XMTS6, 96, 96, 16, 16,
+                 6),
+    SGEMM_KERNEL(NoTransB, MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2, 1, 1, 1,
+                 16, 4),
+    GEMM_TILED_SCHEDULES(float, float, true, false)
+    GEMM_TILED_VARIANTS(SGEMM_TILED_TN)
+    SGEMM_KERNEL(NoTransB, MICRO_NBK_TS16XMTS2, 1, 1, 1, 16, 2)};
+
+static const SgemmKernelEntry kTransABKernels[] = {
+    SGEMM_KERNEL(TransAB, STEP_NBK_TS8XSS8, 1, 1, 1, 8, 1),
+    SGEMM_KERNEL(TransAB, STEP_NBK_TS16XSS16, 1, 1, 1, 16, 1),
+    GEMM_TILED_SCHEDULES(float, float, true, true)
+    GEMM_TILED_VARIANTS(SGEMM_TILED_TT)
+    SGEMM_KERNEL(TransAB, MICRO_TS16XMTS2, 1, 1, 1, 16, 2)};
+
+#undef SGEMM_KERNEL
+#undef SGEMM_TILED
+#undef SGEMM_TILED_NN
+#undef SGEMM_TILED_NT
+#undef SGEMM_TILED_TN
+#undef SGEMM_TILED_TT
+
+static hcblasStatus gemm_dispatch(const SgemmKernelEntry *kernels, int count,
+                                  char transA, char transB,
+                                  hc::accelerator_view accl_view,
+                                  ScratchPool *scratch, float *A,
+                                  __int64_t aOffset, float *B,
+                                  __int64_t bOffset, float *C,
+                                  __int64_t cOffset, int M, int N, int K,
+                                  int lda, int ldb, int ldc, float alpha,
+                                  float beta) {
+  const GemmSelectKey key = {'s', 'C', transA, transB, false};
+  const SgemmKernelEntry *kernel = gemm_select_kernel(
+      key, M, N, K, kernels, count,
+      gemm_tiled_schedule_default<float>(accl_view, M, N, K));
+  return kernel->fn(accl_view, scratch, A, aOffset, B, bOffset, C, cOffset, M,
+                    N, K, lda, ldb, ldc, alpha, beta);
 }
 
-hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, float *A,
-                           __int64_t aOffset, float *B, __int64_t bOffset,
-                           float *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, float alpha, float beta) {
-  if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0 && M <= 4000) {
-    return gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0) {
-    return gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 64 == 0 && N % 64 == 0 && K % 16 == 0) {
-    return gemm_NoTransA_MICRO_NBK_M064_N064_K064_TS16XMTS4(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 96 == 0 && N % 96 == 0 && K % 16 == 0) {
-    return gemm_NoTransA_MICRO_NBK_M096_N096_K096_TS16XMTS6(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((K >= 4000 &&
-              ((M >= 7000 && N >= 9000) || (M >= 9000 && N >= 7000))) ||
-             (K >= 6000 && (M >= 7000 && N >= 7000)) ||
-             (K >= 8500 &&
-              ((M >= 5000 && N >= 7000) || (M >= 7000 && N >= 5000)))) {
-    return gemm_NoTransA_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((K > 30 && (M >= 9000 || N >= 9000)) ||
-             (K >= 4000 && (M >= 8000 || N >= 8000)) ||
-             (K >= 6000 && (M >= 7000 || N >= 7000)) ||
-             (K >= 8500 && (M >= 700 || N >= 700))) {
-    return gemm_NoTransA_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((M <= 500 && N <= 1000) || (N <= 500 && M <= 1000) || K <= 30) {
-    return gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
-  } else if ((M < 9000 && N < 9000 & K < 5000) ||
-             (M < 8000 && N < 8000 && K < 6000) ||
-             (M < 7000 && N < 7000 && K < 8000) ||
-             (M < 6000 && N < 6000 && K < 9000)) {
-    return gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
-  } else {
-    return gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
-  }
+#define KERNEL_COUNT(table) static_cast<int>(sizeof(table) / sizeof(table[0]))
+
+hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view,
+                            ScratchPool *scratch, float *A, __int64_t aOffset,
+                            float *B, __int64_t bOffset, float *C,
+                            __int64_t cOffset, int M, int N, int K, int lda,
+                            int ldb, int ldc, float alpha, float beta) {
+  return gemm_dispatch(kNoTransABKernels, KERNEL_COUNT(kNoTransABKernels), 'n',
+                       'n', accl_view, scratch, A, aOffset, B, bOffset, C,
+                       cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
 }
 
-hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, float *A,
-                           __int64_t aOffset, float *B, __int64_t bOffset,
-                           float *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, float alpha, float beta) {
-  if ((M < 6000 && N < 600 && K < 10) ||
-      (M < 1800 && N < 80 && K > 1800 && K < 6000)) {
-    return gemm_NoTransB_STEP_TS8XSS8(accl_view, A, aOffset, B, bOffset, C,
-                                      cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                      beta);
-  } else if ((M < 600 && N < 600 && K < 6000) ||
-             (M > 1800 && M < 6000 && (K < 600 || (K > 1800 && K < 10000)) &&
-              N < 10) ||
-             (M < 10 && N < 600 && K < 1800) ||
-             (M < 600 && N < 1800 && K < 10)) {
-    return gemm_NoTransB_STEP_NBK_TS16XSS16(accl_view, A, aOffset, B, bOffset,
-                                            C, cOffset, M, N, K, lda, ldb, ldc,
-                                            alpha, beta);
-  } else if (M > 4000 && K > 8000 && N <= 100 && N > 50) {
-    return gemm_NoTransB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if ((M > 1800 && M < 6000 && N > 100 && N < 600 &&
-              (K < 600 || (K < 6000 && K > 1800))) ||
-             (M < 1800 && N < 600 && K < 10) ||
-             (M > 1800 && M < 6000 && K > 1800 && K < 6000 && N < 300 &&
-              M == K)) {
-    return gemm_NoTransB_MICRO_NBK_TS16XMTS2(accl_view, A, aOffset, B, bOffset,
-                                             C, cOffset, M, N, K, lda, ldb, ldc,
-                                             alpha, beta);
-  } else if ((M == K && M < 10000 && N < 200) ||
-             (M < 600 && N < 1800 && K < 600) ||
-             (M < 1800 && N < 100 && K < 1800) ||
-             (M > 600 && M < 6000 && K > 1800 && K < 10000 && N < 300 &&
-              M < K)) {
-    return gemm_NoTransB_MICRO_TS16XMTS2(accl_view, A, aOffset, B, bOffset, C,
-                                         cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                         beta);
+hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, ScratchPool *scratch,
+                           float *A, __int64_t aOffset, float *B,
+                           __int64_t bOffset, float *C, __int64_t cOffset,
+                           int M, int N, int K, int lda, int ldb, int ldc,
+                           float alpha, float beta) {
+  return gemm_dispatch(kNoTransAKernels, KERNEL_COUNT(kNoTransAKernels), 'n',
+                       't', accl_view, scratch, A, aOffset, B, bOffset, C,
+                       cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
+}
+
+hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, ScratchPool *scratch,
+                           float *A, __int64_t aOffset, float *B,
+                           __int64_t bOffset, float *C, __int64_t cOffset,
+                           int M, int N, int K, int lda, int ldb, int ldc,
+                           float alpha, float beta) {
+  return gemm_dispatch(kNoTransBKernels, KERNEL_COUNT(kNoTransBKernels), 't',
+                       'n', accl_view, scratch, A, aOffset, B, bOffset, C,
+                       cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
+}
+
+hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, ScratchPool *scratch,
+                          float *A, __int64_t aOffset, float *B,
+                          __int64_t bOffset, float *C, __int64_t cOffset, int M,
+                          int N, int K, int lda, int ldb, int ldc, float alpha,
+                          float beta) {
+  return gemm_dispatch(kTransABKernels, KERNEL_COUNT(kTransABKernels), 't',
+                       't', accl_view, scratch, A, aOffset, B, bOffset, C,
+                       cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
+}
+
+const SgemmKernelEntry *sgemm_kernel_registry(char transA, char transB,
+                                              int *count) {
+  if (transA == 'n' && transB == 'n') {
+    *count = KERNEL_COUNT(kNoTransABKernels);
+    return kNoTransABKernels;
+  }
+  if (transA == 'n') {
+    *count = KERNEL_COUNT(kNoTransAKernels);
+    return kNoTransAKernels;
   }
-  if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0 && M <= 2000) {
-    return gemm_NoTransB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 128 == 0 && N % 128 == 0 && K % 128 == 0) {
-    return gemm_NoTransB_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 64 == 0 && N % 64 == 0 && K % 16 == 0 && M > 2000 &&
-             M < 3300 && N > 2000 && N < 3300) {
-    return gemm_NoTransB_MICRO_NBK_M064_N064_K064_TS16XMTS4(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M % 96 == 0 && N % 96 == 0 && K % 16 == 0 && M > 2000 &&
-             N > 2000) {
-    return gemm_NoTransB_MICRO_NBK_M096_N096_K096_TS16XMTS6(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else if (M <= 2000 && N <= 5000 && K <= 20) {
-    return gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(accl_view, A, aOffset, B,
-                                                   bOffset, C, cOffset, M, N, K,
-                                                   lda, ldb, ldc, alpha, beta);
-  } else if ((K >= 1500 &&
-              ((M >= 4000 && N >= 5000) || (M >= 5000 && N >= 3000) ||
-               (M >= 7000 && N >= 1000))) ||
-             (K >= 3000 &&
-              ((M >= 3000 && N >= 5000) || (M >= 4000 && N >= 3000) ||
-               (M >= 6000 && N >= 1000))) ||
-             (K >= 5000 &&
-              ((M >= 2000 && N >= 5000) || (M >= 3000 && N >= 2000) ||
-               (M >= 5000 && N >= 1000)))) {
-    return gemm_NoTransB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
-        accl_view, A, aOffset, B, bOffset, C, cOffset, M, N, K, lda, ldb, ldc,
-        alpha, beta);
-  } else {
-    return gemm_NoTransB_MICRO_NBK_TS16XMTS2(accl_view, A, aOffset, B, bOffset,
-                                             C, cOffset, M, N, K, lda, ldb, ldc,
-                                             alpha, beta);
+  if (transB == 'n') {
+    *count = KERNEL_COUNT(kNoTransBKernels);
+    return kNoTransBKernels;
   }
+  *count = KERNEL_COUNT(kTransABKernels);
+  return kTransABKernels;
 }
 
-hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, float *A,
-                          __int64_t aOffset, float *B, __int64_t bOffset,
-                          float *C, __int64_t cOffset, int M, int N, int K,
-                          int lda, int ldb, int ldc, float alpha, float beta) {
-  if ((M < 600 && N < 600 && K < 10) || (M < 1800 && N < 600 && K < 600)) {
-    return gemm_TransAB_STEP_NBK_TS8XSS8(accl_view, A, aOffset, B, bOffset, C,
-                                         cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                         beta);
-  } else if ((M < 600 && N < 600 && K < 1800) ||
-             (M < 1800 && ((N < 600 && K < 1800) || (N < 1800 && K < 10)))) {
-    return gemm_TransAB_STEP_NBK_TS16XSS16(accl_view, A, aOffset, B, bOffset, C,
-                                           cOffset, M, N, K, lda, ldb, ldc,
-                                           alpha, beta);
-  } else {
-    return gemm_TransAB_MICRO_TS16XMTS2(accl_view, A, aOffset, B, bOffset, C,
-                                        cOffset, M, N, K, lda, ldb, ldc, alpha,
-                                        beta);
+hcblasStatus gemm_autotuned(GemmAutotuner *tuner, TuningDb *db,
+                            DispatchTrace *trace, ScratchPool *scratch,
+                            hc::accelerator_view accl_view, char transA,
+                            char transB, float *A, __int64_t aOffset, float *B,
+                            __int64_t bOffset, float *C, __int64_t cOffset,
+                            int M, int N, int K, int lda, int ldb, int ldc,
+                            float alpha, float beta) {
+  int count = 0;
+  const SgemmKernelEntry *kernels =
+      sgemm_kernel_registry(transA, transB, &count);
+  const GemmTuneKey key = {'s', 'C', transA, transB, M, N, K, lda, ldb, ldc};
+  bool trial = false;
+  const char *reason = NULL;
+  const SgemmKernelEntry *kernel =
+      gemm_autotune_kernel(tuner, db, key, kernels, count, &trial, &reason,
+                           gemm_tiled_schedule_default<float>(accl_view, M, N,
+                                                              K));
+  if (!trial && trace == NULL) {
+    return kernel->fn(accl_view, scratch, A, aOffset, B, bOffset, C, cOffset,
+                      M, N, K, lda, ldb, ldc, alpha, beta);
+  }
+  // Drain earlier work so only this kernel is timed
+  accl_view.wait();
+  const std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  hcblasStatus status = kernel->fn(accl_view, scratch, A, aOffset, B, bOffset,
+                                   C, cOffset, M, N, K, lda, ldb, ldc, alpha,
+                                   beta);
+  accl_view.wait();
+  const double ms = dispatch_trace_ms(start);
+  if (trial) {
+    gemm_autotune_record(tuner, db, key, kernels,
+                         static_cast<int>(kernel - kernels), ms);
+  }
+  if (trace != NULL) {
+    DispatchTraceEvent event =
+        dispatch_trace_gemm("sgemm", 'C', transA, transB, M, N, K);
+    event.elapsed_ms = ms;
+    event.variant = kernel->info.name;
+    event.reason = reason;
+    gemm_tiled_trace<float>(accl_view, kernel->info, &event);
+    trace->record(event, start);
   }
+  return status;
 }
 
+#undef KERNEL_COUNT
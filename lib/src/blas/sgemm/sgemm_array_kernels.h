@@ -24,6 +24,8 @@ THE SOFTWARE.
 #define LIB_SRC_BLAS_SGEMM_SGEMM_ARRAY_KERNELS_H_
 
 #include "include/hcblaslib.h"
+#include "src/blas/gemmselect/gemm_autotune.h"
+#include "src/blas/trace/dispatch_trace.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
@@ -392,35 +394,21 @@ hcblasStatus gemm_NoTransAB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS8XMTS4(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransAB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
 hcblasStatus gemm_NoTransAB_MICRO_NBK_MX096_NX096_KX16_TS16XMTS6(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view, float *A,
-                            __int64_t aOffset, float *B, __int64_t bOffset,
-                            float *C, __int64_t cOffset, int M, int N, int K,
-                            int lda, int ldb, int ldc, float alpha, float beta);
+hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view,
+                            ScratchPool *scratch, float *A, __int64_t aOffset,
+                            float *B, __int64_t bOffset, float *C,
+                            __int64_t cOffset, int M, int N, int K, int lda,
+                            int ldb, int ldc, float alpha, float beta);
 
 hcblasStatus gemm_NoTransA_MICRO_NBK_M096_N096_K096_TS16XMTS6(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
@@ -432,21 +420,6 @@ hcblasStatus gemm_NoTransA_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransA_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
 hcblasStatus gemm_NoTransA_MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
@@ -467,25 +440,11 @@ hcblasStatus gemm_NoTransA_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, float *A,
-                           __int64_t aOffset, float *B, __int64_t bOffset,
-                           float *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS2(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS4(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
-
-hcblasStatus gemm_NoTransB_MICRO_NBK_M_N_K_TS16XMTS6(
-    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
-    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
-    int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
+hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, ScratchPool *scratch,
+                           float *A, __int64_t aOffset, float *B,
+                           __int64_t bOffset, float *C, __int64_t cOffset,
+                           int M, int N, int K, int lda, int ldb, int ldc,
+                           float alpha, float beta);
 
 hcblasStatus gemm_NoTransB_MICRO_NBK_M064_N064_K064_TS16XMTS4(
     hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
@@ -517,15 +476,63 @@ hcblasStatus gemm_NoTransB_MICRO_NBK_Mini_Batch_M_N_K_TS16XMTS4_MB2(
     const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
     int N, int K, int lda, int ldb, int ldc, float alpha, float beta);
 
-hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, float *A,
-                           __int64_t aOffset, float *B, __int64_t bOffset,
-                           float *C, __int64_t cOffset, int M, int N, int K,
-                           int lda, int ldb, int ldc, float alpha, float beta);
+hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, ScratchPool *scratch,
+                           float *A, __int64_t aOffset, float *B,
+                           __int64_t bOffset, float *C, __int64_t cOffset,
+                           int M, int N, int K, int lda, int ldb, int ldc,
+                           float alpha, float beta);
+
+hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, ScratchPool *scratch,
+                          float *A, __int64_t aOffset, float *B,
+                          __int64_t bOffset, float *C, __int64_t cOffset, int M,
+                          int N, int K, int lda, int ldb, int ldc, float alpha,
+                          float beta);
+
+/*
+* Kernel registries consulted by the column major dispatch routines
+*/
 
-hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, float *A,
-                          __int64_t aOffset, float *B, __int64_t bOffset,
-                          float *C, __int64_t cOffset, int M, int N, int K,
-                          int lda, int ldb, int ldc, float alpha, float beta);
+typedef hcblasStatus (*SgemmKernelFn)(hc::accelerator_view accl_view,
+                                      ScratchPool *scratch, float *A,
+                                      __int64_t aOffset, float *B,
+                                      __int64_t bOffset, float *C,
+                                      __int64_t cOffset, int M, int N, int K,
+                                      int lda, int ldb, int ldc, float alpha,
+                                      float beta);
+
+typedef hcblasStatus (*SgemmBatchKernelFn)(
+    hc::accelerator_view accl_view, float *A[], __int64_t aOffset,
+    __int64_t A_batchOffset, float *B[], __int64_t bOffset,
+    __int64_t B_batchOffset, float *C[], __int64_t cOffset,
+    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
+    float alpha, float beta, int batchSize);
+
+struct SgemmKernelEntry {
+  GemmKernelInfo info;
+  SgemmKernelFn fn;
+};
+
+struct SgemmBatchKernelEntry {
+  GemmKernelInfo info;
+  SgemmBatchKernelFn fn;
+};
+
+// Column major SGEMM variants for a transpose case ('n' or 't' per operand),
+// the last entry being the general kernel. Used by hcblas-tune to time every
+// variant the selection table can name.
+const SgemmKernelEntry *sgemm_kernel_registry(char transA, char transB,
+                                              int *count);
+
+// Column major SGEMM picking its variant through gemm_autotune_kernel. Trial
+// calls of a tuning handle and traced calls wait for the kernel so it can be
+// timed.
+hcblasStatus gemm_autotuned(GemmAutotuner *tuner, TuningDb *db,
+                            DispatchTrace *trace, ScratchPool *scratch,
+                            hc::accelerator_view accl_view, char transA,
+                            char transB, float *A, __int64_t aOffset,
+                            float *B, __int64_t bOffset, float *C,
+                            __int64_t cOffset, int M, int N, int K, int lda,
+                            int ldb, int ldc, float alpha, float beta);
 
 /*
 * SGEMM Kernels for Batch processing in column major order
@@ -2010,48 +2010,67 @@ hcblasStatus gemm_NoTransB_batch_largeM(
   return HCBLAS_SUCCEEDS;
 }
 
+#define SGEMM_BATCH_KERNEL(prefix, variant, tile, micro) \
+  { {#variant, {1, 1, 1}, tile, micro}, gemm_##prefix##_##variant }
+
+// Batched kernel variants per transpose case; the last one is the general
+// fallback. The selection rules live in gemm_select.cpp.
+static const SgemmBatchKernelEntry kNoTransABBatchKernels[] = {
+    SGEMM_BATCH_KERNEL(NoTransAB, batch_largeM, 32, 2),
+    SGEMM_BATCH_KERNEL(NoTransAB, batch_MICRO_TS16XMTS2, 16, 2),
+    SGEMM_BATCH_KERNEL(NoTransAB, batch_STEP_TS8XSS8, 8, 1),
+    SGEMM_BATCH_KERNEL(NoTransAB, batch_STEP_NBK_TS16XSS16, 16, 1),
+    SGEMM_BATCH_KERNEL(NoTransAB, batch_MICRO_NBK_TS16XMTS2, 16, 2)};
+
+static const SgemmBatchKernelEntry kNoTransABatchKernels[] = {
+    SGEMM_BATCH_KERNEL(NoTransA, batch_largeM, 32, 2),
+    SGEMM_BATCH_KERNEL(NoTransA, batch_MICRO_NBK_TS16XMTS2, 16, 2),
+    SGEMM_BATCH_KERNEL(NoTransA, batch_STEP_TS8XSS8, 8, 1),
+    SGEMM_BATCH_KERNEL(NoTransA, batch_STEP_TS16XSS16, 16, 1),
+    SGEMM_BATCH_KERNEL(NoTransA, batch_STEP_NBK_TS16XSS16, 16, 1),
+    SGEMM_BATCH_KERNEL(NoTransA, batch_MICRO_TS16XMTS2, 16, 2)};
+
+static const SgemmBatchKernelEntry kNoTransBBatchKernels[] = {
+    SGEMM_BATCH_KERNEL(NoTransB, batch_largeM, 32, 2),
+    SGEMM_BATCH_KERNEL(NoTransB, batch_STEP_TS8XSS8, 8, 1),
+    SGEMM_BATCH_KERNEL(NoTransB, batch_STEP_NBK_TS16XSS16, 16, 1),
+    SGEMM_BATCH_KERNEL(NoTransB, batch_MICRO_TS16XMTS2, 16, 2),
+    SGEMM_BATCH_KERNEL(NoTransB, batch_MICRO_NBK_TS16XMTS2, 16, 2)};
+
+static const SgemmBatchKernelEntry kTransABBatchKernels[] = {
+    SGEMM_BATCH_KERNEL(TransAB, batch_STEP_NBK_TS8XSS8, 8, 1),
+    SGEMM_BATCH_KERNEL(TransAB, batch_STEP_NBK_TS16XSS16, 16, 1),
+    SGEMM_BATCH_KERNEL(TransAB, batch_MICRO_TS16XMTS2, 16, 2)};
+
+#undef SGEMM_BATCH_KERNEL
+
+static hcblasStatus gemm_batch_dispatch(
+    const SgemmBatchKernelEntry *kernels, int count, char transA, char transB,
+    hc::accelerator_view accl_view, float *A[], __int64_t aOffset,
+    __int64_t A_batchOffset, float *B[], __int64_t bOffset,
+    __int64_t B_batchOffset, float *C[], __int64_t cOffset,
+    __int64_t C_batchOffset, int M, int N, int K, int lda, int ldb, int ldc,
+    float alpha, float beta, int batchSize) {
+  const GemmSelectKey key = {'s', 'C', transA, transB, true};
+  const SgemmBatchKernelEntry *kernel =
+      gemm_select_kernel(key, M, N, K, kernels, count);
+  return kernel->fn(accl_view, A, aOffset, A_batchOffset, B, bOffset,
+                    B_batchOffset, C, cOffset, C_batchOffset, M, N, K, lda,
+                    ldb, ldc, alpha, beta, batchSize);
+}
+
+#define KERNEL_COUNT(table) static_cast<int>(sizeof(table) / sizeof(table[0]))
+
 hcblasStatus gemm_NoTransAB(hc::accelerator_view accl_view, float *A[],
                             __int64_t aOffset, __int64_t A_batchOffset, float *B[],
                             __int64_t bOffset, __int64_t B_batchOffset, float *C[],
                             __int64_t cOffset, __int64_t C_batchOffset, int M, int N,
                             int K, int lda, int ldb, int ldc, float alpha,
                             float beta, int batchSize) {
-  if (M > 10000 && N < 500) {
-    return gemm_NoTransAB_batch_largeM(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if (M > 600 && M < 1800 && N < 200 && K > 600 && K < 1800) {
-    return gemm_NoTransAB_batch_MICRO_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if (((M > 600 && M < 1800 && N < 600) || (M < 50 && N < 1800)) &&
-             (K < 10)) {
-    return gemm_NoTransAB_batch_STEP_TS8XSS8(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if ((M < 600 && N < 600 && K < 6000) ||
-             (M > 1800 && M < 10000 && K > 600 && K < 10000 && N < 10) ||
-             (M < 10 && N > 600 && N < 1800 && K < 6000)) {
-    return gemm_NoTransAB_batch_STEP_NBK_TS16XSS16(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if ((((M > 1800 && M < 6000 && M == K) ||
-               (M > 1800 && M < 10000 && K > 1800 && K < 10000)) &&
-              N < 200) ||
-             (M < 10000 && N < 1800 && K < 10) ||
-             (M > 1800 && M < 6000 && N < 600 && K < 200)) {
-    return gemm_NoTransAB_batch_MICRO_NBK_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if (M > 6000 && M < 10000 && N < 600 && K < 10) {
-    return gemm_NoTransAB_batch_STEP_TS8XSS8(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else {
-    return gemm_NoTransAB_batch_MICRO_NBK_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  }
+  return gemm_batch_dispatch(
+      kNoTransABBatchKernels, KERNEL_COUNT(kNoTransABBatchKernels), 'n', 'n',
+      accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
+      cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
 }
 
 hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, float *A[],
@@ -2060,39 +2079,10 @@ hcblasStatus gemm_NoTransA(hc::accelerator_view accl_view, float *A[],
                            __int64_t cOffset, __int64_t C_batchOffset, int M, int N,
                            int K, int lda, int ldb, int ldc, float alpha,
                            float beta, int batchSize) {
-  if (M > 10000 && N < 500) {
-    return gemm_NoTransA_batch_largeM(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if (M > 1800 && M < 6000 && N > 600 && N < 1800 && K < 600) {
-    return gemm_NoTransA_batch_MICRO_NBK_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if (M > 600 && M < 1800 && N < 600 && K < 10) {
-    return gemm_NoTransA_batch_STEP_TS8XSS8(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if (M > 1800 && M < 6000 && N > 1800 && N < 6000 && K < 10) {
-    return gemm_NoTransA_batch_MICRO_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if ((M < 600 && N < 600 && K < 6000) ||
-             (M > 1800 && M < 6000 && K < 1800 && N < 10) ||
-             (M < 10 && N < 1800 && K > 1800 && K < 6000)) {
-    return gemm_NoTransA_batch_STEP_TS16XSS16(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if ((M < 1800 && K < 600 && N < 10) ||
-             (M < 10 && N < 600 && K < 1800) ||
-             (M < 600 && N < 1800 && K < 10)) {
-    return gemm_NoTransA_batch_STEP_NBK_TS16XSS16(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else {
-    return gemm_NoTransA_batch_MICRO_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  }
+  return gemm_batch_dispatch(
+      kNoTransABatchKernels, KERNEL_COUNT(kNoTransABatchKernels), 'n', 't',
+      accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
+      cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
 }
 
 hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, float *A[],
@@ -2101,44 +2091,10 @@ hcblasStatus gemm_NoTransB(hc::accelerator_view accl_view, float *A[],
                            __int64_t cOffset, __int64_t C_batchOffset, int M, int N,
                            int K, int lda, int ldb, int ldc, float alpha,
                            float beta, int batchSize) {
-  if (M > 10000 && N < 500) {
-    return gemm_NoTransB_batch_largeM(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if ((M < 6000 && N < 600 && K < 10) ||
-             (M < 1800 && N < 80 && K > 1800 && K < 6000)) {
-    return gemm_NoTransB_batch_STEP_TS8XSS8(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if ((M < 600 && N < 600 && K < 6000) ||
-             (M > 1800 && M < 6000 && (K < 600 || (K > 1800 && K < 10000)) &&
-              N < 10) ||
-             (M < 10 && N < 600 && K < 1800) ||
-             (M < 600 && N < 1800 && K < 10)) {
-    return gemm_NoTransB_batch_STEP_NBK_TS16XSS16(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if ((M > 1800 && M < 6000 && N > 100 && N < 600 &&
-              (K < 600 || (K < 6000 && K > 1800))) ||
-             (M < 1800 && N < 600 && K < 10) ||
-             (M > 1800 && M < 6000 && K > 1800 && K < 6000 && N < 300 &&
-              M == K)) {
-    return gemm_NoTransB_batch_MICRO_NBK_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if ((M == K && M < 10000 && N < 200) ||
-             (M < 600 && N < 1800 && K < 600) ||
-             (M < 1800 && N < 100 && K < 1800) ||
-             (M > 600 && M < 6000 && K > 1800 && K < 10000 && N < 300 &&
-              M < K)) {
-    return gemm_NoTransB_batch_MICRO_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else {
-    return gemm_NoTransB_batch_MICRO_NBK_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  }
+  return gemm_batch_dispatch(
+      kNoTransBBatchKernels, KERNEL_COUNT(kNoTransBBatchKernels), 't', 'n',
+      accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
+      cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
 }
 
 hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, float *A[],
@@ -2147,19 +2103,10 @@ hcblasStatus gemm_TransAB(hc::accelerator_view accl_view, float *A[],
                           __int64_t cOffset, __int64_t C_batchOffset, int M, int N, int K,
                           int lda, int ldb, int ldc, float alpha, float beta,
                           int batchSize) {
-  if ((M < 600 && N < 600 && K < 10) || (M < 1800 && N < 600 && K < 600)) {
-    return gemm_TransAB_batch_STEP_NBK_TS8XSS8(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else if ((M < 600 && N < 600 && K < 1800) ||
-             (M < 1800 && ((N < 600 && K < 1800) || (N < 1800 && K < 10)))) {
-    return gemm_TransAB_batch_STEP_NBK_TS16XSS16(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  } else {
-    return gemm_TransAB_batch_MICRO_TS16XMTS2(
-        accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
-        cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
-  }
+  return gemm_batch_dispatch(
+      kTransABBatchKernels, KERNEL_COUNT(kTransABBatchKernels), 't', 't',
+      accl_view, A, aOffset, A_batchOffset, B, bOffset, B_batchOffset, C,
+      cOffset, C_batchOffset, M, N, K, lda, ldb, ldc, alpha, beta, batchSize);
 }
 
+#undef KERNEL_COUNT
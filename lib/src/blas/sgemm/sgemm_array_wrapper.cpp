@@ -21,12 +21,15 @@ THE SOFTWARE.
 */
 
 #include "./sgemm_array_kernels.h"
+#include "src/blas/gemmgen/gemm_tiled_kernel.h"
+#include "src/blas/host/hcblas_host.h"
+#include <chrono>
 
 // Sgemm Wrapper routine that invokes the appropriate kernel routines depending
 // on the input dimension M N and K
-hcblasStatus gemm_HC(hc::accelerator_view accl_view, const int order,
-                     char TransA, char TransB, const int M, const int N,
-                     const int K, const float alpha, float *A_mat,
+hcblasStatus gemm_HC(hc::accelerator_view accl_view, ScratchPool *scratch,
+                     const int order, char TransA, char TransB, const int M,
+                     const int N, const int K, const float alpha, float *A_mat,
                      __int64_t aOffset, __int64_t lda, float *B_mat,
                      __int64_t bOffset, __int64_t ldb, const float beta,
                      float *C_mat, __int64_t cOffset, __int64_t ldc) {
@@ -36,21 +39,33 @@ hcblasStatus gemm_HC(hc::accelerator_view accl_view, const int order,
   if (order) {
     if (TransB == 'n') {
       if (TransA == 'n') {
-        status =
-            gemm_NoTransAB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                           cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
+        status = gemm_NoTransAB(accl_view, scratch, A_mat, aOffset, B_mat,
+                                bOffset, C_mat, cOffset, M, N, K, lda, ldb,
+                                ldc, alpha, beta);
       } else {
-        status = gemm_NoTransB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                               cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
+        status = gemm_NoTransB(accl_view, scratch, A_mat, aOffset, B_mat,
+                               bOffset, C_mat, cOffset, M, N, K, lda, ldb, ldc,
+                               alpha, beta);
       }
     } else if (TransA == 'n') {
-      status = gemm_NoTransA(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                             cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
+      status = gemm_NoTransA(accl_view, scratch, A_mat, aOffset, B_mat,
+                             bOffset, C_mat, cOffset, M, N, K, lda, ldb, ldc,
+                             alpha, beta);
     } else {
-      status = gemm_TransAB(accl_view, A_mat, aOffset, B_mat, bOffset, C_mat,
-                            cOffset, M, N, K, lda, ldb, ldc, alpha, beta);
+      status = gemm_TransAB(accl_view, scratch, A_mat, aOffset, B_mat, bOffset,
+                            C_mat, cOffset, M, N, K, lda, ldb, ldc, alpha,
+                            beta);
     }
   } else {
+    // Row major has no registry, so shapes the fixed tile grids serve badly
+    // run split-K or stream-K ahead of the hand-written kernels
+    if (gemm_tiled_schedule_rmajor<float, float>(accl_view, scratch, TransA,
+                                                 TransB, A_mat, aOffset, B_mat,
+                                                 bOffset, C_mat, cOffset, M, N,
+                                                 K, lda, ldb, ldc, alpha,
+                                                 beta)) {
+      return HCBLAS_SUCCEEDS;
+    }
     if (TransB == 'n') {
       if (TransA == 'n') {
         status = gemm_NoTransAB_rMajor(accl_view, A_mat, aOffset, B_mat,
@@ -308,6 +323,33 @@ hcblasStatus Hcblaslibrary::hcblas_sgemm(
     return HCBLAS_INVALID;
   }
 
+  // CPU accelerator: run the blocked host engine on the host pointers
+  if (hostExecution) {
+    if (!host_gemm_tuned<float>(gemmAutotuner, tuningDb, trace,
+                                order == ColMajor, typeA == Trans,
+                                typeB == Trans, M, N, K, alpha, A + aOffset,
+                                lda, B + bOffset, ldb, beta, C + cOffset,
+                                ldc)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  // A tuning handle times the column major variants on new shapes; a tuning
+  // database supplies choices made by earlier runs
+  if (order && alpha != 0 &&
+      (gemmAutotuner != NULL || tuningDb != NULL || trace != NULL)) {
+    return gemm_autotuned(gemmAutotuner, tuningDb, trace, scratch, accl_view,
+                          typeA, typeB, A, aOffset, B, bOffset, C, cOffset, M,
+                          N, K, lda, ldb, ldc, alpha, beta);
+  }
+
+  // Traced calls below run kernels outside the registry and are timed whole
+  std::chrono::steady_clock::time_point start;
+  if (trace != NULL) {
+    accl_view.wait();
+    start = std::chrono::steady_clock::now();
+  }
   // For alpha = 0
   if (alpha == 0) {
     if (order) {
@@ -317,10 +359,19 @@ hcblasStatus Hcblaslibrary::hcblas_sgemm(
       status = gemm_alpha0_row(accl_view, A, aOffset, B, bOffset, C, cOffset, M,
                                N, K, lda, ldb, ldc, alpha, beta);
     }
-    return status;
+  } else {
+    status = gemm_HC(accl_view, scratch, order, typeA, typeB, M, N, K, alpha, A,
+                     aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+  }
+  if (trace != NULL) {
+    accl_view.wait();
+    DispatchTraceEvent event = dispatch_trace_gemm(
+        "sgemm", order ? 'C' : 'R', typeA, typeB, M, N, K);
+    event.elapsed_ms = dispatch_trace_ms(start);
+    event.variant = alpha == 0 ? "alpha0" : "row_major";
+    event.reason = "fixed";
+    trace->record(event, start);
   }
-  status = gemm_HC(accl_view, order, typeA, typeB, M, N, K, alpha, A, aOffset,
-                   lda, B, bOffset, ldb, beta, C, cOffset, ldc);
   return status;
 }
 
@@ -342,6 +393,17 @@ hcblasStatus Hcblaslibrary::hcblas_sgemm(
     return HCBLAS_INVALID;
   }
 
+  if (hostExecution) {
+    if (!host_gemm_batched<float>(order == ColMajor, typeA == Trans,
+                                  typeB == Trans, M, N, K, alpha, A, aOffset,
+                                  A_batchOffset, lda, B, bOffset, B_batchOffset,
+                                  ldb, beta, C, cOffset, C_batchOffset, ldc,
+                                  batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   /*  // For alpha = 0
     if (alpha == 0) {
       if (order) {
@@ -363,3 +425,11 @@ hcblasStatus Hcblaslibrary::hcblas_sgemm(
   return status;
 }
 
+// Device workspace carved by a non-batched SGEMM of this shape; the
+// split-K or stream-K schedule the heuristics default to is the only part
+// that takes scratch and does not depend on the layout or the transposes
+size_t Hcblaslibrary::hcblas_sgemm_workspaceSize(
+    hc::accelerator_view accl_view, const int M, const int N, const int K) {
+  if (hostExecution || M <= 0 || N <= 0 || K <= 0) return 0;
+  return gemm_tiled_workspace<float, float>(accl_view, M, N, K);
+}
@@ -0,0 +1,203 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* SGEMM kernel bodies compiled both for the device, by sgemm_array_kernels.cpp
+* with hc.hpp, and for the CPU, by host_sgemm_tiled.cpp on the host runtime
+* (host_tiled.h with HCBLAS_HOST_KERNELS). The includer provides hc:: and
+* tile_static; nothing here depends on which one it is.
+*/
+
+#ifndef LIB_SRC_BLAS_SGEMM_SGEMM_MICRO_KERNELS_H_
+#define LIB_SRC_BLAS_SGEMM_SGEMM_MICRO_KERNELS_H_
+
+// C = alpha * A * B + beta * C, column major, neither operand transposed:
+// 8 x 8 work-groups stepping K by 8, each work-item one element of C
+inline void sgemm_NoTransAB_STEP_TS8XSS8_launch(
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
+  enum { TILE = 8, STEP = 8, SHIFT = 3 };
+  hc::extent<2> grdExt((N + (TILE - 1)) & ~(TILE - 1),
+                       (M + (TILE - 1)) & ~(TILE - 1));
+  hc::tiled_extent<2> t_ext = grdExt.tile(TILE, TILE);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
+    float rC[1][1];
+    float rA[1][STEP / TILE];
+    float rB[1][STEP / TILE];
+    tile_static float lA[TILE * STEP];
+    tile_static float lB[TILE * STEP];
+    rC[0][0] = 0;
+    int gidx = tidx.tile[1];
+    int gidy = tidx.tile[0];
+    int idx = tidx.local[1];
+    int idy = tidx.local[0];
+    int idt = TILE * idy + idx;
+    int idxT = idt % TILE;
+    int idyT = idt / TILE;
+    int block_k = ((K + (STEP - 1)) & ~(STEP - 1)) >> SHIFT;
+    int i = 0;
+
+    do {
+      tidx.barrier.wait();
+
+      for (int sec = 0; sec < STEP / TILE; ++sec) {
+        if (gidy * TILE + idyT < N && (idxT + i * STEP + (TILE * sec)) < K) {
+          lB[idyT * TILE + idxT + (TILE * TILE * sec)] =
+              B[bOffset + (gidy * TILE + idyT) * ldb + idxT + i * STEP +
+                (TILE * sec)];
+        } else {
+          lB[idyT * TILE + idxT + (TILE * TILE * sec)] = 0;
+        }
+
+        if (gidx * TILE + idxT < M && (i * STEP + idyT + (TILE * sec)) < K) {
+          lA[idxT * TILE + idyT + (TILE * TILE * sec)] =
+              A[aOffset + gidx * TILE + idxT + idyT * lda +
+                i * (lda << SHIFT) + (TILE * sec) * lda];
+        } else {
+          lA[idxT * TILE + idyT + (TILE * TILE * sec)] = 0;
+        }
+      }
+
+      tidx.barrier.wait();
+      int offA = idx * TILE;
+      int offB = idy * TILE;
+
+      for (int iter = 0; iter < TILE; ++iter) {
+        for (int s = 0; s < STEP / TILE; ++s) {
+          rA[0][s] = lA[offA + (TILE * TILE) * s];
+          rB[0][s] = lB[offB + (TILE * TILE) * s];
+          rC[0][0] += rA[0][s] * rB[0][s];
+        }
+        offA += 1;
+        offB += 1;
+      }
+
+      i++;
+    } while (--block_k > 0);
+
+    tidx.barrier.wait();
+
+    if (gidx * TILE + idx < M && gidy * TILE + idy < N) {
+      __int64_t C_index =
+          cOffset + gidx * TILE + idx + (gidy * TILE + idy) * ldc;
+      C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
+                    hc::fast_math::isinf(static_cast<float>(C[C_index])))
+                       ? 0
+                       : C[C_index];
+      C[C_index] = alpha * rC[0][0] + beta * C[C_index];
+    }
+  });
+}
+
+// C = alpha * A * B + beta * C, column major, neither operand transposed:
+// 16 x 16 work-groups, each work-item a 2 x 2 micro tile of C
+inline void sgemm_NoTransAB_MICRO_TS16XMTS2_launch(
+    hc::accelerator_view accl_view, const float *A, __int64_t aOffset,
+    const float *B, __int64_t bOffset, float *C, __int64_t cOffset, int M,
+    int N, int K, int lda, int ldb, int ldc, float alpha, float beta) {
+  enum { TILE = 16, MICRO = 2 };
+  int M_ = hc::fast_math::fmaxf(1, (M / MICRO + 1));
+  int N_ = hc::fast_math::fmaxf(1, (N / MICRO + 1));
+  hc::extent<2> grdExt((N_ + (TILE - 1)) & ~(TILE - 1),
+                       (M_ + (TILE - 1)) & ~(TILE - 1));
+  hc::tiled_extent<2> t_ext = grdExt.tile(TILE, TILE);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
+    float rC[MICRO][MICRO] = {{static_cast<float>(0)}};
+    float rA[1][MICRO];
+    float rB[1][MICRO];
+    tile_static float lA[TILE * TILE * MICRO];
+    tile_static float lB[TILE * TILE * MICRO];
+    int gidx = tidx.tile[1];
+    int gidy = tidx.tile[0];
+    int idx = tidx.local[1];
+    int idy = tidx.local[0];
+    int idt = TILE * idy + idx;
+    int idxT = idt % TILE;
+    int idyT = idt / TILE;
+    int block_k = 0;
+
+    do {
+      tidx.barrier.wait();
+
+      for (int sec = 0; sec < MICRO; ++sec) {
+        if (gidy * TILE * MICRO + idyT + (sec * TILE) < N &&
+            block_k * TILE + idxT < K) {
+          lB[(idxT * TILE * MICRO) + idyT + (sec * TILE)] =
+              B[bOffset + (gidy * TILE * MICRO + idyT + sec * TILE) * ldb +
+                idxT + block_k * TILE];
+        } else {
+          lB[(idxT * TILE * MICRO) + idyT + (sec * TILE)] = 0;
+        }
+
+        if (gidx * TILE * MICRO + idxT + (sec * TILE) < M &&
+            block_k * TILE + idyT < K) {
+          lA[(idyT * TILE * MICRO) + idxT + (sec * TILE)] =
+              A[aOffset + (gidx * TILE * MICRO) + idxT + (sec * TILE) +
+                idyT * lda + block_k * (lda * TILE)];
+        } else {
+          lA[(idyT * TILE * MICRO) + idxT + (sec * TILE)] = 0;
+        }
+      }
+
+      tidx.barrier.wait();
+      int offA = idx;
+      int offB = idy;
+
+      for (int iter = 0; iter < TILE; ++iter) {
+        for (int m = 0; m < MICRO; m++) {
+          rA[0][m] = lA[offA + (m * TILE)];
+          rB[0][m] = lB[offB + (m * TILE)];
+        }
+        for (int rowIndex = 0; rowIndex < MICRO; rowIndex++) {
+          for (int colIndex = 0; colIndex < MICRO; colIndex++) {
+            rC[rowIndex][colIndex] =
+                rA[0][rowIndex] * rB[0][colIndex] + rC[rowIndex][colIndex];
+          }
+        }
+        offA += (MICRO * TILE);
+        offB += (MICRO * TILE);
+      }
+
+      tidx.barrier.wait();
+    } while (++block_k < (((K + TILE - 1) & ~(TILE - 1)) / TILE));
+
+    int xIndex = gidx * TILE * MICRO + idx;
+    int yIndex = (gidy * TILE * MICRO + idy) * ldc;
+
+    for (int row = 0; row < MICRO; row++) {
+      for (int col = 0; col < MICRO; col++) {
+        if (xIndex + (TILE * col) < M && (yIndex / ldc) + (TILE * row) < N) {
+          __int64_t C_index =
+              cOffset + (xIndex + TILE * col) + yIndex + (TILE * row) * ldc;
+          C[C_index] = (hc::fast_math::isnan(static_cast<float>(C[C_index])) ||
+                        hc::fast_math::isinf(static_cast<float>(C[C_index])))
+                           ? 0
+                           : C[C_index];
+          C[C_index] = alpha * rC[col][row] + beta * C[C_index];
+        }
+      }
+    }
+  });
+}
+
+#endif  // LIB_SRC_BLAS_SGEMM_SGEMM_MICRO_KERNELS_H_
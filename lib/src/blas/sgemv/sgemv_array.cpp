@@ -21,24 +21,26 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/scratch/scratch_pool.h"
+#include "src/blas/tunedb/tuning_db.h"
 #include <hc.hpp>
 #include <hc_am.hpp>
 #include <hc_math.hpp>
 
 #define BLOCK_SIZE 256
 
-static void gemv_TransA(hc::accelerator_view accl_view, float *A_mat,
-                        __int64_t aOffset, float *X_vec, __int64_t xOffset,
-                        float *Y_vec, __int64_t yOffset, float alpha,
-                        float beta, int lenX, int lenY) {
-  if ((lenX - lenY) > 5000) {
+static void gemv_TransA(hc::accelerator_view accl_view, const TuningDb *db,
+                        ScratchPool *scratch, float *A_mat, __int64_t aOffset,
+                        float *X_vec, __int64_t xOffset, float *Y_vec,
+                        __int64_t yOffset, float alpha, float beta, int lenX,
+                        int lenY) {
+  if ((lenX - lenY) > tuning_db_threshold(db, "sgemv.split_min", 5000)) {
     int len_X = (lenX + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
     int len_Y = (lenY + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
     int num_blocks = len_X / BLOCK_SIZE;
-    float *temp =
-        reinterpret_cast<float *>(malloc(num_blocks * len_Y * sizeof(float)));
-    hc::accelerator acc = accl_view.get_accelerator();
-    float *tempBuf = hc::am_alloc(sizeof(float) * num_blocks * len_Y, acc, 0);
+    ScratchDevice<float> scratchBuf(scratch, accl_view, num_blocks * len_Y);
+    float *tempBuf = scratchBuf.data();
     hc::extent<1> grdExt(len_X);
     hc::tiled_extent<1> t_ext = grdExt.tile(BLOCK_SIZE);
     hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<1> tidx)[[hc]] {
@@ -98,10 +100,6 @@ static void gemv_TransA(hc::accelerator_view accl_view, float *A_mat,
         }
       }
     }) ;
-
-    // Free up resources
-    free(temp);
-    hc::am_free(tempBuf);
   } else {
     hc::extent<1> grdExt(lenY * BLOCK_SIZE);
     hc::tiled_extent<1> t_ext = grdExt.tile(BLOCK_SIZE);
@@ -146,20 +144,19 @@ static void gemv_TransA(hc::accelerator_view accl_view, float *A_mat,
   }
 }
 
-static void gemv_TransA(hc::accelerator_view accl_view, float *A_mat,
-                        __int64_t aOffset, __int64_t A_batchOffset,
-                        float *X_vec, __int64_t xOffset,
-                        __int64_t X_batchOffset, float *Y_vec,
-                        __int64_t yOffset, __int64_t Y_batchOffset, float alpha,
-                        float beta, int lenX, int lenY, int batchSize) {
-  if ((lenX - lenY) > 5000) {
+static void gemv_TransA(hc::accelerator_view accl_view, const TuningDb *db,
+                        ScratchPool *scratch, float *A_mat, __int64_t aOffset,
+                        __int64_t A_batchOffset, float *X_vec,
+                        __int64_t xOffset, __int64_t X_batchOffset,
+                        float *Y_vec, __int64_t yOffset,
+                        __int64_t Y_batchOffset, float alpha, float beta,
+                        int lenX, int lenY, int batchSize) {
+  if ((lenX - lenY) > tuning_db_threshold(db, "sgemv.split_min", 5000)) {
     int len_X = (lenX + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
     int len_Y = (lenY + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
     int num_blocks = len_X / BLOCK_SIZE;
-    float *temp =
-        reinterpret_cast<float *>(malloc(num_blocks * len_Y * sizeof(float)));
-    hc::accelerator acc = accl_view.get_accelerator();
-    float *tempBuf = hc::am_alloc(sizeof(float) * num_blocks * len_Y, acc, 0);
+    ScratchDevice<float> scratchBuf(scratch, accl_view, num_blocks * len_Y);
+    float *tempBuf = scratchBuf.data();
     hc::extent<2> grdExt(batchSize, len_X);
     hc::tiled_extent<2> t_ext = grdExt.tile(1, BLOCK_SIZE);
     hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
@@ -221,10 +218,6 @@ static void gemv_TransA(hc::accelerator_view accl_view, float *A_mat,
         }
       }
     }) ;
-
-    // Free up resources
-    free(temp);
-    hc::am_free(tempBuf);
   } else {
     hc::extent<2> grdExt(batchSize, lenY * BLOCK_SIZE);
     hc::tiled_extent<2> t_ext = grdExt.tile(1, BLOCK_SIZE);
@@ -271,19 +264,18 @@ static void gemv_TransA(hc::accelerator_view accl_view, float *A_mat,
   }
 }
 
-static void gemv_TransA_rMajor(hc::accelerator_view accl_view, float *A_mat,
-                               __int64_t aOffset, float *X_vec,
+static void gemv_TransA_rMajor(hc::accelerator_view accl_view,
+                               const TuningDb *db, ScratchPool *scratch,
+                               float *A_mat, __int64_t aOffset, float *X_vec,
                                __int64_t xOffset, float *Y_vec,
                                __int64_t yOffset, float alpha, float beta,
                                int lenX, int lenY) {
-  if ((lenX - lenY) > 5000) {
+  if ((lenX - lenY) > tuning_db_threshold(db, "sgemv.split_min", 5000)) {
     int len_X = (lenX + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
     int len_Y = (lenY + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
     int num_blocks = len_X / BLOCK_SIZE;
-    float *temp =
-        reinterpret_cast<float *>(malloc(num_blocks * len_Y * sizeof(float)));
-    hc::accelerator acc = accl_view.get_accelerator();
-    float *tempBuf = hc::am_alloc(sizeof(float) * num_blocks * len_Y, acc, 0);
+    ScratchDevice<float> scratchBuf(scratch, accl_view, num_blocks * len_Y);
+    float *tempBuf = scratchBuf.data();
     hc::extent<1> grdExt(len_X);
     hc::tiled_extent<1> t_ext = grdExt.tile(BLOCK_SIZE);
     hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<1> tidx)[[hc]] {
@@ -343,10 +335,6 @@ static void gemv_TransA_rMajor(hc::accelerator_view accl_view, float *A_mat,
         }
       }
     }) ;
-
-    // free up resources
-    free(temp);
-    hc::am_free(tempBuf);
   } else {
     hc::extent<1> grdExt(lenY * BLOCK_SIZE);
     hc::tiled_extent<1> t_ext = grdExt.tile(BLOCK_SIZE);
@@ -391,21 +379,20 @@ static void gemv_TransA_rMajor(hc::accelerator_view accl_view, float *A_mat,
   }
 }
 
-static void gemv_TransA_rMajor(hc::accelerator_view accl_view, float *A_mat,
-                               __int64_t aOffset, __int64_t A_batchOffset,
-                               float *X_vec, __int64_t xOffset,
-                               __int64_t X_batchOffset, float *Y_vec,
-                               __int64_t yOffset, __int64_t Y_batchOffset,
-                               float alpha, float beta, int lenX, int lenY,
-                               int batchSize) {
-  if ((lenX - lenY) > 5000) {
+static void gemv_TransA_rMajor(hc::accelerator_view accl_view,
+                               const TuningDb *db, ScratchPool *scratch,
+                               float *A_mat, __int64_t aOffset,
+                               __int64_t A_batchOffset, float *X_vec,
+                               __int64_t xOffset, __int64_t X_batchOffset,
+                               float *Y_vec, __int64_t yOffset,
+                               __int64_t Y_batchOffset, float alpha, float beta,
+                               int lenX, int lenY, int batchSize) {
+  if ((lenX - lenY) > tuning_db_threshold(db, "sgemv.split_min", 5000)) {
     int len_X = (lenX + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
     int len_Y = (lenY + (BLOCK_SIZE - 1)) & ~(BLOCK_SIZE - 1);
     int num_blocks = len_X / BLOCK_SIZE;
-    float *temp =
-        reinterpret_cast<float *>(malloc(num_blocks * len_Y * sizeof(float)));
-    hc::accelerator acc = accl_view.get_accelerator();
-    float *tempBuf = hc::am_alloc(sizeof(float) * num_blocks * len_Y, acc, 0);
+    ScratchDevice<float> scratchBuf(scratch, accl_view, num_blocks * len_Y);
+    float *tempBuf = scratchBuf.data();
     hc::extent<2> grdExt(batchSize, len_X);
     hc::tiled_extent<2> t_ext = grdExt.tile(1, BLOCK_SIZE);
     hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<2> tidx)[[hc]] {
@@ -467,10 +454,6 @@ static void gemv_TransA_rMajor(hc::accelerator_view accl_view, float *A_mat,
         }
       }
     }) ;
-    // free up resources
-    free(temp);
-    hc::am_free(tempBuf);
-
   } else {
     hc::extent<2> grdExt(batchSize, lenY * BLOCK_SIZE);
     hc::tiled_extent<2> t_ext = grdExt.tile(1, BLOCK_SIZE);
@@ -835,6 +818,16 @@ hcblasStatus Hcblaslibrary::hcblas_sgemv(
     return HCBLAS_INVALID;
   }
 
+  // CPU accelerator: run the blocked host engine on the host pointers
+  if (hostExecution) {
+    if (!host_gemv<float>(order == ColMajor, type == Trans, M, N, alpha,
+                          A + aOffset, lda, X + xOffset, incX, beta,
+                          Y + yOffset, incY)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   int lenX, lenY;
 
   if (type == 'n') {
@@ -857,16 +850,16 @@ hcblasStatus Hcblaslibrary::hcblas_sgemv(
 
   if (order) {
     if (type == 't') {
-      gemv_TransA(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha, beta,
-                  lenX, lenY);
+      gemv_TransA(accl_view, tuningDb, scratch, A, aOffset, X, xOffset, Y,
+                  yOffset, alpha, beta, lenX, lenY);
     } else if (type == 'n') {
       gemv_NoTransA(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha, beta,
                     lenX, lenY);
     }
   } else {
     if (type == 't') {
-      gemv_TransA_rMajor(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha,
-                         beta, lenX, lenY);
+      gemv_TransA_rMajor(accl_view, tuningDb, scratch, A, aOffset, X, xOffset,
+                         Y, yOffset, alpha, beta, lenX, lenY);
     } else if (type == 'n') {
       gemv_NoTransA_rMajor(accl_view, A, aOffset, X, xOffset, Y, yOffset, alpha,
                            beta, lenX, lenY);
@@ -891,6 +884,16 @@ hcblasStatus Hcblaslibrary::hcblas_sgemv(
     return HCBLAS_INVALID;
   }
 
+  if (hostExecution) {
+    if (!host_gemv_batched<float>(order == ColMajor, type == Trans, M, N, alpha,
+                                  A + aOffset, A_batchOffset, lda, X + xOffset,
+                                  X_batchOffset, incX, beta, Y + yOffset,
+                                  Y_batchOffset, incY, batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   int lenX, lenY;
 
   if (type == 'n') {
@@ -915,9 +918,9 @@ hcblasStatus Hcblaslibrary::hcblas_sgemv(
 
   if (order) {
     if (type == 't') {
-      gemv_TransA(accl_view, A, aOffset, A_batchOffset, X, xOffset,
-                  X_batchOffset, Y, yOffset, Y_batchOffset, alpha, beta, lenX,
-                  lenY, batchSize);
+      gemv_TransA(accl_view, tuningDb, scratch, A, aOffset, A_batchOffset, X,
+                  xOffset, X_batchOffset, Y, yOffset, Y_batchOffset, alpha,
+                  beta, lenX, lenY, batchSize);
     } else if (type == 'n') {
       gemv_NoTransA(accl_view, A, aOffset, A_batchOffset, X, xOffset,
                     X_batchOffset, Y, yOffset, Y_batchOffset, alpha, beta, lenX,
@@ -925,9 +928,9 @@ hcblasStatus Hcblaslibrary::hcblas_sgemv(
     }
   } else {
     if (type == 't') {
-      gemv_TransA_rMajor(accl_view, A, aOffset, A_batchOffset, X, xOffset,
-                         X_batchOffset, Y, yOffset, Y_batchOffset, alpha, beta,
-                         lenX, lenY, batchSize);
+      gemv_TransA_rMajor(accl_view, tuningDb, scratch, A, aOffset,
+                         A_batchOffset, X, xOffset, X_batchOffset, Y, yOffset,
+                         Y_batchOffset, alpha, beta, lenX, lenY, batchSize);
     } else if (type == 'n') {
       gemv_NoTransA_rMajor(accl_view, A, aOffset, A_batchOffset, X, xOffset,
                            X_batchOffset, Y, yOffset, Y_batchOffset, alpha,
@@ -21,17 +21,22 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
 #define BLOCK_SIZE 8
 
-void sscal_HC(hc::accelerator_view accl_view, __int64_t n, float alpha,
-              float *X, __int64_t incx, __int64_t xOffset) {
+// alphaPtr, when not NULL, is alpha in device memory (DevicePointer mode)
+// and is read by the kernel in place of alphaValue
+void sscal_HC(hc::accelerator_view accl_view, __int64_t n, float alphaValue,
+              const float *alphaPtr, float *X, __int64_t incx,
+              __int64_t xOffset) {
   __int64_t size = (n + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
   hc::extent<1> compute_domain(size);
   hc::parallel_for_each(accl_view, compute_domain.tile(BLOCK_SIZE), [=
   ](hc::tiled_index<1> tidx)[[hc]] {
+    const float alpha = alphaPtr != NULL ? *alphaPtr : alphaValue;
     if (tidx.global[0] < n) {
       __int64_t X_index = xOffset + tidx.global[0];
       X[X_index] = (hc::fast_math::isnan(static_cast<float>(X[X_index])) ||
@@ -46,13 +51,15 @@ void sscal_HC(hc::accelerator_view accl_view, __int64_t n, float alpha,
   }) ;
 }
 
-void sscal_HC(hc::accelerator_view accl_view, __int64_t n, float alpha,
-              float *X, __int64_t incx, __int64_t xOffset,
+void sscal_HC(hc::accelerator_view accl_view, __int64_t n, float alphaValue,
+              const float *alphaPtr, float *X, __int64_t incx,
+              __int64_t xOffset,
               __int64_t X_batchOffset, int batchSize) {
   __int64_t size = (n + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1);
   hc::extent<2> compute_domain(batchSize, size);
   hc::parallel_for_each(accl_view, compute_domain.tile(1, BLOCK_SIZE), [=
   ](hc::tiled_index<2> tidx)[[hc]] {
+    const float alpha = alphaPtr != NULL ? *alphaPtr : alphaValue;
     int elt = tidx.tile[0];
 
     if (tidx.global[1] < n) {
@@ -78,7 +85,13 @@ hcblasStatus Hcblaslibrary::hcblas_sscal(hc::accelerator_view accl_view,
   if (X == NULL || N <= 0 || incX <= 0) {
     return HCBLAS_INVALID;
   }
-  sscal_HC(accl_view, N, alpha, X, incX, xOffset);
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    host_scal<float>(N, alpha, X + xOffset, incX);
+    return HCBLAS_SUCCEEDS;
+  }
+
+  sscal_HC(accl_view, N, alpha, NULL, X, incX, xOffset);
   return HCBLAS_SUCCEEDS;
 }
 
@@ -94,7 +107,57 @@ hcblasStatus Hcblaslibrary::hcblas_sscal(hc::accelerator_view accl_view,
   if (X == NULL || N <= 0 || incX <= 0) {
     return HCBLAS_INVALID;
   }
-  sscal_HC(accl_view, N, alpha, X, incX, xOffset, X_batchOffset, batchSize);
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    host_scal_batched<float>(N, alpha, X + xOffset, incX, X_batchOffset,
+                             batchSize);
+    return HCBLAS_SUCCEEDS;
+  }
+
+  sscal_HC(accl_view, N, alpha, NULL, X, incX, xOffset, X_batchOffset,
+           batchSize);
   return HCBLAS_SUCCEEDS;
 }
 
+// SSCAL Type III - alpha in memory of pointerMode
+hcblasStatus Hcblaslibrary::hcblas_sscal(hc::accelerator_view accl_view,
+                                         const int N, const float *alpha,
+                                         float *X, const int incX,
+                                         const __int64_t xOffset) {
+  if (alpha == NULL) {
+    return HCBLAS_INVALID;
+  }
+  // Host pointers, or the CPU accelerator whose device memory is host memory
+  if (pointerMode == HostPointer || hostExecution) {
+    return hcblas_sscal(accl_view, N, *alpha, X, incX, xOffset);
+  }
+  if (X == NULL || N <= 0 || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  sscal_HC(accl_view, N, 0, alpha, X, incX, xOffset);
+  return HCBLAS_SUCCEEDS;
+}
+
+// SSCAL Type IV - Batch processing with alpha in memory of pointerMode
+hcblasStatus Hcblaslibrary::hcblas_sscal(hc::accelerator_view accl_view,
+                                         const int N, const float *alpha,
+                                         float *X, const int incX,
+                                         const __int64_t xOffset,
+                                         const __int64_t X_batchOffset,
+                                         const int batchSize) {
+  if (alpha == NULL) {
+    return HCBLAS_INVALID;
+  }
+  if (pointerMode == HostPointer || hostExecution) {
+    return hcblas_sscal(accl_view, N, *alpha, X, incX, xOffset, X_batchOffset,
+                        batchSize);
+  }
+  if (X == NULL || N <= 0 || incX <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  sscal_HC(accl_view, N, 0, alpha, X, incX, xOffset, X_batchOffset,
+           batchSize);
+  return HCBLAS_SUCCEEDS;
+}
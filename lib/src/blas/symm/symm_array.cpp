@@ -0,0 +1,340 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/symm/symm_kernels.h"
+#include <utility>
+
+namespace {
+
+// Shared by SYMM and HEMM in the four precisions: checks the call, hands CPU
+// accelerator calls to host_symm and folds row major layouts into column
+// major (C^T = B^T * A^T, and the column major view of a row major A is A^T
+// stored in the other triangle, so the product moves to the other side)
+template <typename T>
+hcblasStatus symm_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                           hcblasOrder order, hcblasSide side, hcblasUplo uplo,
+                           bool herm, int M, int N, T alpha, T *A,
+                           __int64_t aOffset, __int64_t lda, T *B,
+                           __int64_t bOffset, __int64_t ldb, T beta, T *C,
+                           __int64_t cOffset, __int64_t ldc) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || M <= 0 || N <= 0) {
+    return HCBLAS_INVALID;
+  }
+
+  // CPU accelerator: mirrored panels of A over host_gemm
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_symm<H>(order == ColMajor, side == Left, uplo == Lower, herm, M,
+                      N, Level3Host<T>::value(alpha),
+                      reinterpret_cast<const H *>(A + aOffset), lda,
+                      reinterpret_cast<const H *>(B + bOffset), ldb,
+                      Level3Host<T>::value(beta),
+                      reinterpret_cast<H *>(C + cOffset), ldc)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool left = side == Left;
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    left = !left;
+    lower = !lower;
+    std::swap(M, N);
+  }
+  symm_launch<T>(accl_view, left, lower, herm, M, N, alpha, A, aOffset, lda, B,
+                 bOffset, ldb, beta, C, cOffset, ldc, 1);
+  return HCBLAS_SUCCEEDS;
+}
+
+template <typename T>
+hcblasStatus symm_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                           hcblasOrder order, hcblasSide side, hcblasUplo uplo,
+                           bool herm, int M, int N, T alpha, T *A[],
+                           __int64_t aOffset, __int64_t A_batchOffset,
+                           __int64_t lda, T *B[], __int64_t bOffset,
+                           __int64_t B_batchOffset, __int64_t ldb, T beta,
+                           T *C[], __int64_t cOffset, __int64_t C_batchOffset,
+                           __int64_t ldc, int batchSize) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || M <= 0 || N <= 0 ||
+      batchSize <= 0) {
+    return HCBLAS_INVALID;
+  }
+  aOffset += A_batchOffset;
+  bOffset += B_batchOffset;
+  cOffset += C_batchOffset;
+
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_symm_batched<H>(order == ColMajor, side == Left, uplo == Lower,
+                              herm, M, N, Level3Host<T>::value(alpha),
+                              reinterpret_cast<H *const *>(A), aOffset, lda,
+                              reinterpret_cast<H *const *>(B), bOffset, ldb,
+                              Level3Host<T>::value(beta),
+                              reinterpret_cast<H *const *>(C), cOffset, ldc,
+                              batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool left = side == Left;
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    left = !left;
+    lower = !lower;
+    std::swap(M, N);
+  }
+  // Every entry's tiles share one launch
+  symm_launch<T>(accl_view, left, lower, herm, M, N, alpha, A, aOffset, lda, B,
+                 bOffset, ldb, beta, C, cOffset, ldc, batchSize);
+  return HCBLAS_SUCCEEDS;
+}
+
+}  // namespace
+
+/* SSYMM - C = alpha * A * B + beta * C, symmetric A on either side */
+hcblasStatus Hcblaslibrary::hcblas_ssymm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, const int M,
+                                         const int N, const float &alpha,
+                                         float *A, const __int64_t aOffset,
+                                         const __int64_t lda, float *B,
+                                         const __int64_t bOffset,
+                                         const __int64_t ldb, const float &beta,
+                                         float *C, const __int64_t cOffset,
+                                         const __int64_t ldc) {
+  return symm_dispatch(this, accl_view, order, side, uplo, false, M, N, alpha,
+                       A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+}
+
+/* SSYMM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_ssymm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, const int M,
+                                         const int N, const float &alpha,
+                                         float *A[], const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda, float *B[],
+                                         const __int64_t bOffset,
+                                         const __int64_t B_batchOffset,
+                                         const __int64_t ldb, const float &beta,
+                                         float *C[], const __int64_t cOffset,
+                                         const __int64_t C_batchOffset,
+                                         const __int64_t ldc,
+                                         const int batchSize) {
+  return symm_dispatch(this, accl_view, order, side, uplo, false, M, N, alpha,
+                       A, aOffset, A_batchOffset, lda, B, bOffset,
+                       B_batchOffset, ldb, beta, C, cOffset, C_batchOffset, ldc,
+                       batchSize);
+}
+
+/* DSYMM - C = alpha * A * B + beta * C, symmetric A on either side */
+hcblasStatus Hcblaslibrary::hcblas_dsymm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, const int M,
+                                         const int N, const double &alpha,
+                                         double *A, const __int64_t aOffset,
+                                         const __int64_t lda, double *B,
+                                         const __int64_t bOffset,
+                                         const __int64_t ldb,
+                                         const double &beta, double *C,
+                                         const __int64_t cOffset,
+                                         const __int64_t ldc) {
+  return symm_dispatch(this, accl_view, order, side, uplo, false, M, N, alpha,
+                       A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+}
+
+/* DSYMM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_dsymm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, const int M,
+                                         const int N, const double &alpha,
+                                         double *A[], const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda, double *B[],
+                                         const __int64_t bOffset,
+                                         const __int64_t B_batchOffset,
+                                         const __int64_t ldb,
+                                         const double &beta, double *C[],
+                                         const __int64_t cOffset,
+                                         const __int64_t C_batchOffset,
+                                         const __int64_t ldc,
+                                         const int batchSize) {
+  return symm_dispatch(this, accl_view, order, side, uplo, false, M, N, alpha,
+                       A, aOffset, A_batchOffset, lda, B, bOffset,
+                       B_batchOffset, ldb, beta, C, cOffset, C_batchOffset, ldc,
+                       batchSize);
+}
+
+/* CSYMM - C = alpha * A * B + beta * C, symmetric A on either side */
+hcblasStatus Hcblaslibrary::hcblas_csymm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, const int M,
+                                         const int N,
+                                         const hc::short_vector::float_2 &alpha,
+                                         hc::short_vector::float_2 *A,
+                                         const __int64_t aOffset,
+                                         const __int64_t lda,
+                                         hc::short_vector::float_2 *B,
+                                         const __int64_t bOffset,
+                                         const __int64_t ldb,
+                                         const hc::short_vector::float_2 &beta,
+                                         hc::short_vector::float_2 *C,
+                                         const __int64_t cOffset,
+                                         const __int64_t ldc) {
+  return symm_dispatch(this, accl_view, order, side, uplo, false, M, N, alpha,
+                       A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+}
+
+/* CSYMM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_csymm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, const int M,
+                                         const int N,
+                                         const hc::short_vector::float_2 &alpha,
+                                         hc::short_vector::float_2 *A[],
+                                         const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda,
+                                         hc::short_vector::float_2 *B[],
+                                         const __int64_t bOffset,
+                                         const __int64_t B_batchOffset,
+                                         const __int64_t ldb,
+                                         const hc::short_vector::float_2 &beta,
+                                         hc::short_vector::float_2 *C[],
+                                         const __int64_t cOffset,
+                                         const __int64_t C_batchOffset,
+                                         const __int64_t ldc,
+                                         const int batchSize) {
+  return symm_dispatch(this, accl_view, order, side, uplo, false, M, N, alpha,
+                       A, aOffset, A_batchOffset, lda, B, bOffset,
+                       B_batchOffset, ldb, beta, C, cOffset, C_batchOffset, ldc,
+                       batchSize);
+}
+
+/* ZSYMM - C = alpha * A * B + beta * C, symmetric A on either side */
+hcblasStatus Hcblaslibrary::hcblas_zsymm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasSide side,
+    hcblasUplo uplo, const int M, const int N,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::double_2 *B,
+    const __int64_t bOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return symm_dispatch(this, accl_view, order, side, uplo, false, M, N, alpha,
+                       A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+}
+
+/* ZSYMM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_zsymm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasSide side,
+    hcblasUplo uplo, const int M, const int N,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return symm_dispatch(this, accl_view, order, side, uplo, false, M, N, alpha,
+                       A, aOffset, A_batchOffset, lda, B, bOffset,
+                       B_batchOffset, ldb, beta, C, cOffset, C_batchOffset, ldc,
+                       batchSize);
+}
+
+/* CHEMM - C = alpha * A * B + beta * C, Hermitian A on either side */
+hcblasStatus Hcblaslibrary::hcblas_chemm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, const int M,
+                                         const int N,
+                                         const hc::short_vector::float_2 &alpha,
+                                         hc::short_vector::float_2 *A,
+                                         const __int64_t aOffset,
+                                         const __int64_t lda,
+                                         hc::short_vector::float_2 *B,
+                                         const __int64_t bOffset,
+                                         const __int64_t ldb,
+                                         const hc::short_vector::float_2 &beta,
+                                         hc::short_vector::float_2 *C,
+                                         const __int64_t cOffset,
+                                         const __int64_t ldc) {
+  return symm_dispatch(this, accl_view, order, side, uplo, true, M, N, alpha, A,
+                       aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+}
+
+/* CHEMM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_chemm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, const int M,
+                                         const int N,
+                                         const hc::short_vector::float_2 &alpha,
+                                         hc::short_vector::float_2 *A[],
+                                         const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda,
+                                         hc::short_vector::float_2 *B[],
+                                         const __int64_t bOffset,
+                                         const __int64_t B_batchOffset,
+                                         const __int64_t ldb,
+                                         const hc::short_vector::float_2 &beta,
+                                         hc::short_vector::float_2 *C[],
+                                         const __int64_t cOffset,
+                                         const __int64_t C_batchOffset,
+                                         const __int64_t ldc,
+                                         const int batchSize) {
+  return symm_dispatch(this, accl_view, order, side, uplo, true, M, N, alpha, A,
+                       aOffset, A_batchOffset, lda, B, bOffset, B_batchOffset,
+                       ldb, beta, C, cOffset, C_batchOffset, ldc, batchSize);
+}
+
+/* ZHEMM - C = alpha * A * B + beta * C, Hermitian A on either side */
+hcblasStatus Hcblaslibrary::hcblas_zhemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasSide side,
+    hcblasUplo uplo, const int M, const int N,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::double_2 *B,
+    const __int64_t bOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return symm_dispatch(this, accl_view, order, side, uplo, true, M, N, alpha, A,
+                       aOffset, lda, B, bOffset, ldb, beta, C, cOffset, ldc);
+}
+
+/* ZHEMM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_zhemm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasSide side,
+    hcblasUplo uplo, const int M, const int N,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return symm_dispatch(this, accl_view, order, side, uplo, true, M, N, alpha, A,
+                       aOffset, A_batchOffset, lda, B, bOffset, B_batchOffset,
+                       ldb, beta, C, cOffset, C_batchOffset, ldc, batchSize);
+}
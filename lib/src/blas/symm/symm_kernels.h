@@ -0,0 +1,141 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Symmetric and Hermitian matrix products C = alpha * A * B + beta * C (left
+* side) or C = alpha * B * A + beta * C (right side) that read only the
+* stored triangle of A. The product is tiled like GEMM; A tiles are mirrored
+* (and conjugated for HEMM) as they are staged in local memory, so the full
+* matrix is never formed and C is swept once.
+*
+* Everything here is column major; the wrappers fold row major layouts into
+* the other side and triangle.
+*/
+
+#ifndef LIB_SRC_BLAS_SYMM_SYMM_KERNELS_H_
+#define LIB_SRC_BLAS_SYMM_SYMM_KERNELS_H_
+
+#include "src/blas/level3/level3_common.h"
+
+// Tile of C per work-group and K step, the 16 x 16 work-items holding 4 x 4
+// elements of the tile each
+#define SYMM_NB 64
+#define SYMM_KSTEP 16
+
+// A(row, col) of the full matrix from its stored triangle; the Hermitian
+// diagonal is taken as real
+template <typename T>
+inline T symm_element(const T *a, __int64_t lda, bool lower, bool herm,
+                      int row, int col) [[hc]] {
+  if (lower ? row >= col : row <= col) {
+    const T v = a[row + col * lda];
+    return herm && row == col ? level3_real(v) : v;
+  }
+  const T v = a[col + row * lda];
+  return herm ? level3_conj(v) : v;
+}
+
+// Work-group (elt, j, i) computes the i-th row and j-th column tile of C of
+// entry elt. X is A on the left side and B on the right, Y the other, both
+// staged a K step at a time; A tiles lying wholly in the unstored triangle
+// are loaded along the stored rows so the reads stay contiguous.
+template <typename T, typename P>
+void symm_launch(hc::accelerator_view accl_view, bool left, bool lower,
+                 bool herm, int M, int N, T alpha, P A, __int64_t aOffset,
+                 __int64_t lda, P B, __int64_t bOffset, __int64_t ldb, T beta,
+                 P C, __int64_t cOffset, __int64_t ldc, int batchSize) {
+  enum { NB = SYMM_NB, KSTEP = SYMM_KSTEP };
+  const int K = left ? M : N;
+  const bool betaZero = level3_is_zero(beta);
+  hc::extent<3> grdExt(batchSize, (N + NB - 1) / NB * 16,
+                       (M + NB - 1) / NB * 16);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, 16, 16);
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    // lX[k * NB + r] = X(i0 + r, k0 + k), lY[k * NB + c] = Y(k0 + k, j0 + c)
+    tile_static T lX[KSTEP * NB];
+    tile_static T lY[KSTEP * NB];
+    const int elt = tidx.tile[0];
+    const int i0 = tidx.tile[2] * NB;
+    const int j0 = tidx.tile[1] * NB;
+    const int tx = tidx.local[2];
+    const int ty = tidx.local[1];
+    const int lid = ty * 16 + tx;
+    const T *a = level3_entry(A, elt) + aOffset;
+    const T *b = level3_entry(B, elt) + bOffset;
+    T *c = level3_entry(C, elt) + cOffset;
+    const T zero = Level3Scalar<T>::real(0.0);
+    T acc[4][4];
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) acc[i][j] = zero;
+    }
+    for (int k0 = 0; k0 < K; k0 += KSTEP) {
+      // Whether this step's tile of A is read entirely through the mirror
+      const bool mirrored =
+          left ? (lower ? i0 + NB <= k0 : k0 + KSTEP <= i0)
+               : (lower ? k0 + KSTEP <= j0 : j0 + NB <= k0);
+      for (int idx = lid; idx < KSTEP * NB; idx += 256) {
+        // X rows run along the stored columns unless X is a mirrored A tile
+        int r = left && mirrored ? idx / KSTEP : idx % NB;
+        int k = left && mirrored ? idx % KSTEP : idx / NB;
+        T x = zero;
+        if (i0 + r < M && k0 + k < K) {
+          x = left ? symm_element(a, lda, lower, herm, i0 + r, k0 + k)
+                   : b[i0 + r + (k0 + k) * ldb];
+        }
+        lX[k * NB + r] = x;
+        // Y columns run along k unless Y is a mirrored A tile
+        const int cc = !left && mirrored ? idx % NB : idx / KSTEP;
+        k = !left && mirrored ? idx / NB : idx % KSTEP;
+        T y = zero;
+        if (j0 + cc < N && k0 + k < K) {
+          y = left ? b[k0 + k + (j0 + cc) * ldb]
+                   : symm_element(a, lda, lower, herm, k0 + k, j0 + cc);
+        }
+        lY[k * NB + cc] = y;
+      }
+      tidx.barrier.wait();
+      for (int k = 0; k < KSTEP; k++) {
+        for (int i = 0; i < 4; i++) {
+          const T x = lX[k * NB + tx * 4 + i];
+          for (int j = 0; j < 4; j++) {
+            acc[i][j] += level3_mul(x, lY[k * NB + ty * 4 + j]);
+          }
+        }
+      }
+      tidx.barrier.wait();
+    }
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) {
+        const int r = i0 + tx * 4 + i;
+        const int cc = j0 + ty * 4 + j;
+        if (r < M && cc < N) {
+          T *e = c + r + cc * ldc;
+          T v = level3_mul(alpha, acc[i][j]);
+          if (!betaZero) v += level3_mul(beta, *e);
+          *e = v;
+        }
+      }
+    }
+  });
+}
+
+#endif  // LIB_SRC_BLAS_SYMM_SYMM_KERNELS_H_
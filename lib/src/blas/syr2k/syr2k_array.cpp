@@ -0,0 +1,329 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/level3/level3_triangle.h"
+
+namespace {
+
+// Shared by SYR2K and HER2K in the four precisions. Row major layouts fold
+// into the other triangle with the other transpose as for SYRK; HER2K's
+// C^T = conj(C) also swaps alpha for conj(alpha).
+template <typename T>
+hcblasStatus syr2k_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                            hcblasOrder order, hcblasUplo uplo,
+                            hcblasTranspose typeA, bool herm, int N, int K,
+                            T alpha, T *A, __int64_t aOffset, __int64_t lda,
+                            T *B, __int64_t bOffset, __int64_t ldb, T beta,
+                            T *C, __int64_t cOffset, __int64_t ldc) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || N <= 0 || K < 0) {
+    return HCBLAS_INVALID;
+  }
+  // Complex SYR2K has no conjugate transpose and HER2K no plain one
+  if (Level3Scalar<T>::complex && typeA == (herm ? Trans : ConjTrans)) {
+    return HCBLAS_INVALID;
+  }
+  bool trans = typeA != NoTrans;
+
+  // CPU accelerator: host triangle update over host_gemm
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_syr2k<H>(order == ColMajor, uplo == Lower, trans, herm, N, K,
+                       Level3Host<T>::value(alpha),
+                       reinterpret_cast<const H *>(A + aOffset), lda,
+                       reinterpret_cast<const H *>(B + bOffset), ldb,
+                       Level3Host<T>::value(beta),
+                       reinterpret_cast<H *>(C + cOffset), ldc)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    lower = !lower;
+    trans = !trans;
+    if (herm) alpha = level3_conj(alpha);
+  }
+  return triangle_update2k<T>(accl_view, lib->scratch,
+                              Level3Gemm(lib, accl_view, 1), lower, herm, trans,
+                              N, K, alpha, A, aOffset, lda, B, bOffset, ldb,
+                              beta, C, cOffset, ldc, 1);
+}
+
+template <typename T>
+hcblasStatus syr2k_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                            hcblasOrder order, hcblasUplo uplo,
+                            hcblasTranspose typeA, bool herm, int N, int K,
+                            T alpha, T *A[], __int64_t aOffset,
+                            __int64_t A_batchOffset, __int64_t lda, T *B[],
+                            __int64_t bOffset, __int64_t B_batchOffset,
+                            __int64_t ldb, T beta, T *C[], __int64_t cOffset,
+                            __int64_t C_batchOffset, __int64_t ldc,
+                            int batchSize) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || C == NULL || N <= 0 || K < 0 ||
+      batchSize <= 0) {
+    return HCBLAS_INVALID;
+  }
+  if (Level3Scalar<T>::complex && typeA == (herm ? Trans : ConjTrans)) {
+    return HCBLAS_INVALID;
+  }
+  bool trans = typeA != NoTrans;
+  aOffset += A_batchOffset;
+  bOffset += B_batchOffset;
+  cOffset += C_batchOffset;
+
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_syr2k_batched<H>(order == ColMajor, uplo == Lower, trans, herm, N,
+                               K, Level3Host<T>::value(alpha),
+                               reinterpret_cast<H *const *>(A), aOffset, lda,
+                               reinterpret_cast<H *const *>(B), bOffset, ldb,
+                               Level3Host<T>::value(beta),
+                               reinterpret_cast<H *const *>(C), cOffset, ldc,
+                               batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    lower = !lower;
+    trans = !trans;
+    if (herm) alpha = level3_conj(alpha);
+  }
+  return triangle_update2k<T>(accl_view, lib->scratch,
+                              Level3Gemm(lib, accl_view, batchSize), lower,
+                              herm, trans, N, K, alpha, A, aOffset, lda, B,
+                              bOffset, ldb, beta, C, cOffset, ldc, batchSize);
+}
+
+}  // namespace
+
+/* SSYR2K - C = alpha * (op(A) * op(B)^T + op(B) * op(A)^T) + beta * C */
+hcblasStatus Hcblaslibrary::hcblas_ssyr2k(hc::accelerator_view accl_view,
+                                          hcblasOrder order, hcblasUplo uplo,
+                                          hcblasTranspose typeA, const int N,
+                                          const int K, const float &alpha,
+                                          float *A, const __int64_t aOffset,
+                                          const __int64_t lda, float *B,
+                                          const __int64_t bOffset,
+                                          const __int64_t ldb,
+                                          const float &beta, float *C,
+                                          const __int64_t cOffset,
+                                          const __int64_t ldc) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                        ldc);
+}
+
+/* SSYR2K - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_ssyr2k(hc::accelerator_view accl_view,
+                                          hcblasOrder order, hcblasUplo uplo,
+                                          hcblasTranspose typeA, const int N,
+                                          const int K, const float &alpha,
+                                          float *A[], const __int64_t aOffset,
+                                          const __int64_t A_batchOffset,
+                                          const __int64_t lda, float *B[],
+                                          const __int64_t bOffset,
+                                          const __int64_t B_batchOffset,
+                                          const __int64_t ldb,
+                                          const float &beta, float *C[],
+                                          const __int64_t cOffset,
+                                          const __int64_t C_batchOffset,
+                                          const __int64_t ldc,
+                                          const int batchSize) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb, beta, C, cOffset, C_batchOffset,
+                        ldc, batchSize);
+}
+
+/* DSYR2K - C = alpha * (op(A) * op(B)^T + op(B) * op(A)^T) + beta * C */
+hcblasStatus Hcblaslibrary::hcblas_dsyr2k(hc::accelerator_view accl_view,
+                                          hcblasOrder order, hcblasUplo uplo,
+                                          hcblasTranspose typeA, const int N,
+                                          const int K, const double &alpha,
+                                          double *A, const __int64_t aOffset,
+                                          const __int64_t lda, double *B,
+                                          const __int64_t bOffset,
+                                          const __int64_t ldb,
+                                          const double &beta, double *C,
+                                          const __int64_t cOffset,
+                                          const __int64_t ldc) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                        ldc);
+}
+
+/* DSYR2K - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_dsyr2k(hc::accelerator_view accl_view,
+                                          hcblasOrder order, hcblasUplo uplo,
+                                          hcblasTranspose typeA, const int N,
+                                          const int K, const double &alpha,
+                                          double *A[], const __int64_t aOffset,
+                                          const __int64_t A_batchOffset,
+                                          const __int64_t lda, double *B[],
+                                          const __int64_t bOffset,
+                                          const __int64_t B_batchOffset,
+                                          const __int64_t ldb,
+                                          const double &beta, double *C[],
+                                          const __int64_t cOffset,
+                                          const __int64_t C_batchOffset,
+                                          const __int64_t ldc,
+                                          const int batchSize) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb, beta, C, cOffset, C_batchOffset,
+                        ldc, batchSize);
+}
+
+/* CSYR2K - C = alpha * (op(A) * op(B)^T + op(B) * op(A)^T) + beta * C */
+hcblasStatus Hcblaslibrary::hcblas_csyr2k(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::float_2 *B,
+    const __int64_t bOffset, const __int64_t ldb,
+    const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                        ldc);
+}
+
+/* CSYR2K - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_csyr2k(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::float_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb,
+    const hc::short_vector::float_2 &beta, hc::short_vector::float_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb, beta, C, cOffset, C_batchOffset,
+                        ldc, batchSize);
+}
+
+/* ZSYR2K - C = alpha * (op(A) * op(B)^T + op(B) * op(A)^T) + beta * C */
+hcblasStatus Hcblaslibrary::hcblas_zsyr2k(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::double_2 *B,
+    const __int64_t bOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb, beta, C, cOffset,
+                        ldc);
+}
+
+/* ZSYR2K - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_zsyr2k(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb, beta, C, cOffset, C_batchOffset,
+                        ldc, batchSize);
+}
+
+/* CHER2K - C = alpha * op(A) * op(B)^H + conj(alpha) * op(B) * op(A)^H +
+   beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_cher2k(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::float_2 *B,
+    const __int64_t bOffset, const __int64_t ldb, const float &beta,
+    hc::short_vector::float_2 *C, const __int64_t cOffset,
+    const __int64_t ldc) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, true, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb,
+                        Level3Scalar<Level3Complex>::real(beta), C, cOffset,
+                        ldc);
+}
+
+/* CHER2K - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_cher2k(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::float_2 &alpha, hc::short_vector::float_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::float_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb, const float &beta,
+    hc::short_vector::float_2 *C[], const __int64_t cOffset,
+    const __int64_t C_batchOffset, const __int64_t ldc, const int batchSize) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, true, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb,
+                        Level3Scalar<Level3Complex>::real(beta), C, cOffset,
+                        C_batchOffset, ldc, batchSize);
+}
+
+/* ZHER2K - C = alpha * op(A) * op(B)^H + conj(alpha) * op(B) * op(A)^H +
+   beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_zher2k(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+    const __int64_t aOffset, const __int64_t lda, hc::short_vector::double_2 *B,
+    const __int64_t bOffset, const __int64_t ldb, const double &beta,
+    hc::short_vector::double_2 *C, const __int64_t cOffset,
+    const __int64_t ldc) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, true, N, K, alpha,
+                        A, aOffset, lda, B, bOffset, ldb,
+                        Level3Scalar<Level3DoubleComplex>::real(beta), C,
+                        cOffset, ldc);
+}
+
+/* ZHER2K - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_zher2k(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb, const double &beta,
+    hc::short_vector::double_2 *C[], const __int64_t cOffset,
+    const __int64_t C_batchOffset, const __int64_t ldc, const int batchSize) {
+  return syr2k_dispatch(this, accl_view, order, uplo, typeA, true, N, K, alpha,
+                        A, aOffset, A_batchOffset, lda, B, bOffset,
+                        B_batchOffset, ldb,
+                        Level3Scalar<Level3DoubleComplex>::real(beta), C,
+                        cOffset, C_batchOffset, ldc, batchSize);
+}
@@ -0,0 +1,328 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/level3/level3_triangle.h"
+
+namespace {
+
+// Shared by SYRK and HERK in the four precisions: checks the call, hands CPU
+// accelerator calls to host_syrk and folds row major layouts into the
+// column major triangle update (C^T is the other triangle of the product
+// with the other transpose; for HERK C^T = conj(C) is that product too)
+template <typename T>
+hcblasStatus syrk_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                           hcblasOrder order, hcblasUplo uplo,
+                           hcblasTranspose typeA, bool herm, int N, int K,
+                           T alpha, T *A, __int64_t aOffset, __int64_t lda,
+                           T beta, T *C, __int64_t cOffset, __int64_t ldc) {
+  // Quick return if possible
+  if (A == NULL || C == NULL || N <= 0 || K < 0) {
+    return HCBLAS_INVALID;
+  }
+  // Complex SYRK has no conjugate transpose and HERK no plain one
+  if (Level3Scalar<T>::complex && typeA == (herm ? Trans : ConjTrans)) {
+    return HCBLAS_INVALID;
+  }
+  bool trans = typeA != NoTrans;
+
+  // CPU accelerator: host triangle update over host_gemm
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_syrk<H>(order == ColMajor, uplo == Lower, trans, herm, N, K,
+                      Level3Host<T>::value(alpha),
+                      reinterpret_cast<const H *>(A + aOffset), lda,
+                      Level3Host<T>::value(beta),
+                      reinterpret_cast<H *>(C + cOffset), ldc)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    lower = !lower;
+    trans = !trans;
+  }
+  const hcblasTranspose opT = herm ? ConjTrans : Trans;
+  return triangle_update<T>(accl_view, lib->scratch,
+                            Level3Gemm(lib, accl_view, 1), lower, herm,
+                            trans ? opT : NoTrans, trans ? NoTrans : opT, N, K,
+                            alpha, A, aOffset, lda, A, aOffset, lda, beta, C,
+                            cOffset, ldc, 1);
+}
+
+template <typename T>
+hcblasStatus syrk_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                           hcblasOrder order, hcblasUplo uplo,
+                           hcblasTranspose typeA, bool herm, int N, int K,
+                           T alpha, T *A[], __int64_t aOffset,
+                           __int64_t A_batchOffset, __int64_t lda, T beta,
+                           T *C[], __int64_t cOffset, __int64_t C_batchOffset,
+                           __int64_t ldc, int batchSize) {
+  // Quick return if possible
+  if (A == NULL || C == NULL || N <= 0 || K < 0 || batchSize <= 0) {
+    return HCBLAS_INVALID;
+  }
+  if (Level3Scalar<T>::complex && typeA == (herm ? Trans : ConjTrans)) {
+    return HCBLAS_INVALID;
+  }
+  bool trans = typeA != NoTrans;
+  // Entry elt starts at X[elt] + xOffset + X_batchOffset, as in the batched
+  // GEMM kernels
+  aOffset += A_batchOffset;
+  cOffset += C_batchOffset;
+
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_syrk_batched<H>(order == ColMajor, uplo == Lower, trans, herm, N,
+                              K, Level3Host<T>::value(alpha),
+                              reinterpret_cast<H *const *>(A), aOffset, lda,
+                              Level3Host<T>::value(beta),
+                              reinterpret_cast<H *const *>(C), cOffset, ldc,
+                              batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    lower = !lower;
+    trans = !trans;
+  }
+  // Every entry's diagonal blocks share one launch, every off-diagonal block
+  // one batched GEMM
+  const hcblasTranspose opT = herm ? ConjTrans : Trans;
+  return triangle_update<T>(accl_view, lib->scratch,
+                            Level3Gemm(lib, accl_view, batchSize), lower, herm,
+                            trans ? opT : NoTrans, trans ? NoTrans : opT, N, K,
+                            alpha, A, aOffset, lda, A, aOffset, lda, beta, C,
+                            cOffset, ldc, batchSize);
+}
+
+}  // namespace
+
+/* SSYRK - C = alpha * op(A) * op(A)^T + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_ssyrk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K, const float &alpha,
+                                         float *A, const __int64_t aOffset,
+                                         const __int64_t lda, const float &beta,
+                                         float *C, const __int64_t cOffset,
+                                         const __int64_t ldc) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                       A, aOffset, lda, beta, C, cOffset, ldc);
+}
+
+/* SSYRK - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_ssyrk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K, const float &alpha,
+                                         float *A[], const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda, const float &beta,
+                                         float *C[], const __int64_t cOffset,
+                                         const __int64_t C_batchOffset,
+                                         const __int64_t ldc,
+                                         const int batchSize) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                       A, aOffset, A_batchOffset, lda, beta, C, cOffset,
+                       C_batchOffset, ldc, batchSize);
+}
+
+/* DSYRK - C = alpha * op(A) * op(A)^T + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_dsyrk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K, const double &alpha,
+                                         double *A, const __int64_t aOffset,
+                                         const __int64_t lda,
+                                         const double &beta, double *C,
+                                         const __int64_t cOffset,
+                                         const __int64_t ldc) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                       A, aOffset, lda, beta, C, cOffset, ldc);
+}
+
+/* DSYRK - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_dsyrk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K, const double &alpha,
+                                         double *A[], const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda,
+                                         const double &beta, double *C[],
+                                         const __int64_t cOffset,
+                                         const __int64_t C_batchOffset,
+                                         const __int64_t ldc,
+                                         const int batchSize) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                       A, aOffset, A_batchOffset, lda, beta, C, cOffset,
+                       C_batchOffset, ldc, batchSize);
+}
+
+/* CSYRK - C = alpha * op(A) * op(A)^T + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_csyrk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K,
+                                         const hc::short_vector::float_2 &alpha,
+                                         hc::short_vector::float_2 *A,
+                                         const __int64_t aOffset,
+                                         const __int64_t lda,
+                                         const hc::short_vector::float_2 &beta,
+                                         hc::short_vector::float_2 *C,
+                                         const __int64_t cOffset,
+                                         const __int64_t ldc) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                       A, aOffset, lda, beta, C, cOffset, ldc);
+}
+
+/* CSYRK - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_csyrk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K,
+                                         const hc::short_vector::float_2 &alpha,
+                                         hc::short_vector::float_2 *A[],
+                                         const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda,
+                                         const hc::short_vector::float_2 &beta,
+                                         hc::short_vector::float_2 *C[],
+                                         const __int64_t cOffset,
+                                         const __int64_t C_batchOffset,
+                                         const __int64_t ldc,
+                                         const int batchSize) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                       A, aOffset, A_batchOffset, lda, beta, C, cOffset,
+                       C_batchOffset, ldc, batchSize);
+}
+
+/* ZSYRK - C = alpha * op(A) * op(A)^T + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_zsyrk(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A,
+    const __int64_t aOffset, const __int64_t lda,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C,
+    const __int64_t cOffset, const __int64_t ldc) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                       A, aOffset, lda, beta, C, cOffset, ldc);
+}
+
+/* ZSYRK - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_zsyrk(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasUplo uplo,
+    hcblasTranspose typeA, const int N, const int K,
+    const hc::short_vector::double_2 &alpha, hc::short_vector::double_2 *A[],
+    const __int64_t aOffset, const __int64_t A_batchOffset, const __int64_t lda,
+    const hc::short_vector::double_2 &beta, hc::short_vector::double_2 *C[],
+    const __int64_t cOffset, const __int64_t C_batchOffset, const __int64_t ldc,
+    const int batchSize) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, false, N, K, alpha,
+                       A, aOffset, A_batchOffset, lda, beta, C, cOffset,
+                       C_batchOffset, ldc, batchSize);
+}
+
+/* CHERK - C = alpha * op(A) * op(A)^H + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_cherk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K, const float &alpha,
+                                         hc::short_vector::float_2 *A,
+                                         const __int64_t aOffset,
+                                         const __int64_t lda, const float &beta,
+                                         hc::short_vector::float_2 *C,
+                                         const __int64_t cOffset,
+                                         const __int64_t ldc) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, true, N, K,
+                       Level3Scalar<Level3Complex>::real(alpha), A, aOffset,
+                       lda, Level3Scalar<Level3Complex>::real(beta), C, cOffset,
+                       ldc);
+}
+
+/* CHERK - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_cherk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K, const float &alpha,
+                                         hc::short_vector::float_2 *A[],
+                                         const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda, const float &beta,
+                                         hc::short_vector::float_2 *C[],
+                                         const __int64_t cOffset,
+                                         const __int64_t C_batchOffset,
+                                         const __int64_t ldc,
+                                         const int batchSize) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, true, N, K,
+                       Level3Scalar<Level3Complex>::real(alpha), A, aOffset,
+                       A_batchOffset, lda,
+                       Level3Scalar<Level3Complex>::real(beta), C, cOffset,
+                       C_batchOffset, ldc, batchSize);
+}
+
+/* ZHERK - C = alpha * op(A) * op(A)^H + beta * C on one triangle */
+hcblasStatus Hcblaslibrary::hcblas_zherk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K, const double &alpha,
+                                         hc::short_vector::double_2 *A,
+                                         const __int64_t aOffset,
+                                         const __int64_t lda,
+                                         const double &beta,
+                                         hc::short_vector::double_2 *C,
+                                         const __int64_t cOffset,
+                                         const __int64_t ldc) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, true, N, K,
+                       Level3Scalar<Level3DoubleComplex>::real(alpha), A,
+                       aOffset, lda,
+                       Level3Scalar<Level3DoubleComplex>::real(beta), C,
+                       cOffset, ldc);
+}
+
+/* ZHERK - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_zherk(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasUplo uplo,
+                                         hcblasTranspose typeA, const int N,
+                                         const int K, const double &alpha,
+                                         hc::short_vector::double_2 *A[],
+                                         const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda,
+                                         const double &beta,
+                                         hc::short_vector::double_2 *C[],
+                                         const __int64_t cOffset,
+                                         const __int64_t C_batchOffset,
+                                         const __int64_t ldc,
+                                         const int batchSize) {
+  return syrk_dispatch(this, accl_view, order, uplo, typeA, true, N, K,
+                       Level3Scalar<Level3DoubleComplex>::real(alpha), A,
+                       aOffset, A_batchOffset, lda,
+                       Level3Scalar<Level3DoubleComplex>::real(beta), C,
+                       cOffset, C_batchOffset, ldc, batchSize);
+}
@@ -0,0 +1,230 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "./dispatch_trace.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+// Events kept per process; about 7 MB
+const size_t kTraceCapacity = 65536;
+
+const char *text(const char *s) { return s != NULL ? s : "-"; }
+
+long long round_up(long long value, long long step) {
+  return (value + step - 1) / step * step;
+}
+
+void set_padding(DispatchTraceEvent *event, long long paddedK) {
+  const double useful = static_cast<double>(event->M) * event->N * event->K;
+  const double issued = static_cast<double>(event->gridM) * event->tileM *
+                        event->gridN * event->tileN * paddedK;
+  event->padding = useful > 0 ? issued / useful : 1.0;
+}
+
+void dump_at_exit() { dispatch_trace()->dump(getenv("HCBLAS_TRACE")); }
+
+}  // namespace
+
+DispatchTrace::DispatchTrace(size_t capacity)
+    : mask([capacity] {
+        uint64_t size = 1;
+        while (size < capacity) size <<= 1;
+        return size - 1;
+      }()),
+      head(0),
+      epoch(std::chrono::steady_clock::now()) {
+  slots = new Slot[mask + 1];
+  for (uint64_t i = 0; i <= mask; i++) {
+    slots[i].sequence.store(0, std::memory_order_relaxed);
+  }
+}
+
+DispatchTrace::~DispatchTrace() { delete[] slots; }
+
+void DispatchTrace::record(DispatchTraceEvent event,
+                           std::chrono::steady_clock::time_point start) {
+  const uint64_t pos = head.fetch_add(1, std::memory_order_relaxed);
+  event.seq = pos;
+  event.start_us =
+      std::chrono::duration<double, std::micro>(start - epoch).count();
+  // Odd while the payload is written, 2 * (pos + 1) once it is complete
+  Slot &slot = slots[pos & mask];
+  slot.sequence.store(2 * pos + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.event = event;
+  slot.sequence.store(2 * pos + 2, std::memory_order_release);
+}
+
+void DispatchTrace::snapshot(std::vector<DispatchTraceEvent> *events) const {
+  events->clear();
+  const uint64_t end = head.load(std::memory_order_acquire);
+  const uint64_t begin = end > mask + 1 ? end - (mask + 1) : 0;
+  for (uint64_t pos = begin; pos < end; pos++) {
+    const Slot &slot = slots[pos & mask];
+    const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+    if (before != 2 * pos + 2) continue;
+    DispatchTraceEvent event = slot.event;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != before) continue;
+    events->push_back(event);
+  }
+}
+
+bool DispatchTrace::dump(const char *path) const {
+  FILE *out = fopen(path, "w");
+  if (out == NULL) {
+    fprintf(stderr, "hcblas: cannot write trace %s\n", path);
+    return false;
+  }
+  std::vector<DispatchTraceEvent> events;
+  snapshot(&events);
+  const size_t length = strlen(path);
+  const bool json = length >= 5 && strcmp(path + length - 5, ".json") == 0;
+  if (json) {
+    fprintf(out, "[\n");
+  } else {
+    fprintf(out,
+            "seq,start_us,elapsed_ms,routine,order,transA,transB,M,N,K,"
+            "variant,reason,grid_m,grid_n,tile_m,tile_n,splits,workers,"
+            "fixups,padding\n");
+  }
+  for (size_t i = 0; i < events.size(); i++) {
+    const DispatchTraceEvent &e = events[i];
+    if (json) {
+      fprintf(out,
+              "  {\"seq\": %llu, \"start_us\": %.3f, \"elapsed_ms\": %.6f, "
+              "\"routine\": \"%s\", \"order\": \"%c\", \"transA\": \"%c\", "
+              "\"transB\": \"%c\", \"M\": %d, \"N\": %d, \"K\": %d, "
+              "\"variant\": \"%s\", \"reason\": \"%s\", \"grid_m\": %d, "
+              "\"grid_n\": %d, \"tile_m\": %d, \"tile_n\": %d, "
+              "\"splits\": %d, \"workers\": %d, \"fixups\": %d, "
+              "\"padding\": %.4f}%s\n",
+              static_cast<unsigned long long>(e.seq), e.start_us,
+              e.elapsed_ms, text(e.routine), e.order, e.transA, e.transB,
+              e.M, e.N, e.K, text(e.variant), text(e.reason), e.gridM,
+              e.gridN, e.tileM, e.tileN, e.splits, e.workers, e.fixups,
+              e.padding, i + 1 < events.size() ? "," : "");
+    } else {
+      fprintf(out, "%llu,%.3f,%.6f,%s,%c,%c,%c,%d,%d,%d,%s,%s,%d,%d,%d,%d,"
+                   "%d,%d,%d,%.4f\n",
+              static_cast<unsigned long long>(e.seq), e.start_us,
+              e.elapsed_ms, text(e.routine), e.order, e.transA, e.transB,
+              e.M, e.N, e.K, text(e.variant), text(e.reason), e.gridM,
+              e.gridN, e.tileM, e.tileN, e.splits, e.workers, e.fixups,
+              e.padding);
+    }
+  }
+  if (json) fprintf(out, "]\n");
+  return fclose(out) == 0;
+}
+
+DispatchTrace *dispatch_trace() {
+  // Never freed: handles may record until the process exits
+  static DispatchTrace *trace = new DispatchTrace(kTraceCapacity);
+  return trace;
+}
+
+DispatchTrace *dispatch_trace_from_env() {
+  static const bool enabled = [] {
+    const char *path = getenv("HCBLAS_TRACE");
+    if (path == NULL || *path == '\0') return false;
+    dispatch_trace();
+    atexit(dump_at_exit);
+    return true;
+  }();
+  return enabled ? dispatch_trace() : NULL;
+}
+
+DispatchTraceEvent dispatch_trace_gemm(const char *routine, char order,
+                                       char transA, char transB, int M, int N,
+                                       int K) {
+  DispatchTraceEvent event = DispatchTraceEvent();
+  event.routine = routine;
+  event.order = order;
+  event.transA = transA;
+  event.transB = transB;
+  event.M = M;
+  event.N = N;
+  event.K = K;
+  event.splits = 1;
+  return event;
+}
+
+double dispatch_trace_ms(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+void dispatch_trace_tiled(DispatchTraceEvent *event, int tile, int microTile) {
+  const long long itemsM = (event->M + microTile - 1) / microTile;
+  const long long itemsN = (event->N + microTile - 1) / microTile;
+  event->gridM = static_cast<int>(round_up(itemsM, tile) / tile);
+  event->gridN = static_cast<int>(round_up(itemsN, tile) / tile);
+  event->tileM = event->tileN = tile * microTile;
+  set_padding(event, round_up(event->K, tile));
+}
+
+void dispatch_trace_panels(DispatchTraceEvent *event, int mr, int nr) {
+  event->gridM = (event->M + mr - 1) / mr;
+  event->gridN = (event->N + nr - 1) / nr;
+  event->tileM = mr;
+  event->tileN = nr;
+  set_padding(event, event->K);
+}
+
+void dispatch_trace_split_k(DispatchTraceEvent *event, int block, int kStep,
+                            int splits) {
+  dispatch_trace_panels(event, block, block);
+  // Ranges past K issue nothing; the last one stops at K
+  const long long chunk = round_up((event->K + splits - 1) / splits, kStep);
+  long long paddedK = 0;
+  for (int s = 0; s < splits; s++) {
+    const long long k = std::min<long long>(chunk, event->K - s * chunk);
+    if (k > 0) paddedK += round_up(k, kStep);
+  }
+  set_padding(event, paddedK);
+  event->splits = splits;
+  event->fixups = splits > 1 ? event->gridM * event->gridN : 0;
+}
+
+void dispatch_trace_stream_k(DispatchTraceEvent *event, int block, int kStep,
+                             int workers) {
+  dispatch_trace_panels(event, block, block);
+  set_padding(event, round_up(event->K, kStep));
+  event->workers = workers;
+  // A tile is fixed up when the workers holding its first and last
+  // iterations differ, as in gemm_stream_k_fixup
+  const long long kIters = (event->K + kStep - 1) / kStep;
+  const long long tiles = static_cast<long long>(event->gridM) * event->gridN;
+  const long long total = tiles * kIters;
+  event->fixups = 0;
+  for (long long t = 0; t < tiles && total > 0; t++) {
+    const long long w0 = ((t * kIters + 1) * workers - 1) / total;
+    const long long w1 = ((t + 1) * kIters * workers - 1) / total;
+    if (w0 != w1) event->fixups++;
+  }
+}
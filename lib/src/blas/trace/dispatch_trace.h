@@ -0,0 +1,144 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Per-call dispatch trace. When enabled (HCBLAS_TRACE or hcblasSetTrace),
+* GEMM calls record the routine, shape, the kernel variant that ran and why
+* it was chosen, the launch geometry with its padded-to-useful work ratio and
+* the elapsed time. Events go to a fixed size ring shared by the process:
+* writers claim a slot with one atomic increment and publish it through a
+* per-slot sequence number, so recording never takes a lock and the oldest
+* events are overwritten once the ring is full. A disabled handle only tests
+* a NULL pointer.
+*
+* Device calls are timed by waiting for the kernel, so tracing serializes
+* the stream it is enabled on.
+*/
+
+#ifndef LIB_SRC_BLAS_TRACE_DISPATCH_TRACE_H_
+#define LIB_SRC_BLAS_TRACE_DISPATCH_TRACE_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+struct DispatchTraceEvent {
+  // Call number within the process and start time since the trace began
+  uint64_t seq;
+  double start_us;
+  double elapsed_ms;
+  // Static strings: routine ("sgemm"), kernel variant and the reason it
+  // was picked ("table", "tuned", "trial", "tuning_db" or "fixed")
+  const char *routine;
+  const char *variant;
+  const char *reason;
+  char order;
+  char transA;
+  char transB;
+  int M;
+  int N;
+  int K;
+  // Work-groups (or host micro-panels) along M and N and the C elements
+  // each covers along M and N
+  int gridM;
+  int gridN;
+  int tileM;
+  int tileN;
+  // Schedule of the split-K and stream-K variants: K ranges computed
+  // separately (1 otherwise), persistent work-groups (0 for a grid launch)
+  // and blocks of C a second pass completes from partial products
+  int splits;
+  int workers;
+  int fixups;
+  // Multiply-adds issued over the M * N * K the call needs; 0 when the
+  // launch geometry is not modelled
+  double padding;
+};
+
+class DispatchTrace {
+ public:
+  // capacity is rounded up to a power of two
+  explicit DispatchTrace(size_t capacity);
+  ~DispatchTrace();
+
+  // Fills seq and start_us from start and stores the event
+  void record(DispatchTraceEvent event,
+              std::chrono::steady_clock::time_point start);
+
+  // Events still in the ring, oldest first. Slots being written are skipped.
+  void snapshot(std::vector<DispatchTraceEvent> *events) const;
+
+  // Writes the ring as JSON when path ends in .json, as CSV otherwise
+  bool dump(const char *path) const;
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> sequence;
+    DispatchTraceEvent event;
+  };
+
+  DispatchTrace(const DispatchTrace &);
+  DispatchTrace &operator=(const DispatchTrace &);
+
+  Slot *slots;
+  const uint64_t mask;
+  std::atomic<uint64_t> head;
+  const std::chrono::steady_clock::time_point epoch;
+};
+
+// Ring shared by every tracing handle, created on first use. With
+// HCBLAS_TRACE=<file> it is also written to that file at exit.
+DispatchTrace *dispatch_trace();
+
+// dispatch_trace() when HCBLAS_TRACE is set, NULL otherwise
+DispatchTrace *dispatch_trace_from_env();
+
+// GEMM event with the call's shape; variant, geometry and timing are left
+// to the caller
+DispatchTraceEvent dispatch_trace_gemm(const char *routine, char order,
+                                       char transA, char transB, int M, int N,
+                                       int K);
+
+// Milliseconds elapsed since start
+double dispatch_trace_ms(std::chrono::steady_clock::time_point start);
+
+// Geometry of a tiled kernel with the given work-group tile edge and
+// elements per work-item along it
+void dispatch_trace_tiled(DispatchTraceEvent *event, int tile, int microTile);
+
+// Geometry of a host GEMM blocked into mr x nr micro-panels
+void dispatch_trace_panels(DispatchTraceEvent *event, int mr, int nr);
+
+// Geometry of a split-K launch: block x block tiles of C, K cut into splits
+// ranges of whole kStep steps, and the pass reducing every tile
+void dispatch_trace_split_k(DispatchTraceEvent *event, int block, int kStep,
+                            int splits);
+
+// Geometry of a stream-K launch: block x block tiles of C whose kStep
+// iterations are shared by workers work-groups, and the fixup of the tiles
+// several of them share
+void dispatch_trace_stream_k(DispatchTraceEvent *event, int block, int kStep,
+                             int workers);
+
+#endif  // LIB_SRC_BLAS_TRACE_DISPATCH_TRACE_H_
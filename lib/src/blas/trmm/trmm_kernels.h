@@ -0,0 +1,192 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Blocked triangular multiply. B = alpha op(A) B (or alpha B op(A)) is cut
+* into diagonal blocks of at most TrmmBlock<T>::NB rows: each block of B is
+* multiplied by its diagonal block of A directly by trmm_multiply_launch, one
+* work-item per column (row for the right side) of B staged with the block in
+* local memory, and then picks up the rest of its row of op(A) with one GEMM
+* call. Only the blocks on the nonzero side of the diagonal are ever read.
+* The result overwrites B: blocks are visited in the order that leaves the
+* parts of B their GEMM reads untouched, so no second buffer is needed.
+* Batched products use the same kernels over pointer arrays.
+*
+* Everything here is column major with op a plain transpose; the wrappers
+* fold row major layouts and conjugate transposes into these cases.
+*/
+
+#ifndef LIB_SRC_BLAS_TRMM_TRMM_KERNELS_H_
+#define LIB_SRC_BLAS_TRMM_TRMM_KERNELS_H_
+
+#include "src/blas/level3/level3_common.h"
+#include <algorithm>
+
+// Diagonal block size NB and columns of B per work-group WG of the direct
+// multiply; the NB x NB block and the NB x WG slice of B share 64 KB of LDS
+template <typename T>
+struct TrmmBlock {
+  enum { NB = 64, WG = 64 };
+};
+template <>
+struct TrmmBlock<double> {
+  enum { NB = 64, WG = 32 };
+};
+template <>
+struct TrmmBlock<Level3Complex> {
+  enum { NB = 64, WG = 32 };
+};
+template <>
+struct TrmmBlock<Level3DoubleComplex> {
+  enum { NB = 32, WG = 32 };
+};
+
+// y = alpha T x for the nvec vectors of an nb x nb diagonal block, in place.
+// T[r][c] is A(c, r) when transT and A(r, c) otherwise; vector v of the left
+// side is column v of B, of the right side row v. Work-group (elt, 0, g)
+// handles vectors g * WG .. g * WG + WG - 1 of product elt.
+template <typename T, typename P>
+void trmm_multiply_launch(hc::accelerator_view accl_view, P A,
+                          __int64_t aOffset, __int64_t lda, P B,
+                          __int64_t bOffset, __int64_t ldb, int nb, int nvec,
+                          bool left, bool transT, bool lowerT, bool unit,
+                          T alpha, int batchSize) {
+  enum { NB = TrmmBlock<T>::NB, WG = TrmmBlock<T>::WG };
+  const int groups = (nvec + WG - 1) / WG;
+  hc::extent<3> grdExt(batchSize, 1, groups * WG);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, 1, WG);
+  const __int64_t se = left ? 1 : ldb;
+  const __int64_t sv = left ? ldb : 1;
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    tile_static T lT[NB * NB];
+    tile_static T lX[NB * (WG + 1)];
+    const int lid = tidx.local[2];
+    const int first = tidx.tile[2] * WG;
+    const T *a = level3_entry(A, tidx.tile[0]) + aOffset;
+    T *b = level3_entry(B, tidx.tile[0]) + bOffset;
+    // lT is row major T; only its triangle is loaded
+    for (int idx = lid; idx < nb * nb; idx += WG) {
+      const int r = idx % nb;
+      const int c = idx / nb;
+      const int tr = transT ? c : r;
+      const int tc = transT ? r : c;
+      if (lowerT ? tr >= tc : tr <= tc) lT[tr * NB + tc] = a[r + c * lda];
+    }
+    // Stride-one walk over B: down the columns on the left side, along the
+    // rows on the right
+    for (int idx = lid; idx < nb * WG; idx += WG) {
+      const int r = left ? idx % nb : idx / WG;
+      const int vv = left ? idx / nb : idx % WG;
+      if (first + vv < nvec) {
+        lX[r * (WG + 1) + vv] = b[r * se + (first + vv) * sv];
+      }
+    }
+    tidx.barrier.wait();
+    if (first + lid < nvec) {
+      // Entry r only reads entries on the far side of the diagonal, which
+      // are still unchanged when r walks toward the zero triangle
+      for (int s = 0; s < nb; s++) {
+        const int r = lowerT ? nb - 1 - s : s;
+        T y = lX[r * (WG + 1) + lid];
+        if (!unit) y = level3_mul(lT[r * NB + r], y);
+        const int cBegin = lowerT ? 0 : r + 1;
+        const int cEnd = lowerT ? r : nb;
+        for (int c = cBegin; c < cEnd; c++) {
+          y += level3_mul(lT[r * NB + c], lX[c * (WG + 1) + lid]);
+        }
+        lX[r * (WG + 1) + lid] = level3_mul(alpha, y);
+      }
+    }
+    tidx.barrier.wait();
+    for (int idx = lid; idx < nb * WG; idx += WG) {
+      const int r = left ? idx % nb : idx / WG;
+      const int vv = left ? idx / nb : idx % WG;
+      if (first + vv < nvec) {
+        b[r * se + (first + vv) * sv] = lX[r * (WG + 1) + vv];
+      }
+    }
+  });
+}
+
+// Column major blocked product B = alpha op(A) B (left) or B = alpha B op(A),
+// in place. conj makes op a conjugate transpose and needs trans.
+// gemm(transA, transB, M, N, K, alpha, A, aOffset, lda, B, bOffset, ldb,
+// beta, C, cOffset, ldc) runs the off-diagonal blocks on the same kind of
+// pointers as A and B.
+template <typename T, typename P, typename Gemm>
+hcblasStatus trmm_blocked(hc::accelerator_view accl_view, Gemm gemm,
+                          bool left, bool lower, bool trans, bool conj,
+                          bool unit, int M, int N, T alpha, P A,
+                          __int64_t aOffset, __int64_t lda, P B,
+                          __int64_t bOffset, __int64_t ldb, int batchSize) {
+  enum { NB = TrmmBlock<T>::NB };
+  if (level3_is_zero(alpha)) {
+    level3_touch_launch<T>(accl_view, B, bOffset, ldb, M, N, false, batchSize);
+    return HCBLAS_SUCCEEDS;
+  }
+  // op(A) = A^H: conj(B) is the transposed product of conj(alpha) B^*
+  conj = conj && Level3Scalar<T>::complex;
+  if (conj) {
+    level3_touch_launch<T>(accl_view, B, bOffset, ldb, M, N, true, batchSize);
+    alpha = level3_conj(alpha);
+  }
+  const int n = left ? M : N;
+  const int nvec = left ? N : M;
+  // The product is y = T x per vector, T = op(A) on the left side and
+  // op(A)^T on the right. Block i of y reads blocks 0 .. i of x when T is
+  // lower triangular, so blocks go backward then and forward otherwise.
+  const bool transT = left == trans;
+  const bool lowerT = left ? lower != trans : lower == trans;
+  const int blocks = (n + NB - 1) / NB;
+  const hcblasTranspose opA = trans ? Trans : NoTrans;
+  const T one = Level3Scalar<T>::real(1.0);
+  hcblasStatus status = HCBLAS_SUCCEEDS;
+  for (int s = 0; s < blocks && status == HCBLAS_SUCCEEDS; s++) {
+    const int blk = lowerT ? blocks - 1 - s : s;
+    const int i0 = blk * NB;
+    const int nb = std::min(static_cast<int>(NB), n - i0);
+    trmm_multiply_launch<T>(accl_view, A, aOffset + i0 + i0 * lda, lda, B,
+                            bOffset + (left ? i0 : i0 * ldb), ldb, nb, nvec,
+                            left, transT, lowerT, unit, alpha, batchSize);
+    // Blocks not yet overwritten on the nonzero side of block i
+    const int r0 = lowerT ? 0 : i0 + nb;
+    const int rn = lowerT ? i0 : n - r0;
+    if (rn == 0) continue;
+    if (left) {
+      // B_i += alpha op(A)_ir B_r
+      status = gemm(opA, NoTrans, nb, N, rn, alpha, A,
+                    aOffset + (trans ? r0 + i0 * lda : i0 + r0 * lda), lda, B,
+                    bOffset + r0, ldb, one, B, bOffset + i0, ldb);
+    } else {
+      // B_i += alpha B_r op(A)_ri
+      status = gemm(NoTrans, opA, M, nb, rn, alpha, B, bOffset + r0 * ldb,
+                    ldb, A, aOffset + (trans ? i0 + r0 * lda : r0 + i0 * lda),
+                    lda, one, B, bOffset + i0 * ldb, ldb);
+    }
+  }
+  if (conj) {
+    level3_touch_launch<T>(accl_view, B, bOffset, ldb, M, N, true, batchSize);
+  }
+  return status;
+}
+
+#endif  // LIB_SRC_BLAS_TRMM_TRMM_KERNELS_H_
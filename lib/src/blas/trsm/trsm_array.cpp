@@ -0,0 +1,243 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/trsm/trsm_kernels.h"
+#include <algorithm>
+
+namespace {
+
+// Shared by the four precisions: checks the call, hands CPU accelerator
+// calls to host_trsm and folds row major layouts into the column major
+// blocked solve (B^T = X^T op(A)^T swaps the side and the triangle)
+template <typename T>
+hcblasStatus trsm_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                           hcblasOrder order, hcblasSide side, hcblasUplo uplo,
+                           hcblasTranspose typeA, hcblasDiag diag, int M,
+                           int N, T alpha, T *A, __int64_t aOffset,
+                           __int64_t lda, T *B, __int64_t bOffset,
+                           __int64_t ldb) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || M <= 0 || N <= 0) {
+    return HCBLAS_INVALID;
+  }
+  const bool trans = typeA != NoTrans;
+  const bool conj = typeA == ConjTrans;
+
+  // CPU accelerator: blocked host solve over host_gemm
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_trsm<H>(order == ColMajor, side == Left, uplo == Lower, trans,
+                      conj, diag == Unit, M, N, Level3Host<T>::value(alpha),
+                      reinterpret_cast<const H *>(A + aOffset), lda,
+                      reinterpret_cast<H *>(B + bOffset), ldb)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool left = side == Left;
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    left = !left;
+    lower = !lower;
+    std::swap(M, N);
+  }
+  return trsm_blocked<T>(accl_view, Level3Gemm(lib, accl_view, 1), left,
+                         lower, trans, conj, diag == Unit, M, N, alpha, A,
+                         aOffset, lda, B, bOffset, ldb, 1);
+}
+
+template <typename T>
+hcblasStatus trsm_dispatch(Hcblaslibrary *lib, hc::accelerator_view accl_view,
+                           hcblasOrder order, hcblasSide side, hcblasUplo uplo,
+                           hcblasTranspose typeA, hcblasDiag diag, int M,
+                           int N, T alpha, T *A[], __int64_t aOffset,
+                           __int64_t A_batchOffset, __int64_t lda, T *B[],
+                           __int64_t bOffset, __int64_t B_batchOffset,
+                           __int64_t ldb, int batchSize) {
+  // Quick return if possible
+  if (A == NULL || B == NULL || M <= 0 || N <= 0 || batchSize <= 0) {
+    return HCBLAS_INVALID;
+  }
+  const bool trans = typeA != NoTrans;
+  const bool conj = typeA == ConjTrans;
+  // Entry elt starts at X[elt] + xOffset + X_batchOffset, as in the batched
+  // GEMM kernels
+  aOffset += A_batchOffset;
+  bOffset += B_batchOffset;
+
+  if (lib->hostExecution) {
+    typedef typename Level3Host<T>::type H;
+    if (!host_trsm_batched<H>(order == ColMajor, side == Left, uplo == Lower,
+                              trans, conj, diag == Unit, M, N,
+                              Level3Host<T>::value(alpha),
+                              reinterpret_cast<H *const *>(A), aOffset, lda,
+                              reinterpret_cast<H *const *>(B), bOffset, ldb,
+                              batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
+  bool left = side == Left;
+  bool lower = uplo == Lower;
+  if (order == RowMajor) {
+    left = !left;
+    lower = !lower;
+    std::swap(M, N);
+  }
+  // Systems of up to TrsmBlock<T>::NB unknowns take a single launch
+  return trsm_blocked<T>(accl_view, Level3Gemm(lib, accl_view, batchSize),
+                         left, lower, trans, conj, diag == Unit, M, N, alpha,
+                         A, aOffset, lda, B, bOffset, ldb, batchSize);
+}
+
+}  // namespace
+
+/* STRSM - op(A) * X = alpha * B or X * op(A) = alpha * B */
+hcblasStatus Hcblaslibrary::hcblas_strsm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, hcblasTranspose typeA,
+                                         hcblasDiag diag, const int M,
+                                         const int N, const float &alpha,
+                                         float *A, const __int64_t aOffset,
+                                         const __int64_t lda, float *B,
+                                         const __int64_t bOffset,
+                                         const __int64_t ldb) {
+  return trsm_dispatch(this, accl_view, order, side, uplo, typeA, diag, M, N,
+                       alpha, A, aOffset, lda, B, bOffset, ldb);
+}
+
+/* STRSM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_strsm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, hcblasTranspose typeA,
+                                         hcblasDiag diag, const int M,
+                                         const int N, const float &alpha,
+                                         float *A[], const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda, float *B[],
+                                         const __int64_t bOffset,
+                                         const __int64_t B_batchOffset,
+                                         const __int64_t ldb,
+                                         const int batchSize) {
+  return trsm_dispatch(this, accl_view, order, side, uplo, typeA, diag, M, N,
+                       alpha, A, aOffset, A_batchOffset, lda, B, bOffset,
+                       B_batchOffset, ldb, batchSize);
+}
+
+/* DTRSM - op(A) * X = alpha * B or X * op(A) = alpha * B */
+hcblasStatus Hcblaslibrary::hcblas_dtrsm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, hcblasTranspose typeA,
+                                         hcblasDiag diag, const int M,
+                                         const int N, const double &alpha,
+                                         double *A, const __int64_t aOffset,
+                                         const __int64_t lda, double *B,
+                                         const __int64_t bOffset,
+                                         const __int64_t ldb) {
+  return trsm_dispatch(this, accl_view, order, side, uplo, typeA, diag, M, N,
+                       alpha, A, aOffset, lda, B, bOffset, ldb);
+}
+
+/* DTRSM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_dtrsm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, hcblasTranspose typeA,
+                                         hcblasDiag diag, const int M,
+                                         const int N, const double &alpha,
+                                         double *A[], const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda, double *B[],
+                                         const __int64_t bOffset,
+                                         const __int64_t B_batchOffset,
+                                         const __int64_t ldb,
+                                         const int batchSize) {
+  return trsm_dispatch(this, accl_view, order, side, uplo, typeA, diag, M, N,
+                       alpha, A, aOffset, A_batchOffset, lda, B, bOffset,
+                       B_batchOffset, ldb, batchSize);
+}
+
+/* CTRSM - op(A) * X = alpha * B or X * op(A) = alpha * B */
+hcblasStatus Hcblaslibrary::hcblas_ctrsm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, hcblasTranspose typeA,
+                                         hcblasDiag diag, const int M,
+                                         const int N,
+                                         const hc::short_vector::float_2 &alpha,
+                                         hc::short_vector::float_2 *A,
+                                         const __int64_t aOffset,
+                                         const __int64_t lda,
+                                         hc::short_vector::float_2 *B,
+                                         const __int64_t bOffset,
+                                         const __int64_t ldb) {
+  return trsm_dispatch(this, accl_view, order, side, uplo, typeA, diag, M, N,
+                       alpha, A, aOffset, lda, B, bOffset, ldb);
+}
+
+/* CTRSM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_ctrsm(hc::accelerator_view accl_view,
+                                         hcblasOrder order, hcblasSide side,
+                                         hcblasUplo uplo, hcblasTranspose typeA,
+                                         hcblasDiag diag, const int M,
+                                         const int N,
+                                         const hc::short_vector::float_2 &alpha,
+                                         hc::short_vector::float_2 *A[],
+                                         const __int64_t aOffset,
+                                         const __int64_t A_batchOffset,
+                                         const __int64_t lda,
+                                         hc::short_vector::float_2 *B[],
+                                         const __int64_t bOffset,
+                                         const __int64_t B_batchOffset,
+                                         const __int64_t ldb,
+                                         const int batchSize) {
+  return trsm_dispatch(this, accl_view, order, side, uplo, typeA, diag, M, N,
+                       alpha, A, aOffset, A_batchOffset, lda, B, bOffset,
+                       B_batchOffset, ldb, batchSize);
+}
+
+/* ZTRSM - op(A) * X = alpha * B or X * op(A) = alpha * B */
+hcblasStatus Hcblaslibrary::hcblas_ztrsm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasSide side,
+    hcblasUplo uplo, hcblasTranspose typeA, hcblasDiag diag, const int M,
+    const int N, const hc::short_vector::double_2 &alpha,
+    hc::short_vector::double_2 *A, const __int64_t aOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B, const __int64_t bOffset,
+    const __int64_t ldb) {
+  return trsm_dispatch(this, accl_view, order, side, uplo, typeA, diag, M, N,
+                       alpha, A, aOffset, lda, B, bOffset, ldb);
+}
+
+/* ZTRSM - Overloaded function with arguments related to batch processing */
+hcblasStatus Hcblaslibrary::hcblas_ztrsm(
+    hc::accelerator_view accl_view, hcblasOrder order, hcblasSide side,
+    hcblasUplo uplo, hcblasTranspose typeA, hcblasDiag diag, const int M,
+    const int N, const hc::short_vector::double_2 &alpha,
+    hc::short_vector::double_2 *A[], const __int64_t aOffset,
+    const __int64_t A_batchOffset, const __int64_t lda,
+    hc::short_vector::double_2 *B[], const __int64_t bOffset,
+    const __int64_t B_batchOffset, const __int64_t ldb, const int batchSize) {
+  return trsm_dispatch(this, accl_view, order, side, uplo, typeA, diag, M, N,
+                       alpha, A, aOffset, A_batchOffset, lda, B, bOffset,
+                       B_batchOffset, ldb, batchSize);
+}
@@ -0,0 +1,187 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/*
+* Blocked triangular solve. op(A) X = alpha B (or X op(A) = alpha B) is cut
+* into diagonal blocks of at most TrsmBlock<T>::NB rows: each block is solved
+* directly by trsm_solve_launch, one work-item per column (row for the right
+* side) of B staged with the block in local memory, and the rest of B is
+* updated with one GEMM call per block so most of the work runs through the
+* tuned GEMM paths. Batched systems use the same kernels over pointer arrays.
+*
+* Everything here is column major with op a plain transpose; the wrappers
+* fold row major layouts and conjugate transposes into these cases.
+*/
+
+#ifndef LIB_SRC_BLAS_TRSM_TRSM_KERNELS_H_
+#define LIB_SRC_BLAS_TRSM_TRSM_KERNELS_H_
+
+#include "src/blas/level3/level3_common.h"
+#include <algorithm>
+
+// Diagonal block size NB and columns of B per work-group WG of the direct
+// solve; the NB x NB block and the NB x WG slice of B share 64 KB of LDS
+template <typename T>
+struct TrsmBlock {
+  enum { NB = 64, WG = 64 };
+};
+template <>
+struct TrsmBlock<double> {
+  enum { NB = 64, WG = 32 };
+};
+template <>
+struct TrsmBlock<Level3Complex> {
+  enum { NB = 64, WG = 32 };
+};
+template <>
+struct TrsmBlock<Level3DoubleComplex> {
+  enum { NB = 32, WG = 32 };
+};
+
+// Solves T y = alpha b for the nvec vectors of an nb x nb diagonal block,
+// in place. T[r][c] is A(c, r) when transT and A(r, c) otherwise; vector v
+// of the left side is column v of B, of the right side row v. Work-group
+// (elt, 0, g) handles vectors g * WG .. g * WG + WG - 1 of system elt.
+template <typename T, typename P>
+void trsm_solve_launch(hc::accelerator_view accl_view, P A, __int64_t aOffset,
+                       __int64_t lda, P B, __int64_t bOffset, __int64_t ldb,
+                       int nb, int nvec, bool left, bool transT, bool lowerT,
+                       bool unit, T alpha, int batchSize) {
+  enum { NB = TrsmBlock<T>::NB, WG = TrsmBlock<T>::WG };
+  const int groups = (nvec + WG - 1) / WG;
+  hc::extent<3> grdExt(batchSize, 1, groups * WG);
+  hc::tiled_extent<3> t_ext = grdExt.tile(1, 1, WG);
+  const __int64_t se = left ? 1 : ldb;
+  const __int64_t sv = left ? ldb : 1;
+  hc::parallel_for_each(accl_view, t_ext, [=](hc::tiled_index<3> tidx)[[hc]] {
+    tile_static T lT[NB * NB];
+    tile_static T lX[NB * (WG + 1)];
+    const int lid = tidx.local[2];
+    const int first = tidx.tile[2] * WG;
+    const T *a = level3_entry(A, tidx.tile[0]) + aOffset;
+    T *b = level3_entry(B, tidx.tile[0]) + bOffset;
+    // lT is row major T
+    for (int idx = lid; idx < nb * nb; idx += WG) {
+      const int r = idx % nb;
+      const int c = idx / nb;
+      lT[transT ? c * NB + r : r * NB + c] = a[r + c * lda];
+    }
+    // Stride-one walk over B: down the columns on the left side, along the
+    // rows on the right
+    for (int idx = lid; idx < nb * WG; idx += WG) {
+      const int r = left ? idx % nb : idx / WG;
+      const int vv = left ? idx / nb : idx % WG;
+      if (first + vv < nvec) {
+        lX[r * (WG + 1) + vv] =
+            level3_mul(alpha, b[r * se + (first + vv) * sv]);
+      }
+    }
+    tidx.barrier.wait();
+    if (first + lid < nvec) {
+      for (int s = 0; s < nb; s++) {
+        const int c = lowerT ? s : nb - 1 - s;
+        T x = lX[c * (WG + 1) + lid];
+        if (!unit) x = level3_div(x, lT[c * NB + c]);
+        lX[c * (WG + 1) + lid] = x;
+        const int rBegin = lowerT ? c + 1 : 0;
+        const int rEnd = lowerT ? nb : c;
+        for (int r = rBegin; r < rEnd; r++) {
+          lX[r * (WG + 1) + lid] -= level3_mul(lT[r * NB + c], x);
+        }
+      }
+    }
+    tidx.barrier.wait();
+    for (int idx = lid; idx < nb * WG; idx += WG) {
+      const int r = left ? idx % nb : idx / WG;
+      const int vv = left ? idx / nb : idx % WG;
+      if (first + vv < nvec) {
+        b[r * se + (first + vv) * sv] = lX[r * (WG + 1) + vv];
+      }
+    }
+  });
+}
+
+// Column major blocked solve of op(A) X = alpha B (left) or X op(A) = alpha
+// B, X overwriting B. conj makes op a conjugate transpose and needs trans.
+// gemm(transA, transB, M, N, K, alpha, A, aOffset, lda, B, bOffset, ldb,
+// beta, C, cOffset, ldc) runs the updates on the same kind of pointers as
+// A and B.
+template <typename T, typename P, typename Gemm>
+hcblasStatus trsm_blocked(hc::accelerator_view accl_view, Gemm gemm,
+                          bool left, bool lower, bool trans, bool conj,
+                          bool unit, int M, int N, T alpha, P A,
+                          __int64_t aOffset, __int64_t lda, P B,
+                          __int64_t bOffset, __int64_t ldb, int batchSize) {
+  enum { NB = TrsmBlock<T>::NB };
+  if (level3_is_zero(alpha)) {
+    level3_touch_launch<T>(accl_view, B, bOffset, ldb, M, N, false, batchSize);
+    return HCBLAS_SUCCEEDS;
+  }
+  // op(A) = A^H: conj(X) solves the transposed system with conj(alpha) B^*
+  conj = conj && Level3Scalar<T>::complex;
+  if (conj) {
+    level3_touch_launch<T>(accl_view, B, bOffset, ldb, M, N, true, batchSize);
+    alpha = level3_conj(alpha);
+  }
+  const int n = left ? M : N;
+  const int nvec = left ? N : M;
+  // The solved system is T y = b per vector, T = op(A) on the left side and
+  // op(A)^T on the right; blocks go forward when T is lower triangular
+  const bool transT = left == trans;
+  const bool lowerT = left ? lower != trans : lower == trans;
+  const int blocks = (n + NB - 1) / NB;
+  const hcblasTranspose opA = trans ? Trans : NoTrans;
+  const T one = Level3Scalar<T>::real(1.0);
+  const T minusOne = Level3Scalar<T>::real(-1.0);
+  hcblasStatus status = HCBLAS_SUCCEEDS;
+  for (int s = 0; s < blocks && status == HCBLAS_SUCCEEDS; s++) {
+    const int blk = lowerT ? s : blocks - 1 - s;
+    const int i0 = blk * NB;
+    const int nb = std::min(static_cast<int>(NB), n - i0);
+    // alpha scales B once: the first block here, the rest in its update
+    const T scale = s == 0 ? alpha : one;
+    trsm_solve_launch<T>(accl_view, A, aOffset + i0 + i0 * lda, lda, B,
+                         bOffset + (left ? i0 : i0 * ldb), ldb, nb, nvec, left,
+                         transT, lowerT, unit, scale, batchSize);
+    // Blocks still to be solved
+    const int r0 = lowerT ? i0 + nb : 0;
+    const int rn = lowerT ? n - r0 : i0;
+    if (rn == 0) continue;
+    if (left) {
+      // B_r = scale * B_r - op(A)_ri X_i
+      status = gemm(opA, NoTrans, rn, N, nb, minusOne, A,
+                    aOffset + (trans ? i0 + r0 * lda : r0 + i0 * lda), lda, B,
+                    bOffset + i0, ldb, scale, B, bOffset + r0, ldb);
+    } else {
+      // B_r = scale * B_r - X_i op(A)_ir
+      status = gemm(NoTrans, opA, M, rn, nb, minusOne, B, bOffset + i0 * ldb,
+                    ldb, A, aOffset + (trans ? r0 + i0 * lda : i0 + r0 * lda),
+                    lda, scale, B, bOffset + r0 * ldb, ldb);
+    }
+  }
+  if (conj) {
+    level3_touch_launch<T>(accl_view, B, bOffset, ldb, M, N, true, batchSize);
+  }
+  return status;
+}
+
+#endif  // LIB_SRC_BLAS_TRSM_TRSM_KERNELS_H_
@@ -0,0 +1,349 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "./tuning_db.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <sstream>
+
+namespace {
+
+const char kMagic[8] = {'H', 'C', 'B', 'L', 'T', 'D', 'B', '1'};
+
+struct TuningDbHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t count;
+  // NUL terminated, truncated to fit
+  char signature[240];
+};
+
+bool record_less(const TuningRecord &a, const TuningRecord &b) {
+  if (a.kind != b.kind) return a.kind < b.kind;
+  return std::lexicographical_compare(a.key, a.key + 7, b.key, b.key + 7);
+}
+
+bool same_key(const TuningRecord &a, const TuningRecord &b) {
+  return !record_less(a, b) && !record_less(b, a);
+}
+
+void fill_header(TuningDbHeader *header, const std::string &signature,
+                 uint32_t count) {
+  memset(header, 0, sizeof(*header));
+  memcpy(header->magic, kMagic, sizeof(kMagic));
+  header->version = HCBLAS_TUNING_VERSION;
+  header->count = count;
+  strncpy(header->signature, signature.c_str(),
+          sizeof(header->signature) - 1);
+}
+
+// Number of records in a file image, -1 when it is not a database for this
+// signature and version
+long long valid_records(const void *data, size_t bytes,
+                        const std::string &signature) {
+  if (bytes < sizeof(TuningDbHeader)) return -1;
+  TuningDbHeader expected;
+  fill_header(&expected, signature, 0);
+  const TuningDbHeader *header = static_cast<const TuningDbHeader *>(data);
+  if (memcmp(header->magic, expected.magic, sizeof(kMagic)) != 0 ||
+      header->version != expected.version ||
+      memcmp(header->signature, expected.signature,
+             sizeof(expected.signature)) != 0 ||
+      bytes != sizeof(TuningDbHeader) +
+                   static_cast<size_t>(header->count) * sizeof(TuningRecord)) {
+    return -1;
+  }
+  return header->count;
+}
+
+bool write_all(int fd, const void *data, size_t bytes) {
+  const char *p = static_cast<const char *>(data);
+  while (bytes > 0) {
+    ssize_t n = write(fd, p, bytes);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    p += n;
+    bytes -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+// Databases opened by tuning_db_open, live until the process exits
+std::mutex &registry_lock() {
+  static std::mutex *lock = new std::mutex();
+  return *lock;
+}
+
+std::map<std::string, TuningDb *> &registry() {
+  static std::map<std::string, TuningDb *> *dbs =
+      new std::map<std::string, TuningDb *>();
+  return *dbs;
+}
+
+void flush_registry() {
+  std::lock_guard<std::mutex> guard(registry_lock());
+  for (std::map<std::string, TuningDb *>::iterator it = registry().begin();
+       it != registry().end(); ++it) {
+    it->second->flush();
+  }
+}
+
+}  // namespace
+
+uint64_t tuning_hash(const char *text) {
+  uint64_t h = 14695981039346656037ULL;
+  for (const unsigned char *p = reinterpret_cast<const unsigned char *>(text);
+       *p != '\0'; p++) {
+    h = (h ^ *p) * 1099511628211ULL;
+  }
+  return h;
+}
+
+TuningDb::Snapshot::Snapshot()
+    : base(NULL), bytes(0), records(NULL), count(0), dev(0), ino(0),
+      mtime(0) {}
+
+TuningDb::Snapshot::~Snapshot() {
+  if (base != NULL) munmap(base, bytes);
+}
+
+TuningDb::TuningDb(const std::string &path, const std::string &signature)
+    : file(path), signature(signature) {
+  refresh();
+}
+
+TuningDb::~TuningDb() { flush(); }
+
+std::shared_ptr<const TuningDb::Snapshot> TuningDb::map_file() const {
+  std::shared_ptr<Snapshot> snap(new Snapshot());
+  int fd = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return snap;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    snap->dev = st.st_dev;
+    snap->ino = st.st_ino;
+    snap->mtime = static_cast<int64_t>(st.st_mtime);
+    size_t bytes = static_cast<size_t>(st.st_size);
+    void *base = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    if (base != MAP_FAILED) {
+      long long count = valid_records(base, bytes, signature);
+      if (count < 0) {
+        fprintf(stderr, "hcblas: ignoring tuning database %s\n",
+                file.c_str());
+        munmap(base, bytes);
+      } else {
+        snap->base = base;
+        snap->bytes = bytes;
+        snap->records = reinterpret_cast<const TuningRecord *>(
+            static_cast<const char *>(base) + sizeof(TuningDbHeader));
+        snap->count = static_cast<uint32_t>(count);
+      }
+    }
+  }
+  close(fd);
+  return snap;
+}
+
+void TuningDb::refresh() {
+  std::lock_guard<std::mutex> guard(lock);
+  std::shared_ptr<const Snapshot> old = std::atomic_load(&current);
+  if (old != NULL) {
+    // Replacing the file gives it a new inode; an unchanged one is current
+    struct stat st;
+    if (stat(file.c_str(), &st) != 0) return;
+    if (old->base != NULL && st.st_dev == old->dev && st.st_ino == old->ino &&
+        static_cast<int64_t>(st.st_mtime) == old->mtime) {
+      return;
+    }
+  }
+  // Lookups still searching the old mapping hold it until they return
+  std::atomic_store(&current, map_file());
+}
+
+bool TuningDb::lookup(uint32_t kind, const int64_t key[7],
+                      int64_t *value) const {
+  std::shared_ptr<const Snapshot> snap = std::atomic_load(&current);
+  if (snap == NULL || snap->count == 0) return false;
+  TuningRecord probe;
+  probe.kind = kind;
+  std::copy(key, key + 7, probe.key);
+  const TuningRecord *end = snap->records + snap->count;
+  const TuningRecord *it =
+      std::lower_bound(snap->records, end, probe, record_less);
+  if (it == end || !same_key(*it, probe)) return false;
+  *value = it->value;
+  return true;
+}
+
+bool TuningDb::read_records(std::vector<TuningRecord> *records) const {
+  records->clear();
+  int fd = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return errno == ENOENT;
+  struct stat st;
+  bool ok = fstat(fd, &st) == 0;
+  std::vector<char> data(ok ? static_cast<size_t>(st.st_size) : 0);
+  size_t got = 0;
+  while (ok && got < data.size()) {
+    ssize_t n = read(fd, &data[got], data.size() - got);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    got += static_cast<size_t>(n);
+  }
+  close(fd);
+  // A foreign or damaged file is rewritten from scratch
+  long long count =
+      (ok && got == data.size()) ? valid_records(data.data(), got, signature)
+                                 : -1;
+  if (count > 0) {
+    const TuningRecord *first = reinterpret_cast<const TuningRecord *>(
+        data.data() + sizeof(TuningDbHeader));
+    records->assign(first, first + count);
+  }
+  return ok;
+}
+
+bool TuningDb::store(const std::vector<TuningRecord> &add) {
+  const std::string lockPath = file + ".lock";
+  int lockFd = open(lockPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (lockFd < 0) return false;
+  while (flock(lockFd, LOCK_EX) != 0) {
+    if (errno != EINTR) {
+      close(lockFd);
+      return false;
+    }
+  }
+
+  std::vector<TuningRecord> merged;
+  bool ok = read_records(&merged);
+  if (ok) {
+    // New records sort after old ones with the same key and replace them
+    merged.insert(merged.end(), add.begin(), add.end());
+    std::stable_sort(merged.begin(), merged.end(), record_less);
+    std::vector<TuningRecord> unique;
+    for (size_t i = 0; i < merged.size(); i++) {
+      if (!unique.empty() && same_key(unique.back(), merged[i])) {
+        unique.back() = merged[i];
+      } else {
+        unique.push_back(merged[i]);
+      }
+    }
+    merged.swap(unique);
+
+    std::ostringstream tmp;
+    tmp << file << ".tmp." << getpid();
+    int fd = open(tmp.str().c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  0644);
+    ok = fd >= 0;
+    if (ok) {
+      TuningDbHeader header;
+      fill_header(&header, signature, static_cast<uint32_t>(merged.size()));
+      ok = write_all(fd, &header, sizeof(header)) &&
+           (merged.empty() ||
+            write_all(fd, merged.data(),
+                      merged.size() * sizeof(TuningRecord))) &&
+           fsync(fd) == 0;
+      ok = (close(fd) == 0) && ok;
+      ok = ok && rename(tmp.str().c_str(), file.c_str()) == 0;
+      if (!ok) unlink(tmp.str().c_str());
+    }
+  }
+  flock(lockFd, LOCK_UN);
+  close(lockFd);
+  if (ok) refresh();
+  return ok;
+}
+
+void TuningDb::queue(const TuningRecord &record) {
+  std::vector<TuningRecord> batch;
+  {
+    std::lock_guard<std::mutex> guard(pendingLock);
+    pending.push_back(record);
+    if (pending.size() < TUNING_DB_BATCH) return;
+    batch.swap(pending);
+  }
+  if (!store(batch)) {
+    std::lock_guard<std::mutex> guard(pendingLock);
+    pending.insert(pending.begin(), batch.begin(), batch.end());
+  }
+}
+
+bool TuningDb::flush() {
+  std::vector<TuningRecord> batch;
+  {
+    std::lock_guard<std::mutex> guard(pendingLock);
+    batch.swap(pending);
+  }
+  if (batch.empty() || store(batch)) return true;
+  // Records queued meanwhile are newer and stay behind the failed batch
+  std::lock_guard<std::mutex> guard(pendingLock);
+  pending.insert(pending.begin(), batch.begin(), batch.end());
+  return false;
+}
+
+TuningDb *tuning_db_open(const std::string &signature) {
+  const char *dir = getenv("HCBLAS_TUNING_DB");
+  if (dir == NULL || *dir == '\0') return NULL;
+  std::ostringstream versioned;
+  versioned << signature << "|v" << HCBLAS_TUNING_VERSION;
+  char name[64];
+  snprintf(name, sizeof(name), "/hcblas-%016llx.tdb",
+           static_cast<unsigned long long>(
+               tuning_hash(versioned.str().c_str())));
+  const std::string path = std::string(dir) + name;
+
+  std::lock_guard<std::mutex> guard(registry_lock());
+  std::map<std::string, TuningDb *>::iterator it = registry().find(path);
+  if (it != registry().end()) {
+    // Another process may have tuned since this one last looked
+    it->second->refresh();
+    return it->second;
+  }
+  if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "hcblas: cannot use tuning database directory %s\n", dir);
+    return NULL;
+  }
+  // Queued records of handles never destroyed are stored at exit
+  if (registry().empty()) atexit(flush_registry);
+  TuningDb *db = new TuningDb(path, versioned.str());
+  registry()[path] = db;
+  return db;
+}
+
+void tuning_db_flush(TuningDb *db) {
+  if (db != NULL) db->flush();
+}
+
+int64_t tuning_db_threshold(const TuningDb *db, const char *name,
+                            int64_t fallback) {
+  if (db == NULL) return fallback;
+  int64_t key[7] = {static_cast<int64_t>(tuning_hash(name)), 0, 0, 0, 0, 0, 0};
+  int64_t value;
+  return db->lookup(TUNING_THRESHOLD, key, &value) ? value : fallback;
+}
@@ -0,0 +1,137 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+/*
+* Persistent tuning database shared by every process on a node. Setting
+* HCBLAS_TUNING_DB to a directory enables it: each device (or CPU) signature
+* and tuning version gets its own file there, memory mapped read-only when a
+* handle is created. Records are fixed size and sorted, so lookups are a
+* binary search over the mapping.
+*
+* Updates take an exclusive flock on <file>.lock, merge with the records
+* currently on disk, write a temporary file and rename it over the old one,
+* so readers always see a complete file. A process picks up other processes'
+* updates the next time it creates a handle or stores a record. Records the
+* GEMM autotuner produces are queued and stored in batches instead of one
+* rewrite per record.
+*/
+
+#ifndef LIB_SRC_BLAS_TUNEDB_TUNING_DB_H_
+#define LIB_SRC_BLAS_TUNEDB_TUNING_DB_H_
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Bump whenever kernels or tuned parameters change meaning; files written
+// for another version are ignored
+#define HCBLAS_TUNING_VERSION 1
+
+// Queued records that make queue() store them without waiting for a flush
+#define TUNING_DB_BATCH 32
+
+enum TuningRecordKind {
+  // key: packed precision/order/trans, M, N, K, lda, ldb, ldc;
+  // value: tuning_hash() of the kernel variant name
+  TUNING_GEMM_KERNEL = 1,
+  // key[0]: tuning_hash() of the threshold name; value: the threshold
+  TUNING_THRESHOLD = 2
+};
+
+struct TuningRecord {
+  uint32_t kind;
+  uint32_t reserved;
+  int64_t key[7];
+  int64_t value;
+};
+
+// 64-bit FNV-1a, stable across builds and processes
+uint64_t tuning_hash(const char *text);
+
+class TuningDb {
+ public:
+  TuningDb(const std::string &path, const std::string &signature);
+  ~TuningDb();
+
+  // Maps the file again when another process has replaced it
+  void refresh();
+
+  bool lookup(uint32_t kind, const int64_t key[7], int64_t *value) const;
+
+  // Adds or replaces records on disk and in this process. Returns false when
+  // the file cannot be written; the mapping in use is left unchanged then.
+  bool store(const std::vector<TuningRecord> &records);
+
+  // Queues a record for store(). The queue is stored once TUNING_DB_BATCH
+  // records wait, by flush() when a handle using the database is destroyed
+  // or rebound, and at process exit; lookups see a record once it is stored.
+  void queue(const TuningRecord &record);
+
+  // Stores the queued records; they stay queued when the file cannot be
+  // written
+  bool flush();
+
+  const std::string &path() const { return file; }
+
+ private:
+  // A mapping of the file, unmapped when the last lookup holding it is done
+  struct Snapshot {
+    Snapshot();
+    ~Snapshot();
+    void *base;
+    size_t bytes;
+    const TuningRecord *records;
+    uint32_t count;
+    dev_t dev;
+    ino_t ino;
+    int64_t mtime;
+  };
+
+  std::shared_ptr<const Snapshot> map_file() const;
+  bool read_records(std::vector<TuningRecord> *records) const;
+
+  const std::string file;
+  const std::string signature;
+  // Loaded and replaced with std::atomic_load and std::atomic_store, so a
+  // lookup keeps the mapping it searches alive while refresh() moves on
+  std::shared_ptr<const Snapshot> current;
+  // Serializes refresh()
+  std::mutex lock;
+  // Records queue() holds for the next store, oldest first
+  std::mutex pendingLock;
+  std::vector<TuningRecord> pending;
+};
+
+// Database for a device signature, shared by all handles of the process.
+// NULL when HCBLAS_TUNING_DB is not set or the directory is unusable.
+TuningDb *tuning_db_open(const std::string &signature);
+
+// Stores the records db has queued; nothing when db is NULL
+void tuning_db_flush(TuningDb *db);
+
+// Threshold stored under name, or fallback when db is NULL or has none
+int64_t tuning_db_threshold(const TuningDb *db, const char *name,
+                            int64_t fallback);
+
+#endif  // LIB_SRC_BLAS_TUNEDB_TUNING_DB_H_
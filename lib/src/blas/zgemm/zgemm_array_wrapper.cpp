@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "./zgemm_array_kernels.h"
+#include "src/blas/host/hcblas_host.h"
 
 hcblasStatus zgemm_alpha0_col(hc::accelerator_view accl_view,
                               hc::short_vector::double_2 *A, __int64_t aOffset,
@@ -225,6 +226,23 @@ hcblasStatus Hcblaslibrary::hcblas_zgemm(
     return HCBLAS_INVALID;
   }
 
+  // CPU accelerator: interleaved complex host engine
+  if (hostExecution) {
+    typedef HostComplexDouble Cplx;
+    if (!host_gemm_tuned<Cplx>(NULL, tuningDb, trace, order == ColMajor,
+                               typeA == Trans, typeB == Trans, M, N, K,
+                               Cplx(Calpha.x, Calpha.y),
+                               reinterpret_cast<const Cplx *>(Acmplx + aOffset),
+                               lda,
+                               reinterpret_cast<const Cplx *>(Bcmplx + bOffset),
+                               ldb, Cplx(Cbeta.x, Cbeta.y),
+                               reinterpret_cast<Cplx *>(Ccmplx + cOffset),
+                               ldc)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   if (!Calpha.x && !Calpha.y) {
     if (order)
       status =
@@ -303,6 +321,24 @@ hcblasStatus Hcblaslibrary::hcblas_zgemm(
     return HCBLAS_INVALID;
   }
 
+  // The batched complex kernels address X[elt] + xOffset and ignore the
+  // batch offsets, so the host path does the same
+  if (hostExecution) {
+    typedef HostComplexDouble Cplx;
+    if (!host_gemm_batched<Cplx>(order == ColMajor, typeA == Trans,
+                                 typeB == Trans, M, N, K,
+                                 Cplx(Calpha.x, Calpha.y),
+                                 reinterpret_cast<Cplx *const *>(Acmplx),
+                                 aOffset, 0, lda,
+                                 reinterpret_cast<Cplx *const *>(Bcmplx),
+                                 bOffset, 0, ldb, Cplx(Cbeta.x, Cbeta.y),
+                                 reinterpret_cast<Cplx *const *>(Ccmplx),
+                                 cOffset, 0, ldc, batchSize)) {
+      return HCBLAS_INVALID;
+    }
+    return HCBLAS_SUCCEEDS;
+  }
+
   if (!Calpha.x && !Calpha.y) {
     if (order)
       status = zgemm_alpha0_colbatch(accl_view, Acmplx, aOffset, A_batchOffset,
@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "include/hcblaslib.h"
+#include "src/blas/host/hcblas_host.h"
 #include <hc.hpp>
 #include <hc_math.hpp>
 
@@ -88,6 +89,14 @@ hcblasStatus Hcblaslibrary::hcblas_zscal(
   if (X == NULL || N <= 0 || incX <= 0) {
     return HCBLAS_INVALID;
   }
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    typedef HostComplexDouble Cplx;
+    host_scal<Cplx>(N, Cplx(alpha.x, alpha.y),
+                    reinterpret_cast<Cplx *>(X + xOffset), incX);
+    return HCBLAS_SUCCEEDS;
+  }
+
   zscal_HC(accl_view, N, alpha, X, incX, xOffset);
   return HCBLAS_SUCCEEDS;
 }
@@ -103,6 +112,15 @@ hcblasStatus Hcblaslibrary::hcblas_zscal(
   if (X == NULL || N <= 0 || incX <= 0) {
     return HCBLAS_INVALID;
   }
+  // CPU accelerator: stream the host pointers directly
+  if (hostExecution) {
+    typedef HostComplexDouble Cplx;
+    host_scal_batched<Cplx>(N, Cplx(alpha.x, alpha.y),
+                            reinterpret_cast<Cplx *>(X + xOffset), incX,
+                            X_batchOffset, batchSize);
+    return HCBLAS_SUCCEEDS;
+  }
+
   double alpha_x = alpha.x;
   double alpha_y = alpha.y;
   zscal_HC(accl_view, N, alpha_x, alpha_y, X, incX, xOffset, X_batchOffset,
@@ -22,7 +22,39 @@ THE SOFTWARE.
 
 #include "include/hcblas.h"
 #include "include/hcblaslib.h"
+#include "src/blas/gemmselect/gemm_autotune.h"
+#include "src/blas/host/host_platform.h"
+#include "src/blas/scratch/scratch_pool.h"
+#include "src/blas/trace/dispatch_trace.h"
+#include "src/blas/tunedb/tuning_db.h"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
+
+// Timed calls per kernel variant and shape when a handle tunes SGEMM
+static const int kGemmTuneSamples = 3;
+
+// A scalar argument passed by pointer. In HCBLAS_POINTER_MODE_DEVICE it is
+// in device memory; the routines without a kernel reading it in place copy
+// it to the host first, so their call waits for the queue. scalar_arg<T>
+// reads the public type U as the same sized T of the kernels.
+template <typename T, typename U>
+static T scalar_arg(hcblasHandle_t handle, const U *x) {
+  static_assert(sizeof(T) == sizeof(U), "scalar types differ in size");
+  T value;
+  if (handle->pointerMode == HostPointer || handle->hostExecution) {
+    memcpy(&value, x, sizeof(T));
+  } else {
+    handle->currentAcclView.copy(x, &value, sizeof(T));
+  }
+  return value;
+}
+
+template <typename T>
+static T scalar_arg(hcblasHandle_t handle, const T *x) {
+  return scalar_arg<T, T>(handle, x);
+}
 
 // hcblas Helper functions
 
@@ -99,6 +131,10 @@ hcblasStatus_t hcblasSetAcclView(hcblasHandle_t handle,
   }
   handle->currentAcclView = accl_view;
   handle->currentStream = stream;
+  handle->hostExecution =
+      Hcblaslibrary::isHostAccelerator(accl_view.get_accelerator());
+  tuning_db_flush(handle->tuningDb);
+  handle->tuningDb = tuning_db_for_accelerator(accl_view.get_accelerator());
   return HCBLAS_STATUS_SUCCESS;
 }
 
@@ -311,6 +347,228 @@ hcblasStatus_t hcblasGetMatrix(hcblasHandle_t handle, int rows, int cols,
   return HCBLAS_STATUS_SUCCESS;
 }
 
+// 7. hcblasSetGemmAutotune()
+
+// This function turns online SGEMM tuning on (budget > 0) or off (budget 0)
+// for the handle. budget is the number of timed calls the tuner may spend.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the tuning mode was set
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      budget < 0
+
+hcblasStatus_t hcblasSetGemmAutotune(hcblasHandle_t handle, int budget) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (budget < 0) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  gemm_autotuner_release(handle->gemmAutotuner);
+  handle->gemmAutotuner = NULL;
+  if (budget > 0) {
+    handle->gemmAutotuner = new GemmAutotuner(budget, kGemmTuneSamples);
+  }
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 8. hcblasSetTrace()
+
+// This function turns the dispatch trace on (enable != 0) or off for the
+// handle. Traced calls are recorded in a ring shared by the process.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the trace mode was set
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+
+hcblasStatus_t hcblasSetTrace(hcblasHandle_t handle, int enable) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  handle->trace = enable ? dispatch_trace() : NULL;
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 9. hcblasDumpTrace()
+
+// This function writes the trace ring to path, as JSON when path ends in
+// ".json" and as CSV otherwise.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the trace was written
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      path is NULL
+// HCBLAS_STATUS_INTERNAL_ERROR     path could not be written
+
+hcblasStatus_t hcblasDumpTrace(hcblasHandle_t handle, const char *path) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (path == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  return dispatch_trace()->dump(path) ? HCBLAS_STATUS_SUCCESS
+                                      : HCBLAS_STATUS_INTERNAL_ERROR;
+}
+
+// 10. hcblasGetScratchHighWater()
+
+// This function reports the most bytes of device and host scratch the
+// handle's routines have held at once.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the high-water marks were returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+
+hcblasStatus_t hcblasGetScratchHighWater(hcblasHandle_t handle,
+                                         size_t *deviceBytes,
+                                         size_t *hostBytes) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (deviceBytes != NULL) *deviceBytes = handle->scratch->highWater(true);
+  if (hostBytes != NULL) *hostBytes = handle->scratch->highWater(false);
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 11. hcblasSetWorkspace()
+
+// This function makes the handle carve its temporary device memory from a
+// caller owned region, or from its own pool again when workspace is NULL.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the workspace was set
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      workspace is not NULL and bytes is 0
+
+hcblasStatus_t hcblasSetWorkspace(hcblasHandle_t handle, void *workspace,
+                                  size_t bytes) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (workspace != NULL && bytes == 0) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  handle->scratch->setWorkspace(handle->currentAcclView, workspace, bytes);
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 12. hcblas<t>gemm_workspaceSize() and hcblas<t>dot_workspaceSize()
+
+// These functions return the workspace bytes one call of the routine carves.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the size was returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      a dimension is negative or bytes is NULL
+
+hcblasStatus_t hcblasSgemm_workspaceSize(hcblasHandle_t handle, int m, int n,
+                                         int k, size_t *bytes) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (m < 0 || n < 0 || k < 0 || bytes == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  *bytes = handle->hcblas_sgemm_workspaceSize(handle->currentAcclView, m, n, k);
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+hcblasStatus_t hcblasDgemm_workspaceSize(hcblasHandle_t handle, int m, int n,
+                                         int k, size_t *bytes) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (m < 0 || n < 0 || k < 0 || bytes == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  *bytes = handle->hcblas_dgemm_workspaceSize(handle->currentAcclView, m, n, k);
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+hcblasStatus_t hcblasSdot_workspaceSize(hcblasHandle_t handle, int n,
+                                        size_t *bytes) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (n < 0 || bytes == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  *bytes = handle->hcblas_sdot_workspaceSize(handle->currentAcclView, n);
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+hcblasStatus_t hcblasDdot_workspaceSize(hcblasHandle_t handle, int n,
+                                        size_t *bytes) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (n < 0 || bytes == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  *bytes = handle->hcblas_ddot_workspaceSize(handle->currentAcclView, n);
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// 13. hcblasSetPointerMode() and hcblasGetPointerMode()
+
+// These functions set and return where the scalars passed by pointer live.
+
+// Return Values
+// ---------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS            the pointer mode was set or returned
+// HCBLAS_STATUS_NOT_INITIALIZED    the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE      mode is NULL (hcblasGetPointerMode())
+
+hcblasStatus_t hcblasSetPointerMode(hcblasHandle_t handle,
+                                    hcblasPointerMode_t mode) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  handle->pointerMode =
+      mode == HCBLAS_POINTER_MODE_DEVICE ? DevicePointer : HostPointer;
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+hcblasStatus_t hcblasGetPointerMode(hcblasHandle_t handle,
+                                    hcblasPointerMode_t *mode) {
+  if (handle == nullptr || handle->initialized == false) {
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+  }
+  if (mode == NULL) {
+    return HCBLAS_STATUS_INVALID_VALUE;
+  }
+  *mode = handle->pointerMode == DevicePointer ? HCBLAS_POINTER_MODE_DEVICE
+                                               : HCBLAS_POINTER_MODE_HOST;
+  return HCBLAS_STATUS_SUCCESS;
+}
+
+// Tuning files are keyed by what the results depend on: the device and
+// its driver description, or the CPU model and the host ISA in use
+TuningDb *tuning_db_for_accelerator(const hc::accelerator &accl) {
+  if (getenv("HCBLAS_TUNING_DB") == NULL) {
+    return NULL;
+  }
+  std::string signature;
+  if (Hcblaslibrary::isHostAccelerator(accl)) {
+    const HostCpuInfo &cpu = host_cpu_info();
+    signature = "cpu|" + std::string(cpu.brand) + "|isa" +
+                std::to_string(static_cast<int>(cpu.isa));
+  } else {
+    std::wstring path = accl.get_device_path();
+    std::wstring description = accl.get_description();
+    signature = std::string(path.begin(), path.end()) + "|" +
+                std::string(description.begin(), description.end());
+  }
+  return tuning_db_open(signature);
+}
+
 // HCBLAS Level-1 function reference
 
 // Level-1 Basic Linear Algebra Subprograms (BLAS1) functions perform scalar and
@@ -344,6 +602,10 @@ hcblasStatus_t hcblasGetMatrix(hcblasHandle_t handle, int rows, int cols,
 //                                              elements of x.
 // result       host or device   output         the resulting index, which is
 //                                              0.0 if n,incx<=0.
+//                                              Batched: batchCount values,
+//                                              result[i] for vector i, which
+//                                              starts n * incx elements after
+//                                              vector i - 1.
 // batchCount   host             input          number of pointers contained in
 //                                              input and output arrays.
 
@@ -373,10 +635,11 @@ hcblasStatus_t hcblasSasumBatched(hcblasHandle_t handle, const int n, float *x,
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
   __int64_t xOffset = 0;
-  __int64_t X_batchOffset = n;
+  __int64_t X_batchOffset = static_cast<__int64_t>(n) * incx;
   hcblasStatus status;
-  status = handle->hcblas_sasum(handle->currentAcclView, n, x, incx, xOffset,
-                                result, X_batchOffset, batchCount);
+  status = handle->hcblas_sasum_batched(handle->currentAcclView, n, x, incx,
+                                        xOffset, result, X_batchOffset,
+                                        batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -403,10 +666,11 @@ hcblasStatus_t hcblasDasumBatched(hcblasHandle_t handle, const int n, double *x,
   if (handle == nullptr || handle->initialized == false)
     return HCBLAS_STATUS_NOT_INITIALIZED;
   __int64_t xOffset = 0;
-  __int64_t X_batchOffset = n;
+  __int64_t X_batchOffset = static_cast<__int64_t>(n) * incx;
   hcblasStatus status;
-  status = handle->hcblas_dasum(handle->currentAcclView, n, x, incx, xOffset,
-                                result, X_batchOffset, batchCount);
+  status = handle->hcblas_dasum_batched(handle->currentAcclView, n, x, incx,
+                                        xOffset, result, X_batchOffset,
+                                        batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -448,7 +712,7 @@ hcblasStatus_t hcblasSaxpy(hcblasHandle_t handle, int n, const float *alpha,
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_saxpy(handle->currentAcclView, n, *alpha, x, incx, y,
+  status = handle->hcblas_saxpy(handle->currentAcclView, n, alpha, x, incx, y,
                                 incy, xOffset, yOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -463,7 +727,7 @@ hcblasStatus_t hcblasDaxpy(hcblasHandle_t handle, int n, const double *alpha,
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_daxpy(handle->currentAcclView, n, *alpha, x, incx, y,
+  status = handle->hcblas_daxpy(handle->currentAcclView, n, alpha, x, incx, y,
                                 incy, xOffset, yOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -481,7 +745,7 @@ hcblasStatus_t hcblasSaxpyBatched(hcblasHandle_t handle, int n,
   __int64_t X_batchOffset = n;
   __int64_t Y_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_saxpy(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_saxpy(handle->currentAcclView, n, alpha, x, incx,
                                 X_batchOffset, y, incy, Y_batchOffset, xOffset,
                                 yOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -601,6 +865,10 @@ hcblasStatus_t hcblasDcopyBatched(hcblasHandle_t handle, int n, const double *x,
 //                                              elements of y.
 // result       host or device   output         the resulting dot product, which
 //                                              is 0.0 if n<=0.
+//                                              Batched: batchCount values,
+//                                              result[i] for vectors i, which
+//                                              start n * incx and n * incy
+//                                              elements after vectors i - 1.
 // batchCount   host             input          number of pointers contained in
 //                                              input and output arrays.
 
@@ -618,7 +886,7 @@ hcblasStatus_t hcblasSdot(hcblasHandle_t handle, int n, const float *x,
   __int64_t yOffset = 0;
   hcblasStatus status;
   status = handle->hcblas_sdot(handle->currentAcclView, n, x, incx, xOffset, y,
-                               incy, yOffset, *result);
+                               incy, yOffset, result);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -632,12 +900,13 @@ hcblasStatus_t hcblasSdotBatched(hcblasHandle_t handle, int n, const float *x,
     return HCBLAS_STATUS_NOT_INITIALIZED;
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
-  __int64_t X_batchOffset = n;
-  __int64_t Y_batchOffset = n;
+  __int64_t X_batchOffset = static_cast<__int64_t>(n) * incx;
+  __int64_t Y_batchOffset = static_cast<__int64_t>(n) * incy;
   hcblasStatus status;
-  status = handle->hcblas_sdot(handle->currentAcclView, n, x, incx, xOffset, y,
-                               incy, yOffset, *result, X_batchOffset,
-                               Y_batchOffset, batchCount);
+  status = handle->hcblas_sdot_batched(handle->currentAcclView, n, x, incx,
+                                       xOffset, y, incy, yOffset, result,
+                                       X_batchOffset, Y_batchOffset,
+                                       batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -652,7 +921,7 @@ hcblasStatus_t hcblasDdot(hcblasHandle_t handle, int n, const double *x,
   __int64_t yOffset = 0;
   hcblasStatus status;
   status = handle->hcblas_ddot(handle->currentAcclView, n, x, incx, xOffset, y,
-                               incy, yOffset, *result);
+                               incy, yOffset, result);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -666,12 +935,13 @@ hcblasStatus_t hcblasDdotBatched(hcblasHandle_t handle, int n, const double *x,
     return HCBLAS_STATUS_NOT_INITIALIZED;
   __int64_t xOffset = 0;
   __int64_t yOffset = 0;
-  __int64_t X_batchOffset = n;
-  __int64_t Y_batchOffset = n;
+  __int64_t X_batchOffset = static_cast<__int64_t>(n) * incx;
+  __int64_t Y_batchOffset = static_cast<__int64_t>(n) * incy;
   hcblasStatus status;
-  status = handle->hcblas_ddot(handle->currentAcclView, n, x, incx, xOffset, y,
-                               incy, yOffset, *result, X_batchOffset,
-                               Y_batchOffset, batchCount);
+  status = handle->hcblas_ddot_batched(handle->currentAcclView, n, x, incx,
+                                       xOffset, y, incy, yOffset, result,
+                                       X_batchOffset, Y_batchOffset,
+                                       batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -709,7 +979,7 @@ hcblasStatus_t hcblasSscal(hcblasHandle_t handle, int n, const float *alpha,
     return HCBLAS_STATUS_NOT_INITIALIZED;
   __int64_t xOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_sscal(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_sscal(handle->currentAcclView, n, alpha, x, incx,
                                 xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -725,7 +995,7 @@ hcblasStatus_t hcblasSscalBatched(hcblasHandle_t handle, int n,
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_sscal(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_sscal(handle->currentAcclView, n, alpha, x, incx,
                                 xOffset, X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -739,7 +1009,7 @@ hcblasStatus_t hcblasDscal(hcblasHandle_t handle, int n, const double *alpha,
     return HCBLAS_STATUS_NOT_INITIALIZED;
   __int64_t xOffset = 0;
   hcblasStatus status;
-  status = handle->hcblas_dscal(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_dscal(handle->currentAcclView, n, alpha, x, incx,
                                 xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -755,7 +1025,7 @@ hcblasStatus_t hcblasDscalBatched(hcblasHandle_t handle, int n,
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
-  status = handle->hcblas_dscal(handle->currentAcclView, n, *alpha, x, incx,
+  status = handle->hcblas_dscal(handle->currentAcclView, n, alpha, x, incx,
                                 xOffset, X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -771,7 +1041,7 @@ hcblasStatus_t hcblasCscal(hcblasHandle_t handle, int n, const hcComplex *alpha,
   hcblasStatus status;
   status = handle->hcblas_cscal(
       handle->currentAcclView, n,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
+      scalar_arg<hc::short_vector::float2>(handle, alpha),
       reinterpret_cast<hc::short_vector::float2 *>(x), incx, xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -789,7 +1059,7 @@ hcblasStatus_t hcblasCscalBatched(hcblasHandle_t handle, int n,
   hcblasStatus status;
   status = handle->hcblas_cscal(
       handle->currentAcclView, n,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
+      scalar_arg<hc::short_vector::float2>(handle, alpha),
       reinterpret_cast<hc::short_vector::float2 *>(x), incx, xOffset,
       X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -807,7 +1077,7 @@ hcblasStatus_t hcblasZscal(hcblasHandle_t handle, int n,
   hcblasStatus status;
   status = handle->hcblas_zscal(
       handle->currentAcclView, n,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
+      scalar_arg<hc::short_vector::double2>(handle, alpha),
       reinterpret_cast<hc::short_vector::double2 *>(x), incx, xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -826,7 +1096,7 @@ hcblasStatus_t hcblasZscalBatched(hcblasHandle_t handle, int n,
   hcblasStatus status;
   status = handle->hcblas_zscal(
       handle->currentAcclView, n,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
+      scalar_arg<hc::short_vector::double2>(handle, alpha),
       reinterpret_cast<hc::short_vector::double2 *>(x), incx, xOffset,
       X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
@@ -842,7 +1112,7 @@ hcblasStatus_t hcblasCsscal(hcblasHandle_t handle, int n, const float *alpha,
   __int64_t xOffset = 0;
   hcblasStatus status;
   status = handle->hcblas_csscal(
-      handle->currentAcclView, n, *alpha,
+      handle->currentAcclView, n, scalar_arg(handle, alpha),
       reinterpret_cast<hc::short_vector::float2 *>(x), incx, xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -858,10 +1128,10 @@ hcblasStatus_t hcblasCsscalBatched(hcblasHandle_t handle, int n,
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
-  status =
-      handle->hcblas_csscal(handle->currentAcclView, n, *alpha,
-                            reinterpret_cast<hc::short_vector::float2 *>(x),
-                            incx, xOffset, X_batchOffset, batchCount);
+  status = handle->hcblas_csscal(
+      handle->currentAcclView, n, scalar_arg(handle, alpha),
+      reinterpret_cast<hc::short_vector::float2 *>(x), incx, xOffset,
+      X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -875,7 +1145,7 @@ hcblasStatus_t hcblasZdscal(hcblasHandle_t handle, int n, const double *alpha,
   __int64_t xOffset = 0;
   hcblasStatus status;
   status = handle->hcblas_zdscal(
-      handle->currentAcclView, n, *alpha,
+      handle->currentAcclView, n, scalar_arg(handle, alpha),
       reinterpret_cast<hc::short_vector::double2 *>(x), incx, xOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -891,10 +1161,10 @@ hcblasStatus_t hcblasZdscalBatched(hcblasHandle_t handle, int n,
   __int64_t xOffset = 0;
   __int64_t X_batchOffset = n;
   hcblasStatus status;
-  status =
-      handle->hcblas_zdscal(handle->currentAcclView, n, *alpha,
-                            reinterpret_cast<hc::short_vector::double2 *>(x),
-                            incx, xOffset, X_batchOffset, batchCount);
+  status = handle->hcblas_zdscal(
+      handle->currentAcclView, n, scalar_arg(handle, alpha),
+      reinterpret_cast<hc::short_vector::double2 *>(x), incx, xOffset,
+      X_batchOffset, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -981,8 +1251,9 @@ hcblasStatus_t hcblasSgemv(hcblasHandle_t handle, hcblasOperation_t trans,
   hcblasTranspose transA;
   transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
   status = handle->hcblas_sgemv(handle->currentAcclView, handle->Order, transA,
-                                m, n, *alpha, A, aOffset, lda, x, xOffset, incx,
-                                *beta, y, yOffset, incy);
+                                m, n, scalar_arg(handle, alpha), A, aOffset,
+                                lda, x, xOffset, incx, scalar_arg(handle, beta),
+                                y, yOffset, incy);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -1018,8 +1289,9 @@ hcblasStatus_t hcblasSgemvBatched(hcblasHandle_t handle,
   __int64_t Y_batchOffset = col;
   __int64_t A_batchOffset = row * col;
   status = handle->hcblas_sgemv(handle->currentAcclView, handle->Order, transA,
-                                m, n, *alpha, A, aOffset, A_batchOffset, lda, x,
-                                xOffset, X_batchOffset, incx, *beta, y, yOffset,
+                                m, n, scalar_arg(handle, alpha), A, aOffset,
+                                A_batchOffset, lda, x, xOffset, X_batchOffset,
+                                incx, scalar_arg(handle, beta), y, yOffset,
                                 Y_batchOffset, incy, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -1045,8 +1317,9 @@ hcblasStatus_t hcblasDgemv(hcblasHandle_t handle, hcblasOperation_t trans,
   hcblasTranspose transA;
   transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
   status = handle->hcblas_dgemv(handle->currentAcclView, handle->Order, transA,
-                                m, n, *alpha, A, aOffset, lda, x, xOffset, incx,
-                                *beta, y, yOffset, incy);
+                                m, n, scalar_arg(handle, alpha), A, aOffset,
+                                lda, x, xOffset, incx, scalar_arg(handle, beta),
+                                y, yOffset, incy);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -1082,8 +1355,9 @@ hcblasStatus_t hcblasDgemvBatched(hcblasHandle_t handle,
   __int64_t Y_batchOffset = col;
   __int64_t A_batchOffset = row * col;
   status = handle->hcblas_dgemv(handle->currentAcclView, handle->Order, transA,
-                                m, n, *alpha, A, aOffset, A_batchOffset, lda, x,
-                                xOffset, X_batchOffset, incx, *beta, y, yOffset,
+                                m, n, scalar_arg(handle, alpha), A, aOffset,
+                                A_batchOffset, lda, x, xOffset, X_batchOffset,
+                                incx, scalar_arg(handle, beta), y, yOffset,
                                 Y_batchOffset, incy, batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -1140,9 +1414,9 @@ hcblasStatus_t hcblasSger(hcblasHandle_t handle, int m, int n,
   __int64_t yOffset = 0;
   __int64_t aOffset = 0;
   hcblasStatus status;
-  status =
-      handle->hcblas_sger(handle->currentAcclView, handle->Order, m, n, *alpha,
-                          x, xOffset, incx, y, yOffset, incy, A, aOffset, lda);
+  status = handle->hcblas_sger(handle->currentAcclView, handle->Order, m, n,
+                               scalar_arg(handle, alpha), x, xOffset, incx, y,
+                               yOffset, incy, A, aOffset, lda);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -1167,9 +1441,10 @@ hcblasStatus_t hcblasSgerBatched(hcblasHandle_t handle, int m, int n,
   __int64_t A_batchOffset = m * n;
   hcblasStatus status;
   status = handle->hcblas_sger(handle->currentAcclView, handle->Order, m, n,
-                               *alpha, x, xOffset, X_batchOffset, incx, y,
-                               yOffset, Y_batchOffset, incy, A, aOffset,
-                               A_batchOffset, lda, batchCount);
+                               scalar_arg(handle, alpha), x, xOffset,
+                               X_batchOffset, incx, y, yOffset, Y_batchOffset,
+                               incy, A, aOffset, A_batchOffset, lda,
+                               batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -1190,9 +1465,9 @@ hcblasStatus_t hcblasDger(hcblasHandle_t handle, int m, int n,
   __int64_t yOffset = 0;
   __int64_t aOffset = 0;
   hcblasStatus status;
-  status =
-      handle->hcblas_dger(handle->currentAcclView, handle->Order, m, n, *alpha,
-                          x, xOffset, incx, y, yOffset, incy, A, aOffset, lda);
+  status = handle->hcblas_dger(handle->currentAcclView, handle->Order, m, n,
+                               scalar_arg(handle, alpha), x, xOffset, incx, y,
+                               yOffset, incy, A, aOffset, lda);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -1217,9 +1492,10 @@ hcblasStatus_t hcblasDgerBatched(hcblasHandle_t handle, int m, int n,
   __int64_t A_batchOffset = m * n;
   hcblasStatus status;
   status = handle->hcblas_dger(handle->currentAcclView, handle->Order, m, n,
-                               *alpha, x, xOffset, X_batchOffset, incx, y,
-                               yOffset, Y_batchOffset, incy, A, aOffset,
-                               A_batchOffset, lda, batchCount);
+                               scalar_arg(handle, alpha), x, xOffset,
+                               X_batchOffset, incx, y, yOffset, Y_batchOffset,
+                               incy, A, aOffset, A_batchOffset, lda,
+                               batchCount);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -1318,8 +1594,9 @@ hcblasStatus_t hcblasSgemm(hcblasHandle_t handle, hcblasOperation_t transa,
   transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
   transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
   status = handle->hcblas_sgemm(handle->currentAcclView, handle->Order, transA,
-                                transB, m, n, k, *alpha, A, lda, B, ldb, *beta,
-                                C, ldc, aOffset, bOffset, cOffset);
+                                transB, m, n, k, scalar_arg(handle, alpha), A,
+                                lda, B, ldb, scalar_arg(handle, beta), C, ldc,
+                                aOffset, bOffset, cOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -1348,10 +1625,10 @@ hcblasStatus_t hcblasCgemm(hcblasHandle_t handle, hcblasOperation_t transa,
 
   status = handle->hcblas_cgemm(
       handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
+      scalar_arg<hc::short_vector::float2>(handle, alpha),
       reinterpret_cast<hc::short_vector::float2 *>(A), aOffset, lda,
       reinterpret_cast<hc::short_vector::float2 *>(B), bOffset, ldb,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(beta)),
+      scalar_arg<hc::short_vector::float2>(handle, beta),
       reinterpret_cast<hc::short_vector::float2 *>(C), cOffset, ldc);
 
   if (status == HCBLAS_SUCCEEDS)
@@ -1377,8 +1654,9 @@ hcblasStatus_t hcblasDgemm(hcblasHandle_t handle, hcblasOperation_t transa,
   transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
   transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
   status = handle->hcblas_dgemm(handle->currentAcclView, handle->Order, transA,
-                                transB, m, n, k, *alpha, A, lda, B, ldb, *beta,
-                                C, ldc, aOffset, bOffset, cOffset);
+                                transB, m, n, k, scalar_arg(handle, alpha), A,
+                                lda, B, ldb, scalar_arg(handle, beta), C, ldc,
+                                aOffset, bOffset, cOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -1408,10 +1686,10 @@ hcblasStatus_t hcblasZgemm(hcblasHandle_t handle, hcblasOperation_t transa,
 
   status = handle->hcblas_zgemm(
       handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
+      scalar_arg<hc::short_vector::double2>(handle, alpha),
       reinterpret_cast<hc::short_vector::double2 *>(A), aOffset, lda,
       reinterpret_cast<hc::short_vector::double2 *>(B), bOffset, ldb,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(beta)),
+      scalar_arg<hc::short_vector::double2>(handle, beta),
       reinterpret_cast<hc::short_vector::double2 *>(C), cOffset, ldc);
 
   if (status == HCBLAS_SUCCEEDS)
@@ -1437,12 +1715,13 @@ hcblasStatus_t hcblasHgemm(hcblasHandle_t handle, hcblasOperation_t transa,
   hcblasTranspose transA, transB;
   transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
   transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
-  status = handle->hcblas_hgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::half *>(alpha)),
-      reinterpret_cast<hc::half *>(A), lda, reinterpret_cast<hc::half *>(B),
-      ldb, *(reinterpret_cast<const hc::half *>(beta)),
-      reinterpret_cast<hc::half *>(C), ldc, aOffset, bOffset, cOffset);
+  status = handle->hcblas_hgemm(handle->currentAcclView, handle->Order, transA,
+                                transB, m, n, k, scalar_arg(handle, alpha),
+                                reinterpret_cast<hc::half *>(A), lda,
+                                reinterpret_cast<hc::half *>(B), ldb,
+                                scalar_arg(handle, beta),
+                                reinterpret_cast<hc::half *>(C), ldc, aOffset,
+                                bOffset, cOffset);
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
   else
@@ -1544,10 +1823,12 @@ hcblasStatus_t hcblasSgemmBatched(hcblasHandle_t handle,
   transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
   transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
 
-  status = handle->hcblas_sgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k, *alpha,
-      Aarray, lda, A_batchOffset, Barray, ldb, B_batchOffset, *beta, Carray,
-      ldc, C_batchOffset, aOffset, bOffset, cOffset, batchCount);
+  status = handle->hcblas_sgemm(handle->currentAcclView, handle->Order, transA,
+                                transB, m, n, k, scalar_arg(handle, alpha),
+                                Aarray, lda, A_batchOffset, Barray, ldb,
+                                B_batchOffset, scalar_arg(handle, beta), Carray,
+                                ldc, C_batchOffset, aOffset, bOffset, cOffset,
+                                batchCount);
 
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -1582,11 +1863,11 @@ hcblasStatus_t hcblasCgemmBatched(hcblasHandle_t handle,
 
   status = handle->hcblas_cgemm(
       handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(alpha)),
+      scalar_arg<hc::short_vector::float2>(handle, alpha),
       reinterpret_cast<hc::short_vector::float2 **>(Aarray), aOffset,
       A_batchOffset, lda, reinterpret_cast<hc::short_vector::float2 **>(Barray),
       bOffset, B_batchOffset, ldb,
-      *(reinterpret_cast<const hc::short_vector::float2 *>(beta)),
+      scalar_arg<hc::short_vector::float2>(handle, beta),
       reinterpret_cast<hc::short_vector::float2 **>(Carray), cOffset,
       C_batchOffset, ldc, batchCount);
 
@@ -1622,10 +1903,12 @@ hcblasStatus_t hcblasDgemmBatched(hcblasHandle_t handle,
   transA = (transa == HCBLAS_OP_N) ? NoTrans : Trans;
   transB = (transb == HCBLAS_OP_N) ? NoTrans : Trans;
 
-  status = handle->hcblas_dgemm(
-      handle->currentAcclView, handle->Order, transA, transB, m, n, k, *alpha,
-      Aarray, lda, A_batchOffset, Barray, ldb, B_batchOffset, *beta, Carray,
-      ldc, C_batchOffset, aOffset, bOffset, cOffset, batchCount);
+  status = handle->hcblas_dgemm(handle->currentAcclView, handle->Order, transA,
+                                transB, m, n, k, scalar_arg(handle, alpha),
+                                Aarray, lda, A_batchOffset, Barray, ldb,
+                                B_batchOffset, scalar_arg(handle, beta), Carray,
+                                ldc, C_batchOffset, aOffset, bOffset, cOffset,
+                                batchCount);
 
   if (status == HCBLAS_SUCCEEDS)
     return HCBLAS_STATUS_SUCCESS;
@@ -1659,12 +1942,11 @@ hcblasStatus_t hcblasZgemmBatched(
 
   status = handle->hcblas_zgemm(
       handle->currentAcclView, handle->Order, transA, transB, m, n, k,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(alpha)),
+      scalar_arg<hc::short_vector::double2>(handle, alpha),
       reinterpret_cast<hc::short_vector::double2 **>(Aarray), aOffset,
       A_batchOffset, lda,
       reinterpret_cast<hc::short_vector::double2 **>(Barray), bOffset,
-      B_batchOffset, ldb,
-      *(reinterpret_cast<const hc::short_vector::double2 *>(beta)),
+      B_batchOffset, ldb, scalar_arg<hc::short_vector::double2>(handle, beta),
       reinterpret_cast<hc::short_vector::double2 **>(Carray), cOffset,
       C_batchOffset, ldc, batchCount);
 
@@ -1673,3 +1955,2937 @@ hcblasStatus_t hcblasZgemmBatched(
   else
     return HCBLAS_STATUS_EXECUTION_FAILED;
 }
+
+// 3. hcblas<t>trsm()
+
+// This function solves the triangular linear system with multiple right-hand
+// sides
+// op ( A ) X = α B   if  side == HCBLAS_SIDE_LEFT
+// X op ( A ) = α B   if  side == HCBLAS_SIDE_RIGHT
+// where A is a triangular matrix stored in lower or upper mode with or
+// without the main diagonal, X and B are m × n matrices, and α is a scalar.
+// Also, for matrix A
+// op ( A ) = A   if  transa == HCBLAS_OP_N
+//            A^T if  transa == HCBLAS_OP_T
+//            A^H if  transa == HCBLAS_OP_C
+// The solution X overwrites B on exit. Diagonal blocks of A are solved
+// directly and the remaining updates of B run through hcblas<t>gemm().
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// side         host             input          indicates if matrix A is on the
+//                                              left or right of X.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A) that is non- or
+//                                              (conj.) transpose.
+// diag         host             input          indicates if the elements on the
+//                                              main diagonal of matrix A are
+//                                              unity and should not be
+//                                              accessed.
+// m            host             input          number of rows of matrix B, with
+//                                              matrix A sized accordingly.
+// n            host             input          number of columns of matrix B,
+//                                              with matrix A sized
+//                                              accordingly.
+// alpha        host             input          <type> scalar used for
+//                                              multiplication. If alpha==0, A
+//                                              is not referenced and B does
+//                                              not have to be a valid input.
+// A            device           input          <type> array of dimension lda x
+//                                              m with lda>=max(1,m) if
+//                                              side == HCBLAS_SIDE_LEFT and
+//                                              lda x n with lda>=max(1,n)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           in/out         <type> array of dimension ldb x
+//                                              n with ldb>=max(1,m). It is
+//                                              overwritten with X.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrsm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const float *alpha, float *A, int lda, float *B,
+                           int ldb) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_strsm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, transA, diagA, m, n,
+                                scalar_arg(handle, alpha), A, aOffset, lda, B,
+                                bOffset, ldb);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDtrsm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const double *alpha, double *A, int lda, double *B,
+                           int ldb) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_dtrsm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, transA, diagA, m, n,
+                                scalar_arg(handle, alpha), A, aOffset, lda, B,
+                                bOffset, ldb);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCtrsm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           hcComplex *B, int ldb) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_ctrsm(
+      handle->currentAcclView, handle->Order, sideA, uploA, transA, diagA, m, n,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 *>(B), bOffset, ldb);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZtrsm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, hcDoubleComplex *B, int ldb) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_ztrsm(
+      handle->currentAcclView, handle->Order, sideA, uploA, transA, diagA, m, n,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 *>(B), bOffset, ldb);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 4. hcblas<t>trsmBatched()
+
+// This function solves an array of triangular linear systems with multiple
+// right-hand sides
+// op ( A [ i ] ) X [ i ] = α B [ i ]   if  side == HCBLAS_SIDE_LEFT
+// X [ i ] op ( A [ i ] ) = α B [ i ]   if  side == HCBLAS_SIDE_RIGHT
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>trsm()
+// applying to every entry. Aarray and Barray are arrays of pointers to
+// matrices stored in column-major format; X [ i ] overwrites B [ i ].
+
+// This function is intended for many small systems: when A [ i ] has at most
+// 64 rows (32 for double complex), every system is solved by a single launch.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x m if side ==
+//                                              HCBLAS_SIDE_LEFT and lda x n
+//                                              otherwise.
+// Barray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n with ldb>=max(1,m).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray and Barray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrsmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const float *alpha, float *Aarray[], int lda,
+                                  float *Barray[], int ldb, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_strsm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, transA, diagA, m, n,
+                                scalar_arg(handle, alpha), Aarray, aOffset,
+                                A_batchOffset, lda, Barray, bOffset,
+                                B_batchOffset, ldb, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDtrsmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const double *alpha, double *Aarray[],
+                                  int lda, double *Barray[], int ldb,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_dtrsm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, transA, diagA, m, n,
+                                scalar_arg(handle, alpha), Aarray, aOffset,
+                                A_batchOffset, lda, Barray, bOffset,
+                                B_batchOffset, ldb, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCtrsmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, hcComplex *Barray[], int ldb,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_ctrsm(
+      handle->currentAcclView, handle->Order, sideA, uploA, transA, diagA, m, n,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZtrsmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  hcDoubleComplex *Barray[], int ldb,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_ztrsm(
+      handle->currentAcclView, handle->Order, sideA, uploA, transA, diagA, m, n,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 5. hcblas<t>syrk()
+
+// This function performs the symmetric rank-k update
+// C = α op ( A ) op ( A )^T + β C
+// where α and β are scalars, C is a symmetric matrix stored in lower or upper
+// mode, and A is a matrix with dimensions op(A) n × k. Also, for matrix A
+// op ( A ) = A   if  trans == HCBLAS_OP_N
+//            A^T if  trans == HCBLAS_OP_T
+// Only the uplo triangle of C is computed and written: off-diagonal blocks
+// run through hcblas<t>gemm() and the diagonal blocks through a kernel that
+// skips the other triangle, about half the work of the full product.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix C lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A) that is non- or
+//                                              transpose (HCBLAS_OP_C is
+//                                              taken as HCBLAS_OP_T for the
+//                                              real types and rejected for the
+//                                              complex ones).
+// n            host             input          number of rows of matrix op(A)
+//                                              and C.
+// k            host             input          number of columns of matrix
+//                                              op(A).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or trans is
+//                                 HCBLAS_OP_C for the complex types
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyrk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const float *alpha, float *A, int lda,
+                           const float *beta, float *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_ssyrk(handle->currentAcclView, handle->Order, uploC,
+                                transA, n, k, scalar_arg(handle, alpha), A,
+                                aOffset, lda, scalar_arg(handle, beta), C,
+                                cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDsyrk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const double *alpha, double *A, int lda,
+                           const double *beta, double *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_dsyrk(handle->currentAcclView, handle->Order, uploC,
+                                transA, n, k, scalar_arg(handle, alpha), A,
+                                aOffset, lda, scalar_arg(handle, beta), C,
+                                cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCsyrk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           const hcComplex *beta, hcComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || trans == HCBLAS_OP_C)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_csyrk(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 *>(A), aOffset, lda,
+      scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZsyrk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, const hcDoubleComplex *beta,
+                           hcDoubleComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || trans == HCBLAS_OP_C)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_zsyrk(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 *>(A), aOffset, lda,
+      scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 6. hcblas<t>syrkBatched()
+
+// This function performs the symmetric rank-k update for an array of matrices
+// C [ i ] = α op ( A [ i ] ) op ( A [ i ] )^T + β C [ i ]
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>syrk()
+// applying to every entry. Aarray and Carray are arrays of pointers to
+// matrices stored in column-major format. The diagonal blocks of every entry
+// share one launch and each off-diagonal block is one batched GEMM.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if trans ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0 or trans is
+//                                 HCBLAS_OP_C for the complex types
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyrkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const float *alpha, float *Aarray[], int lda,
+                                  const float *beta, float *Carray[], int ldc,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_ssyrk(handle->currentAcclView, handle->Order, uploC,
+                                transA, n, k, scalar_arg(handle, alpha), Aarray,
+                                aOffset, A_batchOffset, lda,
+                                scalar_arg(handle, beta), Carray, cOffset,
+                                C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDsyrkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const double *alpha, double *Aarray[],
+                                  int lda, const double *beta, double *Carray[],
+                                  int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_dsyrk(handle->currentAcclView, handle->Order, uploC,
+                                transA, n, k, scalar_arg(handle, alpha), Aarray,
+                                aOffset, A_batchOffset, lda,
+                                scalar_arg(handle, beta), Carray, cOffset,
+                                C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCsyrkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, const hcComplex *beta,
+                                  hcComplex *Carray[], int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0 || trans == HCBLAS_OP_C)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_csyrk(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 **>(Aarray), aOffset,
+      A_batchOffset, lda, scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZsyrkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  const hcDoubleComplex *beta,
+                                  hcDoubleComplex *Carray[], int ldc,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0 || trans == HCBLAS_OP_C)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_zsyrk(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 **>(Aarray), aOffset,
+      A_batchOffset, lda, scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 7. hcblas<t>herk()
+
+// This function performs the Hermitian rank-k update
+// C = α op ( A ) op ( A )^H + β C
+// where α and β are real scalars, C is a Hermitian matrix stored in lower or
+// upper mode, and A is a matrix with dimensions op(A) n × k. Also, for
+// matrix A
+// op ( A ) = A   if  trans == HCBLAS_OP_N
+//            A^H if  trans == HCBLAS_OP_C
+// Only the uplo triangle of C is computed and written, as in
+// hcblas<t>syrk(); the imaginary parts of the diagonal are set to zero.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix C lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A) that is non- or
+//                                              conj. transpose.
+// n            host             input          number of rows of matrix op(A)
+//                                              and C.
+// k            host             input          number of columns of matrix
+//                                              op(A).
+// alpha        host             input          real scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// beta         host             input          real scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or trans is HCBLAS_OP_T
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasCherk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const float *alpha, hcComplex *A, int lda,
+                           const float *beta, hcComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || trans == HCBLAS_OP_T)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : ConjTrans;
+
+  status = handle->hcblas_cherk(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 *>(A), aOffset, lda,
+      scalar_arg(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZherk(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                           hcblasOperation_t trans, int n, int k,
+                           const double *alpha, hcDoubleComplex *A, int lda,
+                           const double *beta, hcDoubleComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || trans == HCBLAS_OP_T)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : ConjTrans;
+
+  status = handle->hcblas_zherk(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 *>(A), aOffset, lda,
+      scalar_arg(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 8. hcblas<t>herkBatched()
+
+// This function performs the Hermitian rank-k update for an array of matrices
+// C [ i ] = α op ( A [ i ] ) op ( A [ i ] )^H + β C [ i ]
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>herk()
+// applying to every entry. Aarray and Carray are arrays of pointers to
+// matrices stored in column-major format. The diagonal blocks of every entry
+// share one launch and each off-diagonal block is one batched GEMM.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if trans ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0 or trans is
+//                                 HCBLAS_OP_T
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasCherkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const float *alpha, hcComplex *Aarray[],
+                                  int lda, const float *beta,
+                                  hcComplex *Carray[], int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0 || trans == HCBLAS_OP_T)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : ConjTrans;
+
+  status = handle->hcblas_cherk(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 **>(Aarray), aOffset,
+      A_batchOffset, lda, scalar_arg(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZherkBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans, int n, int k,
+                                  const double *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  const double *beta, hcDoubleComplex *Carray[],
+                                  int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0 || trans == HCBLAS_OP_T)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : ConjTrans;
+
+  status = handle->hcblas_zherk(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 **>(Aarray), aOffset,
+      A_batchOffset, lda, scalar_arg(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 9. hcblas<t>syr2k()
+
+// This function performs the symmetric rank-2k update
+// C = α ( op ( A ) op ( B )^T + op ( B ) op ( A )^T ) + β C
+// where α and β are scalars, C is a symmetric matrix stored in lower or upper
+// mode, and A and B are matrices with dimensions op(A) and op(B) n × k.
+// Also, for matrices A and B
+// op ( A ) and op ( B ) = A and B     if  trans == HCBLAS_OP_N
+//                         A^T and B^T if  trans == HCBLAS_OP_T
+// Both products are accumulated in one pass over the uplo triangle of C,
+// which is read and written once instead of once per hcblas<t>gemm() call.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix C lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A), op(B) that is
+//                                              non- or transpose (HCBLAS_OP_C
+//                                              is taken as HCBLAS_OP_T for the
+//                                              real types and rejected for the
+//                                              complex ones).
+// n            host             input          number of rows of matrix op(A),
+//                                              op(B) and C.
+// k            host             input          number of columns of matrix
+//                                              op(A) and op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              k with ldb>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and ldb x
+//                                              n with ldb>=max(1,k) otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or trans is
+//                                 HCBLAS_OP_C for the complex types
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyr2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const float *alpha, float *A, int lda, float *B,
+                            int ldb, const float *beta, float *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_ssyr2k(handle->currentAcclView, handle->Order, uploC,
+                                 transA, n, k, scalar_arg(handle, alpha), A,
+                                 aOffset, lda, B, bOffset, ldb,
+                                 scalar_arg(handle, beta), C, cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDsyr2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const double *alpha, double *A, int lda, double *B,
+                            int ldb, const double *beta, double *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_dsyr2k(handle->currentAcclView, handle->Order, uploC,
+                                 transA, n, k, scalar_arg(handle, alpha), A,
+                                 aOffset, lda, B, bOffset, ldb,
+                                 scalar_arg(handle, beta), C, cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCsyr2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const hcComplex *alpha, hcComplex *A, int lda,
+                            hcComplex *B, int ldb, const hcComplex *beta,
+                            hcComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || trans == HCBLAS_OP_C)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_csyr2k(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 *>(B), bOffset, ldb,
+      scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZsyr2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                            int lda, hcDoubleComplex *B, int ldb,
+                            const hcDoubleComplex *beta, hcDoubleComplex *C,
+                            int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || trans == HCBLAS_OP_C)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_zsyr2k(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 *>(B), bOffset, ldb,
+      scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 10. hcblas<t>syr2kBatched()
+
+// This function performs the symmetric rank-2k update for an array of matrices
+// C [ i ] = α ( op ( A [ i ] ) op ( B [ i ] )^T
+//            + op ( B [ i ] ) op ( A [ i ] )^T ) + β C [ i ]
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>syr2k()
+// applying to every entry. Aarray, Barray and Carray are arrays of pointers
+// to matrices stored in column-major format.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if trans ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x k if trans ==
+//                                              HCBLAS_OP_N and ldb x n
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0 or trans is
+//                                 HCBLAS_OP_C for the complex types
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsyr2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const float *alpha, float *Aarray[], int lda,
+                                   float *Barray[], int ldb, const float *beta,
+                                   float *Carray[], int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_ssyr2k(handle->currentAcclView, handle->Order, uploC,
+                                 transA, n, k, scalar_arg(handle, alpha),
+                                 Aarray, aOffset, A_batchOffset, lda, Barray,
+                                 bOffset, B_batchOffset, ldb,
+                                 scalar_arg(handle, beta), Carray, cOffset,
+                                 C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDsyr2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const double *alpha, double *Aarray[],
+                                   int lda, double *Barray[], int ldb,
+                                   const double *beta, double *Carray[],
+                                   int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_dsyr2k(handle->currentAcclView, handle->Order, uploC,
+                                 transA, n, k, scalar_arg(handle, alpha),
+                                 Aarray, aOffset, A_batchOffset, lda, Barray,
+                                 bOffset, B_batchOffset, ldb,
+                                 scalar_arg(handle, beta), Carray, cOffset,
+                                 C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCsyr2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const hcComplex *alpha, hcComplex *Aarray[],
+                                   int lda, hcComplex *Barray[], int ldb,
+                                   const hcComplex *beta, hcComplex *Carray[],
+                                   int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0 || trans == HCBLAS_OP_C)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_csyr2k(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZsyr2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const hcDoubleComplex *alpha,
+                                   hcDoubleComplex *Aarray[], int lda,
+                                   hcDoubleComplex *Barray[], int ldb,
+                                   const hcDoubleComplex *beta,
+                                   hcDoubleComplex *Carray[], int ldc,
+                                   int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0 || trans == HCBLAS_OP_C)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : Trans;
+
+  status = handle->hcblas_zsyr2k(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 11. hcblas<t>her2k()
+
+// This function performs the Hermitian rank-2k update
+// C = α op ( A ) op ( B )^H + conj ( α ) op ( B ) op ( A )^H + β C
+// where α is a complex and β a real scalar, C is a Hermitian matrix stored in
+// lower or upper mode, and A and B are matrices with dimensions op(A) and
+// op(B) n × k. Also, for matrices A and B
+// op ( A ) and op ( B ) = A and B     if  trans == HCBLAS_OP_N
+//                         A^H and B^H if  trans == HCBLAS_OP_C
+// As in hcblas<t>syr2k() only the uplo triangle of C is read and written,
+// once; the imaginary parts of the diagonal are set to zero.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if matrix C lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A), op(B) that is
+//                                              non- or conj. transpose.
+// n            host             input          number of rows of matrix op(A),
+//                                              op(B) and C.
+// k            host             input          number of columns of matrix
+//                                              op(A) and op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              k with ldb>=max(1,n) if
+//                                              trans == HCBLAS_OP_N and ldb x
+//                                              n with ldb>=max(1,k) otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          real scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0 or trans is HCBLAS_OP_T
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasCher2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const hcComplex *alpha, hcComplex *A, int lda,
+                            hcComplex *B, int ldb, const float *beta,
+                            hcComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || trans == HCBLAS_OP_T)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : ConjTrans;
+
+  status = handle->hcblas_cher2k(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 *>(B), bOffset, ldb,
+      scalar_arg(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZher2k(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t trans, int n, int k,
+                            const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                            int lda, hcDoubleComplex *B, int ldb,
+                            const double *beta, hcDoubleComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || trans == HCBLAS_OP_T)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : ConjTrans;
+
+  status = handle->hcblas_zher2k(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 *>(B), bOffset, ldb,
+      scalar_arg(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 12. hcblas<t>her2kBatched()
+
+// This function performs the Hermitian rank-2k update for an array of matrices
+// C [ i ] = α op ( A [ i ] ) op ( B [ i ] )^H
+//          + conj ( α ) op ( B [ i ] ) op ( A [ i ] )^H + β C [ i ]
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>her2k()
+// applying to every entry. Aarray, Barray and Carray are arrays of pointers
+// to matrices stored in column-major format.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if trans ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x k if trans ==
+//                                              HCBLAS_OP_N and ldb x n
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0 or trans is
+//                                 HCBLAS_OP_T
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasCher2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const hcComplex *alpha, hcComplex *Aarray[],
+                                   int lda, hcComplex *Barray[], int ldb,
+                                   const float *beta, hcComplex *Carray[],
+                                   int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0 || trans == HCBLAS_OP_T)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : ConjTrans;
+
+  status = handle->hcblas_cher2k(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZher2kBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t trans, int n, int k,
+                                   const hcDoubleComplex *alpha,
+                                   hcDoubleComplex *Aarray[], int lda,
+                                   hcDoubleComplex *Barray[], int ldb,
+                                   const double *beta,
+                                   hcDoubleComplex *Carray[], int ldc,
+                                   int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0 || trans == HCBLAS_OP_T)
+    return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N) ? NoTrans : ConjTrans;
+
+  status = handle->hcblas_zher2k(
+      handle->currentAcclView, handle->Order, uploC, transA, n, k,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 13. hcblas<t>symm()
+
+// This function performs the symmetric matrix-matrix multiplication
+// C = α A B + β C   if  side == HCBLAS_SIDE_LEFT
+// C = α B A + β C   if  side == HCBLAS_SIDE_RIGHT
+// where A is a symmetric matrix stored in lower or upper mode, B and C are
+// m × n matrices, and α and β are scalars. Only the uplo triangle of A is
+// read: tiles of the other one are mirrored from it as they are loaded, so
+// the full matrix is never formed.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// side         host             input          indicates if matrix A is on the
+//                                              left or right of B.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// m            host             input          number of rows of matrix C and
+//                                              B, with matrix A sized
+//                                              accordingly.
+// n            host             input          number of columns of matrix C
+//                                              and B, with matrix A sized
+//                                              accordingly.
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              m with lda>=max(1,m) if
+//                                              side == HCBLAS_SIDE_LEFT and
+//                                              lda x n with lda>=max(1,n)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              n with ldb>=max(1,m).
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsymm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const float *alpha, float *A, int lda, float *B,
+                           int ldb, const float *beta, float *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_ssymm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, m, n, scalar_arg(handle, alpha), A,
+                                aOffset, lda, B, bOffset, ldb,
+                                scalar_arg(handle, beta), C, cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDsymm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const double *alpha, double *A, int lda, double *B,
+                           int ldb, const double *beta, double *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_dsymm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, m, n, scalar_arg(handle, alpha), A,
+                                aOffset, lda, B, bOffset, ldb,
+                                scalar_arg(handle, beta), C, cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCsymm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           hcComplex *B, int ldb, const hcComplex *beta,
+                           hcComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_csymm(
+      handle->currentAcclView, handle->Order, sideA, uploA, m, n,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 *>(B), bOffset, ldb,
+      scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZsymm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, hcDoubleComplex *B, int ldb,
+                           const hcDoubleComplex *beta, hcDoubleComplex *C,
+                           int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_zsymm(
+      handle->currentAcclView, handle->Order, sideA, uploA, m, n,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 *>(B), bOffset, ldb,
+      scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 14. hcblas<t>symmBatched()
+
+// This function performs the symmetric matrix-matrix multiplication for an
+// array of matrices
+// C [ i ] = α A [ i ] B [ i ] + β C [ i ]   if  side == HCBLAS_SIDE_LEFT
+// C [ i ] = α B [ i ] A [ i ] + β C [ i ]   if  side == HCBLAS_SIDE_RIGHT
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>symm()
+// applying to every entry. Aarray, Barray and Carray are arrays of pointers
+// to matrices stored in column-major format. The tiles of every entry share
+// one launch.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x m if side ==
+//                                              HCBLAS_SIDE_LEFT and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n with ldb>=max(1,m).
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,m).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSsymmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const float *alpha, float *Aarray[], int lda,
+                                  float *Barray[], int ldb, const float *beta,
+                                  float *Carray[], int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_ssymm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, m, n, scalar_arg(handle, alpha), Aarray,
+                                aOffset, A_batchOffset, lda, Barray, bOffset,
+                                B_batchOffset, ldb, scalar_arg(handle, beta),
+                                Carray, cOffset, C_batchOffset, ldc,
+                                batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDsymmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const double *alpha, double *Aarray[],
+                                  int lda, double *Barray[], int ldb,
+                                  const double *beta, double *Carray[], int ldc,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_dsymm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, m, n, scalar_arg(handle, alpha), Aarray,
+                                aOffset, A_batchOffset, lda, Barray, bOffset,
+                                B_batchOffset, ldb, scalar_arg(handle, beta),
+                                Carray, cOffset, C_batchOffset, ldc,
+                                batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCsymmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, hcComplex *Barray[], int ldb,
+                                  const hcComplex *beta, hcComplex *Carray[],
+                                  int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_csymm(
+      handle->currentAcclView, handle->Order, sideA, uploA, m, n,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZsymmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  hcDoubleComplex *Barray[], int ldb,
+                                  const hcDoubleComplex *beta,
+                                  hcDoubleComplex *Carray[], int ldc,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_zsymm(
+      handle->currentAcclView, handle->Order, sideA, uploA, m, n,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 15. hcblas<t>hemm()
+
+// This function performs the Hermitian matrix-matrix multiplication
+// C = α A B + β C   if  side == HCBLAS_SIDE_LEFT
+// C = α B A + β C   if  side == HCBLAS_SIDE_RIGHT
+// where A is a Hermitian matrix stored in lower or upper mode, B and C are
+// m × n matrices, and α and β are scalars. Only the uplo triangle of A is
+// read: tiles of the other one are mirrored from it as they are loaded, so
+// the full matrix is never formed.
+// The imaginary parts of the diagonal of A are assumed to be zero.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// side         host             input          indicates if matrix A is on the
+//                                              left or right of B.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// m            host             input          number of rows of matrix C and
+//                                              B, with matrix A sized
+//                                              accordingly.
+// n            host             input          number of columns of matrix C
+//                                              and B, with matrix A sized
+//                                              accordingly.
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              m with lda>=max(1,m) if
+//                                              side == HCBLAS_SIDE_LEFT and
+//                                              lda x n with lda>=max(1,n)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              n with ldb>=max(1,m).
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n with ldc>=max(1,m).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasChemm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           hcComplex *B, int ldb, const hcComplex *beta,
+                           hcComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_chemm(
+      handle->currentAcclView, handle->Order, sideA, uploA, m, n,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 *>(B), bOffset, ldb,
+      scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZhemm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, int m, int n,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, hcDoubleComplex *B, int ldb,
+                           const hcDoubleComplex *beta, hcDoubleComplex *C,
+                           int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_zhemm(
+      handle->currentAcclView, handle->Order, sideA, uploA, m, n,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 *>(B), bOffset, ldb,
+      scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 16. hcblas<t>hemmBatched()
+
+// This function performs the Hermitian matrix-matrix multiplication for an
+// array of matrices
+// C [ i ] = α A [ i ] B [ i ] + β C [ i ]   if  side == HCBLAS_SIDE_LEFT
+// C [ i ] = α B [ i ] A [ i ] + β C [ i ]   if  side == HCBLAS_SIDE_RIGHT
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>hemm()
+// applying to every entry. Aarray, Barray and Carray are arrays of pointers
+// to matrices stored in column-major format. The tiles of every entry share
+// one launch.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x m if side ==
+//                                              HCBLAS_SIDE_LEFT and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n with ldb>=max(1,m).
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,m).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasChemmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, hcComplex *Barray[], int ldb,
+                                  const hcComplex *beta, hcComplex *Carray[],
+                                  int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_chemm(
+      handle->currentAcclView, handle->Order, sideA, uploA, m, n,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZhemmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo, int m, int n,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  hcDoubleComplex *Barray[], int ldb,
+                                  const hcDoubleComplex *beta,
+                                  hcDoubleComplex *Carray[], int ldc,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+
+  status = handle->hcblas_zhemm(
+      handle->currentAcclView, handle->Order, sideA, uploA, m, n,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 17. hcblas<t>trmm()
+
+// This function performs the triangular matrix-matrix multiplication
+// B = α op ( A ) B   if  side == HCBLAS_SIDE_LEFT
+// B = α B op ( A )   if  side == HCBLAS_SIDE_RIGHT
+// where A is a triangular matrix stored in lower or upper mode with or
+// without the main diagonal, B is an m × n matrix, and α is a scalar.
+// Also, for matrix A
+// op ( A ) = A   if  transa == HCBLAS_OP_N
+//            A^T if  transa == HCBLAS_OP_T
+//            A^H if  transa == HCBLAS_OP_C
+// The product overwrites B on exit, without a second buffer: blocks of B are
+// multiplied by their diagonal blocks of A directly, in an order that leaves
+// the blocks still to be read unchanged, and the rest of each block row of
+// op ( A ) runs through hcblas<t>gemm(). Blocks of A in the other triangle
+// are never read.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// side         host             input          indicates if matrix A is on the
+//                                              left or right of B.
+// uplo         host             input          indicates if matrix A lower or
+//                                              upper part is stored, the other
+//                                              part is not referenced.
+// trans        host             input          operation op(A) that is non- or
+//                                              (conj.) transpose.
+// diag         host             input          indicates if the elements on the
+//                                              main diagonal of matrix A are
+//                                              unity and should not be
+//                                              accessed.
+// m            host             input          number of rows of matrix B, with
+//                                              matrix A sized accordingly.
+// n            host             input          number of columns of matrix B,
+//                                              with matrix A sized
+//                                              accordingly.
+// alpha        host             input          <type> scalar used for
+//                                              multiplication. If alpha==0, A
+//                                              is not referenced and B does
+//                                              not have to be a valid input.
+// A            device           input          <type> array of dimension lda x
+//                                              m with lda>=max(1,m) if
+//                                              side == HCBLAS_SIDE_LEFT and
+//                                              lda x n with lda>=max(1,n)
+//                                              otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           in/out         <type> array of dimension ldb x
+//                                              n with ldb>=max(1,m). It is
+//                                              overwritten with the product.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrmm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const float *alpha, float *A, int lda, float *B,
+                           int ldb) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_strmm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, transA, diagA, m, n,
+                                scalar_arg(handle, alpha), A, aOffset, lda, B,
+                                bOffset, ldb);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDtrmm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const double *alpha, double *A, int lda, double *B,
+                           int ldb) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_dtrmm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, transA, diagA, m, n,
+                                scalar_arg(handle, alpha), A, aOffset, lda, B,
+                                bOffset, ldb);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCtrmm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const hcComplex *alpha, hcComplex *A, int lda,
+                           hcComplex *B, int ldb) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_ctrmm(
+      handle->currentAcclView, handle->Order, sideA, uploA, transA, diagA, m, n,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 *>(B), bOffset, ldb);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZtrmm(hcblasHandle_t handle, hcblasSideMode_t side,
+                           hcblasFillMode_t uplo, hcblasOperation_t trans,
+                           hcblasDiagType_t diag, int m, int n,
+                           const hcDoubleComplex *alpha, hcDoubleComplex *A,
+                           int lda, hcDoubleComplex *B, int ldb) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_ztrmm(
+      handle->currentAcclView, handle->Order, sideA, uploA, transA, diagA, m, n,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 *>(B), bOffset, ldb);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 18. hcblas<t>trmmBatched()
+
+// This function performs the triangular matrix-matrix multiplication for an
+// array of matrices
+// B [ i ] = α op ( A [ i ] ) B [ i ]   if  side == HCBLAS_SIDE_LEFT
+// B [ i ] = α B [ i ] op ( A [ i ] )   if  side == HCBLAS_SIDE_RIGHT
+// for i  ∈ [ 0 , batchCount − 1 ], with the parameters of hcblas<t>trmm()
+// applying to every entry. Aarray and Barray are arrays of pointers to
+// matrices stored in column-major format; each product overwrites B [ i ].
+
+// This function is intended for many small products: when A [ i ] has at
+// most 64 rows (32 for double complex), every product takes a single launch.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x m if side ==
+//                                              HCBLAS_SIDE_LEFT and lda x n
+//                                              otherwise.
+// Barray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n with ldb>=max(1,m).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray and Barray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters m,n,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasStrmmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const float *alpha, float *Aarray[], int lda,
+                                  float *Barray[], int ldb, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_strmm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, transA, diagA, m, n,
+                                scalar_arg(handle, alpha), Aarray, aOffset,
+                                A_batchOffset, lda, Barray, bOffset,
+                                B_batchOffset, ldb, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDtrmmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const double *alpha, double *Aarray[],
+                                  int lda, double *Barray[], int ldb,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_dtrmm(handle->currentAcclView, handle->Order, sideA,
+                                uploA, transA, diagA, m, n,
+                                scalar_arg(handle, alpha), Aarray, aOffset,
+                                A_batchOffset, lda, Barray, bOffset,
+                                B_batchOffset, ldb, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCtrmmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const hcComplex *alpha, hcComplex *Aarray[],
+                                  int lda, hcComplex *Barray[], int ldb,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_ctrmm(
+      handle->currentAcclView, handle->Order, sideA, uploA, transA, diagA, m, n,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZtrmmBatched(hcblasHandle_t handle, hcblasSideMode_t side,
+                                  hcblasFillMode_t uplo,
+                                  hcblasOperation_t trans,
+                                  hcblasDiagType_t diag, int m, int n,
+                                  const hcDoubleComplex *alpha,
+                                  hcDoubleComplex *Aarray[], int lda,
+                                  hcDoubleComplex *Barray[], int ldb,
+                                  int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (m < 0 || n < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasSide sideA = (side == HCBLAS_SIDE_LEFT) ? Left : Right;
+  hcblasUplo uploA = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (trans == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (trans == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasDiag diagA = (diag == HCBLAS_DIAG_UNIT) ? Unit : NonUnit;
+
+  status = handle->hcblas_ztrmm(
+      handle->currentAcclView, handle->Order, sideA, uploA, transA, diagA, m, n,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 19. hcblas<t>gemmt()
+
+// This function performs the matrix-matrix multiplication
+// C = α op ( A ) op ( B ) + β C
+// on the lower or upper triangle of C only, where α and β are scalars, A and
+// B are general matrices with dimensions op(A) n × k and op(B) k × n, and C
+// is an n × n matrix whose other triangle is not referenced. Also, for
+// matrix A
+// op ( A ) = A   if  transa == HCBLAS_OP_N
+//            A^T if  transa == HCBLAS_OP_T
+//            A^H if  transa == HCBLAS_OP_C
+// and op ( B ) is defined similarly for matrix B. Blocks of C outside the
+// uplo triangle are never computed: off-diagonal blocks run through
+// hcblas<t>gemm() and the diagonal blocks through a kernel that skips the
+// other triangle, about half the work of the full product.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// handle       host             input          handle to the HCBLAS library
+//                                              context.
+// uplo         host             input          indicates if the lower or upper
+//                                              part of matrix C is computed,
+//                                              the other part is not
+//                                              referenced.
+// transa       host             input          operation op(A) that is non- or
+//                                              (conj.) transpose.
+// transb       host             input          operation op(B) that is non- or
+//                                              (conj.) transpose.
+// n            host             input          number of rows of matrix op(A),
+//                                              columns of matrix op(B) and
+//                                              rows and columns of C.
+// k            host             input          number of columns of op(A) and
+//                                              rows of op(B).
+// alpha        host             input          <type> scalar used for
+//                                              multiplication.
+// A            device           input          <type> array of dimension lda x
+//                                              k with lda>=max(1,n) if
+//                                              transa == HCBLAS_OP_N and lda x
+//                                              n with lda>=max(1,k) otherwise.
+// lda          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix A.
+// B            device           input          <type> array of dimension ldb x
+//                                              n with ldb>=max(1,k) if
+//                                              transb == HCBLAS_OP_N and ldb x
+//                                              k with ldb>=max(1,n) otherwise.
+// ldb          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix B.
+// beta         host             input          <type> scalar used for
+//                                              multiplication, if beta==0 then
+//                                              C does not have to be a valid
+//                                              input.
+// C            device           in/out         <type> array of dimension ldc x
+//                                              n, with ldc>=max(1,n).
+// ldc          host             input          leading dimension of
+//                                              two-dimensional array used to
+//                                              store matrix C.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgemmt(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t transa, hcblasOperation_t transb,
+                            int n, int k, const float *alpha, float *A, int lda,
+                            float *B, int ldb, const float *beta, float *C,
+                            int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (transa == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transa == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasTranspose transB = (transb == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transb == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_sgemmt(handle->currentAcclView, handle->Order, uploC,
+                                 transA, transB, n, k,
+                                 scalar_arg(handle, alpha), A, aOffset, lda, B,
+                                 bOffset, ldb, scalar_arg(handle, beta), C,
+                                 cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDgemmt(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t transa, hcblasOperation_t transb,
+                            int n, int k, const double *alpha, double *A,
+                            int lda, double *B, int ldb, const double *beta,
+                            double *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (transa == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transa == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasTranspose transB = (transb == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transb == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_dgemmt(handle->currentAcclView, handle->Order, uploC,
+                                 transA, transB, n, k,
+                                 scalar_arg(handle, alpha), A, aOffset, lda, B,
+                                 bOffset, ldb, scalar_arg(handle, beta), C,
+                                 cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCgemmt(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t transa, hcblasOperation_t transb,
+                            int n, int k, const hcComplex *alpha, hcComplex *A,
+                            int lda, hcComplex *B, int ldb,
+                            const hcComplex *beta, hcComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (transa == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transa == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasTranspose transB = (transb == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transb == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_cgemmt(
+      handle->currentAcclView, handle->Order, uploC, transA, transB, n, k,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 *>(B), bOffset, ldb,
+      scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZgemmt(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                            hcblasOperation_t transa, hcblasOperation_t transb,
+                            int n, int k, const hcDoubleComplex *alpha,
+                            hcDoubleComplex *A, int lda, hcDoubleComplex *B,
+                            int ldb, const hcDoubleComplex *beta,
+                            hcDoubleComplex *C, int ldc) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (transa == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transa == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasTranspose transB = (transb == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transb == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_zgemmt(
+      handle->currentAcclView, handle->Order, uploC, transA, transB, n, k,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 *>(A), aOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 *>(B), bOffset, ldb,
+      scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 *>(C), cOffset, ldc);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// 20. hcblas<t>gemmtBatched()
+
+// This function performs the triangular matrix-matrix multiplication for an
+// array of matrices
+// C [ i ] = α op ( A [ i ] ) op ( B [ i ] ) + β C [ i ]
+// on the uplo triangle of each C [ i ], for i  ∈ [ 0 , batchCount − 1 ],
+// with the parameters of hcblas<t>gemmt() applying to every entry. Aarray,
+// Barray and Carray are arrays of pointers to matrices stored in
+// column-major format. The diagonal blocks of every entry share one launch
+// and each off-diagonal block is one batched GEMM.
+
+// Param.       Memory           In/out         Meaning
+// -------------------------------------------------------------------------------------
+// Aarray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              lda x k if transa ==
+//                                              HCBLAS_OP_N and lda x n
+//                                              otherwise.
+// Barray       device           input          array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldb x n if transb ==
+//                                              HCBLAS_OP_N and ldb x k
+//                                              otherwise.
+// Carray       device           in/out         array of pointers to <type>
+//                                              array, with each array of dim.
+//                                              ldc x n with ldc>=max(1,n).
+// batchCount   host             input          number of pointers contained in
+//                                              Aarray, Barray and Carray.
+
+// Return Values
+// --------------------------------------------------------------------
+// HCBLAS_STATUS_SUCCESS           the operation completed successfully
+// HCBLAS_STATUS_NOT_INITIALIZED   the library was not initialized
+// HCBLAS_STATUS_INVALID_VALUE     the parameters n,k,batchCount<0
+// HCBLAS_STATUS_EXECUTION_FAILED  the function failed to launch on the GPU
+
+hcblasStatus_t hcblasSgemmtBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int n, int k,
+                                   const float *alpha, float *Aarray[], int lda,
+                                   float *Barray[], int ldb, const float *beta,
+                                   float *Carray[], int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (transa == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transa == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasTranspose transB = (transb == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transb == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_sgemmt(handle->currentAcclView, handle->Order, uploC,
+                                 transA, transB, n, k,
+                                 scalar_arg(handle, alpha), Aarray, aOffset,
+                                 A_batchOffset, lda, Barray, bOffset,
+                                 B_batchOffset, ldb, scalar_arg(handle, beta),
+                                 Carray, cOffset, C_batchOffset, ldc,
+                                 batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasDgemmtBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int n, int k,
+                                   const double *alpha, double *Aarray[],
+                                   int lda, double *Barray[], int ldb,
+                                   const double *beta, double *Carray[],
+                                   int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (transa == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transa == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasTranspose transB = (transb == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transb == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_dgemmt(handle->currentAcclView, handle->Order, uploC,
+                                 transA, transB, n, k,
+                                 scalar_arg(handle, alpha), Aarray, aOffset,
+                                 A_batchOffset, lda, Barray, bOffset,
+                                 B_batchOffset, ldb, scalar_arg(handle, beta),
+                                 Carray, cOffset, C_batchOffset, ldc,
+                                 batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasCgemmtBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int n, int k,
+                                   const hcComplex *alpha, hcComplex *Aarray[],
+                                   int lda, hcComplex *Barray[], int ldb,
+                                   const hcComplex *beta, hcComplex *Carray[],
+                                   int ldc, int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (transa == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transa == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasTranspose transB = (transb == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transb == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_cgemmt(
+      handle->currentAcclView, handle->Order, uploC, transA, transB, n, k,
+      scalar_arg<hc::short_vector::float_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::float_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::float_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg<hc::short_vector::float_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::float_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hcblasStatus_t hcblasZgemmtBatched(hcblasHandle_t handle, hcblasFillMode_t uplo,
+                                   hcblasOperation_t transa,
+                                   hcblasOperation_t transb, int n, int k,
+                                   const hcDoubleComplex *alpha,
+                                   hcDoubleComplex *Aarray[], int lda,
+                                   hcDoubleComplex *Barray[], int ldb,
+                                   const hcDoubleComplex *beta,
+                                   hcDoubleComplex *Carray[], int ldc,
+                                   int batchCount) {
+  if (handle == nullptr || handle->initialized == false)
+    return HCBLAS_STATUS_NOT_INITIALIZED;
+
+  if (n < 0 || k < 0 || batchCount < 0) return HCBLAS_STATUS_INVALID_VALUE;
+
+  __int64_t aOffset = 0;
+  __int64_t bOffset = 0;
+  __int64_t cOffset = 0;
+  __int64_t A_batchOffset = 0;
+  __int64_t B_batchOffset = 0;
+  __int64_t C_batchOffset = 0;
+
+  hcblasStatus status;
+  hcblasUplo uploC = (uplo == HCBLAS_FILL_MODE_LOWER) ? Lower : Upper;
+  hcblasTranspose transA = (transa == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transa == HCBLAS_OP_T) ? Trans : ConjTrans;
+  hcblasTranspose transB = (transb == HCBLAS_OP_N)
+                               ? NoTrans
+                               : (transb == HCBLAS_OP_T) ? Trans : ConjTrans;
+
+  status = handle->hcblas_zgemmt(
+      handle->currentAcclView, handle->Order, uploC, transA, transB, n, k,
+      scalar_arg<hc::short_vector::double_2>(handle, alpha),
+      reinterpret_cast<hc::short_vector::double_2 **>(Aarray), aOffset,
+      A_batchOffset, lda,
+      reinterpret_cast<hc::short_vector::double_2 **>(Barray), bOffset,
+      B_batchOffset, ldb, scalar_arg<hc::short_vector::double_2>(handle, beta),
+      reinterpret_cast<hc::short_vector::double_2 **>(Carray), cOffset,
+      C_batchOffset, ldc, batchCount);
+
+  if (status == HCBLAS_SUCCEEDS)
+    return HCBLAS_STATUS_SUCCESS;
+  else
+    return HCBLAS_STATUS_EXECUTION_FAILED;
+}
@@ -193,6 +193,7 @@ hipblasStatus_t hipblasDasum(hipblasHandle_t handle, int n, const double *x,
       hcblasDasum(handle, n, const_cast<double *>(x), incx, result));
 }
 
+// result holds batchCount values, result[i] for vector i
 hipblasStatus_t hipblasSasumBatched(hipblasHandle_t handle, int n, float *x,
                                     int incx, float *result, int batchCount) {
   return hipHCBLASStatusToHIPStatus(
@@ -262,6 +263,7 @@ hipblasStatus_t hipblasDdot(hipblasHandle_t handle, int n, const double *x,
       hcblasDdot(handle, n, x, incx, y, incy, result));
 }
 
+// result holds batchCount values, result[i] for vectors i
 hipblasStatus_t hipblasSdotBatched(hipblasHandle_t handle, int n,
                                    const float *x, int incx, const float *y,
                                    int incy, float *result, int batchCount) {
@@ -0,0 +1,168 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include <cblas.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Compares the host (CPU accelerator) SGEMM/DGEMM path against the reference
+// BLAS linked with -lblas for every transpose combination in both orders.
+// Usage: gemm_host_timer M N K [iterations]
+
+unsigned int global_seed = 100;
+
+template <typename T>
+T average(const std::vector<std::chrono::duration<T>> &data) {
+  T avg_duration = 0;
+  for (auto &i : data) avg_duration += i.count();
+  return avg_duration / data.size();
+}
+
+double gflops(double Time, int M, int N, int K) {
+  return ((2.0 * M * N * K) / Time);
+}
+
+void cblas_gemm(CBLAS_ORDER order, CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb,
+                int M, int N, int K, float alpha, const float *A, int lda,
+                const float *B, int ldb, float beta, float *C, int ldc) {
+  cblas_sgemm(order, ta, tb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+void cblas_gemm(CBLAS_ORDER order, CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb,
+                int M, int N, int K, double alpha, const double *A, int lda,
+                const double *B, int ldb, double beta, double *C, int ldc) {
+  cblas_dgemm(order, ta, tb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hcblasStatus hcblas_gemm(Hcblaslibrary &hc, hcblasOrder order,
+                         hcblasTranspose ta, hcblasTranspose tb, int M, int N,
+                         int K, float alpha, float *A, __int64_t lda, float *B,
+                         __int64_t ldb, float beta, float *C, __int64_t ldc) {
+  return hc.hcblas_sgemm(hc.currentAcclView, order, ta, tb, M, N, K, alpha, A,
+                         lda, B, ldb, beta, C, ldc, 0, 0, 0);
+}
+
+hcblasStatus hcblas_gemm(Hcblaslibrary &hc, hcblasOrder order,
+                         hcblasTranspose ta, hcblasTranspose tb, int M, int N,
+                         int K, double alpha, double *A, __int64_t lda,
+                         double *B, __int64_t ldb, double beta, double *C,
+                         __int64_t ldc) {
+  return hc.hcblas_dgemm(hc.currentAcclView, order, ta, tb, M, N, K, alpha, A,
+                         lda, B, ldb, beta, C, ldc, 0, 0, 0);
+}
+
+template <typename T>
+bool run_case(Hcblaslibrary &hc, const char *name, hcblasOrder order,
+              hcblasTranspose ta, hcblasTranspose tb, int M, int N, int K,
+              int iterations) {
+  // Leading dimensions for the stored (possibly transposed) matrices
+  bool col = (order == ColMajor);
+  __int64_t lda = (col == (ta == NoTrans)) ? M : K;
+  __int64_t ldb = (col == (tb == NoTrans)) ? K : N;
+  __int64_t ldc = col ? M : N;
+  std::vector<T> A(static_cast<size_t>(M) * K), B(static_cast<size_t>(K) * N);
+  std::vector<T> C(static_cast<size_t>(M) * N), C_cblas(C.size());
+  T alpha = 1, beta = 0;
+  for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 100;
+  for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 15;
+
+  std::chrono::time_point<std::chrono::high_resolution_clock> start, end;
+  std::vector<std::chrono::duration<double>> elapsed_hcblas, elapsed_cblas;
+  CBLAS_ORDER cOrder = col ? CblasColMajor : CblasRowMajor;
+  CBLAS_TRANSPOSE Transa = (ta == NoTrans) ? CblasNoTrans : CblasTrans;
+  CBLAS_TRANSPOSE Transb = (tb == NoTrans) ? CblasNoTrans : CblasTrans;
+  for (int iter = 0; iter < iterations; iter++) {
+    start = std::chrono::high_resolution_clock::now();
+    hcblasStatus status = hcblas_gemm(hc, order, ta, tb, M, N, K, alpha,
+                                      A.data(), lda, B.data(), ldb, beta,
+                                      C.data(), ldc);
+    end = std::chrono::high_resolution_clock::now();
+    elapsed_hcblas.push_back(end - start);
+    if (status) std::cout << "TEST FAILED" << status << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    cblas_gemm(cOrder, Transa, Transb, M, N, K, alpha, A.data(), lda,
+               B.data(), ldb, beta, C_cblas.data(), ldc);
+    end = std::chrono::high_resolution_clock::now();
+    elapsed_cblas.push_back(end - start);
+  }
+
+  // Integer inputs: both results are exact
+  for (size_t i = 0; i < C.size(); i++) {
+    if (C[i] != C_cblas[i]) {
+      std::cout << name << " mismatch at " << i << ": " << C[i]
+                << " != " << C_cblas[i] << std::endl;
+      return false;
+    }
+  }
+  double hc_time = average(elapsed_hcblas) * 1e9;
+  double cblas_time = average(elapsed_cblas) * 1e9;
+  std::cout << name << (col ? " Col " : " Row ") << (ta == NoTrans ? "N" : "T")
+            << (tb == NoTrans ? "N" : "T") << "  hcblas host <Gflops>:"
+            << gflops(hc_time, M, N, K)
+            << "  cblas <Gflops>:" << gflops(cblas_time, M, N, K)
+            << "  speedup:" << cblas_time / hc_time << std::endl;
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 4) {
+    std::cout << "No sufficient commandline arguments specified"
+              << "argc :" << argc << std::endl;
+    return -1;
+  }
+  int M = atoi(argv[1]);
+  int N = atoi(argv[2]);
+  int K = atoi(argv[3]);
+  int iterations = (argc > 4) ? atoi(argv[4]) : 5;
+
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  if (!hc.hostExecution) {
+    std::cout << "CPU accelerator not available" << std::endl;
+    return -1;
+  }
+
+  hcblasOrder orders[] = {ColMajor, RowMajor};
+  hcblasTranspose trans[] = {NoTrans, Trans};
+  bool ispassed = true;
+  for (int o = 0; o < 2; o++) {
+    for (int a = 0; a < 2; a++) {
+      for (int b = 0; b < 2; b++) {
+        ispassed &= run_case<float>(hc, "sgemm", orders[o], trans[a], trans[b],
+                                    M, N, K, iterations);
+        ispassed &= run_case<double>(hc, "dgemm", orders[o], trans[a],
+                                     trans[b], M, N, K, iterations);
+      }
+    }
+  }
+  if (!ispassed) {
+    std::cout << "TEST FAILED" << std::endl;
+    return -1;
+  }
+  return 0;
+}
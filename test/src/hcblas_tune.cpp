@@ -0,0 +1,624 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblas.h"
+#include "include/hcblaslib.h"
+#include "src/blas/dgemm/dgemm_array_kernels.h"
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/scratch/scratch_pool.h"
+#include "src/blas/sgemm/sgemm_array_kernels.h"
+#include "src/blas/tunedb/tuning_db.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <hc_am.hpp>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Offline GEMM autotuner. Runs every kernel variant the selection table can
+// name on each shape of the given dimension files (the 13 column format of
+// benchmark/BLAS_benchmark_Convolution_Networks) and writes a table for
+// HCBLAS_GEMM_TABLE.
+//
+// Usage: hcblas-tune [--cpu] [--precision s|d] [--order C|R] [--repeat N]
+//                    [--min-time ms] [--exact] [-o table.txt] dims.txt...
+//
+// On the GPU the column major SGEMM or DGEMM variants (MICRO_NBK_*,
+// Mini_Batch_*, STEP_*, TILED_*) are timed. With --cpu, or when no GPU is present, the host GEMM
+// variants are timed instead, so CPU deployments can be tuned without a GPU.
+// Host rules name host_* variants and GPU rules name device kernels, so both
+// can live in one table.
+//
+// Each variant is checked against the default kernel on integer data and
+// dropped for the shape on a mismatch. A timing is the median of --repeat
+// samples, each running the variant enough times to last --min-time ms.
+// Shapes are grouped into power of two buckets per dimension and a bucket
+// gets the variant with the lowest summed time relative to the best variant
+// per shape; --exact emits one rule per shape instead.
+//
+// --thresholds takes no dimension files: it times the GPU AXPY step sizes
+// and the split and unsplit transposed GEMV of the precision against each
+// other and stores the crossovers as threshold records in the tuning
+// database of HCBLAS_TUNING_DB, where saxpy/daxpy and sgemv/dgemv read them.
+
+struct Options {
+  bool cpu = false;
+  char precision = 's';
+  char order = 'C';
+  int repeat = 5;
+  double minTimeMs = 2.0;
+  bool exact = false;
+  bool thresholds = false;
+  std::string output;
+  std::vector<std::string> files;
+};
+
+struct Shape {
+  int M, N, K;
+  bool transA, transB;
+  __int64_t lda, ldb, ldc;
+};
+
+// Median per call time of a variant in milliseconds. sync is called once
+// per sample so asynchronous launches are fully counted.
+double time_variant(const Options &opt, const std::function<void()> &run,
+                    const std::function<void()> &sync) {
+  typedef std::chrono::high_resolution_clock Clock;
+  run();
+  sync();
+  Clock::time_point start = Clock::now();
+  run();
+  sync();
+  double once = std::chrono::duration<double, std::milli>(Clock::now() - start)
+                    .count();
+  int iters = std::max(1, static_cast<int>(std::ceil(opt.minTimeMs /
+                                                     std::max(once, 1e-6))));
+  std::vector<double> samples;
+  for (int r = 0; r < opt.repeat; r++) {
+    start = Clock::now();
+    for (int i = 0; i < iters; i++) run();
+    sync();
+    samples.push_back(
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count() /
+        iters);
+  }
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+
+// Stored extents of op(X) for the chosen order: rows x cols in memory
+__int64_t stored_ld(bool colMajor, bool trans, int rows, int cols) {
+  return (colMajor == !trans) ? rows : cols;
+}
+
+__int64_t stored_size(__int64_t ld, bool colMajor, bool trans, int rows,
+                      int cols) {
+  return ld * ((colMajor == !trans) ? cols : rows);
+}
+
+template <typename T>
+void fill(std::vector<T> &X, unsigned int *seed) {
+  for (size_t i = 0; i < X.size(); i++) X[i] = rand_r(seed) % 7 - 3;
+}
+
+// Host variants: returns variant name -> milliseconds
+template <typename T>
+std::map<std::string, double> tune_host(const Options &opt, const Shape &s) {
+  bool col = opt.order == 'C';
+  unsigned int seed = 100;
+  std::vector<T> A(stored_size(s.lda, col, s.transA, s.M, s.K));
+  std::vector<T> B(stored_size(s.ldb, col, s.transB, s.K, s.N));
+  std::vector<T> C(stored_size(s.ldc, col, false, s.M, s.N)), ref(C.size());
+  fill(A, &seed);
+  fill(B, &seed);
+  int count = host_gemm_variant_count<T>();
+  host_gemm_variant<T>(count - 1, col, s.transA, s.transB, s.M, s.N, s.K, 1,
+                       A.data(), s.lda, B.data(), s.ldb, 0, ref.data(),
+                       s.ldc);
+  std::map<std::string, double> result;
+  for (int v = 0; v < count; v++) {
+    std::function<void()> run = [&]() {
+      host_gemm_variant<T>(v, col, s.transA, s.transB, s.M, s.N, s.K, 1,
+                           A.data(), s.lda, B.data(), s.ldb, 0, C.data(),
+                           s.ldc);
+    };
+    run();
+    if (C != ref) {
+      std::cerr << "  " << host_gemm_variant_name<T>(v)
+                << " disagrees with the default, skipped" << std::endl;
+      continue;
+    }
+    result[host_gemm_variant_name<T>(v)] =
+        time_variant(opt, run, []() {});
+  }
+  return result;
+}
+
+// Column major device variants of the registry (kernels, count) admitting
+// the shape
+template <typename T, typename Entry>
+std::map<std::string, double> tune_device(const Options &opt,
+                                          hc::accelerator_view &av,
+                                          const Shape &s, const Entry *kernels,
+                                          int count) {
+  unsigned int seed = 100;
+  std::vector<T> A(stored_size(s.lda, true, s.transA, s.M, s.K));
+  std::vector<T> B(stored_size(s.ldb, true, s.transB, s.K, s.N));
+  std::vector<T> C(stored_size(s.ldc, true, false, s.M, s.N), 0);
+  std::vector<T> ref(C.size());
+  fill(A, &seed);
+  fill(B, &seed);
+  hc::accelerator acc = av.get_accelerator();
+  T *devA = hc::am_alloc(sizeof(T) * A.size(), acc, 0);
+  T *devB = hc::am_alloc(sizeof(T) * B.size(), acc, 0);
+  T *devC = hc::am_alloc(sizeof(T) * C.size(), acc, 0);
+  av.copy(A.data(), devA, A.size() * sizeof(T));
+  av.copy(B.data(), devB, B.size() * sizeof(T));
+
+  std::map<std::string, double> result;
+  // Partials of the SPLIT_K and STREAM_K variants
+  ScratchPool scratch;
+  // The last entry is the general kernel and serves as the reference
+  for (int v = count - 1; v >= 0; v--) {
+    const Entry &k = kernels[v];
+    if (!k.info.admits(s.M, s.N, s.K)) continue;
+    std::function<void()> run = [&]() {
+      k.fn(av, &scratch, devA, 0, devB, 0, devC, 0, s.M, s.N, s.K, s.lda,
+           s.ldb, s.ldc, 1, 0);
+    };
+    av.copy(C.data(), devC, C.size() * sizeof(T));
+    run();
+    av.wait();
+    std::vector<T> out(C.size());
+    av.copy(devC, out.data(), out.size() * sizeof(T));
+    if (v == count - 1) {
+      ref = out;
+    } else if (out != ref) {
+      std::cerr << "  " << k.info.name << " disagrees with the default, skipped"
+                << std::endl;
+      continue;
+    }
+    result[k.info.name] = time_variant(opt, run, [&]() { av.wait(); });
+  }
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+  return result;
+}
+
+bool read_shapes(const std::string &path, const Options &opt,
+                 std::vector<Shape> *shapes) {
+  std::ifstream in(path.c_str());
+  if (!in) {
+    std::cerr << "hcblas-tune: cannot open " << path << std::endl;
+    return false;
+  }
+  bool col = opt.order == 'C';
+  std::string line;
+  int line_no = 0;
+  while (std::getline(in, line)) {
+    line_no++;
+    std::istringstream fields(line);
+    long v[8];
+    int n = 0;
+    while (n < 8 && fields >> v[n]) n++;
+    if (n == 0) continue;
+    if (n < 5 || v[0] <= 0 || v[1] <= 0 || v[2] <= 0) {
+      std::cerr << "hcblas-tune: " << path << ":" << line_no
+                << ": expected 'M N K TransA TransB lda ldb ldc ...'"
+                << std::endl;
+      return false;
+    }
+    Shape s;
+    s.M = v[0];
+    s.N = v[1];
+    s.K = v[2];
+    s.transA = v[3] != 0;
+    s.transB = v[4] != 0;
+    // Leading dimensions from the file when they are valid, else tight
+    s.lda = stored_ld(col, s.transA, s.M, s.K);
+    s.ldb = stored_ld(col, s.transB, s.K, s.N);
+    s.ldc = stored_ld(col, false, s.M, s.N);
+    if (n == 8) {
+      s.lda = std::max<__int64_t>(s.lda, v[5]);
+      s.ldb = std::max<__int64_t>(s.ldb, v[6]);
+      s.ldc = std::max<__int64_t>(s.ldc, v[7]);
+    }
+    shapes->push_back(s);
+  }
+  return true;
+}
+
+// Power of two bucket [2^(b-1) + 1, 2^b] holding v
+void bucket(int v, int *lo, int *hi) {
+  int b = 1;
+  while (b < v) b <<= 1;
+  *hi = b;
+  *lo = b == 1 ? 1 : b / 2 + 1;
+}
+
+struct Measured {
+  Shape shape;
+  std::map<std::string, double> ms;
+};
+
+std::string range(int lo, int hi) {
+  std::ostringstream r;
+  r << lo << ":" << hi;
+  return r.str();
+}
+
+std::string rule_prefix(const Options &opt, const Shape &s) {
+  std::ostringstream r;
+  r << opt.precision << " " << opt.order << " " << (s.transA ? 't' : 'n')
+    << " " << (s.transB ? 't' : 'n') << " 0";
+  return r.str();
+}
+
+// Variant with the lowest time relative to the best one, summed over the
+// group. Only variants measured on every shape of the group compete.
+std::string pick(const std::vector<const Measured *> &group) {
+  std::map<std::string, double> score;
+  std::map<std::string, int> seen;
+  for (size_t i = 0; i < group.size(); i++) {
+    double best = 0;
+    for (std::map<std::string, double>::const_iterator it =
+             group[i]->ms.begin();
+         it != group[i]->ms.end(); ++it) {
+      if (best == 0 || it->second < best) best = it->second;
+    }
+    for (std::map<std::string, double>::const_iterator it =
+             group[i]->ms.begin();
+         it != group[i]->ms.end(); ++it) {
+      score[it->first] += it->second / best;
+      seen[it->first]++;
+    }
+  }
+  std::string winner;
+  double winnerScore = 0;
+  for (std::map<std::string, double>::const_iterator it = score.begin();
+       it != score.end(); ++it) {
+    if (seen[it->first] != static_cast<int>(group.size())) continue;
+    if (winner.empty() || it->second < winnerScore) {
+      winner = it->first;
+      winnerScore = it->second;
+    }
+  }
+  return winner;
+}
+
+void write_table(const Options &opt, const std::vector<Measured> &results,
+                 std::ostream &out) {
+  out << "# hcblas-tune " << (opt.cpu ? "host" : "device") << " table, "
+      << results.size() << " shapes\n";
+  out << "# prec order transA transB batched M N K relation kernel\n";
+  // Groups keep file order so the emitted rules are stable
+  std::vector<std::string> order;
+  std::map<std::string, std::vector<const Measured *> > groups;
+  for (size_t i = 0; i < results.size(); i++) {
+    const Shape &s = results[i].shape;
+    std::ostringstream key;
+    key << rule_prefix(opt, s);
+    if (opt.exact) {
+      key << " " << range(s.M, s.M) << " " << range(s.N, s.N) << " "
+          << range(s.K, s.K);
+    } else {
+      int lo[3], hi[3];
+      bucket(s.M, &lo[0], &hi[0]);
+      bucket(s.N, &lo[1], &hi[1]);
+      bucket(s.K, &lo[2], &hi[2]);
+      key << " " << range(lo[0], hi[0]) << " " << range(lo[1], hi[1]) << " "
+          << range(lo[2], hi[2]);
+    }
+    if (groups.find(key.str()) == groups.end()) order.push_back(key.str());
+    groups[key.str()].push_back(&results[i]);
+  }
+  for (size_t g = 0; g < order.size(); g++) {
+    const std::vector<const Measured *> &group = groups[order[g]];
+    std::string winner = pick(group);
+    if (!winner.empty()) {
+      out << order[g] << " - " << winner << "\n";
+      continue;
+    }
+    // No variant ran on every shape of the bucket: fall back to exact rules
+    for (size_t i = 0; i < group.size(); i++) {
+      std::vector<const Measured *> one(1, group[i]);
+      winner = pick(one);
+      if (winner.empty()) continue;
+      const Shape &s = group[i]->shape;
+      out << rule_prefix(opt, s) << " " << range(s.M, s.M) << " "
+          << range(s.N, s.N) << " " << range(s.K, s.K) << " - " << winner
+          << "\n";
+    }
+  }
+}
+
+// Threshold records of the given names and values
+bool store_thresholds(TuningDb *db, const std::vector<std::string> &names,
+                      const std::vector<int64_t> &values) {
+  std::vector<TuningRecord> records;
+  for (size_t i = 0; i < names.size(); i++) {
+    TuningRecord record = {TUNING_THRESHOLD, 0, {0, 0, 0, 0, 0, 0, 0},
+                           values[i]};
+    record.key[0] = static_cast<int64_t>(tuning_hash(names[i].c_str()));
+    records.push_back(record);
+  }
+  return db->store(records);
+}
+
+// AXPY updates 1, 3, 5, 7 or 15 elements per work-item, switching at the
+// flat_max, step3_max, step5_max and step7_max thresholds. Every step is
+// timed on 2^14 to 2^23 elements, run by storing thresholds that send every
+// size to it, and a threshold becomes the largest size at which its step or
+// a smaller one was fastest.
+template <typename T, typename Axpy>
+bool tune_axpy(const Options &opt, hc::accelerator_view &av, TuningDb *db,
+               const std::string &prefix, Axpy axpy) {
+  const char *suffixes[] = {".flat_max", ".step3_max", ".step5_max",
+                            ".step7_max"};
+  std::vector<std::string> names;
+  for (int i = 0; i < 4; i++) names.push_back(prefix + suffixes[i]);
+  const int maxN = 1 << 23;
+  unsigned int seed = 100;
+  std::vector<T> X(maxN);
+  fill(X, &seed);
+  hc::accelerator acc = av.get_accelerator();
+  T *devX = hc::am_alloc(sizeof(T) * maxN, acc, 0);
+  T *devY = hc::am_alloc(sizeof(T) * maxN, acc, 0);
+  av.copy(X.data(), devX, sizeof(T) * maxN);
+  av.copy(X.data(), devY, sizeof(T) * maxN);
+  std::vector<int64_t> thresholds(4, 0);
+  bool ok = true;
+  for (int n = 1 << 14; n <= maxN && ok; n *= 2) {
+    int best = 0;
+    double bestMs = 0;
+    for (int step = 0; step < 5 && ok; step++) {
+      std::vector<int64_t> force(4);
+      for (int i = 0; i < 4; i++) {
+        force[i] = i < step ? -1 : std::numeric_limits<int64_t>::max();
+      }
+      ok = store_thresholds(db, names, force);
+      double ms = time_variant(opt, [&]() { axpy(n, devX, devY); },
+                               [&]() { av.wait(); });
+      std::cerr << "  " << prefix << " n " << n << " step " << step << " "
+                << ms << " ms" << std::endl;
+      if (step == 0 || ms < bestMs) {
+        best = step;
+        bestMs = ms;
+      }
+    }
+    for (int i = best; i < 4; i++) thresholds[i] = n;
+  }
+  // A larger step never wins below the threshold of a smaller one
+  for (int i = 1; i < 4; i++) {
+    thresholds[i] = std::max(thresholds[i], thresholds[i - 1]);
+  }
+  hc::am_free(devX);
+  hc::am_free(devY);
+  return ok && store_thresholds(db, names, thresholds);
+}
+
+// Transposed GEMV splits the length of X over work-groups once it exceeds
+// the length of Y by more than split_min. Both ways are timed on 64 columns
+// of 2^7 to 2^17 more rows, and split_min becomes half the first row
+// surplus at which the split was faster, or the largest one tried.
+template <typename T, typename Gemv>
+bool tune_gemv(const Options &opt, hc::accelerator_view &av, TuningDb *db,
+               const std::string &name, Gemv gemv) {
+  const std::vector<std::string> names(1, name);
+  const int N = 64, maxM = N + (1 << 17);
+  unsigned int seed = 100;
+  std::vector<T> A(static_cast<size_t>(maxM) * N), X(maxM);
+  fill(A, &seed);
+  fill(X, &seed);
+  hc::accelerator acc = av.get_accelerator();
+  T *devA = hc::am_alloc(sizeof(T) * A.size(), acc, 0);
+  T *devX = hc::am_alloc(sizeof(T) * maxM, acc, 0);
+  T *devY = hc::am_alloc(sizeof(T) * N, acc, 0);
+  av.copy(A.data(), devA, sizeof(T) * A.size());
+  av.copy(X.data(), devX, sizeof(T) * maxM);
+  av.copy(X.data(), devY, sizeof(T) * N);
+  int64_t splitMin = 1 << 17;
+  bool ok = true;
+  for (int d = 1 << 7; d <= 1 << 17 && ok; d *= 2) {
+    const int M = N + d;
+    double ms[2];
+    for (int split = 0; split < 2 && ok; split++) {
+      ok = store_thresholds(
+          db, names, std::vector<int64_t>(
+                         1, split ? -1 : std::numeric_limits<int64_t>::max()));
+      ms[split] = time_variant(opt, [&]() { gemv(M, N, devA, devX, devY); },
+                               [&]() { av.wait(); });
+      std::cerr << "  " << name << " surplus " << d << (split ? " split " : " ")
+                << ms[split] << " ms" << std::endl;
+    }
+    if (ms[1] < ms[0]) {
+      splitMin = d / 2;
+      break;
+    }
+  }
+  hc::am_free(devA);
+  hc::am_free(devX);
+  hc::am_free(devY);
+  return ok && store_thresholds(db, names, std::vector<int64_t>(1, splitMin));
+}
+
+// --thresholds for the precision of opt
+int tune_thresholds(const Options &opt, hc::accelerator_view &av) {
+  Hcblaslibrary hc(&av);
+  if (hc.tuningDb == NULL) {
+    std::cerr << "hcblas-tune: --thresholds needs HCBLAS_TUNING_DB set to a "
+              << "usable directory" << std::endl;
+    return -1;
+  }
+  bool ok;
+  if (opt.precision == 's') {
+    ok = tune_axpy<float>(opt, av, hc.tuningDb, "saxpy",
+                          [&](int n, float *X, float *Y) {
+                            hc.hcblas_saxpy(av, n, 0.5f, X, 1, Y, 1, 0, 0);
+                          }) &&
+         tune_gemv<float>(opt, av, hc.tuningDb, "sgemv.split_min",
+                          [&](int M, int N, float *A, float *X, float *Y) {
+                            hc.hcblas_sgemv(av, ColMajor, Trans, M, N, 1.0f, A,
+                                            0, M, X, 0, 1, 0.0f, Y, 0, 1);
+                          });
+  } else {
+    ok = tune_axpy<double>(opt, av, hc.tuningDb, "daxpy",
+                           [&](int n, double *X, double *Y) {
+                             hc.hcblas_daxpy(av, n, 0.5, X, 1, Y, 1, 0, 0);
+                           }) &&
+         tune_gemv<double>(opt, av, hc.tuningDb, "dgemv.split_min",
+                           [&](int M, int N, double *A, double *X, double *Y) {
+                             hc.hcblas_dgemv(av, ColMajor, Trans, M, N, 1.0, A,
+                                             0, M, X, 0, 1, 0.0, Y, 0, 1);
+                           });
+  }
+  if (!ok) {
+    std::cerr << "hcblas-tune: cannot write " << hc.tuningDb->path()
+              << std::endl;
+    return -1;
+  }
+  std::cerr << "thresholds stored in " << hc.tuningDb->path() << std::endl;
+  return 0;
+}
+
+int usage() {
+  std::cerr << "Usage: hcblas-tune [--cpu] [--precision s|d] [--order C|R] "
+            << "[--repeat N] [--min-time ms] [--exact] [-o table.txt] "
+            << "dims.txt..." << std::endl;
+  std::cerr << "       hcblas-tune --thresholds [--precision s|d] "
+            << "[--repeat N] [--min-time ms]" << std::endl;
+  return -1;
+}
+
+int main(int argc, char *argv[]) {
+  Options opt;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--cpu") {
+      opt.cpu = true;
+    } else if (arg == "--exact") {
+      opt.exact = true;
+    } else if (arg == "--thresholds") {
+      opt.thresholds = true;
+    } else if (arg == "--precision" && hasValue) {
+      opt.precision = argv[++i][0];
+    } else if (arg == "--order" && hasValue) {
+      opt.order = argv[++i][0];
+    } else if (arg == "--repeat" && hasValue) {
+      opt.repeat = std::max(1, atoi(argv[++i]));
+    } else if (arg == "--min-time" && hasValue) {
+      opt.minTimeMs = std::max(0.0, atof(argv[++i]));
+    } else if (arg == "-o" && hasValue) {
+      opt.output = argv[++i];
+    } else if (!arg.empty() && arg[0] == '-') {
+      return usage();
+    } else {
+      opt.files.push_back(arg);
+    }
+  }
+  if (opt.files.empty() != opt.thresholds ||
+      (opt.precision != 's' && opt.precision != 'd') ||
+      (opt.order != 'C' && opt.order != 'R')) {
+    return usage();
+  }
+
+  std::vector<hc::accelerator> accs = hc::accelerator::get_all();
+  hc::accelerator acc;
+  if (opt.cpu || accs.size() < 2) {
+    acc = hc::accelerator(L"cpu");
+    opt.cpu = true;
+  }
+  hc::accelerator_view av = acc.get_default_view();
+  if (opt.thresholds) {
+    if (opt.cpu) {
+      std::cerr << "hcblas-tune: the thresholds are those of the GPU paths"
+                << std::endl;
+      return -1;
+    }
+    return tune_thresholds(opt, av);
+  }
+  if (!opt.cpu && opt.order != 'C') {
+    std::cerr << "hcblas-tune: the GPU table covers column major GEMM only; "
+              << "use --cpu for other cases" << std::endl;
+    return -1;
+  }
+
+  std::vector<Shape> shapes;
+  for (size_t f = 0; f < opt.files.size(); f++) {
+    if (!read_shapes(opt.files[f], opt, &shapes)) return -1;
+  }
+
+  std::vector<Measured> results;
+  for (size_t i = 0; i < shapes.size(); i++) {
+    const Shape &s = shapes[i];
+    std::cerr << s.M << " " << s.N << " " << s.K << " " << s.transA << " "
+              << s.transB << std::endl;
+    Measured m;
+    m.shape = s;
+    const char transA = s.transA ? 't' : 'n';
+    const char transB = s.transB ? 't' : 'n';
+    int count = 0;
+    if (!opt.cpu && opt.precision == 's') {
+      const SgemmKernelEntry *kernels =
+          sgemm_kernel_registry(transA, transB, &count);
+      m.ms = tune_device<float>(opt, av, s, kernels, count);
+    } else if (!opt.cpu) {
+      const DgemmKernelEntry *kernels =
+          dgemm_kernel_registry(transA, transB, &count);
+      m.ms = tune_device<double>(opt, av, s, kernels, count);
+    } else if (opt.precision == 's') {
+      m.ms = tune_host<float>(opt, s);
+    } else {
+      m.ms = tune_host<double>(opt, s);
+    }
+    for (std::map<std::string, double>::const_iterator it = m.ms.begin();
+         it != m.ms.end(); ++it) {
+      std::cerr << "  " << it->first << " " << it->second << " ms"
+                << std::endl;
+    }
+    results.push_back(m);
+  }
+
+  if (opt.output.empty()) {
+    write_table(opt, results, std::cout);
+  } else {
+    std::ofstream out(opt.output.c_str());
+    write_table(opt, results, out);
+    if (!out) {
+      std::cerr << "hcblas-tune: cannot write " << opt.output << std::endl;
+      return -1;
+    }
+  }
+  return 0;
+}
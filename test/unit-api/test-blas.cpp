@@ -95,8 +95,8 @@ TEST(hcblaswrapper_sasumBatched, func_return_correct_sasumBatched) {
   int n = 23;
   int incx = 1;
   __int64_t lenx = 1 + (n - 1) * abs(incx);
-  float result;
   int batchSize = 128;
+  float *result = (float *)calloc(batchSize, sizeof(float));
 
   // HCBLAS_STATUS_SUCCESS and FUNCTIONALITY CHECK
   float *X = (float *)calloc(lenx * batchSize, sizeof(float));  // host input
@@ -108,24 +108,23 @@ TEST(hcblaswrapper_sasumBatched, func_return_correct_sasumBatched) {
   status = hcblasSetVector(handle, lenx * batchSize, sizeof(float), X, incx,
                            devX, incx);
   EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
-  status = hcblasSasumBatched(handle, n, devX, incx, &result, batchSize);
+  status = hcblasSasumBatched(handle, n, devX, incx, result, batchSize);
   EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
 
-  float asumcblas = 0.0;
   float *asumcblastemp = (float *)calloc(batchSize, sizeof(float));
   for (int i = 0; i < batchSize; i++) {
     asumcblastemp[i] = cblas_sasum(n, X + i * n, incx);
-    asumcblas += asumcblastemp[i];
+    EXPECT_EQ(result[i], asumcblastemp[i]);
   }
-  EXPECT_EQ(result, asumcblas);
 
   handle->currentAcclView.wait();
   // HCBLAS_STATUS_NOT_INITIALIZED
   hcblasDestroy(&handle);
-  status = hcblasSasumBatched(handle, n, devX, incx, &result, batchSize);
+  status = hcblasSasumBatched(handle, n, devX, incx, result, batchSize);
   EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
 
   free(X);
+  free(result);
   hc::am_free(devX);
 }
 
@@ -176,8 +175,8 @@ TEST(hcblaswrapper_dasumBatched, func_return_correct_dasumBatched) {
   int n = 23;
   int incx = 1;
   __int64_t lenx = 1 + (n - 1) * abs(incx);
-  double result;
   int batchSize = 128;
+  double *result = (double *)calloc(batchSize, sizeof(double));
 
   // HCBLAS_STATUS_SUCCESS and FUNCTIONALITY CHECK
   double *X = (double *)calloc(lenx * batchSize, sizeof(double));  // host input
@@ -189,24 +188,23 @@ TEST(hcblaswrapper_dasumBatched, func_return_correct_dasumBatched) {
   status = hcblasSetVector(handle, lenx * batchSize, sizeof(double), X, incx,
                            devX, incx);
   EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
-  status = hcblasDasumBatched(handle, n, devX, incx, &result, batchSize);
+  status = hcblasDasumBatched(handle, n, devX, incx, result, batchSize);
   EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
 
-  double asumcblas = 0.0;
   double *asumcblastemp = (double *)calloc(batchSize, sizeof(double));
   for (int i = 0; i < batchSize; i++) {
     asumcblastemp[i] = cblas_dasum(n, X + i * n, incx);
-    asumcblas += asumcblastemp[i];
+    EXPECT_EQ(result[i], asumcblastemp[i]);
   }
-  EXPECT_EQ(result, asumcblas);
 
   handle->currentAcclView.wait();
   // HCBLAS_STATUS_NOT_INITIALIZED
   hcblasDestroy(&handle);
-  status = hcblasDasumBatched(handle, n, devX, incx, &result, batchSize);
+  status = hcblasDasumBatched(handle, n, devX, incx, result, batchSize);
   EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
 
   free(X);
+  free(result);
   hc::am_free(devX);
 }
 
@@ -1122,8 +1120,8 @@ TEST(hcblaswrapper_sdotBatched, func_return_correct_sdotBatched) {
   int incy = 1;
   __int64_t lenx = 1 + (n - 1) * abs(incx);
   __int64_t leny = 1 + (n - 1) * abs(incy);
-  float result;
   int batchSize = 32;
+  float *result = (float *)calloc(batchSize, sizeof(float));
 
   // HCBLAS_STATUS_SUCCESS and FUNCTIONALITY CHECK
   float *X = (float *)calloc(lenx * batchSize, sizeof(float));  // host input
@@ -1146,22 +1144,22 @@ TEST(hcblaswrapper_sdotBatched, func_return_correct_sdotBatched) {
                            devY, incy);
   EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
   status =
-      hcblasSdotBatched(handle, n, devX, incx, devY, incy, &result, batchSize);
-  float dotcblas = 0.0;
+      hcblasSdotBatched(handle, n, devX, incx, devY, incy, result, batchSize);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
   for (int i = 0; i < batchSize; i++) {
     dotcblastemp[i] = cblas_sdot(n, X + i * n, incx, Y + i * n, incy);
-    dotcblas += dotcblastemp[i];
+    EXPECT_EQ(result[i], dotcblastemp[i]);
   }
-  EXPECT_EQ(result, dotcblas);
 
   handle->currentAcclView.wait();
   // HCBLAS_STATUS_NOT_INITIALIZED
   hcblasDestroy(&handle);
   status =
-      hcblasSdotBatched(handle, n, devX, incx, devY, incy, &result, batchSize);
+      hcblasSdotBatched(handle, n, devX, incx, devY, incy, result, batchSize);
   EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
 
   free(X);
+  free(result);
   hc::am_free(devX);
   free(Y);
   hc::am_free(devY);
@@ -1225,8 +1223,8 @@ TEST(hcblaswrapper_ddotBatched, func_return_correct_ddotBatched) {
   int incy = 1;
   __int64_t lenx = 1 + (n - 1) * abs(incx);
   __int64_t leny = 1 + (n - 1) * abs(incy);
-  double result;
   int batchSize = 32;
+  double *result = (double *)calloc(batchSize, sizeof(double));
 
   // HCBLAS_STATUS_SUCCESS and FUNCTIONALITY CHECK
   double *X = (double *)calloc(lenx * batchSize, sizeof(double));  // host input
@@ -1249,22 +1247,22 @@ TEST(hcblaswrapper_ddotBatched, func_return_correct_ddotBatched) {
                            devY, incy);
   EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
   status =
-      hcblasDdotBatched(handle, n, devX, incx, devY, incy, &result, batchSize);
-  double dotcblas = 0.0;
+      hcblasDdotBatched(handle, n, devX, incx, devY, incy, result, batchSize);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
   for (int i = 0; i < batchSize; i++) {
     dotcblastemp[i] = cblas_ddot(n, X + i * n, incx, Y + i * n, incy);
-    dotcblas += dotcblastemp[i];
+    EXPECT_EQ(result[i], dotcblastemp[i]);
   }
-  EXPECT_EQ(result, dotcblas);
 
   handle->currentAcclView.wait();
   // HCBLAS_STATUS_NOT_INITIALIZED
   hcblasDestroy(&handle);
   status =
-      hcblasDdotBatched(handle, n, devX, incx, devY, incy, &result, batchSize);
+      hcblasDdotBatched(handle, n, devX, incx, devY, incy, result, batchSize);
   EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
 
   free(X);
+  free(result);
   hc::am_free(devX);
   free(Y);
   hc::am_free(devY);
@@ -1919,6 +1917,26 @@ TEST(hcblaswrapper_sgemm, func_return_correct_sgemm) {
     EXPECT_EQ(C_hcblas[i], C_cblas[i]);
   }
 
+  // Device pointer mode: alpha and beta are read from device memory
+  const float scalars[2] = {alpha, beta};
+  float *devScalars = hc::am_alloc(sizeof(scalars), handle->currentAccl, 0);
+  handle->currentAcclView.copy(scalars, devScalars, sizeof(scalars));
+  status = hcblasSetPointerMode(handle, HCBLAS_POINTER_MODE_DEVICE);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSgemm(handle, typeA, typeB, M, N, K, devScalars, devA, lda,
+                       devB, ldb, devScalars + 1, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasGetMatrix(handle, M, N, sizeof(float), devC, 1, C_hcblas, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  cblas_sgemm(order, Transa, Transb, M, N, K, alpha, A, lda, B, ldb, beta,
+              C_cblas, ldc);
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(C_hcblas[i], C_cblas[i]);
+  }
+  status = hcblasSetPointerMode(handle, HCBLAS_POINTER_MODE_HOST);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  hc::am_free(devScalars);
+
   handle->currentAcclView.wait();
   // HCBLAS_STATUS_NOT_INITIALIZED
   hcblasDestroy(&handle);
@@ -2820,3 +2838,388 @@ TEST(hcblaswrapper_zgemmBatched, func_return_correct_zgemmBatched) {
   hc::am_free(d_Carray);
 }
 #endif
+
+TEST(hcblaswrapper_strsm, func_return_correct_strsm) {
+  hcblasStatus_t status;
+  hcblasHandle_t handle = NULL;
+  hc::accelerator default_acc;
+  hc::accelerator_view av = default_acc.get_default_view();
+  status = hcblasCreate(&handle, &av);
+  int M = 130;
+  int N = 40;
+  float alpha = 2;
+  int lda = M, ldb = M;
+  float *A = (float *)calloc(M * M, sizeof(float));
+  float *B = (float *)calloc(M * N, sizeof(float));
+  float *B_hcblas = (float *)calloc(M * N, sizeof(float));
+  float *devA = hc::am_alloc(sizeof(float) * M * M, handle->currentAccl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * M * N, handle->currentAccl, 0);
+  // Dominant diagonal keeps the solve well conditioned
+  for (int i = 0; i < M * M; i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < M; i++) {
+    A[i + i * lda] += 10 * M;
+  }
+  for (int i = 0; i < M * N; i++) {
+    B[i] = rand_r(&global_seed) % 25;
+  }
+  status = hcblasSetMatrix(handle, M, M, sizeof(float), A, 1, devA, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, M, N, sizeof(float), B, 1, devB, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  status = hcblasStrsm(handle, HCBLAS_SIDE_LEFT, HCBLAS_FILL_MODE_LOWER,
+                       HCBLAS_OP_N, HCBLAS_DIAG_NON_UNIT, M, N, &alpha, devA,
+                       lda, devB, ldb);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasGetMatrix(handle, M, N, sizeof(float), devB, 1, B_hcblas, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  cblas_strsm(CblasColMajor, CblasLeft, CblasLower, CblasNoTrans,
+              CblasNonUnit, M, N, alpha, A, lda, B, ldb);
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_NEAR(B_hcblas[i], B[i], 1e-4);
+  }
+
+  status = hcblasStrsm(handle, HCBLAS_SIDE_LEFT, HCBLAS_FILL_MODE_LOWER,
+                       HCBLAS_OP_N, HCBLAS_DIAG_NON_UNIT, -1, N, &alpha, devA,
+                       lda, devB, ldb);
+  EXPECT_EQ(status, HCBLAS_STATUS_INVALID_VALUE);
+
+  handle->currentAcclView.wait();
+  // HCBLAS_STATUS_NOT_INITIALIZED
+  hcblasDestroy(&handle);
+  status = hcblasStrsm(handle, HCBLAS_SIDE_LEFT, HCBLAS_FILL_MODE_LOWER,
+                       HCBLAS_OP_N, HCBLAS_DIAG_NON_UNIT, M, N, &alpha, devA,
+                       lda, devB, ldb);
+  EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
+
+  free(A);
+  free(B);
+  free(B_hcblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+}
+
+TEST(hcblaswrapper_ssyrk, func_return_correct_ssyrk) {
+  hcblasStatus_t status;
+  hcblasHandle_t handle = NULL;
+  hc::accelerator default_acc;
+  hc::accelerator_view av = default_acc.get_default_view();
+  status = hcblasCreate(&handle, &av);
+  int N = 140;
+  int K = 60;
+  float alpha = 1;
+  float beta = 2;
+  int lda = N, ldc = N;
+  float *A = (float *)calloc(N * K, sizeof(float));
+  float *C = (float *)calloc(N * N, sizeof(float));
+  float *C_hcblas = (float *)calloc(N * N, sizeof(float));
+  float *devA = hc::am_alloc(sizeof(float) * N * K, handle->currentAccl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * N * N, handle->currentAccl, 0);
+  for (int i = 0; i < N * K; i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < N * N; i++) {
+    C[i] = rand_r(&global_seed) % 25;
+  }
+  status = hcblasSetMatrix(handle, N, K, sizeof(float), A, 1, devA, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, N, N, sizeof(float), C, 1, devC, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  status = hcblasSsyrk(handle, HCBLAS_FILL_MODE_LOWER, HCBLAS_OP_N, N, K,
+                       &alpha, devA, lda, &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasGetMatrix(handle, N, N, sizeof(float), devC, 1, C_hcblas, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  // The upper triangle is left as it was
+  cblas_ssyrk(CblasColMajor, CblasLower, CblasNoTrans, N, K, alpha, A, lda,
+              beta, C, ldc);
+  for (int i = 0; i < N * N; i++) {
+    EXPECT_EQ(C_hcblas[i], C[i]);
+  }
+
+  status = hcblasSsyrk(handle, HCBLAS_FILL_MODE_LOWER, HCBLAS_OP_N, -1, K,
+                       &alpha, devA, lda, &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_INVALID_VALUE);
+
+  handle->currentAcclView.wait();
+  // HCBLAS_STATUS_NOT_INITIALIZED
+  hcblasDestroy(&handle);
+  status = hcblasSsyrk(handle, HCBLAS_FILL_MODE_LOWER, HCBLAS_OP_N, N, K,
+                       &alpha, devA, lda, &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
+
+  free(A);
+  free(C);
+  free(C_hcblas);
+  hc::am_free(devA);
+  hc::am_free(devC);
+}
+
+TEST(hcblaswrapper_ssyr2k, func_return_correct_ssyr2k) {
+  hcblasStatus_t status;
+  hcblasHandle_t handle = NULL;
+  hc::accelerator default_acc;
+  hc::accelerator_view av = default_acc.get_default_view();
+  status = hcblasCreate(&handle, &av);
+  int N = 140;
+  int K = 60;
+  float alpha = 1;
+  float beta = 2;
+  int lda = N, ldb = N, ldc = N;
+  float *A = (float *)calloc(N * K, sizeof(float));
+  float *B = (float *)calloc(N * K, sizeof(float));
+  float *C = (float *)calloc(N * N, sizeof(float));
+  float *C_hcblas = (float *)calloc(N * N, sizeof(float));
+  float *devA = hc::am_alloc(sizeof(float) * N * K, handle->currentAccl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * N * K, handle->currentAccl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * N * N, handle->currentAccl, 0);
+  for (int i = 0; i < N * K; i++) {
+    A[i] = rand_r(&global_seed) % 10;
+    B[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < N * N; i++) {
+    C[i] = rand_r(&global_seed) % 25;
+  }
+  status = hcblasSetMatrix(handle, N, K, sizeof(float), A, 1, devA, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, N, K, sizeof(float), B, 1, devB, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, N, N, sizeof(float), C, 1, devC, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  status = hcblasSsyr2k(handle, HCBLAS_FILL_MODE_UPPER, HCBLAS_OP_N, N, K,
+                        &alpha, devA, lda, devB, ldb, &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasGetMatrix(handle, N, N, sizeof(float), devC, 1, C_hcblas, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  // The lower triangle is left as it was
+  cblas_ssyr2k(CblasColMajor, CblasUpper, CblasNoTrans, N, K, alpha, A, lda, B,
+               ldb, beta, C, ldc);
+  for (int i = 0; i < N * N; i++) {
+    EXPECT_EQ(C_hcblas[i], C[i]);
+  }
+
+  status = hcblasSsyr2k(handle, HCBLAS_FILL_MODE_UPPER, HCBLAS_OP_N, -1, K,
+                        &alpha, devA, lda, devB, ldb, &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_INVALID_VALUE);
+
+  handle->currentAcclView.wait();
+  // HCBLAS_STATUS_NOT_INITIALIZED
+  hcblasDestroy(&handle);
+  status = hcblasSsyr2k(handle, HCBLAS_FILL_MODE_UPPER, HCBLAS_OP_N, N, K,
+                        &alpha, devA, lda, devB, ldb, &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
+
+  free(A);
+  free(B);
+  free(C);
+  free(C_hcblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblaswrapper_ssymm, func_return_correct_ssymm) {
+  hcblasStatus_t status;
+  hcblasHandle_t handle = NULL;
+  hc::accelerator default_acc;
+  hc::accelerator_view av = default_acc.get_default_view();
+  status = hcblasCreate(&handle, &av);
+  int M = 120;
+  int N = 80;
+  float alpha = 1;
+  float beta = 2;
+  int lda = M, ldb = M, ldc = M;
+  float *A = (float *)calloc(M * M, sizeof(float));
+  float *B = (float *)calloc(M * N, sizeof(float));
+  float *C = (float *)calloc(M * N, sizeof(float));
+  float *C_hcblas = (float *)calloc(M * N, sizeof(float));
+  float *devA = hc::am_alloc(sizeof(float) * M * M, handle->currentAccl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * M * N, handle->currentAccl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * M * N, handle->currentAccl, 0);
+  for (int i = 0; i < M * M; i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < M * N; i++) {
+    B[i] = rand_r(&global_seed) % 10;
+    C[i] = rand_r(&global_seed) % 25;
+  }
+  status = hcblasSetMatrix(handle, M, M, sizeof(float), A, 1, devA, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, M, N, sizeof(float), B, 1, devB, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, M, N, sizeof(float), C, 1, devC, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  status = hcblasSsymm(handle, HCBLAS_SIDE_LEFT, HCBLAS_FILL_MODE_LOWER, M, N,
+                       &alpha, devA, lda, devB, ldb, &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasGetMatrix(handle, M, N, sizeof(float), devC, 1, C_hcblas, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  // Only the lower triangle of A is read
+  cblas_ssymm(CblasColMajor, CblasLeft, CblasLower, M, N, alpha, A, lda, B,
+              ldb, beta, C, ldc);
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(C_hcblas[i], C[i]);
+  }
+
+  status = hcblasSsymm(handle, HCBLAS_SIDE_LEFT, HCBLAS_FILL_MODE_LOWER, -1, N,
+                       &alpha, devA, lda, devB, ldb, &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_INVALID_VALUE);
+
+  handle->currentAcclView.wait();
+  // HCBLAS_STATUS_NOT_INITIALIZED
+  hcblasDestroy(&handle);
+  status = hcblasSsymm(handle, HCBLAS_SIDE_LEFT, HCBLAS_FILL_MODE_LOWER, M, N,
+                       &alpha, devA, lda, devB, ldb, &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
+
+  free(A);
+  free(B);
+  free(C);
+  free(C_hcblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblaswrapper_strmm, func_return_correct_strmm) {
+  hcblasStatus_t status;
+  hcblasHandle_t handle = NULL;
+  hc::accelerator default_acc;
+  hc::accelerator_view av = default_acc.get_default_view();
+  status = hcblasCreate(&handle, &av);
+  int M = 40;
+  int N = 130;
+  float alpha = 2;
+  int lda = N, ldb = M;
+  float *A = (float *)calloc(N * N, sizeof(float));
+  float *B = (float *)calloc(M * N, sizeof(float));
+  float *B_hcblas = (float *)calloc(M * N, sizeof(float));
+  float *devA = hc::am_alloc(sizeof(float) * N * N, handle->currentAccl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * M * N, handle->currentAccl, 0);
+  for (int i = 0; i < N * N; i++) {
+    A[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < M * N; i++) {
+    B[i] = rand_r(&global_seed) % 25;
+  }
+  status = hcblasSetMatrix(handle, N, N, sizeof(float), A, 1, devA, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, M, N, sizeof(float), B, 1, devB, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  // B is overwritten in place with B * A^T
+  status = hcblasStrmm(handle, HCBLAS_SIDE_RIGHT, HCBLAS_FILL_MODE_UPPER,
+                       HCBLAS_OP_T, HCBLAS_DIAG_NON_UNIT, M, N, &alpha, devA,
+                       lda, devB, ldb);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasGetMatrix(handle, M, N, sizeof(float), devB, 1, B_hcblas, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  cblas_strmm(CblasColMajor, CblasRight, CblasUpper, CblasTrans, CblasNonUnit,
+              M, N, alpha, A, lda, B, ldb);
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(B_hcblas[i], B[i]);
+  }
+
+  status = hcblasStrmm(handle, HCBLAS_SIDE_RIGHT, HCBLAS_FILL_MODE_UPPER,
+                       HCBLAS_OP_T, HCBLAS_DIAG_NON_UNIT, M, -1, &alpha, devA,
+                       lda, devB, ldb);
+  EXPECT_EQ(status, HCBLAS_STATUS_INVALID_VALUE);
+
+  handle->currentAcclView.wait();
+  // HCBLAS_STATUS_NOT_INITIALIZED
+  hcblasDestroy(&handle);
+  status = hcblasStrmm(handle, HCBLAS_SIDE_RIGHT, HCBLAS_FILL_MODE_UPPER,
+                       HCBLAS_OP_T, HCBLAS_DIAG_NON_UNIT, M, N, &alpha, devA,
+                       lda, devB, ldb);
+  EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
+
+  free(A);
+  free(B);
+  free(B_hcblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+}
+
+TEST(hcblaswrapper_sgemmt, func_return_correct_sgemmt) {
+  hcblasStatus_t status;
+  hcblasHandle_t handle = NULL;
+  hc::accelerator default_acc;
+  hc::accelerator_view av = default_acc.get_default_view();
+  status = hcblasCreate(&handle, &av);
+  int N = 140;
+  int K = 60;
+  float alpha = 1;
+  float beta = 2;
+  int lda = N, ldb = N, ldc = N;
+  float *A = (float *)calloc(N * K, sizeof(float));
+  float *B = (float *)calloc(N * K, sizeof(float));
+  float *C = (float *)calloc(N * N, sizeof(float));
+  float *C_full = (float *)calloc(N * N, sizeof(float));
+  float *C_hcblas = (float *)calloc(N * N, sizeof(float));
+  float *devA = hc::am_alloc(sizeof(float) * N * K, handle->currentAccl, 0);
+  float *devB = hc::am_alloc(sizeof(float) * N * K, handle->currentAccl, 0);
+  float *devC = hc::am_alloc(sizeof(float) * N * N, handle->currentAccl, 0);
+  for (int i = 0; i < N * K; i++) {
+    A[i] = rand_r(&global_seed) % 10;
+    B[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < N * N; i++) {
+    C[i] = rand_r(&global_seed) % 25;
+    C_full[i] = C[i];
+  }
+  status = hcblasSetMatrix(handle, N, K, sizeof(float), A, 1, devA, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, N, K, sizeof(float), B, 1, devB, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasSetMatrix(handle, N, N, sizeof(float), C, 1, devC, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  status = hcblasSgemmt(handle, HCBLAS_FILL_MODE_UPPER, HCBLAS_OP_N,
+                        HCBLAS_OP_T, N, K, &alpha, devA, lda, devB, ldb, &beta,
+                        devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+  status = hcblasGetMatrix(handle, N, N, sizeof(float), devC, 1, C_hcblas, 1);
+  EXPECT_EQ(status, HCBLAS_STATUS_SUCCESS);
+
+  // The upper triangle of the full product; the lower one is left as it was
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasTrans, N, N, K, alpha, A, lda,
+              B, ldb, beta, C_full, ldc);
+  for (int j = 0; j < N; j++) {
+    for (int i = 0; i < N; i++) {
+      EXPECT_EQ(C_hcblas[i + j * ldc], i <= j ? C_full[i + j * ldc]
+                                              : C[i + j * ldc]);
+    }
+  }
+
+  status = hcblasSgemmt(handle, HCBLAS_FILL_MODE_UPPER, HCBLAS_OP_N,
+                        HCBLAS_OP_T, N, -1, &alpha, devA, lda, devB, ldb,
+                        &beta, devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_INVALID_VALUE);
+
+  handle->currentAcclView.wait();
+  // HCBLAS_STATUS_NOT_INITIALIZED
+  hcblasDestroy(&handle);
+  status = hcblasSgemmt(handle, HCBLAS_FILL_MODE_UPPER, HCBLAS_OP_N,
+                        HCBLAS_OP_T, N, K, &alpha, devA, lda, devB, ldb, &beta,
+                        devC, ldc);
+  EXPECT_EQ(status, HCBLAS_STATUS_NOT_INITIALIZED);
+
+  free(A);
+  free(B);
+  free(C);
+  free(C_full);
+  free(C_hcblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
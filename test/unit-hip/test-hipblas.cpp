@@ -92,8 +92,8 @@ TEST(hipblaswrapper_sasumBatched, func_return_correct_sasumBatched) {
   int n = 23;
   int incx = 1;
   __int64_t lenx = 1 + (n - 1) * abs(incx);
-  float result;
   int batchSize = 128;
+  float *result = (float *)calloc(batchSize, sizeof(float));
 
   // HIPBLAS_STATUS_SUCCESS and FUNCTIONALITY __HIP_PLATFORM_HCC__
   float *X = (float *)calloc(lenx * batchSize, sizeof(float));  // host input
@@ -105,23 +105,22 @@ TEST(hipblaswrapper_sasumBatched, func_return_correct_sasumBatched) {
   status =
       hipblasSetVector(lenx * batchSize, sizeof(float), X, incx, devX, incx);
   EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
-  status = hipblasSasumBatched(handle, n, devX, incx, &result, batchSize);
+  status = hipblasSasumBatched(handle, n, devX, incx, result, batchSize);
   EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
 
-  float asumcblas = 0.0;
   float *asumcblastemp = (float *)calloc(batchSize, sizeof(float));
   for (int i = 0; i < batchSize; i++) {
     asumcblastemp[i] = cblas_sasum(n, X + i * n, incx);
-    asumcblas += asumcblastemp[i];
+    EXPECT_EQ(result[i], asumcblastemp[i]);
   }
-  EXPECT_EQ(result, asumcblas);
 
   // HIPBLAS_STATUS_NOT_INITIALIZED
   hipblasDestroy(handle);
-  status = hipblasSasumBatched(handle, n, devX, incx, &result, batchSize);
+  status = hipblasSasumBatched(handle, n, devX, incx, result, batchSize);
   EXPECT_EQ(status, HIPBLAS_STATUS_NOT_INITIALIZED);
 
   free(X);
+  free(result);
   hipFree(devX);
 }
 #endif
@@ -170,8 +169,8 @@ TEST(hipblaswrapper_dasumBatched, func_return_correct_dasumBatched) {
   int n = 23;
   int incx = 1;
   __int64_t lenx = 1 + (n - 1) * abs(incx);
-  double result;
   int batchSize = 128;
+  double *result = (double *)calloc(batchSize, sizeof(double));
 
   // HIPBLAS_STATUS_SUCCESS and FUNCTIONALITY __HIP_PLATFORM_HCC__
   double *X = (double *)calloc(lenx * batchSize, sizeof(double));  // host input
@@ -183,23 +182,22 @@ TEST(hipblaswrapper_dasumBatched, func_return_correct_dasumBatched) {
   status =
       hipblasSetVector(lenx * batchSize, sizeof(double), X, incx, devX, incx);
   EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
-  status = hipblasDasumBatched(handle, n, devX, incx, &result, batchSize);
+  status = hipblasDasumBatched(handle, n, devX, incx, result, batchSize);
   EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
 
-  double asumcblas = 0.0;
   double *asumcblastemp = (double *)calloc(batchSize, sizeof(double));
   for (int i = 0; i < batchSize; i++) {
     asumcblastemp[i] = cblas_dasum(n, X + i * n, incx);
-    asumcblas += asumcblastemp[i];
+    EXPECT_EQ(result[i], asumcblastemp[i]);
   }
-  EXPECT_EQ(result, asumcblas);
 
   // HIPBLAS_STATUS_NOT_INITIALIZED
   hipblasDestroy(handle);
-  status = hipblasDasumBatched(handle, n, devX, incx, &result, batchSize);
+  status = hipblasDasumBatched(handle, n, devX, incx, result, batchSize);
   EXPECT_EQ(status, HIPBLAS_STATUS_NOT_INITIALIZED);
 
   free(X);
+  free(result);
   hipFree(devX);
 }
 #endif
@@ -1093,8 +1091,8 @@ TEST(hipblaswrapper_sdotBatched, func_return_correct_sdotBatched) {
   int incy = 1;
   __int64_t lenx = 1 + (n - 1) * abs(incx);
   __int64_t leny = 1 + (n - 1) * abs(incy);
-  float result;
   int batchSize = 32;
+  float *result = (float *)calloc(batchSize, sizeof(float));
 
   // HIPBLAS_STATUS_SUCCESS and FUNCTIONALITY __HIP_PLATFORM_HCC__
   float *X = (float *)calloc(lenx * batchSize, sizeof(float));  // host input
@@ -1116,21 +1114,21 @@ TEST(hipblaswrapper_sdotBatched, func_return_correct_sdotBatched) {
       hipblasSetVector(leny * batchSize, sizeof(float), Y, incy, devY, incy);
   EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
   status =
-      hipblasSdotBatched(handle, n, devX, incx, devY, incy, &result, batchSize);
-  float dotcblas = 0.0;
+      hipblasSdotBatched(handle, n, devX, incx, devY, incy, result, batchSize);
+  EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
   for (int i = 0; i < batchSize; i++) {
     dotcblastemp[i] = cblas_sdot(n, X + i * n, incx, Y + i * n, incy);
-    dotcblas += dotcblastemp[i];
+    EXPECT_EQ(result[i], dotcblastemp[i]);
   }
-  EXPECT_EQ(result, dotcblas);
 
   // HIPBLAS_STATUS_NOT_INITIALIZED
   hipblasDestroy(handle);
   status =
-      hipblasSdotBatched(handle, n, devX, incx, devY, incy, &result, batchSize);
+      hipblasSdotBatched(handle, n, devX, incx, devY, incy, result, batchSize);
   EXPECT_EQ(status, HIPBLAS_STATUS_NOT_INITIALIZED);
 
   free(X);
+  free(result);
   hipFree(devX);
   free(Y);
   hipFree(devY);
@@ -1192,8 +1190,8 @@ TEST(hipblaswrapper_ddotBatched, func_return_correct_ddotBatched) {
   int incy = 1;
   __int64_t lenx = 1 + (n - 1) * abs(incx);
   __int64_t leny = 1 + (n - 1) * abs(incy);
-  double result;
   int batchSize = 32;
+  double *result = (double *)calloc(batchSize, sizeof(double));
 
   // HIPBLAS_STATUS_SUCCESS and FUNCTIONALITY __HIP_PLATFORM_HCC__
   double *X = (double *)calloc(lenx * batchSize, sizeof(double));  // host input
@@ -1215,21 +1213,21 @@ TEST(hipblaswrapper_ddotBatched, func_return_correct_ddotBatched) {
       hipblasSetVector(leny * batchSize, sizeof(double), Y, incy, devY, incy);
   EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
   status =
-      hipblasDdotBatched(handle, n, devX, incx, devY, incy, &result, batchSize);
-  double dotcblas = 0.0;
+      hipblasDdotBatched(handle, n, devX, incx, devY, incy, result, batchSize);
+  EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
   for (int i = 0; i < batchSize; i++) {
     dotcblastemp[i] = cblas_ddot(n, X + i * n, incx, Y + i * n, incy);
-    dotcblas += dotcblastemp[i];
+    EXPECT_EQ(result[i], dotcblastemp[i]);
   }
-  EXPECT_EQ(result, dotcblas);
 
   // HIPBLAS_STATUS_NOT_INITIALIZED
   hipblasDestroy(handle);
   status =
-      hipblasDdotBatched(handle, n, devX, incx, devY, incy, &result, batchSize);
+      hipblasDdotBatched(handle, n, devX, incx, devY, incy, result, batchSize);
   EXPECT_EQ(status, HIPBLAS_STATUS_NOT_INITIALIZED);
 
   free(X);
+  free(result);
   hipFree(devX);
   free(Y);
   hipFree(devY);
@@ -1217,3 +1217,132 @@ TEST(hcblas_cgemm, func_correct_cgemm_Implementation_type_2) {
   hc::am_free(d_Barray);
   hc::am_free(d_Carray);
 }
+
+// Host execution: interleaved complex panels on the CPU accelerator. Integer
+// inputs keep both results exact.
+void func_check_cgemm_host(hcblasOrder order, hcblasTranspose typeA,
+                           hcblasTranspose typeB, int M, int N, int K) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  EXPECT_TRUE(hc.hostExecution);
+  __int64_t lda = (order == ColMajor) == (typeA == NoTrans) ? M : K;
+  __int64_t ldb = (order == ColMajor) == (typeB == NoTrans) ? K : N;
+  __int64_t ldc = (order == ColMajor) ? M : N;
+  hc::short_vector::float_2 cAlpha, cBeta;
+  cAlpha.x = 2;
+  cAlpha.y = -1;
+  cBeta.x = 1;
+  cBeta.y = 3;
+  float alpha[2] = {cAlpha.x, cAlpha.y};
+  float beta[2] = {cBeta.x, cBeta.y};
+  hc::short_vector::float_2 *A = (hc::short_vector::float_2 *)calloc(
+      M * K, sizeof(hc::short_vector::float_2));
+  hc::short_vector::float_2 *B = (hc::short_vector::float_2 *)calloc(
+      K * N, sizeof(hc::short_vector::float_2));
+  hc::short_vector::float_2 *C = (hc::short_vector::float_2 *)calloc(
+      M * N, sizeof(hc::short_vector::float_2));
+  float *ablas = (float *)malloc(sizeof(float) * M * K * 2);
+  float *bblas = (float *)malloc(sizeof(float) * K * N * 2);
+  float *cblas = (float *)malloc(sizeof(float) * M * N * 2);
+  for (int i = 0; i < M * K; i++) {
+    ablas[2 * i] = A[i].x = rand_r(&global_seed) % 10;
+    ablas[2 * i + 1] = A[i].y = rand_r(&global_seed) % 20;
+  }
+  for (int i = 0; i < K * N; i++) {
+    bblas[2 * i] = B[i].x = rand_r(&global_seed) % 15;
+    bblas[2 * i + 1] = B[i].y = rand_r(&global_seed) % 25;
+  }
+  for (int i = 0; i < M * N; i++) {
+    cblas[2 * i] = C[i].x = rand_r(&global_seed) % 18;
+    cblas[2 * i + 1] = C[i].y = rand_r(&global_seed) % 28;
+  }
+
+  hcblasStatus status = hc.hcblas_cgemm(hc.currentAcclView, order, typeA,
+                                        typeB, M, N, K, cAlpha, A, 0, lda, B,
+                                        0, ldb, cBeta, C, 0, ldc);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  cblas_cgemm(order == ColMajor ? CblasColMajor : CblasRowMajor,
+              typeA == NoTrans ? CblasNoTrans : CblasTrans,
+              typeB == NoTrans ? CblasNoTrans : CblasTrans, M, N, K, &alpha,
+              ablas, lda, bblas, ldb, &beta, cblas, ldc);
+  for (int i = 0; i < M * N; i++) {
+    EXPECT_EQ(C[i].x, cblas[2 * i]);
+    EXPECT_EQ(C[i].y, cblas[2 * i + 1]);
+  }
+
+  free(A);
+  free(B);
+  free(C);
+  free(ablas);
+  free(bblas);
+  free(cblas);
+}
+
+TEST(hcblas_cgemm, func_correct_cgemm_host) {
+  hcblasTranspose trans[] = {NoTrans, Trans};
+  int shapes[][3] = {{1, 1, 1}, {189, 9, 19}, {67, 130, 300}, {5, 400, 33}};
+  for (int s = 0; s < 4; s++) {
+    for (int a = 0; a < 2; a++) {
+      for (int b = 0; b < 2; b++) {
+        int M = shapes[s][0], N = shapes[s][1], K = shapes[s][2];
+        func_check_cgemm_host(ColMajor, trans[a], trans[b], M, N, K);
+        func_check_cgemm_host(RowMajor, trans[a], trans[b], M, N, K);
+      }
+    }
+  }
+}
+
+TEST(hcblas_cgemm, func_correct_cgemm_host_batched) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 67, N = 33, K = 41, batchSize = 8;
+  __int64_t lda = M, ldb = N, ldc = M;
+  hc::short_vector::float_2 cAlpha, cBeta;
+  cAlpha.x = 1;
+  cAlpha.y = 1;
+  cBeta.x = 0;
+  cBeta.y = 0;
+  float alpha[2] = {cAlpha.x, cAlpha.y};
+  float beta[2] = {cBeta.x, cBeta.y};
+  hc::short_vector::float_2 *A[batchSize];
+  hc::short_vector::float_2 *B[batchSize];
+  hc::short_vector::float_2 *C[batchSize];
+  for (int b = 0; b < batchSize; b++) {
+    A[b] = (hc::short_vector::float_2 *)malloc(
+        sizeof(hc::short_vector::float_2) * M * K);
+    B[b] = (hc::short_vector::float_2 *)malloc(
+        sizeof(hc::short_vector::float_2) * K * N);
+    C[b] = (hc::short_vector::float_2 *)calloc(
+        M * N, sizeof(hc::short_vector::float_2));
+    for (int i = 0; i < M * K; i++) {
+      A[b][i].x = rand_r(&global_seed) % 10;
+      A[b][i].y = rand_r(&global_seed) % 20;
+    }
+    for (int i = 0; i < K * N; i++) {
+      B[b][i].x = rand_r(&global_seed) % 15;
+      B[b][i].y = rand_r(&global_seed) % 25;
+    }
+  }
+
+  // NoTransA TransB, column major
+  hcblasStatus status = hc.hcblas_cgemm(
+      hc.currentAcclView, ColMajor, NoTrans, Trans, M, N, K, cAlpha, A, 0, 0,
+      lda, B, 0, 0, ldb, cBeta, C, 0, 0, ldc, batchSize);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  float *cblas = (float *)calloc(M * N * 2, sizeof(float));
+  for (int b = 0; b < batchSize; b++) {
+    cblas_cgemm(CblasColMajor, CblasNoTrans, CblasTrans, M, N, K, &alpha,
+                reinterpret_cast<float *>(A[b]), lda,
+                reinterpret_cast<float *>(B[b]), ldb, &beta, cblas, ldc);
+    for (int i = 0; i < M * N; i++) {
+      EXPECT_EQ(C[b][i].x, cblas[2 * i]);
+      EXPECT_EQ(C[b][i].y, cblas[2 * i + 1]);
+    }
+    free(A[b]);
+    free(B[b]);
+    free(C[b]);
+  }
+  free(cblas);
+}
@@ -23,9 +23,12 @@ THE SOFTWARE.
 #include "include/hcblas.h"
 #include "include/hcblaslib.h"
 #include "gtest/gtest.h"
+#include "src/blas/dgemm/dgemm_array_kernels.h"
+#include "src/blas/scratch/scratch_pool.h"
 #include <cblas.h>
 #include <cstdlib>
 #include <hc_am.hpp>
+#include <vector>
 
 unsigned int global_seed = 100;
 
@@ -1163,3 +1166,206 @@ TEST(hcblas_dgemm, func_correct_dgemm_Implementation_type_2) {
     hc::am_free(devCbatch);*/
 }
 
+
+// Host execution: a handle bound to the CPU accelerator runs the blocked host
+// engine directly on host pointers. Integer inputs keep the results exact.
+void func_check_dgemm_host(hcblasOrder order, hcblasTranspose typeA,
+                           hcblasTranspose typeB, int M, int N, int K,
+                           double alpha, double beta) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  EXPECT_TRUE(hc.hostExecution);
+  __int64_t aRows = (order == ColMajor) == (typeA == NoTrans) ? M : K;
+  __int64_t aCols = (aRows == M) ? K : M;
+  __int64_t bRows = (order == ColMajor) == (typeB == NoTrans) ? K : N;
+  __int64_t bCols = (bRows == K) ? N : K;
+  __int64_t cRows = (order == ColMajor) ? M : N;
+  __int64_t cCols = (order == ColMajor) ? N : M;
+  __int64_t lda = aRows + 1, ldb = bRows + 2, ldc = cRows + 3;
+  double* A = (double*)calloc(lda * aCols, sizeof(double));
+  double* B = (double*)calloc(ldb * bCols, sizeof(double));
+  double* C = (double*)calloc(ldc * cCols, sizeof(double));
+  double* C_cblas = (double*)calloc(ldc * cCols, sizeof(double));
+
+  for (int i = 0; i < lda * aCols; i++) {
+    A[i] = rand_r(&global_seed) % 100;
+  }
+  for (int i = 0; i < ldb * bCols; i++) {
+    B[i] = rand_r(&global_seed) % 15;
+  }
+  for (int i = 0; i < ldc * cCols; i++) {
+    C[i] = C_cblas[i] = rand_r(&global_seed) % 25;
+  }
+
+  hcblasStatus status =
+      hc.hcblas_dgemm(hc.currentAcclView, order, typeA, typeB, M, N, K, alpha,
+                      A, lda, B, ldb, beta, C, ldc, 0, 0, 0);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  cblas_dgemm(order == ColMajor ? CblasColMajor : CblasRowMajor,
+              typeA == NoTrans ? CblasNoTrans : CblasTrans,
+              typeB == NoTrans ? CblasNoTrans : CblasTrans, M, N, K, alpha, A,
+              lda, B, ldb, beta, C_cblas, ldc);
+  for (int i = 0; i < ldc * cCols; i++) EXPECT_EQ(C[i], C_cblas[i]);
+
+  free(A);
+  free(B);
+  free(C);
+  free(C_cblas);
+}
+
+TEST(hcblas_dgemm, func_correct_dgemm_host) {
+  hcblasTranspose trans[] = {NoTrans, Trans};
+  int shapes[][3] = {{1, 1, 1}, {189, 9, 19}, {257, 130, 515}, {7, 1000, 33}};
+  for (int s = 0; s < 4; s++) {
+    for (int a = 0; a < 2; a++) {
+      for (int b = 0; b < 2; b++) {
+        int M = shapes[s][0], N = shapes[s][1], K = shapes[s][2];
+        func_check_dgemm_host(ColMajor, trans[a], trans[b], M, N, K, 1, 1);
+        func_check_dgemm_host(RowMajor, trans[a], trans[b], M, N, K, 2, 0);
+        func_check_dgemm_host(ColMajor, trans[a], trans[b], M, N, K, 0, 3);
+      }
+    }
+  }
+}
+
+// Device column major DGEMM against cblas. Integer inputs keep the results
+// exact.
+void func_check_dgemm_device(hcblasTranspose typeA, hcblasTranspose typeB,
+                             int M, int N, int K) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  hc::accelerator acc = hc.currentAccl;
+  __int64_t lda = (typeA == NoTrans) ? M : K;
+  __int64_t ldb = (typeB == NoTrans) ? K : N;
+  __int64_t ldc = M;
+  std::vector<double> A(M * K), B(K * N), C(M * N), C_cblas(M * N);
+  for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 10;
+  for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 5;
+  for (size_t i = 0; i < C.size(); i++) C[i] = C_cblas[i] = i % 7;
+  double* devA = hc::am_alloc(sizeof(double) * A.size(), acc, 0);
+  double* devB = hc::am_alloc(sizeof(double) * B.size(), acc, 0);
+  double* devC = hc::am_alloc(sizeof(double) * C.size(), acc, 0);
+  av.copy(A.data(), devA, sizeof(double) * A.size());
+  av.copy(B.data(), devB, sizeof(double) * B.size());
+  av.copy(C.data(), devC, sizeof(double) * C.size());
+  EXPECT_EQ(hc.hcblas_dgemm(av, ColMajor, typeA, typeB, M, N, K, 2, devA, lda,
+                            devB, ldb, 1, devC, ldc, 0, 0, 0),
+            HCBLAS_SUCCEEDS);
+  av.copy(devC, C.data(), sizeof(double) * C.size());
+  cblas_dgemm(CblasColMajor, typeA == NoTrans ? CblasNoTrans : CblasTrans,
+              typeB == NoTrans ? CblasNoTrans : CblasTrans, M, N, K, 2,
+              A.data(), lda, B.data(), ldb, 1, C_cblas.data(), ldc);
+  EXPECT_TRUE(C == C_cblas);
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_dgemm, func_correct_dgemm_NT_TN_multiple_of_128) {
+  // Multiples of 128, which the table sends to the M064/M096 kernels
+  int shapes[][3] = {{256, 256, 256}, {4096, 128, 128}, {384, 512, 128}};
+  for (int s = 0; s < 3; s++) {
+    func_check_dgemm_device(NoTrans, Trans, shapes[s][0], shapes[s][1],
+                            shapes[s][2]);
+    func_check_dgemm_device(Trans, NoTrans, shapes[s][0], shapes[s][1],
+                            shapes[s][2]);
+  }
+}
+
+// Every registry entry against cblas, with leading dimensions with slack:
+// on a shape no tile divides for the general kernels and on one every
+// divisibility constraint admits for the rest. The last entry is general.
+TEST(hcblas_dgemm, dgemm_kernel_registry) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  ScratchPool scratch;
+  const char trans[] = {'n', 't'};
+  int shapes[][3] = {{131, 77, 45}, {384, 384, 256}};
+  for (int t = 0; t < 4; t++) {
+    bool transA = trans[t / 2] == 't', transB = trans[t % 2] == 't';
+    int count = 0;
+    const DgemmKernelEntry* kernels =
+        dgemm_kernel_registry(trans[t / 2], trans[t % 2], &count);
+    ASSERT_GE(count, 2);
+    EXPECT_TRUE(kernels[count - 1].info.admits(131, 77, 45));
+    std::vector<int> runs(count, 0);
+    for (int s = 0; s < 2; s++) {
+      int M = shapes[s][0], N = shapes[s][1], K = shapes[s][2];
+      __int64_t lda = (transA ? K : M) + 1;
+      __int64_t ldb = (transB ? N : K) + 2;
+      __int64_t ldc = M + 3;
+      std::vector<double> A(lda * (transA ? M : K));
+      std::vector<double> B(ldb * (transB ? K : N));
+      std::vector<double> C(ldc * N), C_cblas(ldc * N);
+      for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 10;
+      for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 5;
+      for (size_t i = 0; i < C.size(); i++) C_cblas[i] = i % 7;
+      cblas_dgemm(CblasColMajor, transA ? CblasTrans : CblasNoTrans,
+                  transB ? CblasTrans : CblasNoTrans, M, N, K, 2, A.data(),
+                  lda, B.data(), ldb, 1, C_cblas.data(), ldc);
+      double* devA = hc::am_alloc(sizeof(double) * A.size(), accl, 0);
+      double* devB = hc::am_alloc(sizeof(double) * B.size(), accl, 0);
+      double* devC = hc::am_alloc(sizeof(double) * C.size(), accl, 0);
+      av.copy(A.data(), devA, sizeof(double) * A.size());
+      av.copy(B.data(), devB, sizeof(double) * B.size());
+      for (int v = 0; v < count; v++) {
+        if (!kernels[v].info.admits(M, N, K)) continue;
+        runs[v]++;
+        for (size_t i = 0; i < C.size(); i++) C[i] = i % 7;
+        av.copy(C.data(), devC, sizeof(double) * C.size());
+        EXPECT_EQ(kernels[v].fn(av, &scratch, devA, 0, devB, 0, devC, 0, M,
+                                N, K, lda, ldb, ldc, 2, 1),
+                  HCBLAS_SUCCEEDS);
+        av.copy(devC, C.data(), sizeof(double) * C.size());
+        EXPECT_TRUE(C == C_cblas) << kernels[v].info.name << " " << t;
+      }
+      hc::am_free(devA);
+      hc::am_free(devB);
+      hc::am_free(devC);
+    }
+    for (int v = 0; v < count; v++) {
+      EXPECT_GT(runs[v], 0) << kernels[v].info.name << " " << t;
+    }
+  }
+}
+
+TEST(hcblas_dgemm, func_correct_dgemm_host_batched) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 189, N = 9, K = 19, batchSize = 32;
+  double alpha = 1, beta = 1;
+  __int64_t lda = K, ldb = K, ldc = M;
+  double* A[batchSize];
+  double* B[batchSize];
+  double* C[batchSize];
+  double* C_cblas[batchSize];
+  for (int b = 0; b < batchSize; b++) {
+    A[b] = (double*)malloc(sizeof(double) * M * K);
+    B[b] = (double*)malloc(sizeof(double) * K * N);
+    C[b] = (double*)malloc(sizeof(double) * M * N);
+    C_cblas[b] = (double*)malloc(sizeof(double) * M * N);
+    for (int i = 0; i < M * K; i++) A[b][i] = rand_r(&global_seed) % 100;
+    for (int i = 0; i < K * N; i++) B[b][i] = rand_r(&global_seed) % 15;
+    for (int i = 0; i < M * N; i++) {
+      C[b][i] = C_cblas[b][i] = rand_r(&global_seed) % 25;
+    }
+  }
+
+  // TransA NoTransB, column major
+  hcblasStatus status = hc.hcblas_dgemm(
+      hc.currentAcclView, ColMajor, Trans, NoTrans, M, N, K, alpha, A, lda, 0,
+      B, ldb, 0, beta, C, ldc, 0, 0, 0, 0, batchSize);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  for (int b = 0; b < batchSize; b++) {
+    cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, M, N, K, alpha, A[b],
+                lda, B[b], ldb, beta, C_cblas[b], ldc);
+    for (int i = 0; i < M * N; i++) EXPECT_EQ(C[b][i], C_cblas[b][i]);
+    free(A[b]);
+    free(B[b]);
+    free(C[b]);
+    free(C_cblas[b]);
+  }
+}
@@ -0,0 +1,245 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblaslib.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <hc_am.hpp>
+#include <hc_short_vector.hpp>
+#include <vector>
+
+unsigned int global_seed = 100;
+
+// The reference is the full GEMM on a copy of C: outside the uplo triangle
+// (and in the padding rows) C must keep its original values
+template <typename T>
+void keep_triangle(bool colMajor, bool lower, int N, int ldc,
+                   const std::vector<T> &C0, std::vector<T> *full) {
+  for (size_t i = 0; i < C0.size(); i++) {
+    const int r = colMajor ? i % ldc : i / ldc;
+    const int c = colMajor ? i / ldc : i % ldc;
+    if (r >= N || c >= N || (lower ? r < c : r > c)) (*full)[i] = C0[i];
+  }
+}
+
+// One triangle of a general product for every triangle and pair of ops in
+// both orders through hcblas_sgemmt or hcblas_dgemmt. N spans several
+// diagonal blocks so the off-diagonal GEMM split is exercised.
+template <typename T, typename Gemmt, typename Ref>
+void check_gemmt_real(Gemmt gemmt, Ref ref, double tol) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  int N = 200, K = 70;
+  hcblasOrder orders[] = {ColMajor, RowMajor};
+  hcblasUplo uplos[] = {Lower, Upper};
+  hcblasTranspose ops[] = {NoTrans, Trans};
+  for (int o = 0; o < 2; o++)
+    for (int u = 0; u < 2; u++)
+      for (int ta = 0; ta < 2; ta++)
+        for (int tb = 0; tb < 2; tb++) {
+          const bool colMajor = orders[o] == ColMajor;
+          // Rows of A and B as stored in the given order
+          const int rowsA = (ops[ta] == NoTrans) == colMajor ? N : K;
+          const int rowsB = (ops[tb] == NoTrans) == colMajor ? K : N;
+          const int lda = rowsA + 1;
+          const int ldb = rowsB + 3;
+          const int ldc = N + 2;
+          std::vector<T> A(lda * (rowsA == N ? K : N));
+          std::vector<T> B(ldb * (rowsB == K ? N : K));
+          std::vector<T> C(ldc * N), C_cblas;
+          for (size_t i = 0; i < A.size(); i++) {
+            A[i] = (rand_r(&global_seed) % 100) / 50.0 - 1;
+          }
+          for (size_t i = 0; i < B.size(); i++) {
+            B[i] = (rand_r(&global_seed) % 100) / 50.0 - 1;
+          }
+          for (size_t i = 0; i < C.size(); i++) {
+            C[i] = rand_r(&global_seed) % 10;
+          }
+          C_cblas = C;
+          T *devA = hc::am_alloc(sizeof(T) * A.size(), accl, 0);
+          T *devB = hc::am_alloc(sizeof(T) * B.size(), accl, 0);
+          T *devC = hc::am_alloc(sizeof(T) * C.size(), accl, 0);
+          av.copy(A.data(), devA, sizeof(T) * A.size());
+          av.copy(B.data(), devB, sizeof(T) * B.size());
+          av.copy(C.data(), devC, sizeof(T) * C.size());
+          EXPECT_EQ(gemmt(av, orders[o], uplos[u], ops[ta], ops[tb], N, K,
+                          devA, lda, devB, ldb, devC, ldc),
+                    HCBLAS_SUCCEEDS);
+          ref(colMajor ? CblasColMajor : CblasRowMajor,
+              ops[ta] == NoTrans ? CblasNoTrans : CblasTrans,
+              ops[tb] == NoTrans ? CblasNoTrans : CblasTrans, N, K, A.data(),
+              lda, B.data(), ldb, C_cblas.data(), ldc);
+          keep_triangle(colMajor, uplos[u] == Lower, N, ldc, C, &C_cblas);
+          av.copy(devC, C.data(), sizeof(T) * C.size());
+          for (size_t i = 0; i < C.size(); i++) {
+            EXPECT_NEAR(C[i], C_cblas[i], tol * (1 + std::fabs(C_cblas[i])));
+          }
+          hc::am_free(devA);
+          hc::am_free(devB);
+          hc::am_free(devC);
+        }
+}
+
+TEST(hcblas_gemmt, func_correct_sgemmt) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  check_gemmt_real<float>(
+      [&](hc::accelerator_view v, hcblasOrder order, hcblasUplo uplo,
+          hcblasTranspose opA, hcblasTranspose opB, int N, int K, float *A,
+          int lda, float *B, int ldb, float *C, int ldc) {
+        return hc.hcblas_sgemmt(v, order, uplo, opA, opB, N, K, 1.5f, A, 0,
+                                lda, B, 0, ldb, -0.5f, C, 0, ldc);
+      },
+      [](CBLAS_ORDER order, CBLAS_TRANSPOSE opA, CBLAS_TRANSPOSE opB, int N,
+         int K, const float *A, int lda, const float *B, int ldb, float *C,
+         int ldc) {
+        cblas_sgemm(order, opA, opB, N, N, K, 1.5f, A, lda, B, ldb, -0.5f, C,
+                    ldc);
+      },
+      1e-4);
+}
+
+TEST(hcblas_gemmt, func_correct_dgemmt) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  check_gemmt_real<double>(
+      [&](hc::accelerator_view v, hcblasOrder order, hcblasUplo uplo,
+          hcblasTranspose opA, hcblasTranspose opB, int N, int K, double *A,
+          int lda, double *B, int ldb, double *C, int ldc) {
+        return hc.hcblas_dgemmt(v, order, uplo, opA, opB, N, K, 1.5, A, 0, lda,
+                                B, 0, ldb, -0.5, C, 0, ldc);
+      },
+      [](CBLAS_ORDER order, CBLAS_TRANSPOSE opA, CBLAS_TRANSPOSE opB, int N,
+         int K, const double *A, int lda, const double *B, int ldb, double *C,
+         int ldc) {
+        cblas_dgemm(order, opA, opB, N, N, K, 1.5, A, lda, B, ldb, -0.5, C,
+                    ldc);
+      },
+      1e-10);
+}
+
+TEST(hcblas_gemmt, func_correct_zgemmt_conj_trans) {
+  // A^H reaches the GEMM paths as a transpose of a conjugated copy
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  typedef hc::short_vector::double_2 Z;
+  // K = 2000 takes two K panels of the copy
+  const int N = 150, Ks[] = {40, 2000};
+  const Z alpha(0.75, -0.5), beta(2.0, 1.0);
+  hcblasOrder orders[] = {ColMajor, RowMajor};
+  hcblasUplo uplos[] = {Lower, Upper};
+  for (int k = 0; k < 2; k++)
+    for (int o = 0; o < 2; o++)
+      for (int u = 0; u < 2; u++) {
+        const int K = Ks[k];
+        const bool colMajor = orders[o] == ColMajor;
+        // op(A) = A^H and op(B) = B, both stored K x N in column major
+        const int ld = colMajor ? K : N;
+        std::vector<Z> A(K * N), B(K * N), C(N * N);
+        for (size_t i = 0; i < A.size(); i++) {
+          A[i].x = (rand_r(&global_seed) % 100) / 50.0 - 1;
+          A[i].y = (rand_r(&global_seed) % 100) / 50.0 - 1;
+          B[i].x = (rand_r(&global_seed) % 100) / 50.0 - 1;
+          B[i].y = (rand_r(&global_seed) % 100) / 50.0 - 1;
+        }
+        for (size_t i = 0; i < C.size(); i++) {
+          C[i].x = rand_r(&global_seed) % 10;
+          C[i].y = rand_r(&global_seed) % 10;
+        }
+        std::vector<Z> C_cblas = C;
+        Z *devA = hc::am_alloc(sizeof(Z) * A.size(), accl, 0);
+        Z *devB = hc::am_alloc(sizeof(Z) * B.size(), accl, 0);
+        Z *devC = hc::am_alloc(sizeof(Z) * C.size(), accl, 0);
+        av.copy(A.data(), devA, sizeof(Z) * A.size());
+        av.copy(B.data(), devB, sizeof(Z) * B.size());
+        av.copy(C.data(), devC, sizeof(Z) * C.size());
+        EXPECT_EQ(hc.hcblas_zgemmt(av, orders[o], uplos[u], ConjTrans, NoTrans,
+                                   N, K, alpha, devA, 0, ld, devB, 0, ld, beta,
+                                   devC, 0, N),
+                  HCBLAS_SUCCEEDS);
+        cblas_zgemm(colMajor ? CblasColMajor : CblasRowMajor, CblasConjTrans,
+                    CblasNoTrans, N, N, K, &alpha, A.data(), ld, B.data(), ld,
+                    &beta, C_cblas.data(), N);
+        keep_triangle(colMajor, uplos[u] == Lower, N, N, C, &C_cblas);
+        av.copy(devC, C.data(), sizeof(Z) * C.size());
+        for (size_t i = 0; i < C.size(); i++) {
+          EXPECT_NEAR(C[i].x, C_cblas[i].x,
+                      1e-10 * (1 + std::fabs(C_cblas[i].x)));
+          EXPECT_NEAR(C[i].y, C_cblas[i].y,
+                      1e-10 * (1 + std::fabs(C_cblas[i].y)));
+        }
+        hc::am_free(devA);
+        hc::am_free(devB);
+        hc::am_free(devC);
+      }
+}
+
+TEST(hcblas_gemmt, func_correct_dgemmt_batched) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 96, K = 20, batchSize = 16;
+  std::vector<std::vector<double>> A(batchSize), B(batchSize), C(batchSize),
+      C_cblas;
+  double *devA[16], *devB[16], *devC[16];
+  for (int b = 0; b < batchSize; b++) {
+    A[b].resize(N * K);
+    B[b].resize(N * K);
+    C[b].resize(N * N);
+    for (int i = 0; i < N * K; i++) {
+      A[b][i] = (rand_r(&global_seed) % 100) / 50.0 - 1;
+      B[b][i] = (rand_r(&global_seed) % 100) / 50.0 - 1;
+    }
+    for (int i = 0; i < N * N; i++) C[b][i] = rand_r(&global_seed) % 10;
+    devA[b] = hc::am_alloc(sizeof(double) * N * K, accl, 0);
+    devB[b] = hc::am_alloc(sizeof(double) * N * K, accl, 0);
+    devC[b] = hc::am_alloc(sizeof(double) * N * N, accl, 0);
+    av.copy(A[b].data(), devA[b], sizeof(double) * N * K);
+    av.copy(B[b].data(), devB[b], sizeof(double) * N * K);
+    av.copy(C[b].data(), devC[b], sizeof(double) * N * N);
+  }
+  C_cblas = C;
+  // Covariance-style A * B^T, only the upper triangle kept
+  EXPECT_EQ(hc.hcblas_dgemmt(av, ColMajor, Upper, NoTrans, Trans, N, K, 0.5,
+                             devA, 0, 0, N, devB, 0, 0, N, 1.0, devC, 0, 0, N,
+                             batchSize),
+            HCBLAS_SUCCEEDS);
+  for (int b = 0; b < batchSize; b++) {
+    cblas_dgemm(CblasColMajor, CblasNoTrans, CblasTrans, N, N, K, 0.5,
+                A[b].data(), N, B[b].data(), N, 1.0, C_cblas[b].data(), N);
+    keep_triangle(true, false, N, N, C[b], &C_cblas[b]);
+    av.copy(devC[b], C[b].data(), sizeof(double) * N * N);
+    for (int i = 0; i < N * N; i++) {
+      EXPECT_NEAR(C[b][i], C_cblas[b][i],
+                  1e-10 * (1 + std::fabs(C_cblas[b][i])));
+    }
+    hc::am_free(devA[b]);
+    hc::am_free(devB[b]);
+    hc::am_free(devC[b]);
+  }
+}
@@ -25,9 +25,12 @@ THE SOFTWARE.
 #include "include/hcblaslib.h"
 #include "include/helper_functions.h"
 #include "gtest/gtest.h"
+#include "src/blas/hgemm/hgemm_array_kernels.h"
+#include "src/blas/scratch/scratch_pool.h"
 #include <cblas.h>
 #include <cstdlib>
 #include <hc_am.hpp>
+#include <vector>
 
 unsigned int global_seed = 100;
 
@@ -1478,4 +1481,146 @@ TEST(hcblas_hgemm,
   func_check_hgemmTT_Col_type_1(M, N, K, alpha, beta, 1.0e-5f);
 }
 
+// Host execution: FP32 accumulation with a single rounding of C. The
+// reference is cblas_sgemm on the widened operands, so results may only differ
+// by the rounding to half and float summation order.
+void func_check_hgemm_host(hcblasOrder order, hcblasTranspose typeA,
+                           hcblasTranspose typeB, int M, int N, int K,
+                           float alpha, float beta) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  __int64_t lda = (order == ColMajor) == (typeA == NoTrans) ? M : K;
+  __int64_t ldb = (order == ColMajor) == (typeB == NoTrans) ? K : N;
+  __int64_t ldc = (order == ColMajor) ? M : N;
+  half* A = (half*)calloc(M * K, sizeof(half));
+  half* B = (half*)calloc(K * N, sizeof(half));
+  half* C = (half*)calloc(M * N, sizeof(half));
+  float* A_float = (float*)calloc(M * K, sizeof(float));
+  float* B_float = (float*)calloc(K * N, sizeof(float));
+  float* C_float = (float*)calloc(M * N, sizeof(float));
+  float X = 2;
+  for (int i = 0; i < M * K; i++) {
+    A[i] = (half)(static_cast<float>(rand_r(&global_seed)) /
+                  (static_cast<float>(RAND_MAX / X)));
+    A_float[i] = static_cast<float>(A[i]);
+  }
+  for (int i = 0; i < K * N; i++) {
+    B[i] = (half)(static_cast<float>(rand_r(&global_seed)) /
+                  (static_cast<float>(RAND_MAX / X)));
+    B_float[i] = static_cast<float>(B[i]);
+  }
+  for (int i = 0; i < M * N; i++) {
+    C[i] = (half)(static_cast<float>(rand_r(&global_seed)) /
+                  (static_cast<float>(RAND_MAX / X)));
+    C_float[i] = static_cast<float>(C[i]);
+  }
+
+  hcblasStatus status = hc.hcblas_hgemm(
+      hc.currentAcclView, order, typeA, typeB, M, N, K, (half)alpha, A, lda, B,
+      ldb, (half)beta, C, ldc, 0, 0, 0);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  cblas_sgemm(order == ColMajor ? CblasColMajor : CblasRowMajor,
+              typeA == NoTrans ? CblasNoTrans : CblasTrans,
+              typeB == NoTrans ? CblasNoTrans : CblasTrans, M, N, K, alpha,
+              A_float, lda, B_float, ldb, beta, C_float, ldc);
+  for (int i = 0; i < M * N; i++) {
+    // Half a half-precision ulp plus float accumulation error
+    EXPECT_NEAR(static_cast<float>(C[i]), C_float[i],
+                fabsf(C_float[i]) * 4.9e-4f + 1.0e-3f);
+  }
+
+  free(A);
+  free(B);
+  free(C);
+  free(A_float);
+  free(B_float);
+  free(C_float);
+}
+
+TEST(hcblas_hgemm, func_correct_hgemm_host) {
+  hcblasTranspose trans[] = {NoTrans, Trans};
+  // The last shape spans several K blocks of the host engine
+  int shapes[][3] = {{189, 9, 19}, {64, 130, 257}, {33, 65, 2049}};
+  for (int s = 0; s < 3; s++) {
+    for (int a = 0; a < 2; a++) {
+      for (int b = 0; b < 2; b++) {
+        int M = shapes[s][0], N = shapes[s][1], K = shapes[s][2];
+        func_check_hgemm_host(ColMajor, trans[a], trans[b], M, N, K, 0.5f,
+                              1.0f);
+        func_check_hgemm_host(RowMajor, trans[a], trans[b], M, N, K, 0.25f,
+                              0.0f);
+      }
+    }
+  }
+}
+
+// Every registry entry against cblas on small integers, which half holds
+// exactly: on a shape no tile divides for the general kernels and on one
+// every divisibility constraint admits for the rest
+TEST(hcblas_hgemm, hgemm_kernel_registry) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  ScratchPool scratch;
+  const char trans[] = {'n', 't'};
+  int shapes[][3] = {{131, 77, 45}, {384, 384, 256}};
+  for (int t = 0; t < 4; t++) {
+    bool transA = trans[t / 2] == 't', transB = trans[t % 2] == 't';
+    int count = 0;
+    const HgemmKernelEntry* kernels =
+        hgemm_kernel_registry(trans[t / 2], trans[t % 2], &count);
+    ASSERT_GE(count, 2);
+    EXPECT_TRUE(kernels[count - 1].info.admits(131, 77, 45));
+    std::vector<int> runs(count, 0);
+    for (int s = 0; s < 2; s++) {
+      int M = shapes[s][0], N = shapes[s][1], K = shapes[s][2];
+      __int64_t lda = (transA ? K : M) + 1;
+      __int64_t ldb = (transB ? N : K) + 2;
+      __int64_t ldc = M + 3;
+      std::vector<float> A(lda * (transA ? M : K));
+      std::vector<float> B(ldb * (transB ? K : N));
+      std::vector<float> C_cblas(ldc * N);
+      for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 3;
+      for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 3;
+      for (size_t i = 0; i < C_cblas.size(); i++) C_cblas[i] = i % 7;
+      cblas_sgemm(CblasColMajor, transA ? CblasTrans : CblasNoTrans,
+                  transB ? CblasTrans : CblasNoTrans, M, N, K, 1, A.data(),
+                  lda, B.data(), ldb, 1, C_cblas.data(), ldc);
+      std::vector<half> A_half(A.begin(), A.end());
+      std::vector<half> B_half(B.begin(), B.end());
+      std::vector<half> C(ldc * N);
+      half* devA = hc::am_alloc(sizeof(half) * A.size(), accl, 0);
+      half* devB = hc::am_alloc(sizeof(half) * B.size(), accl, 0);
+      half* devC = hc::am_alloc(sizeof(half) * C.size(), accl, 0);
+      av.copy(A_half.data(), devA, sizeof(half) * A.size());
+      av.copy(B_half.data(), devB, sizeof(half) * B.size());
+      for (int v = 0; v < count; v++) {
+        if (!kernels[v].info.admits(M, N, K)) continue;
+        runs[v]++;
+        for (size_t i = 0; i < C.size(); i++) C[i] = i % 7;
+        av.copy(C.data(), devC, sizeof(half) * C.size());
+        EXPECT_EQ(kernels[v].fn(av, &scratch, devA, 0, devB, 0, devC, 0, M,
+                                N, K, lda, ldb, ldc, 1, 1),
+                  HCBLAS_SUCCEEDS);
+        av.copy(devC, C.data(), sizeof(half) * C.size());
+        int mismatches = 0;
+        for (int j = 0; j < N; j++) {
+          for (int i = 0; i < M; i++) {
+            if (static_cast<float>(C[j * ldc + i]) != C_cblas[j * ldc + i]) {
+              mismatches++;
+            }
+          }
+        }
+        EXPECT_EQ(mismatches, 0) << kernels[v].info.name << " " << t;
+      }
+      hc::am_free(devA);
+      hc::am_free(devB);
+      hc::am_free(devC);
+    }
+    for (int v = 0; v < count; v++) {
+      EXPECT_GT(runs[v], 0) << kernels[v].info.name << " " << t;
+    }
+  }
+}
+
 #endif
@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include <cblas.h>
 #include <cstdlib>
 #include <hc_am.hpp>
+#include <vector>
 
 unsigned int global_seed = 100;
 
@@ -182,3 +183,89 @@ TEST(hcblas_sasum, func_correct_sasum_Implementation_type_2) {
   hc::am_free(devXbatch);
 }
 
+// Host execution: CPU accelerator, host pointers, strided and long vectors.
+// Small integer data keeps every partial sum exact in single precision.
+
+void func_check_sasum_host(int N, int incX) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  __int64_t xOffset = 3;
+  __int64_t lenx = xOffset + 1 + (N - 1) * abs(incX);
+  float *X = (float *)calloc(lenx, sizeof(float));
+  for (int i = 0; i < lenx; i++) {
+    X[i] = (rand_r(&global_seed) % 7) - 3;
+  }
+  float asumhcblas;
+  hcblasStatus status =
+      hc.hcblas_sasum(hc.currentAcclView, N, X, incX, xOffset, &asumhcblas);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  EXPECT_EQ(asumhcblas, cblas_sasum(N, X + xOffset, incX));
+  free(X);
+}
+
+TEST(hcblas_sasum, func_correct_sasum_host) {
+  int sizes[] = {1, 7, 119, 4099, 1 << 20};
+  for (int s = 0; s < 5; s++) {
+    func_check_sasum_host(sizes[s], 1);
+    func_check_sasum_host(sizes[s], 3);
+  }
+}
+
+TEST(hcblas_sasum, func_correct_sasum_host_batched) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 119;
+  int incX = 1;
+  int batchSize = 128;
+  __int64_t X_batchOffset = N;
+  float *Xbatch = (float *)calloc(N * batchSize, sizeof(float));
+  for (int i = 0; i < N * batchSize; i++) {
+    Xbatch[i] = rand_r(&global_seed) % 10;
+  }
+  float asumhcblas;
+  float asumcblas = 0.0;
+  hcblasStatus status = hc.hcblas_sasum(hc.currentAcclView, N, Xbatch, incX, 0,
+                                        &asumhcblas, X_batchOffset, batchSize);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  for (int i = 0; i < batchSize; i++) {
+    asumcblas += cblas_sasum(N, Xbatch + i * N, incX);
+  }
+  EXPECT_EQ(asumhcblas, asumcblas);
+  free(Xbatch);
+}
+
+TEST(hcblas_sasum, func_correct_sasumBatched_strided) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  if (hc.hostExecution) return;
+  int N = 700;
+  int incX = 3;
+  int batchSize = 4;
+  // hcblasSasumBatched packs the vectors back to back: n * incx apart
+  __int64_t lenx = static_cast<__int64_t>(N) * incX * batchSize;
+  std::vector<float> X(lenx);
+  for (__int64_t i = 0; i < lenx; i++) {
+    X[i] = (rand_r(&global_seed) % 7) - 3;
+  }
+  float *devX = hc::am_alloc(sizeof(float) * lenx, hc.currentAccl, 0);
+  av.copy(X.data(), devX, lenx * sizeof(float));
+  std::vector<float> sums(batchSize, 0.0f);
+  EXPECT_EQ(hcblasSasumBatched(&hc, N, devX, incX, sums.data(), batchSize),
+            HCBLAS_STATUS_SUCCESS);
+  float total = 0;
+  for (int i = 0; i < batchSize; i++) {
+    EXPECT_EQ(sums[i], cblas_sasum(N, X.data() + i * N * incX, incX));
+    total += sums[i];
+  }
+
+  // The single-output batch overload reports the sum of those results
+  float asumhcblas = 0;
+  EXPECT_EQ(hc.hcblas_sasum(av, N, devX, incX, 0, &asumhcblas, N * incX,
+                            batchSize),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(asumhcblas, total);
+  hc::am_free(devX);
+}
@@ -253,3 +253,59 @@ TEST(hcblas_scopy, func_correct_scopy_Implementation_type_2) {
   hc::am_free(devXbatch);
   hc::am_free(devYbatch);
 }
+
+// Host execution: CPU accelerator, host pointers, strided and long vectors.
+// Small integer data keeps every partial sum exact in single precision.
+
+void func_check_scopy_host(int N, int incX, int incY) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  __int64_t xOffset = 2, yOffset = 1;
+  __int64_t lenx = xOffset + 1 + (N - 1) * abs(incX);
+  __int64_t leny = yOffset + 1 + (N - 1) * abs(incY);
+  float *X = (float *)calloc(lenx, sizeof(float));
+  float *Y = (float *)calloc(leny, sizeof(float));
+  float *Ycblas = (float *)calloc(leny, sizeof(float));
+  for (int i = 0; i < lenx; i++) {
+    X[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < leny; i++) {
+    Y[i] = Ycblas[i] = rand_r(&global_seed) % 15;
+  }
+  hcblasStatus status = hc.hcblas_scopy(hc.currentAcclView, N, X, incX,
+                                        xOffset, Y, incY, yOffset);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  cblas_scopy(N, X + xOffset, incX, Ycblas + yOffset, incY);
+  for (int i = 0; i < leny; i++) EXPECT_EQ(Y[i], Ycblas[i]);
+  free(X);
+  free(Y);
+  free(Ycblas);
+}
+
+TEST(hcblas_scopy, func_correct_scopy_host) {
+  int sizes[] = {1, 7, 279, 4099, 1 << 20};
+  for (int s = 0; s < 5; s++) {
+    func_check_scopy_host(sizes[s], 1, 1);
+    func_check_scopy_host(sizes[s], 2, 3);
+  }
+}
+
+TEST(hcblas_scopy, func_correct_scopy_host_batched) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 279;
+  int batchSize = 64;
+  float *X = (float *)calloc(N * batchSize, sizeof(float));
+  float *Y = (float *)calloc(N * batchSize, sizeof(float));
+  for (int i = 0; i < N * batchSize; i++) {
+    X[i] = rand_r(&global_seed) % 10;
+  }
+  hcblasStatus status = hc.hcblas_scopy(hc.currentAcclView, N, X, 1, 0, Y, 1,
+                                        0, N, N, batchSize);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  for (int i = 0; i < N * batchSize; i++) EXPECT_EQ(Y[i], X[i]);
+  free(X);
+  free(Y);
+}
@@ -23,10 +23,13 @@ THE SOFTWARE.
 #include "include/hcblas.h"
 #include "./test_constants.h"
 #include "include/hcblaslib.h"
+#include "src/blas/scratch/scratch_pool.h"
 #include "gtest/gtest.h"
 #include <cblas.h>
 #include <cstdlib>
 #include <hc_am.hpp>
+#include <thread>
+#include <vector>
 
 unsigned int global_seed = 100;
 
@@ -338,3 +341,436 @@ TEST(hcblas_sdot, func_correct_sdot_batch_vvsmallN_Implementation_type_2) {
   func_check_sdot_batch_with_input(input);
 }
 
+// Host execution: CPU accelerator, host pointers, strided and long vectors.
+// Small integer data keeps every partial sum exact in single precision.
+
+void func_check_sdot_host(int N, int incX, int incY) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  __int64_t xOffset = 1, yOffset = 5;
+  __int64_t lenx = xOffset + 1 + (N - 1) * abs(incX);
+  __int64_t leny = yOffset + 1 + (N - 1) * abs(incY);
+  float *X = (float *)calloc(lenx, sizeof(float));
+  float *Y = (float *)calloc(leny, sizeof(float));
+  for (int i = 0; i < lenx; i++) {
+    X[i] = (rand_r(&global_seed) % 7) - 3;
+  }
+  for (int i = 0; i < leny; i++) {
+    Y[i] = rand_r(&global_seed) % 3;
+  }
+  float dothcblas;
+  hcblasStatus status = hc.hcblas_sdot(hc.currentAcclView, N, X, incX, xOffset,
+                                       Y, incY, yOffset, dothcblas);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  EXPECT_EQ(dothcblas, cblas_sdot(N, X + xOffset, incX, Y + yOffset, incY));
+  free(X);
+  free(Y);
+}
+
+TEST(hcblas_sdot, func_correct_sdot_host) {
+  int sizes[] = {1, 7, 119, 4099, 1 << 20};
+  for (int s = 0; s < 5; s++) {
+    func_check_sdot_host(sizes[s], 1, 1);
+    func_check_sdot_host(sizes[s], 2, 3);
+  }
+}
+
+TEST(hcblas_sdot, func_correct_sdot_host_batched) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 1000;
+  int batchSize = 32;
+  float *X = (float *)calloc(N * batchSize, sizeof(float));
+  float *Y = (float *)calloc(N * batchSize, sizeof(float));
+  for (int i = 0; i < N * batchSize; i++) {
+    X[i] = rand_r(&global_seed) % 10;
+    Y[i] = rand_r(&global_seed) % 5;
+  }
+  float dothcblas;
+  float dotcblas = 0.0;
+  hcblasStatus status = hc.hcblas_sdot(hc.currentAcclView, N, X, 1, 0, Y, 1, 0,
+                                       dothcblas, N, N, batchSize);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  for (int i = 0; i < batchSize; i++) {
+    dotcblas += cblas_sdot(N, X + i * N, 1, Y + i * N, 1);
+  }
+  EXPECT_EQ(dothcblas, dotcblas);
+  free(X);
+  free(Y);
+}
+
+// Device vectors with strides, up to and past the work-group cap of the
+// single-launch reduction
+void func_check_sdot_strided(int N, int incX, int incY) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  __int64_t xOffset = 1, yOffset = 5;
+  __int64_t lenx = xOffset + 1 + (N - 1) * abs(incX);
+  __int64_t leny = yOffset + 1 + (N - 1) * abs(incY);
+  std::vector<float> X(lenx), Y(leny);
+  for (__int64_t i = 0; i < lenx; i++) {
+    X[i] = (rand_r(&global_seed) % 7) - 3;
+  }
+  for (__int64_t i = 0; i < leny; i++) {
+    Y[i] = rand_r(&global_seed) % 3;
+  }
+  float *devX = hc::am_alloc(sizeof(float) * lenx, hc.currentAccl, 0);
+  float *devY = hc::am_alloc(sizeof(float) * leny, hc.currentAccl, 0);
+  av.copy(X.data(), devX, lenx * sizeof(float));
+  av.copy(Y.data(), devY, leny * sizeof(float));
+  float dothcblas = 0;
+  EXPECT_EQ(hc.hcblas_sdot(av, N, devX, incX, xOffset, devY, incY, yOffset,
+                           dothcblas),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(dothcblas, cblas_sdot(N, X.data() + xOffset, incX,
+                                  Y.data() + yOffset, incY));
+  hc::am_free(devX);
+  hc::am_free(devY);
+}
+
+TEST(hcblas_sdot, func_correct_sdot_strided) {
+  int sizes[] = {1, 255, 257, 1024 * 256 + 1, 1 << 20};
+  for (int s = 0; s < 5; s++) {
+    func_check_sdot_strided(sizes[s], 1, 1);
+    func_check_sdot_strided(sizes[s], 2, 3);
+  }
+}
+
+TEST(hcblas_sdot, scratch_pool_reuse) {
+  EXPECT_EQ(ScratchPool::sizeClass(1), SCRATCH_MIN_CLASS);
+  EXPECT_EQ(ScratchPool::sizeClass(256), 8);
+  EXPECT_EQ(ScratchPool::sizeClass(257), 9);
+  ScratchPool pool;
+  {
+    ScratchHost<float> a(&pool, 100);
+    ScratchHost<float> b(&pool, 1000);
+    a.data()[99] = 1.0f;
+    b.data()[999] = 1.0f;
+    // 400 and 4000 bytes round up to 512 and 4096
+    EXPECT_EQ(pool.highWater(false), 512u + 4096u);
+  }
+  // A second round of the same size classes allocates nothing
+  const size_t reserved = pool.reserved(false);
+  {
+    ScratchHost<float> a(&pool, 120);
+    ScratchHost<float> b(&pool, 900);
+  }
+  EXPECT_EQ(pool.reserved(false), reserved);
+  EXPECT_EQ(pool.highWater(false), 512u + 4096u);
+
+  // Leases taken concurrently never share a buffer
+  std::vector<std::thread> workers;
+  std::vector<int> clashes(8, 0);
+  for (int t = 0; t < 8; t++) {
+    workers.push_back(std::thread([&pool, &clashes, t] {
+      for (int i = 0; i < 200; i++) {
+        ScratchHost<int> lease(&pool, 64 << (i % 4));
+        for (int k = 0; k < 64; k++) lease.data()[k] = t;
+        std::this_thread::yield();
+        for (int k = 0; k < 64; k++) clashes[t] += lease.data()[k] != t;
+      }
+    }));
+  }
+  for (size_t t = 0; t < workers.size(); t++) workers[t].join();
+  for (int t = 0; t < 8; t++) EXPECT_EQ(clashes[t], 0);
+  EXPECT_LE(pool.highWater(false), 8u * 2048u);
+  EXPECT_EQ(pool.highWater(true), 0u);
+}
+
+TEST(hcblas_sdot, func_correct_sdot_scratch_reuse) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  if (hc.hostExecution) return;
+  __int64_t N = 100000;
+  std::vector<float> X(N), Y(N);
+  for (__int64_t i = 0; i < N; i++) {
+    X[i] = rand_r(&global_seed) % 10;
+    Y[i] = rand_r(&global_seed) % 15;
+  }
+  float *devX = hc::am_alloc(sizeof(float) * N, hc.currentAccl, 0);
+  float *devY = hc::am_alloc(sizeof(float) * N, hc.currentAccl, 0);
+  av.copy(X.data(), devX, N * sizeof(float));
+  av.copy(Y.data(), devY, N * sizeof(float));
+  const float dotcblas = cblas_sdot(N, X.data(), 1, Y.data(), 1);
+  float dothcblas = 0;
+  EXPECT_EQ(hc.hcblas_sdot(av, N, devX, 1, 0, devY, 1, 0, dothcblas),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(dothcblas, dotcblas);
+  // 391 work-group partials and the sum: 1568 bytes of device scratch, one
+  // 2 KB class; the reduction ends on the device so no host scratch
+  size_t deviceBytes = 0, hostBytes = 0;
+  EXPECT_EQ(hcblasGetScratchHighWater(&hc, &deviceBytes, &hostBytes),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(deviceBytes, 2048u);
+  EXPECT_EQ(hostBytes, 0u);
+
+  // Later calls, also from several threads at once, reuse the pool
+  std::vector<std::thread> callers;
+  std::vector<float> dots(4, 0.0f);
+  for (int t = 0; t < 4; t++) {
+    callers.push_back(std::thread([&, t] {
+      for (int i = 0; i < 5; i++) {
+        hc.hcblas_sdot(av, N - t, devX, 1, 0, devY, 1, 0, dots[t]);
+      }
+    }));
+  }
+  for (size_t t = 0; t < callers.size(); t++) callers[t].join();
+  for (int t = 0; t < 4; t++) {
+    EXPECT_EQ(dots[t], cblas_sdot(N - t, X.data(), 1, Y.data(), 1));
+  }
+  EXPECT_LE(hc.scratch->reserved(true), 4u * 2048u);
+  EXPECT_LE(hc.scratch->highWater(false), 4u * 2048u);
+  hc::am_free(devX);
+  hc::am_free(devY);
+}
+
+TEST(hcblas_sdot, func_correct_sdot_workspace) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  if (hc.hostExecution) return;
+  __int64_t N = 100000;
+  std::vector<float> X(N), Y(N);
+  for (__int64_t i = 0; i < N; i++) {
+    X[i] = rand_r(&global_seed) % 10;
+    Y[i] = rand_r(&global_seed) % 15;
+  }
+  float *devX = hc::am_alloc(sizeof(float) * N, hc.currentAccl, 0);
+  float *devY = hc::am_alloc(sizeof(float) * N, hc.currentAccl, 0);
+  av.copy(X.data(), devX, N * sizeof(float));
+  av.copy(Y.data(), devY, N * sizeof(float));
+  const float dotcblas = cblas_sdot(N, X.data(), 1, Y.data(), 1);
+  // 391 work-group partials and the sum: 1568 bytes, aligned to 1792; the
+  // arrival counter takes another 256
+  size_t bytes = 0;
+  EXPECT_EQ(hcblasSdot_workspaceSize(&hc, N, &bytes), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(bytes, 2048u);
+  EXPECT_EQ(hcblasSdot_workspaceSize(&hc, -1, &bytes),
+            HCBLAS_STATUS_INVALID_VALUE);
+  char *region = hc::am_alloc(2 * bytes, hc.currentAccl, 0);
+  EXPECT_EQ(hcblasSetWorkspace(&hc, region, 2 * bytes),
+            HCBLAS_STATUS_SUCCESS);
+
+  // Leases are carved first fit and never overlap
+  {
+    ScratchDevice<float> a(hc.scratch, av, 100);
+    ScratchDevice<float> b(hc.scratch, av, 100);
+    EXPECT_EQ(reinterpret_cast<char *>(a.data()), region);
+    EXPECT_EQ(reinterpret_cast<char *>(b.data()), region + 512);
+  }
+  // The counter is carved from memory holding anything, here all ones
+  std::vector<char> garbage(2 * bytes, -1);
+  av.copy(garbage.data(), region, garbage.size());
+  float dothcblas = 0;
+  EXPECT_EQ(hc.hcblas_sdot(av, N, devX, 1, 0, devY, 1, 0, dothcblas),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(dothcblas, dotcblas);
+  // Every byte, counters included, came from the region
+  EXPECT_EQ(hc.scratch->reserved(true), 0u);
+  EXPECT_EQ(hc.scratch->highWater(true), bytes);
+
+  // A region too small for the call falls back to memory of its own
+  EXPECT_EQ(hcblasSetWorkspace(&hc, region, 256), HCBLAS_STATUS_SUCCESS);
+  dothcblas = 0;
+  EXPECT_EQ(hc.hcblas_sdot(av, N, devX, 1, 0, devY, 1, 0, dothcblas),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(dothcblas, dotcblas);
+  EXPECT_EQ(hc.scratch->reserved(true), 0u);
+
+  // Without a workspace the pool serves the call again
+  EXPECT_EQ(hcblasSetWorkspace(&hc, NULL, 0), HCBLAS_STATUS_SUCCESS);
+  dothcblas = 0;
+  EXPECT_EQ(hc.hcblas_sdot(av, N, devX, 1, 0, devY, 1, 0, dothcblas),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(dothcblas, dotcblas);
+  EXPECT_EQ(hc.scratch->reserved(true), 2048u);
+  hc::am_free(region);
+  hc::am_free(devX);
+  hc::am_free(devY);
+}
+
+TEST(hcblas_sdot, func_correct_sdot_device_pointer_mode) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  if (hc.hostExecution) return;
+  __int64_t N = 100000;
+  std::vector<float> X(N), Y(N);
+  for (__int64_t i = 0; i < N; i++) {
+    X[i] = rand_r(&global_seed) % 10;
+    Y[i] = rand_r(&global_seed) % 15;
+  }
+  float *devX = hc::am_alloc(sizeof(float) * N, hc.currentAccl, 0);
+  float *devY = hc::am_alloc(sizeof(float) * N, hc.currentAccl, 0);
+  float *devScalars = hc::am_alloc(sizeof(float) * 2, hc.currentAccl, 0);
+  av.copy(X.data(), devX, N * sizeof(float));
+  av.copy(Y.data(), devY, N * sizeof(float));
+  hcblasPointerMode_t mode = HCBLAS_POINTER_MODE_DEVICE;
+  EXPECT_EQ(hcblasGetPointerMode(&hc, &mode), HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(mode, HCBLAS_POINTER_MODE_HOST);
+  EXPECT_EQ(hcblasSetPointerMode(&hc, HCBLAS_POINTER_MODE_DEVICE),
+            HCBLAS_STATUS_SUCCESS);
+
+  // The dot product stays in device memory, no host scratch is taken
+  EXPECT_EQ(hc.hcblas_sdot(av, N, devX, 1, 0, devY, 1, 0, devScalars),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(hc.hcblas_sdot(av, N / 2, devX, 1, 0, devY, 1, 0, devScalars + 1,
+                           N / 2, N / 2, 2),
+            HCBLAS_SUCCEEDS);
+  float dots[2];
+  av.copy(devScalars, dots, sizeof(dots));
+  const float dotcblas = cblas_sdot(N, X.data(), 1, Y.data(), 1);
+  EXPECT_EQ(dots[0], dotcblas);
+  EXPECT_EQ(dots[1], dotcblas);
+  EXPECT_EQ(hc.scratch->highWater(false), 0u);
+
+  // alpha read from device memory
+  const float half = 0.5f;
+  av.copy(&half, devScalars, sizeof(float));
+  EXPECT_EQ(hc.hcblas_sscal(av, N, devScalars, devX, 1, 0), HCBLAS_SUCCEEDS);
+  EXPECT_EQ(hc.hcblas_saxpy(av, N, devScalars, devY, 1, devX, 1, 0, 0),
+            HCBLAS_SUCCEEDS);
+  std::vector<float> Xout(N);
+  av.copy(devX, Xout.data(), N * sizeof(float));
+  for (__int64_t i = 0; i < N; i++) {
+    EXPECT_EQ(Xout[i], 0.5f * X[i] + 0.5f * Y[i]);
+  }
+
+  // Host mode again: the same overloads take host pointers
+  EXPECT_EQ(hcblasSetPointerMode(&hc, HCBLAS_POINTER_MODE_HOST),
+            HCBLAS_STATUS_SUCCESS);
+  float dothcblas = 0;
+  EXPECT_EQ(hc.hcblas_sdot(av, N, devY, 1, 0, devY, 1, 0, &dothcblas),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(dothcblas, cblas_sdot(N, Y.data(), 1, Y.data(), 1));
+  hc::am_free(devScalars);
+  hc::am_free(devX);
+  hc::am_free(devY);
+}
+
+TEST(hcblas_sdot, func_correct_sdot_batched_per_entry) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  if (hc.hostExecution) return;
+  int N = 1000;
+  int incX = 2, incY = 1;
+  int batchSize = 5;
+  __int64_t X_batchOffset = (N - 1) * incX + 7;
+  __int64_t Y_batchOffset = N + 3;
+  __int64_t lenx = X_batchOffset * batchSize;
+  __int64_t leny = Y_batchOffset * batchSize;
+  std::vector<float> X(lenx), Y(leny);
+  for (__int64_t i = 0; i < lenx; i++) {
+    X[i] = (rand_r(&global_seed) % 7) - 3;
+  }
+  for (__int64_t i = 0; i < leny; i++) {
+    Y[i] = rand_r(&global_seed) % 5;
+  }
+  float *devX = hc::am_alloc(sizeof(float) * lenx, hc.currentAccl, 0);
+  float *devY = hc::am_alloc(sizeof(float) * leny, hc.currentAccl, 0);
+  av.copy(X.data(), devX, lenx * sizeof(float));
+  av.copy(Y.data(), devY, leny * sizeof(float));
+  std::vector<float> dotcblas(batchSize);
+  for (int i = 0; i < batchSize; i++) {
+    dotcblas[i] = cblas_sdot(N, X.data() + i * X_batchOffset, incX,
+                             Y.data() + i * Y_batchOffset, incY);
+  }
+
+  // Strided batches, one result per entry
+  std::vector<float> dots(batchSize, 0.0f);
+  EXPECT_EQ(hc.hcblas_sdot_batched(av, N, devX, incX, 0, devY, incY, 0,
+                                   dots.data(), X_batchOffset, Y_batchOffset,
+                                   batchSize),
+            HCBLAS_SUCCEEDS);
+  for (int i = 0; i < batchSize; i++) EXPECT_EQ(dots[i], dotcblas[i]);
+
+  // Arrays of vectors, given in reverse order
+  std::vector<const float *> ptrX(batchSize), ptrY(batchSize);
+  for (int i = 0; i < batchSize; i++) {
+    ptrX[i] = devX + (batchSize - 1 - i) * X_batchOffset;
+    ptrY[i] = devY + (batchSize - 1 - i) * Y_batchOffset;
+  }
+  const float **devPtrX =
+      hc::am_alloc(sizeof(float *) * batchSize, hc.currentAccl, 0);
+  const float **devPtrY =
+      hc::am_alloc(sizeof(float *) * batchSize, hc.currentAccl, 0);
+  av.copy(ptrX.data(), devPtrX, batchSize * sizeof(float *));
+  av.copy(ptrY.data(), devPtrY, batchSize * sizeof(float *));
+  EXPECT_EQ(hc.hcblas_sdot_batched(av, N, devPtrX, incX, 0, devPtrY, incY, 0,
+                                   dots.data(), batchSize),
+            HCBLAS_SUCCEEDS);
+  for (int i = 0; i < batchSize; i++) {
+    EXPECT_EQ(dots[i], dotcblas[batchSize - 1 - i]);
+  }
+
+  // Device pointer mode: the results stay in device memory
+  float *devDots = hc::am_alloc(sizeof(float) * batchSize, hc.currentAccl, 0);
+  EXPECT_EQ(hcblasSetPointerMode(&hc, HCBLAS_POINTER_MODE_DEVICE),
+            HCBLAS_STATUS_SUCCESS);
+  EXPECT_EQ(hc.hcblas_sdot_batched(av, N, devX, incX, 0, devY, incY, 0,
+                                   devDots, X_batchOffset, Y_batchOffset,
+                                   batchSize),
+            HCBLAS_SUCCEEDS);
+  av.copy(devDots, dots.data(), batchSize * sizeof(float));
+  for (int i = 0; i < batchSize; i++) EXPECT_EQ(dots[i], dotcblas[i]);
+
+  EXPECT_EQ(hc.hcblas_sdot_batched(av, N, devX, incX, 0, devY, incY, 0,
+                                   devDots, X_batchOffset, Y_batchOffset, 0),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(hc.hcblas_sdot_batched(av, N, devX, incX, 0, devY, incY, 0,
+                                   devDots, X_batchOffset, Y_batchOffset, -1),
+            HCBLAS_INVALID);
+  hc::am_free(devDots);
+  hc::am_free(devPtrX);
+  hc::am_free(devPtrY);
+  hc::am_free(devX);
+  hc::am_free(devY);
+}
+
+TEST(hcblas_sdot, func_correct_sdotBatched_strided) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  if (hc.hostExecution) return;
+  int N = 700;
+  int incX = 2, incY = 3;
+  int batchSize = 4;
+  // hcblasSdotBatched packs the vectors back to back: n * inc apart
+  __int64_t lenx = static_cast<__int64_t>(N) * incX * batchSize;
+  __int64_t leny = static_cast<__int64_t>(N) * incY * batchSize;
+  std::vector<float> X(lenx), Y(leny);
+  for (__int64_t i = 0; i < lenx; i++) {
+    X[i] = (rand_r(&global_seed) % 7) - 3;
+  }
+  for (__int64_t i = 0; i < leny; i++) {
+    Y[i] = rand_r(&global_seed) % 5;
+  }
+  float *devX = hc::am_alloc(sizeof(float) * lenx, hc.currentAccl, 0);
+  float *devY = hc::am_alloc(sizeof(float) * leny, hc.currentAccl, 0);
+  av.copy(X.data(), devX, lenx * sizeof(float));
+  av.copy(Y.data(), devY, leny * sizeof(float));
+  std::vector<float> dots(batchSize, 0.0f);
+  EXPECT_EQ(hcblasSdotBatched(&hc, N, devX, incX, devY, incY, dots.data(),
+                              batchSize),
+            HCBLAS_STATUS_SUCCESS);
+  float total = 0;
+  for (int i = 0; i < batchSize; i++) {
+    EXPECT_EQ(dots[i], cblas_sdot(N, X.data() + i * N * incX, incX,
+                                  Y.data() + i * N * incY, incY));
+    total += dots[i];
+  }
+
+  // The single-output batch overload reports the sum of those results
+  float dothcblas = 0;
+  EXPECT_EQ(hc.hcblas_sdot(av, N, devX, incX, 0, devY, incY, 0, dothcblas,
+                           N * incX, N * incY, batchSize),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(dothcblas, total);
+  hc::am_free(devX);
+  hc::am_free(devY);
+}
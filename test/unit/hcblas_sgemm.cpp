@@ -24,10 +24,18 @@ THE SOFTWARE.
 #include "./test_constants.h"
 #include "include/hcblaslib.h"
 #include "include/helper_functions.h"
+#include "src/blas/gemmgen/gemm_tiled_kernel.h"
+#include "src/blas/gemmselect/gemm_autotune.h"
+#include "src/blas/host/hcblas_host.h"
+#include "src/blas/trace/dispatch_trace.h"
 #include "gtest/gtest.h"
 #include <cblas.h>
+#include <cstdio>
 #include <cstdlib>
 #include <hc_am.hpp>
+#include <string>
+#include <thread>
+#include <unistd.h>
 
 unsigned int global_seed = 100;
 
@@ -1958,3 +1966,638 @@ TEST(hcblas_sgemm, func_correct_sgemm_Implementation_type_2) {
     hc::am_free(devBbatch);
     hc::am_free(devCbatch);*/
 }
+
+// Host execution: a handle bound to the CPU accelerator runs the blocked host
+// engine directly on host pointers
+void func_check_sgemm_host(hcblasOrder order, hcblasTranspose typeA,
+                           hcblasTranspose typeB, int M, int N, int K,
+                           float alpha, float beta, float tolerance) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  EXPECT_TRUE(hc.hostExecution);
+  __int64_t aOffset = 2, bOffset = 1, cOffset = 3;
+  // Padded leading dimensions exercise the strided packing paths
+  __int64_t aRows = (order == ColMajor) == (typeA == NoTrans) ? M : K;
+  __int64_t aCols = (aRows == M) ? K : M;
+  __int64_t bRows = (order == ColMajor) == (typeB == NoTrans) ? K : N;
+  __int64_t bCols = (bRows == K) ? N : K;
+  __int64_t cRows = (order == ColMajor) ? M : N;
+  __int64_t cCols = (order == ColMajor) ? N : M;
+  __int64_t lda = aRows + 3, ldb = bRows + 1, ldc = cRows + 2;
+  float* A = (float*)calloc(aOffset + lda * aCols, sizeof(float));
+  float* B = (float*)calloc(bOffset + ldb * bCols, sizeof(float));
+  float* C = (float*)calloc(cOffset + ldc * cCols, sizeof(float));
+  float* C_cblas = (float*)calloc(cOffset + ldc * cCols, sizeof(float));
+  float X = 2;
+
+  for (int i = 0; i < aOffset + lda * aCols; i++) {
+    A[i] = static_cast<float>(rand_r(&global_seed)) /
+           (static_cast<float>(RAND_MAX / X));
+  }
+  for (int i = 0; i < bOffset + ldb * bCols; i++) {
+    B[i] = static_cast<float>(rand_r(&global_seed)) /
+           (static_cast<float>(RAND_MAX / X));
+  }
+  for (int i = 0; i < cOffset + ldc * cCols; i++) {
+    C[i] = static_cast<float>(rand_r(&global_seed)) /
+           (static_cast<float>(RAND_MAX / X));
+    C_cblas[i] = C[i];
+  }
+
+  hcblasStatus status = hc.hcblas_sgemm(
+      hc.currentAcclView, order, typeA, typeB, M, N, K, alpha, A, lda, B, ldb,
+      beta, C, ldc, aOffset, bOffset, cOffset);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  cblas_sgemm(order == ColMajor ? CblasColMajor : CblasRowMajor,
+              typeA == NoTrans ? CblasNoTrans : CblasTrans,
+              typeB == NoTrans ? CblasNoTrans : CblasTrans, M, N, K, alpha,
+              A + aOffset, lda, B + bOffset, ldb, beta, C_cblas + cOffset, ldc);
+
+  float result =
+      sgemmCompareL2fe(C_cblas, C, cOffset + ldc * cCols, tolerance);
+  EXPECT_LE(result, tolerance);
+
+  free(A);
+  free(B);
+  free(C);
+  free(C_cblas);
+}
+
+void func_check_sgemm_host_all(int M, int N, int K, float alpha, float beta) {
+  hcblasTranspose trans[] = {NoTrans, Trans};
+  for (int a = 0; a < 2; a++) {
+    for (int b = 0; b < 2; b++) {
+      func_check_sgemm_host(ColMajor, trans[a], trans[b], M, N, K, alpha, beta,
+                            1.0e-5f);
+      func_check_sgemm_host(RowMajor, trans[a], trans[b], M, N, K, alpha, beta,
+                            1.0e-5f);
+    }
+  }
+}
+
+TEST(hcblas_sgemm, func_correct_sgemm_host_square) {
+  func_check_sgemm_host_all(gen_small(), gen_small(), gen_small(), 1.5f, 0.5f);
+  func_check_sgemm_host_all(513, 513, 513, 1.0f, 0.0f);
+}
+
+TEST(hcblas_sgemm, func_correct_sgemm_host_rect) {
+  // Tall, wide and deep shapes that leave partial micro-tiles on every edge
+  func_check_sgemm_host_all(1031, 7, 45, 0.75f, 1.0f);
+  func_check_sgemm_host_all(9, 777, 300, -1.0f, 2.0f);
+  func_check_sgemm_host_all(33, 65, 2049, 1.0f, 0.0f);
+}
+
+TEST(hcblas_sgemm, func_correct_sgemm_host_alpha0) {
+  func_check_sgemm_host_all(100, 50, 20, 0.0f, 3.0f);
+  func_check_sgemm_host_all(100, 50, 20, 0.0f, 0.0f);
+}
+
+TEST(hcblas_sgemm, func_correct_sgemm_host_split_k) {
+  EXPECT_EQ(gemm_split_k_count(1, 8, 100000, 4096), 8);
+  EXPECT_EQ(gemm_split_k_count(8, 8, 100000, 4096), 1);
+  EXPECT_EQ(gemm_split_k_count(2, 64, 10000, 4096), 2);
+  EXPECT_EQ(gemm_split_k_count(1, 1000, 1000000, 4096), 64);
+  // Small M x N with very long K splits K across the pool
+  func_check_sgemm_host_all(5, 3, 60000, 1.0f, 1.0f);
+  func_check_sgemm_host_all(17, 9, 30001, 0.5f, 0.0f);
+}
+
+TEST(hcblas_sgemm, func_correct_sgemm_host_batched) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 67, N = 45, K = 129, batchSize = 16;
+  float alpha = 1.25f, beta = 0.5f;
+  __int64_t aOffset = 1, bOffset = 2, cOffset = 3;
+  __int64_t A_batchOffset = 0, B_batchOffset = 0, C_batchOffset = 0;
+  __int64_t lda = K, ldb = N, ldc = N;
+  float* A[batchSize];
+  float* B[batchSize];
+  float* C[batchSize];
+  float* C_cblas[batchSize];
+  for (int b = 0; b < batchSize; b++) {
+    A[b] = (float*)malloc(sizeof(float) * (aOffset + M * K));
+    B[b] = (float*)malloc(sizeof(float) * (bOffset + K * N));
+    C[b] = (float*)malloc(sizeof(float) * (cOffset + M * N));
+    C_cblas[b] = (float*)malloc(sizeof(float) * (cOffset + M * N));
+    for (int i = 0; i < aOffset + M * K; i++) {
+      A[b][i] = rand_r(&global_seed) % 100;
+    }
+    for (int i = 0; i < bOffset + K * N; i++) {
+      B[b][i] = rand_r(&global_seed) % 15;
+    }
+    for (int i = 0; i < cOffset + M * N; i++) {
+      C[b][i] = C_cblas[b][i] = rand_r(&global_seed) % 25;
+    }
+  }
+
+  hcblasStatus status = hc.hcblas_sgemm(
+      hc.currentAcclView, RowMajor, NoTrans, NoTrans, M, N, K, alpha, A, lda,
+      A_batchOffset, B, ldb, B_batchOffset, beta, C, ldc, C_batchOffset,
+      aOffset, bOffset, cOffset, batchSize);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  for (int b = 0; b < batchSize; b++) {
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha,
+                A[b] + aOffset, lda, B[b] + bOffset, ldb, beta,
+                C_cblas[b] + cOffset, ldc);
+    for (int i = 0; i < cOffset + M * N; i++) {
+      EXPECT_EQ(C[b][i], C_cblas[b][i]);
+    }
+    free(A[b]);
+    free(B[b]);
+    free(C[b]);
+    free(C_cblas[b]);
+  }
+}
+
+struct TestKernelEntry {
+  GemmKernelInfo info;
+};
+
+TEST(hcblas_sgemm, gemm_selection_builtin) {
+  const TestKernelEntry kernels[] = {
+      {{"MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2", {128, 128, 128},
+        16, 2}},
+      {{"MICRO_NBK_MX064_NX064_KX16_TS16XMTS4", {64, 64, 16}, 16, 4}},
+      {{"TILED_TS16_MT2X2_K16", {1, 1, 1}, 16, 2}},
+      {{"TILED_TS16_MT4X4_K16", {1, 1, 1}, 16, 4}},
+      {{"TILED_TS16_MT6X6_K16", {1, 1, 1}, 16, 6}}};
+  const int count = sizeof(kernels) / sizeof(kernels[0]);
+  const GemmSelectKey key = {'s', 'C', 'n', 'n', false};
+  // Divisible shapes take the specialised variants, others fall through
+  EXPECT_STREQ(gemm_select_kernel(key, 1024, 1024, 1024, kernels, count)
+                   ->info.name,
+               "MICRO_NBK_Mini_Batch_M128_N128_K16_TS16XMTS2_MB2");
+  EXPECT_STREQ(gemm_select_kernel(key, 640, 640, 32, kernels, count)->info.name,
+               "MICRO_NBK_MX064_NX064_KX16_TS16XMTS4");
+  EXPECT_STREQ(gemm_select_kernel(key, 100, 100, 100, kernels, count)
+                   ->info.name,
+               "TILED_TS16_MT2X2_K16");
+  EXPECT_STREQ(gemm_select_kernel(key, 3001, 3001, 3001, kernels, count)
+                   ->info.name,
+               "TILED_TS16_MT4X4_K16");
+  // A key without rules lands on the registry's general kernel
+  const GemmSelectKey other = {'z', 'R', 't', 't', true};
+  EXPECT_STREQ(gemm_select_kernel(other, 100, 100, 100, kernels, count)
+                   ->info.name,
+               "TILED_TS16_MT6X6_K16");
+  // A default the caller prefers wins over the built-in rules when it admits
+  // the shape and is listed
+  EXPECT_STREQ(gemm_select_kernel(key, 1024, 1024, 1024, kernels, count,
+                                  "TILED_TS16_MT6X6_K16")
+                   ->info.name,
+               "TILED_TS16_MT6X6_K16");
+  EXPECT_STREQ(gemm_select_kernel(key, 100, 100, 100, kernels, count,
+                                  "MICRO_NBK_MX064_NX064_KX16_TS16XMTS4")
+                   ->info.name,
+               "TILED_TS16_MT2X2_K16");
+  EXPECT_STREQ(gemm_select_kernel(key, 100, 100, 100, kernels, count,
+                                  "SPLIT_K")
+                   ->info.name,
+               "TILED_TS16_MT2X2_K16");
+}
+
+TEST(hcblas_sgemm, gemm_selection_parse) {
+  GemmSelectionTable table;
+  std::string error;
+  EXPECT_TRUE(table.parse("# comment\n"
+                          "s C n t 0 10:20 * :5 - A  # trailing comment\n"
+                          "s C n t 0 * * * M=K B\n"
+                          "s C n t 1 * 3: * M<K C\n",
+                          &error));
+  const GemmSelectKey key = {'s', 'C', 'n', 't', false};
+  const std::vector<GemmSelectRule> &rules = table.rules(key);
+  ASSERT_EQ(rules.size(), 2u);
+  EXPECT_EQ(rules[0].kernel, "A");
+  EXPECT_TRUE(rules[0].matches(10, 1, 5));
+  EXPECT_FALSE(rules[0].matches(21, 1, 5));
+  EXPECT_FALSE(rules[0].matches(15, 1, 6));
+  EXPECT_TRUE(rules[1].matches(7, 9, 7));
+  EXPECT_FALSE(rules[1].matches(7, 9, 8));
+  const GemmSelectKey batched = {'s', 'C', 'n', 't', true};
+  ASSERT_EQ(table.rules(batched).size(), 1u);
+  EXPECT_TRUE(table.rules(batched)[0].matches(2, 3, 4));
+  EXPECT_FALSE(table.rules(batched)[0].matches(2, 2, 4));
+
+  // A bad line rejects the whole text and leaves the table as it was
+  EXPECT_FALSE(table.parse("s C n t 0 * * * - D\ns C x t 0 * * * - E\n",
+                           &error));
+  EXPECT_NE(error.find("line 2"), std::string::npos);
+  EXPECT_EQ(table.rules(key).size(), 2u);
+  EXPECT_FALSE(table.parse("s C n t 0 9:1 * * - F\n", &error));
+
+  // M=N, and a retired kernel name reads as the kernel that replaced it
+  EXPECT_TRUE(table.parse("d C t n 0 * * * M=N MICRO_NBK_M_N_K_TS16XMTS6\n",
+                          &error));
+  const GemmSelectKey dkey = {'d', 'C', 't', 'n', false};
+  ASSERT_EQ(table.rules(dkey).size(), 1u);
+  EXPECT_EQ(table.rules(dkey)[0].kernel, "TILED_TS16_MT6X6_K16");
+  EXPECT_TRUE(table.rules(dkey)[0].matches(7, 7, 9));
+  EXPECT_FALSE(table.rules(dkey)[0].matches(7, 8, 7));
+  EXPECT_FALSE(table.load("/nonexistent/hcblas_gemm_table", &error));
+}
+
+// Every host variant hcblas-tune can emit agrees exactly with the default
+// on integer data, including N beyond one 4096 column B block
+TEST(hcblas_sgemm, host_gemm_variants) {
+  int count = host_gemm_variant_count<float>();
+  ASSERT_GE(count, 2);
+  const std::string last = host_gemm_variant_name<float>(count - 1);
+  EXPECT_EQ(last.substr(last.size() - 3), "_mt");
+  int shapes[][3] = {{37, 29, 45}, {5, 4500, 8}};
+  for (int s = 0; s < 2; s++) {
+    int M = shapes[s][0], N = shapes[s][1], K = shapes[s][2];
+    std::vector<float> A(M * K), B(K * N), C(M * N), ref(M * N);
+    for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 7;
+    for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 7;
+    host_gemm<float>(true, false, true, M, N, K, 1.0f, A.data(), M, B.data(),
+                     N, 0.0f, ref.data(), M);
+    for (int v = 0; v < count; v++) {
+      std::string name = host_gemm_variant_name<float>(v);
+      EXPECT_EQ(name.compare(0, 5, "host_"), 0);
+      host_gemm_variant<float>(v, true, false, true, M, N, K, 1.0f, A.data(),
+                               M, B.data(), N, 0.0f, C.data(), M);
+      EXPECT_TRUE(C == ref) << name;
+    }
+  }
+}
+
+// The device kernels on the host runtime match cblas on integer data:
+// partial tiles, one K step, several K steps, padded leading dimensions and
+// every transpose (TS8XSS8 and TS16XMTS2 run TS16XMTS4 for the transposes)
+TEST(hcblas_sgemm, host_tiled_kernel) {
+  int shapes[][4] = {{37, 29, 45, 0}, {16, 16, 16, 0}, {70, 33, 100, 5}};
+  for (int s = 0; s < 3; s++) {
+    int M = shapes[s][0], N = shapes[s][1], K = shapes[s][2];
+    int lda = (M > K ? M : K) + shapes[s][3];
+    int ldb = K > N ? K : N;
+    std::vector<float> A(lda * lda), B(ldb * ldb), C(M * N), C_cblas(M * N);
+    for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 7;
+    for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 7;
+    for (int kernel = 0; kernel < HOST_TILED_KERNELS; kernel++) {
+      for (int t = 0; t < 4; t++) {
+        bool transA = (t & 1) != 0, transB = (t & 2) != 0;
+        for (size_t i = 0; i < C.size(); i++) C[i] = C_cblas[i] = i % 3;
+        host_sgemm_tiled(static_cast<HostTiledKernel>(kernel), transA, transB,
+                         M, N, K, 1.0f, A.data(), lda, B.data(), ldb, 2.0f,
+                         C.data(), M);
+        cblas_sgemm(CblasColMajor, transA ? CblasTrans : CblasNoTrans,
+                    transB ? CblasTrans : CblasNoTrans, M, N, K, 1.0f,
+                    A.data(), lda, B.data(), ldb, 2.0f, C_cblas.data(), M);
+        EXPECT_TRUE(C == C_cblas) << kernel << " " << t << " " << M << "x"
+                                  << N << "x" << K;
+      }
+    }
+  }
+}
+
+TEST(hcblas_sgemm, gemm_autotune_pins_fastest) {
+  const TestKernelEntry kernels[] = {
+      {{"MICRO_NBK_MX064_NX064_KX16_TS16XMTS4", {64, 64, 16}, 16, 4}},
+      {{"TILED_TS16_MT2X2_K16", {1, 1, 1}, 16, 2}},
+      {{"TILED_TS16_MT4X4_K16", {1, 1, 1}, 16, 4}},
+      {{"TILED_TS16_MT6X6_K16", {1, 1, 1}, 16, 6}}};
+  const int count = sizeof(kernels) / sizeof(kernels[0]);
+  // 100 is not a multiple of 64: three eligible variants, two samples each
+  GemmAutotuner tuner(8, 2);
+  const GemmTuneKey key = {'s', 'C', 'n', 'n', 100, 100, 100, 100, 100, 100};
+  const double ms[] = {0, 3.0, 1.0, 2.0};
+  bool trial = false;
+  // The rule table's pick is timed first
+  const TestKernelEntry *first =
+      gemm_autotune_kernel(&tuner, NULL, key, kernels, count, &trial);
+  EXPECT_TRUE(trial);
+  EXPECT_STREQ(first->info.name, "TILED_TS16_MT2X2_K16");
+  tuner.record(key, first - kernels, ms[first - kernels]);
+  for (int call = 1; call < 6; call++) {
+    const TestKernelEntry *k =
+        gemm_autotune_kernel(&tuner, NULL, key, kernels, count, &trial);
+    EXPECT_TRUE(trial);
+    EXPECT_NE(k - kernels, 0);
+    tuner.record(key, k - kernels, ms[k - kernels]);
+  }
+  EXPECT_EQ(tuner.pinned(key), 2);
+  EXPECT_EQ(gemm_autotune_kernel(&tuner, NULL, key, kernels, count, &trial),
+            &kernels[2]);
+  EXPECT_FALSE(trial);
+
+  // The remaining budget of 2 cannot cover a new key, which keeps the
+  // table's pick without timing
+  EXPECT_EQ(tuner.budget_left(), 2);
+  const GemmTuneKey other = {'s', 'C', 'n', 'n', 100, 100, 100, 128, 100, 100};
+  EXPECT_EQ(gemm_autotune_kernel(&tuner, NULL, other, kernels, count, &trial),
+            &kernels[1]);
+  EXPECT_FALSE(trial);
+  EXPECT_EQ(tuner.pinned(other), 1);
+  // No tuner: plain table selection
+  EXPECT_EQ(gemm_autotune_kernel<TestKernelEntry>(NULL, NULL, key, kernels,
+                                                  count, &trial),
+            &kernels[1]);
+}
+
+TEST(hcblas_sgemm, gemm_tuning_db_persists) {
+  const TestKernelEntry kernels[] = {
+      {{"TILED_TS16_MT2X2_K16", {1, 1, 1}, 16, 2}},
+      {{"TILED_TS16_MT4X4_K16", {1, 1, 1}, 16, 4}}};
+  char dir[] = "/tmp/hcblas_tunedb_XXXXXX";
+  ASSERT_TRUE(mkdtemp(dir) != NULL);
+  const std::string path = std::string(dir) + "/test.tdb";
+  TuningDb writer(path, "test-device");
+  const GemmTuneKey key = {'s', 'C', 'n', 'n', 100, 100, 100, 100, 100, 100};
+  bool trial = false;
+  // One sample per variant; the second is faster and is written out
+  GemmAutotuner tuner(2, 1);
+  for (int call = 0; call < 2; call++) {
+    const TestKernelEntry *k =
+        gemm_autotune_kernel(&tuner, &writer, key, kernels, 2, &trial);
+    EXPECT_TRUE(trial);
+    const int variant = static_cast<int>(k - kernels);
+    gemm_autotune_record(&tuner, &writer, key, kernels, variant,
+                         variant == 0 ? 2.0 : 1.0);
+  }
+  EXPECT_EQ(tuner.pinned(key), 1);
+  // The choice is queued until a flush (or TUNING_DB_BATCH records)
+  int64_t dbKey[7], stored;
+  gemm_tune_db_key(key, dbKey);
+  EXPECT_FALSE(TuningDb(path, "test-device")
+                   .lookup(TUNING_GEMM_KERNEL, dbKey, &stored));
+  EXPECT_TRUE(writer.flush());
+
+  // Another process: no tuner, the stored choice runs untimed
+  TuningDb reader(path, "test-device");
+  EXPECT_EQ(gemm_autotune_kernel<TestKernelEntry>(NULL, &reader, key, kernels,
+                                                  2, &trial),
+            &kernels[1]);
+  EXPECT_FALSE(trial);
+
+  // Later stores merge with and replace earlier records
+  TuningRecord threshold = {TUNING_THRESHOLD, 0, {0, 0, 0, 0, 0, 0, 0}, 7};
+  threshold.key[0] = static_cast<int64_t>(tuning_hash("saxpy.flat_max"));
+  EXPECT_TRUE(writer.store(std::vector<TuningRecord>(1, threshold)));
+  threshold.value = 9;
+  EXPECT_TRUE(writer.store(std::vector<TuningRecord>(1, threshold)));
+  EXPECT_EQ(tuning_db_threshold(&writer, "saxpy.flat_max", 102400), 9);
+  EXPECT_EQ(tuning_db_threshold(&writer, "saxpy.step3_max", 409600), 409600);
+  reader.refresh();
+  EXPECT_EQ(tuning_db_threshold(&reader, "saxpy.flat_max", 102400), 9);
+  EXPECT_EQ(gemm_autotune_kernel<TestKernelEntry>(NULL, &reader, key, kernels,
+                                                  2, &trial),
+            &kernels[1]);
+
+  // A file written for another device is ignored
+  TuningDb other(path, "other-device");
+  EXPECT_EQ(tuning_db_threshold(&other, "saxpy.flat_max", 102400), 102400);
+  unlink(path.c_str());
+  unlink((path + ".lock").c_str());
+  rmdir(dir);
+}
+
+TEST(hcblas_sgemm, func_correct_sgemm_host_autotune) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  EXPECT_EQ(hcblasSetGemmAutotune(&hc, -1), HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasSetGemmAutotune(&hc, 1000), HCBLAS_STATUS_SUCCESS);
+  int M = 70, N = 50, K = 90;
+  std::vector<float> A(M * K), B(K * N), C(M * N), C_cblas(M * N);
+  for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 7;
+  for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 7;
+  cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f,
+              A.data(), M, B.data(), K, 0.0f, C_cblas.data(), M);
+  // Trial calls and pinned calls alike must be correct
+  for (int call = 0; call < 40; call++) {
+    std::fill(C.begin(), C.end(), -1.0f);
+    EXPECT_EQ(hc.hcblas_sgemm(av, ColMajor, NoTrans, NoTrans, M, N, K, 1.0f,
+                              A.data(), M, B.data(), K, 0.0f, C.data(), M, 0,
+                              0, 0),
+              HCBLAS_SUCCEEDS);
+    EXPECT_TRUE(C == C_cblas);
+  }
+  const GemmTuneKey key = {'s', 'C', 'n', 'n', M, N, K, M, K, M};
+  EXPECT_GE(hc.gemmAutotuner->pinned(key), 0);
+  EXPECT_EQ(hcblasSetGemmAutotune(&hc, 0), HCBLAS_STATUS_SUCCESS);
+  EXPECT_TRUE(hc.gemmAutotuner == NULL);
+}
+
+TEST(hcblas_sgemm, dispatch_trace_ring) {
+  // Four writers overrun a ring of 64; the newest events survive in order
+  DispatchTrace trace(64);
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 4; t++) {
+    writers.push_back(std::thread([&trace, t] {
+      for (int i = 0; i < 100; i++) {
+        DispatchTraceEvent event =
+            dispatch_trace_gemm("sgemm", 'C', 'n', 'n', t, i, 1);
+        trace.record(event, std::chrono::steady_clock::now());
+      }
+    }));
+  }
+  for (size_t t = 0; t < writers.size(); t++) writers[t].join();
+  std::vector<DispatchTraceEvent> events;
+  trace.snapshot(&events);
+  ASSERT_EQ(events.size(), 64u);
+  for (size_t i = 0; i < events.size(); i++) {
+    EXPECT_EQ(events[i].seq, 336 + i);
+    EXPECT_STREQ(events[i].routine, "sgemm");
+  }
+
+  DispatchTraceEvent tiled = dispatch_trace_gemm("sgemm", 'C', 'n', 'n', 100,
+                                                 64, 20);
+  dispatch_trace_tiled(&tiled, 16, 4);
+  EXPECT_EQ(tiled.gridM, 2);
+  EXPECT_EQ(tiled.gridN, 1);
+  EXPECT_EQ(tiled.tileM, 64);
+  // 128 x 64 x 32 issued for 100 x 64 x 20
+  EXPECT_DOUBLE_EQ(tiled.padding, 128.0 * 64 * 32 / (100.0 * 64 * 20));
+  EXPECT_EQ(tiled.splits, 1);
+  EXPECT_EQ(tiled.workers, 0);
+
+  // K = 100 in two ranges of 64 and 36, each rounded to 16, then reduced
+  DispatchTraceEvent split = dispatch_trace_gemm("sgemm", 'C', 'n', 'n', 64,
+                                                 64, 100);
+  dispatch_trace_split_k(&split, 64, 16, 2);
+  EXPECT_EQ(split.gridM, 1);
+  EXPECT_EQ(split.tileM, 64);
+  EXPECT_EQ(split.splits, 2);
+  EXPECT_EQ(split.fixups, 1);
+  EXPECT_DOUBLE_EQ(split.padding, (64.0 + 48) / 100);
+
+  // Two tiles of two iterations over three workers: the first tile is
+  // shared by workers 0 and 1, the second belongs to worker 2
+  DispatchTraceEvent stream = dispatch_trace_gemm("sgemm", 'C', 'n', 'n', 128,
+                                                  64, 32);
+  dispatch_trace_stream_k(&stream, 64, 16, 3);
+  EXPECT_EQ(stream.gridM, 2);
+  EXPECT_EQ(stream.gridN, 1);
+  EXPECT_EQ(stream.workers, 3);
+  EXPECT_EQ(stream.fixups, 1);
+  EXPECT_DOUBLE_EQ(stream.padding, 1.0);
+}
+
+TEST(hcblas_sgemm, func_correct_sgemm_host_trace) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  EXPECT_EQ(hcblasSetTrace(&hc, 1), HCBLAS_STATUS_SUCCESS);
+  int M = 33, N = 17, K = 9;
+  std::vector<float> A(M * K, 1.0f), B(K * N, 2.0f), C(M * N, 0.0f);
+  EXPECT_EQ(hc.hcblas_sgemm(av, ColMajor, NoTrans, Trans, M, N, K, 1.0f,
+                            A.data(), M, B.data(), N, 0.0f, C.data(), M, 0, 0,
+                            0),
+            HCBLAS_SUCCEEDS);
+  EXPECT_EQ(C[0], 18.0f);
+  std::vector<DispatchTraceEvent> events;
+  dispatch_trace()->snapshot(&events);
+  ASSERT_FALSE(events.empty());
+  const DispatchTraceEvent &last = events.back();
+  EXPECT_STREQ(last.routine, "sgemm");
+  EXPECT_STREQ(last.reason, "table");
+  EXPECT_EQ(last.transB, 't');
+  EXPECT_EQ(last.M, M);
+  EXPECT_EQ(last.K, K);
+  EXPECT_EQ(std::string(last.variant).compare(0, 5, "host_"), 0);
+  EXPECT_GE(last.padding, 1.0);
+
+  char path[] = "/tmp/hcblas_trace_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  close(fd);
+  EXPECT_EQ(hcblasDumpTrace(&hc, NULL), HCBLAS_STATUS_INVALID_VALUE);
+  EXPECT_EQ(hcblasDumpTrace(&hc, path), HCBLAS_STATUS_SUCCESS);
+  char header[32] = {0};
+  FILE *csv = fopen(path, "r");
+  ASSERT_TRUE(csv != NULL);
+  EXPECT_TRUE(fgets(header, sizeof(header), csv) != NULL);
+  fclose(csv);
+  EXPECT_EQ(std::string(header).compare(0, 15, "seq,start_us,el"), 0);
+  unlink(path);
+  EXPECT_EQ(hcblasSetTrace(&hc, 0), HCBLAS_STATUS_SUCCESS);
+  EXPECT_TRUE(hc.trace == NULL);
+}
+
+// One generated kernel on device memory against cblas, for a shape that is
+// not a multiple of any tile and leading dimensions with slack
+template <int TILE, int MTM, int MTN, int KSTEP, int PAD, bool TRANSA,
+          bool TRANSB>
+void func_check_gemm_tiled(const char* name, int M, int N, int K) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  __int64_t lda = (TRANSA ? K : M) + 1;
+  __int64_t ldb = (TRANSB ? N : K) + 2;
+  __int64_t ldc = M + 3;
+  std::vector<float> A(lda * (TRANSA ? M : K)), B(ldb * (TRANSB ? K : N));
+  std::vector<float> C(ldc * N), C_cblas(ldc * N);
+  for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 7;
+  for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 7;
+  for (size_t i = 0; i < C.size(); i++) C[i] = C_cblas[i] = i % 5;
+  float* devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+  float* devB = hc::am_alloc(sizeof(float) * B.size(), accl, 0);
+  float* devC = hc::am_alloc(sizeof(float) * C.size(), accl, 0);
+  av.copy(A.data(), devA, sizeof(float) * A.size());
+  av.copy(B.data(), devB, sizeof(float) * B.size());
+  av.copy(C.data(), devC, sizeof(float) * C.size());
+  ScratchPool scratch;
+  EXPECT_EQ((gemm_tiled<float, float, TILE, MTM, MTN, KSTEP, PAD, TRANSA,
+                        TRANSB>(av, &scratch, devA, 0, devB, 0, devC, 0, M, N,
+                                K, lda, ldb, ldc, 2.0f, 1.0f)),
+            HCBLAS_SUCCEEDS);
+  av.copy(devC, C.data(), sizeof(float) * C.size());
+  cblas_sgemm(CblasColMajor, TRANSA ? CblasTrans : CblasNoTrans,
+              TRANSB ? CblasTrans : CblasNoTrans, M, N, K, 2.0f, A.data(), lda,
+              B.data(), ldb, 1.0f, C_cblas.data(), ldc);
+  EXPECT_TRUE(C == C_cblas) << name << " " << TRANSA << TRANSB;
+  hc::am_free(devA);
+  hc::am_free(devB);
+  hc::am_free(devC);
+}
+
+TEST(hcblas_sgemm, func_correct_gemm_tiled_variants) {
+#define CHECK_TILED(name, tile, mtm, mtn, kstep, pad)                         \
+  func_check_gemm_tiled<tile, mtm, mtn, kstep, pad, false, false>(#name, 131, \
+                                                                  67, 45);    \
+  func_check_gemm_tiled<tile, mtm, mtn, kstep, pad, false, true>(#name, 131,  \
+                                                                 67, 45);     \
+  func_check_gemm_tiled<tile, mtm, mtn, kstep, pad, true, false>(#name, 67,   \
+                                                                 131, 33);    \
+  func_check_gemm_tiled<tile, mtm, mtn, kstep, pad, true, true>(#name, 19,    \
+                                                                70, 5);
+  GEMM_TILED_VARIANTS(CHECK_TILED)
+#undef CHECK_TILED
+}
+
+TEST(hcblas_sgemm, func_correct_sgemm_split_k) {
+  // A few blocks of C with K long enough to split across the device.
+  // Integer inputs keep every partial sum exact.
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 20, N = 30, K = 200000;
+  hcblasOrder orders[] = {ColMajor, RowMajor};
+  for (int o = 0; o < 2; o++) {
+    __int64_t lda = orders[o] == ColMajor ? M : K;
+    __int64_t ldb = orders[o] == ColMajor ? K : N;
+    __int64_t ldc = orders[o] == ColMajor ? M : N;
+    std::vector<float> A(M * K), B(K * N), C(M * N), C_cblas(M * N);
+    for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 7;
+    for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 7;
+    for (size_t i = 0; i < C.size(); i++) C[i] = C_cblas[i] = i % 3;
+    float* devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+    float* devB = hc::am_alloc(sizeof(float) * B.size(), accl, 0);
+    float* devC = hc::am_alloc(sizeof(float) * C.size(), accl, 0);
+    av.copy(A.data(), devA, sizeof(float) * A.size());
+    av.copy(B.data(), devB, sizeof(float) * B.size());
+    av.copy(C.data(), devC, sizeof(float) * C.size());
+    EXPECT_EQ(hc.hcblas_sgemm(av, orders[o], NoTrans, NoTrans, M, N, K, 1.0f,
+                              devA, lda, devB, ldb, 2.0f, devC, ldc, 0, 0, 0),
+              HCBLAS_SUCCEEDS);
+    av.copy(devC, C.data(), sizeof(float) * C.size());
+    cblas_sgemm(orders[o] == ColMajor ? CblasColMajor : CblasRowMajor,
+                CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), lda,
+                B.data(), ldb, 2.0f, C_cblas.data(), ldc);
+    EXPECT_TRUE(C == C_cblas);
+    hc::am_free(devA);
+    hc::am_free(devB);
+    hc::am_free(devC);
+  }
+}
+
+TEST(hcblas_sgemm, func_correct_sgemm_stream_k) {
+  // A bit over one wave of 64 x 64 blocks leaves most of the last wave idle;
+  // every tile count here sits in that tail.
+  EXPECT_TRUE(gemm_stream_k_wanted(110, 100, 64));
+  EXPECT_FALSE(gemm_stream_k_wanted(250, 100, 64));
+  EXPECT_FALSE(gemm_stream_k_wanted(50, 100, 64));
+  EXPECT_FALSE(gemm_stream_k_wanted(110, 100, 4));
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 320, N = 320, K = 256;
+  hcblasOrder orders[] = {ColMajor, RowMajor};
+  for (int o = 0; o < 2; o++) {
+    __int64_t lda = orders[o] == ColMajor ? K : M;
+    __int64_t ldb = orders[o] == ColMajor ? K : N;
+    __int64_t ldc = orders[o] == ColMajor ? M : N;
+    std::vector<float> A(M * K), B(K * N), C(M * N), C_cblas(M * N);
+    for (size_t i = 0; i < A.size(); i++) A[i] = rand_r(&global_seed) % 7;
+    for (size_t i = 0; i < B.size(); i++) B[i] = rand_r(&global_seed) % 7;
+    for (size_t i = 0; i < C.size(); i++) C[i] = C_cblas[i] = i % 3;
+    float* devA = hc::am_alloc(sizeof(float) * A.size(), accl, 0);
+    float* devB = hc::am_alloc(sizeof(float) * B.size(), accl, 0);
+    float* devC = hc::am_alloc(sizeof(float) * C.size(), accl, 0);
+    av.copy(A.data(), devA, sizeof(float) * A.size());
+    av.copy(B.data(), devB, sizeof(float) * B.size());
+    av.copy(C.data(), devC, sizeof(float) * C.size());
+    EXPECT_EQ(hc.hcblas_sgemm(av, orders[o], Trans, NoTrans, M, N, K, 1.0f,
+                              devA, lda, devB, ldb, 2.0f, devC, ldc, 0, 0, 0),
+              HCBLAS_SUCCEEDS);
+    av.copy(devC, C.data(), sizeof(float) * C.size());
+    cblas_sgemm(orders[o] == ColMajor ? CblasColMajor : CblasRowMajor,
+                CblasTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), lda,
+                B.data(), ldb, 2.0f, C_cblas.data(), ldc);
+    EXPECT_TRUE(C == C_cblas);
+    hc::am_free(devA);
+    hc::am_free(devB);
+    hc::am_free(devC);
+  }
+}
@@ -732,3 +732,97 @@ TEST(hcblas_sgemv, func_correct_sgemv_Implementation_type_2) {
   hc::am_free(devYbatch1);
 }
 
+
+// Host execution: CPU accelerator, host pointers, padded lda and strided
+// vectors in both orders. Integer data keeps the results exact.
+void func_check_sgemv_host(hcblasOrder order, hcblasTranspose typeA, int M,
+                           int N, int incX, int incY, float beta) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  float alpha = 2;
+  __int64_t lda = ((order == ColMajor) ? M : N) + 3;
+  __int64_t aOffset = 5, xOffset = 2, yOffset = 1;
+  int lenX = (typeA == NoTrans) ? N : M;
+  int lenY = (typeA == NoTrans) ? M : N;
+  __int64_t sizeA = aOffset + lda * ((order == ColMajor) ? N : M);
+  __int64_t sizeX = xOffset + 1 + (lenX - 1) * incX;
+  __int64_t sizeY = yOffset + 1 + (lenY - 1) * incY;
+  float *A = (float *)calloc(sizeA, sizeof(float));
+  float *x = (float *)calloc(sizeX, sizeof(float));
+  float *y = (float *)calloc(sizeY, sizeof(float));
+  float *ycblas = (float *)calloc(sizeY, sizeof(float));
+  for (int i = 0; i < sizeA; i++) {
+    A[i] = rand_r(&global_seed) % 25;
+  }
+  for (int i = 0; i < sizeX; i++) {
+    x[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < sizeY; i++) {
+    y[i] = ycblas[i] = rand_r(&global_seed) % 15;
+  }
+  hcblasStatus status =
+      hc.hcblas_sgemv(hc.currentAcclView, order, typeA, M, N, alpha, A,
+                      aOffset, lda, x, xOffset, incX, beta, y, yOffset, incY);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  cblas_sgemv((order == ColMajor) ? CblasColMajor : CblasRowMajor,
+              (typeA == NoTrans) ? CblasNoTrans : CblasTrans, M, N, alpha,
+              A + aOffset, lda, x + xOffset, incX, beta, ycblas + yOffset,
+              incY);
+  for (int i = 0; i < sizeY; i++) EXPECT_EQ(y[i], ycblas[i]);
+  free(A);
+  free(x);
+  free(y);
+  free(ycblas);
+}
+
+TEST(hcblas_sgemv, func_correct_sgemv_host) {
+  hcblasOrder orders[] = {ColMajor, RowMajor};
+  hcblasTranspose trans[] = {NoTrans, Trans};
+  int shapes[][2] = {{1, 1}, {179, 19}, {19, 179}, {1031, 517}, {5, 20000}};
+  for (int o = 0; o < 2; o++) {
+    for (int t = 0; t < 2; t++) {
+      for (int s = 0; s < 5; s++) {
+        func_check_sgemv_host(orders[o], trans[t], shapes[s][0], shapes[s][1],
+                              1, 1, 1);
+        func_check_sgemv_host(orders[o], trans[t], shapes[s][0], shapes[s][1],
+                              3, 2, 0);
+      }
+    }
+  }
+}
+
+TEST(hcblas_sgemv, func_correct_sgemv_host_batched) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 179, N = 19, batchSize = 32;
+  float alpha = 1, beta = 1;
+  __int64_t lda = M;
+  float *A = (float *)calloc(M * N * batchSize, sizeof(float));
+  float *x = (float *)calloc(N * batchSize, sizeof(float));
+  float *y = (float *)calloc(M * batchSize, sizeof(float));
+  float *ycblas = (float *)calloc(M * batchSize, sizeof(float));
+  for (int i = 0; i < M * N * batchSize; i++) {
+    A[i] = rand_r(&global_seed) % 25;
+  }
+  for (int i = 0; i < N * batchSize; i++) {
+    x[i] = rand_r(&global_seed) % 10;
+  }
+  for (int i = 0; i < M * batchSize; i++) {
+    y[i] = ycblas[i] = rand_r(&global_seed) % 15;
+  }
+  hcblasStatus status = hc.hcblas_sgemv(
+      hc.currentAcclView, ColMajor, NoTrans, M, N, alpha, A, 0, M * N, lda, x,
+      0, N, 1, beta, y, 0, M, 1, batchSize);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  for (int b = 0; b < batchSize; b++) {
+    cblas_sgemv(CblasColMajor, CblasNoTrans, M, N, alpha, A + b * M * N, lda,
+                x + b * N, 1, beta, ycblas + b * M, 1);
+  }
+  for (int i = 0; i < M * batchSize; i++) EXPECT_EQ(y[i], ycblas[i]);
+  free(A);
+  free(x);
+  free(y);
+  free(ycblas);
+}
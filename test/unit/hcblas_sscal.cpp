@@ -209,3 +209,56 @@ TEST(hcblas_sscal, function_correct_sscal_Implementation_type_2) {
   free(Xbatch);
   hc::am_free(devXbatch);
 }
+
+// Host execution: CPU accelerator, host pointers, strided and long vectors.
+// Small integer data keeps every partial sum exact in single precision.
+
+void func_check_sscal_host(int N, int incX, float alpha) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  __int64_t xOffset = 3;
+  __int64_t lenx = xOffset + 1 + (N - 1) * abs(incX);
+  float *X = (float *)calloc(lenx, sizeof(float));
+  float *Xcblas = (float *)calloc(lenx, sizeof(float));
+  for (int i = 0; i < lenx; i++) {
+    X[i] = Xcblas[i] = rand_r(&global_seed) % 10;
+  }
+  hcblasStatus status =
+      hc.hcblas_sscal(hc.currentAcclView, N, alpha, X, incX, xOffset);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  cblas_sscal(N, alpha, Xcblas + xOffset, incX);
+  for (int i = 0; i < lenx; i++) EXPECT_EQ(X[i], Xcblas[i]);
+  free(X);
+  free(Xcblas);
+}
+
+TEST(hcblas_sscal, function_correct_sscal_host) {
+  int sizes[] = {1, 7, 279, 4099, 1 << 20};
+  for (int s = 0; s < 5; s++) {
+    func_check_sscal_host(sizes[s], 1, 3);
+    func_check_sscal_host(sizes[s], 2, -0.5);
+    func_check_sscal_host(sizes[s], 1, 0);
+  }
+}
+
+TEST(hcblas_sscal, function_correct_sscal_host_batched) {
+  hc::accelerator cpu(L"cpu");
+  hc::accelerator_view av = cpu.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 279;
+  int batchSize = 64;
+  float alpha = 2;
+  float *X = (float *)calloc(N * batchSize, sizeof(float));
+  float *Xcblas = (float *)calloc(N * batchSize, sizeof(float));
+  for (int i = 0; i < N * batchSize; i++) {
+    X[i] = Xcblas[i] = rand_r(&global_seed) % 10;
+  }
+  hcblasStatus status = hc.hcblas_sscal(hc.currentAcclView, N, alpha, X, 1, 0,
+                                        N, batchSize);
+  EXPECT_EQ(status, HCBLAS_SUCCEEDS);
+  cblas_sscal(N * batchSize, alpha, Xcblas, 1);
+  for (int i = 0; i < N * batchSize; i++) EXPECT_EQ(X[i], Xcblas[i]);
+  free(X);
+  free(Xcblas);
+}
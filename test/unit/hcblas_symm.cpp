@@ -0,0 +1,221 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblaslib.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <hc_am.hpp>
+#include <hc_short_vector.hpp>
+#include <vector>
+
+unsigned int global_seed = 100;
+
+// C = alpha * A * B + beta * C for both sides and triangles in both orders
+// through hcblas_ssymm or hcblas_dsymm, with the unstored triangle of A
+// filled with garbage that must not be read. M and N span several tiles.
+template <typename T, typename Symm, typename Ref>
+void check_symm_real(Symm symm, Ref ref, double tol) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  int M = 150, N = 90;
+  hcblasOrder orders[] = {ColMajor, RowMajor};
+  hcblasSide sides[] = {Left, Right};
+  hcblasUplo uplos[] = {Lower, Upper};
+  for (int o = 0; o < 2; o++)
+    for (int s = 0; s < 2; s++)
+      for (int u = 0; u < 2; u++) {
+        const bool colMajor = orders[o] == ColMajor;
+        const int ka = sides[s] == Left ? M : N;
+        const int lda = ka + 1;
+        // Leading dimension of B and C as stored in the given order
+        const int ld = (colMajor ? M : N) + 2;
+        std::vector<T> A(lda * ka), B(ld * (colMajor ? N : M)), C(B.size());
+        for (int i = 0; i < ka; i++) {
+          for (int j = 0; j < ka; j++) {
+            // Row major storage swaps which triangle is lower in memory
+            const bool stored = (uplos[u] == Lower) == colMajor ? i >= j
+                                                                : i <= j;
+            A[i + j * lda] = stored ? (rand_r(&global_seed) % 100) / 50.0 - 1
+                                    : 1e6;
+          }
+        }
+        for (size_t i = 0; i < B.size(); i++) {
+          B[i] = (rand_r(&global_seed) % 100) / 50.0 - 1;
+          C[i] = rand_r(&global_seed) % 10;
+        }
+        std::vector<T> C_cblas = C;
+        T *devA = hc::am_alloc(sizeof(T) * A.size(), accl, 0);
+        T *devB = hc::am_alloc(sizeof(T) * B.size(), accl, 0);
+        T *devC = hc::am_alloc(sizeof(T) * C.size(), accl, 0);
+        av.copy(A.data(), devA, sizeof(T) * A.size());
+        av.copy(B.data(), devB, sizeof(T) * B.size());
+        av.copy(C.data(), devC, sizeof(T) * C.size());
+        EXPECT_EQ(symm(av, orders[o], sides[s], uplos[u], M, N, devA, lda,
+                       devB, ld, devC, ld),
+                  HCBLAS_SUCCEEDS);
+        av.copy(devC, C.data(), sizeof(T) * C.size());
+        ref(colMajor ? CblasColMajor : CblasRowMajor,
+            sides[s] == Left ? CblasLeft : CblasRight,
+            uplos[u] == Lower ? CblasLower : CblasUpper, M, N, A.data(), lda,
+            B.data(), ld, C_cblas.data(), ld);
+        for (size_t i = 0; i < C.size(); i++) {
+          EXPECT_NEAR(C[i], C_cblas[i], tol * (1 + std::fabs(C_cblas[i])));
+        }
+        hc::am_free(devA);
+        hc::am_free(devB);
+        hc::am_free(devC);
+      }
+}
+
+TEST(hcblas_symm, func_correct_ssymm) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  check_symm_real<float>(
+      [&](hc::accelerator_view v, hcblasOrder order, hcblasSide side,
+          hcblasUplo uplo, int M, int N, float *A, int lda, float *B, int ldb,
+          float *C, int ldc) {
+        return hc.hcblas_ssymm(v, order, side, uplo, M, N, 1.5f, A, 0, lda, B,
+                               0, ldb, -0.5f, C, 0, ldc);
+      },
+      [](CBLAS_ORDER order, CBLAS_SIDE side, CBLAS_UPLO uplo, int M, int N,
+         const float *A, int lda, const float *B, int ldb, float *C, int ldc) {
+        cblas_ssymm(order, side, uplo, M, N, 1.5f, A, lda, B, ldb, -0.5f, C,
+                    ldc);
+      },
+      1e-4);
+}
+
+TEST(hcblas_symm, func_correct_dsymm) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  check_symm_real<double>(
+      [&](hc::accelerator_view v, hcblasOrder order, hcblasSide side,
+          hcblasUplo uplo, int M, int N, double *A, int lda, double *B,
+          int ldb, double *C, int ldc) {
+        return hc.hcblas_dsymm(v, order, side, uplo, M, N, 1.5, A, 0, lda, B,
+                               0, ldb, -0.5, C, 0, ldc);
+      },
+      [](CBLAS_ORDER order, CBLAS_SIDE side, CBLAS_UPLO uplo, int M, int N,
+         const double *A, int lda, const double *B, int ldb, double *C,
+         int ldc) {
+        cblas_dsymm(order, side, uplo, M, N, 1.5, A, lda, B, ldb, -0.5, C, ldc);
+      },
+      1e-10);
+}
+
+TEST(hcblas_symm, func_correct_zhemm) {
+  // Mirrored tiles of A are conjugated and its diagonal read as real
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  typedef hc::short_vector::double_2 Z;
+  int M = 100, N = 70;
+  const Z alpha(0.75, -0.5), beta(2.0, 1.0);
+  hcblasSide sides[] = {Left, Right};
+  hcblasUplo uplos[] = {Lower, Upper};
+  for (int s = 0; s < 2; s++)
+    for (int u = 0; u < 2; u++) {
+      const int ka = sides[s] == Left ? M : N;
+      std::vector<Z> A(ka * ka), B(M * N), C(M * N);
+      for (size_t i = 0; i < A.size(); i++) {
+        A[i].x = (rand_r(&global_seed) % 100) / 50.0 - 1;
+        A[i].y = (rand_r(&global_seed) % 100) / 50.0 - 1;
+      }
+      for (size_t i = 0; i < B.size(); i++) {
+        B[i].x = (rand_r(&global_seed) % 100) / 50.0 - 1;
+        B[i].y = (rand_r(&global_seed) % 100) / 50.0 - 1;
+        C[i].x = rand_r(&global_seed) % 10;
+        C[i].y = rand_r(&global_seed) % 10;
+      }
+      std::vector<Z> C_cblas = C;
+      Z *devA = hc::am_alloc(sizeof(Z) * A.size(), accl, 0);
+      Z *devB = hc::am_alloc(sizeof(Z) * B.size(), accl, 0);
+      Z *devC = hc::am_alloc(sizeof(Z) * C.size(), accl, 0);
+      av.copy(A.data(), devA, sizeof(Z) * A.size());
+      av.copy(B.data(), devB, sizeof(Z) * B.size());
+      av.copy(C.data(), devC, sizeof(Z) * C.size());
+      EXPECT_EQ(hc.hcblas_zhemm(av, ColMajor, sides[s], uplos[u], M, N, alpha,
+                                devA, 0, ka, devB, 0, M, beta, devC, 0, M),
+                HCBLAS_SUCCEEDS);
+      av.copy(devC, C.data(), sizeof(Z) * C.size());
+      cblas_zhemm(CblasColMajor, sides[s] == Left ? CblasLeft : CblasRight,
+                  uplos[u] == Lower ? CblasLower : CblasUpper, M, N, &alpha,
+                  A.data(), ka, B.data(), M, &beta, C_cblas.data(), M);
+      for (size_t i = 0; i < C.size(); i++) {
+        EXPECT_NEAR(C[i].x, C_cblas[i].x,
+                    1e-10 * (1 + std::fabs(C_cblas[i].x)));
+        EXPECT_NEAR(C[i].y, C_cblas[i].y,
+                    1e-10 * (1 + std::fabs(C_cblas[i].y)));
+      }
+      hc::am_free(devA);
+      hc::am_free(devB);
+      hc::am_free(devC);
+    }
+}
+
+TEST(hcblas_symm, func_correct_ssymm_batched) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 48, N = 80, batchSize = 16;
+  std::vector<std::vector<float>> A(batchSize), B(batchSize), C(batchSize),
+      C_cblas;
+  float *devA[16], *devB[16], *devC[16];
+  for (int b = 0; b < batchSize; b++) {
+    A[b].resize(N * N);
+    B[b].resize(M * N);
+    C[b].resize(M * N);
+    for (int i = 0; i < N * N; i++) {
+      A[b][i] = (rand_r(&global_seed) % 100) / 50.0 - 1;
+    }
+    for (int i = 0; i < M * N; i++) {
+      B[b][i] = (rand_r(&global_seed) % 100) / 50.0 - 1;
+      C[b][i] = rand_r(&global_seed) % 10;
+    }
+    devA[b] = hc::am_alloc(sizeof(float) * N * N, accl, 0);
+    devB[b] = hc::am_alloc(sizeof(float) * M * N, accl, 0);
+    devC[b] = hc::am_alloc(sizeof(float) * M * N, accl, 0);
+    av.copy(A[b].data(), devA[b], sizeof(float) * N * N);
+    av.copy(B[b].data(), devB[b], sizeof(float) * M * N);
+    av.copy(C[b].data(), devC[b], sizeof(float) * M * N);
+  }
+  C_cblas = C;
+  EXPECT_EQ(hc.hcblas_ssymm(av, ColMajor, Right, Upper, M, N, 1.0f, devA, 0, 0,
+                            N, devB, 0, 0, M, 1.0f, devC, 0, 0, M, batchSize),
+            HCBLAS_SUCCEEDS);
+  for (int b = 0; b < batchSize; b++) {
+    av.copy(devC[b], C[b].data(), sizeof(float) * M * N);
+    cblas_ssymm(CblasColMajor, CblasRight, CblasUpper, M, N, 1.0f, A[b].data(),
+                N, B[b].data(), M, 1.0f, C_cblas[b].data(), M);
+    for (int i = 0; i < M * N; i++) {
+      EXPECT_NEAR(C[b][i], C_cblas[b][i],
+                  1e-4 * (1 + std::fabs(C_cblas[b][i])));
+    }
+    hc::am_free(devA[b]);
+    hc::am_free(devB[b]);
+    hc::am_free(devC[b]);
+  }
+}
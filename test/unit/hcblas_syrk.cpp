@@ -0,0 +1,203 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblaslib.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <hc_am.hpp>
+#include <hc_short_vector.hpp>
+#include <vector>
+
+unsigned int global_seed = 100;
+
+// Updates C with every triangle and op in both orders through hcblas_ssyrk
+// or hcblas_dsyrk and compares all of C, the untouched triangle included,
+// with the reference BLAS. N spans several diagonal blocks so the GEMM
+// split is exercised.
+template <typename T, typename Syrk, typename Ref>
+void check_syrk_real(Syrk syrk, Ref ref, double tol) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  int N = 200, K = 90;
+  hcblasOrder orders[] = {ColMajor, RowMajor};
+  hcblasUplo uplos[] = {Lower, Upper};
+  hcblasTranspose ops[] = {NoTrans, Trans};
+  for (int o = 0; o < 2; o++)
+    for (int u = 0; u < 2; u++)
+      for (int t = 0; t < 2; t++) {
+        const bool colMajor = orders[o] == ColMajor;
+        // Rows and columns of A as stored in the given order
+        const int rows = (ops[t] == NoTrans) == colMajor ? N : K;
+        const int cols = rows == N ? K : N;
+        const int lda = rows + 1;
+        const int ldc = N + 2;
+        std::vector<T> A(lda * cols), C(ldc * N), C_cblas;
+        for (size_t i = 0; i < A.size(); i++) {
+          A[i] = (rand_r(&global_seed) % 100) / 50.0 - 1;
+        }
+        for (size_t i = 0; i < C.size(); i++) {
+          C[i] = rand_r(&global_seed) % 10;
+        }
+        C_cblas = C;
+        T *devA = hc::am_alloc(sizeof(T) * A.size(), accl, 0);
+        T *devC = hc::am_alloc(sizeof(T) * C.size(), accl, 0);
+        av.copy(A.data(), devA, sizeof(T) * A.size());
+        av.copy(C.data(), devC, sizeof(T) * C.size());
+        EXPECT_EQ(syrk(av, orders[o], uplos[u], ops[t], N, K, devA, lda, devC,
+                       ldc),
+                  HCBLAS_SUCCEEDS);
+        av.copy(devC, C.data(), sizeof(T) * C.size());
+        ref(colMajor ? CblasColMajor : CblasRowMajor,
+            uplos[u] == Lower ? CblasLower : CblasUpper,
+            ops[t] == NoTrans ? CblasNoTrans : CblasTrans, N, K, A.data(), lda,
+            C_cblas.data(), ldc);
+        for (size_t i = 0; i < C.size(); i++) {
+          EXPECT_NEAR(C[i], C_cblas[i], tol * (1 + std::fabs(C_cblas[i])));
+        }
+        hc::am_free(devA);
+        hc::am_free(devC);
+      }
+}
+
+TEST(hcblas_syrk, func_correct_ssyrk) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  check_syrk_real<float>(
+      [&](hc::accelerator_view v, hcblasOrder order, hcblasUplo uplo,
+          hcblasTranspose op, int N, int K, float *A, int lda, float *C,
+          int ldc) {
+        return hc.hcblas_ssyrk(v, order, uplo, op, N, K, 1.5f, A, 0, lda,
+                               -0.5f, C, 0, ldc);
+      },
+      [](CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE op, int N, int K,
+         const float *A, int lda, float *C, int ldc) {
+        cblas_ssyrk(order, uplo, op, N, K, 1.5f, A, lda, -0.5f, C, ldc);
+      },
+      1e-4);
+}
+
+TEST(hcblas_syrk, func_correct_dsyrk) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  check_syrk_real<double>(
+      [&](hc::accelerator_view v, hcblasOrder order, hcblasUplo uplo,
+          hcblasTranspose op, int N, int K, double *A, int lda, double *C,
+          int ldc) {
+        return hc.hcblas_dsyrk(v, order, uplo, op, N, K, 1.5, A, 0, lda, -0.5,
+                               C, 0, ldc);
+      },
+      [](CBLAS_ORDER order, CBLAS_UPLO uplo, CBLAS_TRANSPOSE op, int N, int K,
+         const double *A, int lda, double *C, int ldc) {
+        cblas_dsyrk(order, uplo, op, N, K, 1.5, A, lda, -0.5, C, ldc);
+      },
+      1e-10);
+}
+
+TEST(hcblas_syrk, func_correct_zherk) {
+  // Off-diagonal blocks read A^H through a conjugated copy; the diagonal of
+  // C comes out real
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  typedef hc::short_vector::double_2 Z;
+  // K = 2000 takes two K panels of the copy
+  const int N = 150, Ks[] = {40, 2000};
+  hcblasTranspose ops[] = {NoTrans, ConjTrans};
+  hcblasUplo uplos[] = {Lower, Upper};
+  for (int k = 0; k < 2; k++)
+    for (int t = 0; t < 2; t++)
+      for (int u = 0; u < 2; u++) {
+        const int K = Ks[k];
+        const int lda = ops[t] == NoTrans ? N : K;
+        std::vector<Z> A(lda * (ops[t] == NoTrans ? K : N)), C(N * N);
+        for (size_t i = 0; i < A.size(); i++) {
+          A[i].x = (rand_r(&global_seed) % 100) / 50.0 - 1;
+          A[i].y = (rand_r(&global_seed) % 100) / 50.0 - 1;
+        }
+        for (size_t i = 0; i < C.size(); i++) {
+          C[i].x = rand_r(&global_seed) % 10;
+          C[i].y = rand_r(&global_seed) % 10;
+        }
+        std::vector<Z> C_cblas = C;
+        Z *devA = hc::am_alloc(sizeof(Z) * A.size(), accl, 0);
+        Z *devC = hc::am_alloc(sizeof(Z) * C.size(), accl, 0);
+        av.copy(A.data(), devA, sizeof(Z) * A.size());
+        av.copy(C.data(), devC, sizeof(Z) * C.size());
+        EXPECT_EQ(hc.hcblas_zherk(av, ColMajor, uplos[u], ops[t], N, K, 0.75,
+                                  devA, 0, lda, 2.0, devC, 0, N),
+                  HCBLAS_SUCCEEDS);
+        av.copy(devC, C.data(), sizeof(Z) * C.size());
+        cblas_zherk(CblasColMajor, uplos[u] == Lower ? CblasLower : CblasUpper,
+                    ops[t] == NoTrans ? CblasNoTrans : CblasConjTrans, N, K,
+                    0.75, A.data(), lda, 2.0, C_cblas.data(), N);
+        for (size_t i = 0; i < C.size(); i++) {
+          EXPECT_NEAR(C[i].x, C_cblas[i].x,
+                      1e-10 * (1 + std::fabs(C_cblas[i].x)));
+          EXPECT_NEAR(C[i].y, C_cblas[i].y,
+                      1e-10 * (1 + std::fabs(C_cblas[i].y)));
+        }
+        for (int i = 0; i < N; i++) EXPECT_EQ(C[i + i * N].y, 0.0);
+        hc::am_free(devA);
+        hc::am_free(devC);
+      }
+}
+
+TEST(hcblas_syrk, func_correct_ssyrk_batched) {
+  // Gram matrices of many small blocks
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int N = 96, K = 20, batchSize = 16;
+  std::vector<std::vector<float>> A(batchSize), C(batchSize), C_cblas;
+  float *devA[16], *devC[16];
+  for (int b = 0; b < batchSize; b++) {
+    A[b].resize(N * K);
+    C[b].resize(N * N);
+    for (int i = 0; i < N * K; i++) {
+      A[b][i] = (rand_r(&global_seed) % 100) / 50.0 - 1;
+    }
+    for (int i = 0; i < N * N; i++) C[b][i] = rand_r(&global_seed) % 10;
+    devA[b] = hc::am_alloc(sizeof(float) * N * K, accl, 0);
+    devC[b] = hc::am_alloc(sizeof(float) * N * N, accl, 0);
+    av.copy(A[b].data(), devA[b], sizeof(float) * N * K);
+    av.copy(C[b].data(), devC[b], sizeof(float) * N * N);
+  }
+  C_cblas = C;
+  EXPECT_EQ(hc.hcblas_ssyrk(av, ColMajor, Upper, NoTrans, N, K, 1.0f, devA, 0,
+                            0, N, 1.0f, devC, 0, 0, N, batchSize),
+            HCBLAS_SUCCEEDS);
+  for (int b = 0; b < batchSize; b++) {
+    av.copy(devC[b], C[b].data(), sizeof(float) * N * N);
+    cblas_ssyrk(CblasColMajor, CblasUpper, CblasNoTrans, N, K, 1.0f,
+                A[b].data(), N, 1.0f, C_cblas[b].data(), N);
+    for (int i = 0; i < N * N; i++) {
+      EXPECT_NEAR(C[b][i], C_cblas[b][i],
+                  1e-4 * (1 + std::fabs(C_cblas[b][i])));
+    }
+    hc::am_free(devA[b]);
+    hc::am_free(devC[b]);
+  }
+}
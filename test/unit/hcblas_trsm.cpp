@@ -0,0 +1,210 @@
+/*
+Copyright (c) 2015-2016 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "include/hcblaslib.h"
+#include "gtest/gtest.h"
+#include <cblas.h>
+#include <cmath>
+#include <cstdlib>
+#include <hc_am.hpp>
+#include <hc_short_vector.hpp>
+#include <vector>
+
+unsigned int global_seed = 100;
+
+// A is n x n with a dominant diagonal so every system is well conditioned;
+// with a unit diagonal the off-diagonal entries are kept small instead
+template <typename T>
+void fill_triangular(std::vector<T> *A, int n, int lda, bool unit) {
+  for (size_t i = 0; i < A->size(); i++) {
+    (*A)[i] = (rand_r(&global_seed) % 100) / (unit ? 100.0 * n : 100.0);
+  }
+  for (int i = 0; i < n; i++) (*A)[i + i * lda] += n;
+}
+
+static CBLAS_TRANSPOSE cblas_op(hcblasTranspose t) {
+  return t == NoTrans ? CblasNoTrans : t == Trans ? CblasTrans : CblasConjTrans;
+}
+
+// Solves with every side, triangle, op and diagonal in both orders through
+// hcblas_strsm or hcblas_dtrsm and compares with the reference BLAS
+template <typename T, typename Solve, typename Ref>
+void check_trsm_real(Solve solve, Ref ref, double tol) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  int M = 150, N = 70;
+  hcblasOrder orders[] = {ColMajor, RowMajor};
+  hcblasSide sides[] = {Left, Right};
+  hcblasUplo uplos[] = {Lower, Upper};
+  hcblasTranspose ops[] = {NoTrans, Trans};
+  hcblasDiag diags[] = {NonUnit, Unit};
+  for (int o = 0; o < 2; o++)
+    for (int s = 0; s < 2; s++)
+      for (int u = 0; u < 2; u++)
+        for (int t = 0; t < 2; t++)
+          for (int d = 0; d < 2; d++) {
+            const int n = sides[s] == Left ? M : N;
+            const int lda = n + 1;
+            const int ldb = (orders[o] == ColMajor ? M : N) + 2;
+            const int bCols = orders[o] == ColMajor ? N : M;
+            std::vector<T> A(lda * n), B(ldb * bCols), B_cblas;
+            fill_triangular(&A, n, lda, diags[d] == Unit);
+            for (size_t i = 0; i < B.size(); i++) {
+              B[i] = rand_r(&global_seed) % 10;
+            }
+            B_cblas = B;
+            T *devA = hc::am_alloc(sizeof(T) * A.size(), accl, 0);
+            T *devB = hc::am_alloc(sizeof(T) * B.size(), accl, 0);
+            av.copy(A.data(), devA, sizeof(T) * A.size());
+            av.copy(B.data(), devB, sizeof(T) * B.size());
+            EXPECT_EQ(solve(av, orders[o], sides[s], uplos[u], ops[t],
+                            diags[d], M, N, devA, lda, devB, ldb),
+                      HCBLAS_SUCCEEDS);
+            av.copy(devB, B.data(), sizeof(T) * B.size());
+            ref(orders[o] == ColMajor ? CblasColMajor : CblasRowMajor,
+                sides[s] == Left ? CblasLeft : CblasRight,
+                uplos[u] == Lower ? CblasLower : CblasUpper,
+                cblas_op(ops[t]),
+                diags[d] == Unit ? CblasUnit : CblasNonUnit, M, N,
+                A.data(), lda, B_cblas.data(), ldb);
+            for (size_t i = 0; i < B.size(); i++) {
+              EXPECT_NEAR(B[i], B_cblas[i], tol * (1 + std::fabs(B_cblas[i])));
+            }
+            hc::am_free(devA);
+            hc::am_free(devB);
+          }
+}
+
+TEST(hcblas_trsm, func_correct_strsm) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  check_trsm_real<float>(
+      [&](hc::accelerator_view v, hcblasOrder order, hcblasSide side,
+          hcblasUplo uplo, hcblasTranspose op, hcblasDiag diag, int M, int N,
+          float *A, int lda, float *B, int ldb) {
+        return hc.hcblas_strsm(v, order, side, uplo, op, diag, M, N, 2.0f, A,
+                               0, lda, B, 0, ldb);
+      },
+      [](CBLAS_ORDER order, CBLAS_SIDE side, CBLAS_UPLO uplo,
+         CBLAS_TRANSPOSE op, CBLAS_DIAG diag, int M, int N, const float *A,
+         int lda, float *B, int ldb) {
+        cblas_strsm(order, side, uplo, op, diag, M, N, 2.0f, A, lda, B, ldb);
+      },
+      1e-4);
+}
+
+TEST(hcblas_trsm, func_correct_dtrsm) {
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  check_trsm_real<double>(
+      [&](hc::accelerator_view v, hcblasOrder order, hcblasSide side,
+          hcblasUplo uplo, hcblasTranspose op, hcblasDiag diag, int M, int N,
+          double *A, int lda, double *B, int ldb) {
+        return hc.hcblas_dtrsm(v, order, side, uplo, op, diag, M, N, 2.0, A, 0,
+                               lda, B, 0, ldb);
+      },
+      [](CBLAS_ORDER order, CBLAS_SIDE side, CBLAS_UPLO uplo,
+         CBLAS_TRANSPOSE op, CBLAS_DIAG diag, int M, int N, const double *A,
+         int lda, double *B, int ldb) {
+        cblas_dtrsm(order, side, uplo, op, diag, M, N, 2.0, A, lda, B, ldb);
+      },
+      1e-10);
+}
+
+TEST(hcblas_trsm, func_correct_ztrsm_conj_trans) {
+  // A^H is solved as a transposed system on conj(B)
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  typedef hc::short_vector::double_2 Z;
+  int M = 100, N = 45;
+  hcblasSide sides[] = {Left, Right};
+  for (int s = 0; s < 2; s++) {
+    const int n = sides[s] == Left ? M : N;
+    std::vector<Z> A(n * n), B(M * N);
+    for (size_t i = 0; i < A.size(); i++) {
+      A[i].x = (rand_r(&global_seed) % 100) / 100.0;
+      A[i].y = (rand_r(&global_seed) % 100) / 100.0;
+    }
+    for (int i = 0; i < n; i++) A[i + i * n].x += n;
+    for (size_t i = 0; i < B.size(); i++) {
+      B[i].x = rand_r(&global_seed) % 10;
+      B[i].y = rand_r(&global_seed) % 10;
+    }
+    std::vector<Z> B_cblas = B;
+    Z alpha(1.0, -0.5);
+    Z *devA = hc::am_alloc(sizeof(Z) * A.size(), accl, 0);
+    Z *devB = hc::am_alloc(sizeof(Z) * B.size(), accl, 0);
+    av.copy(A.data(), devA, sizeof(Z) * A.size());
+    av.copy(B.data(), devB, sizeof(Z) * B.size());
+    EXPECT_EQ(hc.hcblas_ztrsm(av, ColMajor, sides[s], Upper, ConjTrans,
+                              NonUnit, M, N, alpha, devA, 0, n, devB, 0, M),
+              HCBLAS_SUCCEEDS);
+    av.copy(devB, B.data(), sizeof(Z) * B.size());
+    cblas_ztrsm(CblasColMajor, sides[s] == Left ? CblasLeft : CblasRight,
+                CblasUpper, CblasConjTrans, CblasNonUnit, M, N, &alpha,
+                A.data(), n, B_cblas.data(), M);
+    for (size_t i = 0; i < B.size(); i++) {
+      EXPECT_NEAR(B[i].x, B_cblas[i].x, 1e-10 * (1 + std::fabs(B_cblas[i].x)));
+      EXPECT_NEAR(B[i].y, B_cblas[i].y, 1e-10 * (1 + std::fabs(B_cblas[i].y)));
+    }
+    hc::am_free(devA);
+    hc::am_free(devB);
+  }
+}
+
+TEST(hcblas_trsm, func_correct_dtrsm_batched) {
+  // Many small systems, each solved by one launch over the batch
+  hc::accelerator accl;
+  hc::accelerator_view av = accl.get_default_view();
+  Hcblaslibrary hc(&av);
+  int M = 24, N = 10, batchSize = 64;
+  std::vector<std::vector<double>> A(batchSize), B(batchSize), B_cblas;
+  double *devA[64], *devB[64];
+  for (int b = 0; b < batchSize; b++) {
+    A[b].resize(M * M);
+    B[b].resize(M * N);
+    fill_triangular(&A[b], M, M, false);
+    for (int i = 0; i < M * N; i++) B[b][i] = rand_r(&global_seed) % 10;
+    devA[b] = hc::am_alloc(sizeof(double) * M * M, accl, 0);
+    devB[b] = hc::am_alloc(sizeof(double) * M * N, accl, 0);
+    av.copy(A[b].data(), devA[b], sizeof(double) * M * M);
+    av.copy(B[b].data(), devB[b], sizeof(double) * M * N);
+  }
+  B_cblas = B;
+  EXPECT_EQ(hc.hcblas_dtrsm(av, ColMajor, Left, Lower, Trans, NonUnit, M, N,
+                            0.5, devA, 0, 0, M, devB, 0, 0, M, batchSize),
+            HCBLAS_SUCCEEDS);
+  for (int b = 0; b < batchSize; b++) {
+    av.copy(devB[b], B[b].data(), sizeof(double) * M * N);
+    cblas_dtrsm(CblasColMajor, CblasLeft, CblasLower, CblasTrans,
+                CblasNonUnit, M, N, 0.5, A[b].data(), M, B_cblas[b].data(),
+                M);
+    for (int i = 0; i < M * N; i++) {
+      EXPECT_NEAR(B[b][i], B_cblas[b][i], 1e-10 * (1 + std::fabs(B[b][i])));
+    }
+    hc::am_free(devA[b]);
+    hc::am_free(devB[b]);
+  }
+}